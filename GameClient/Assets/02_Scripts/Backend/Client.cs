@@ -14,6 +14,9 @@ public static unsafe class Client
 
         try
         {
+            // 로그인하면 받는 토큰으로 UDP 주소를 TCP 세션에 묶는다. 묶이면 이동/위치 패킷은 UDP로 주고받는다.
+            TCP.OnUdpToken += UDP.BindUdp;
+
             Debug.Log($"[Client] TCP 연결 시도... {IP}:5004");
             TCP.Start();
             Debug.Log("[Client] TCP 연결 성공!");
@@ -0,0 +1,100 @@
+﻿using System;
+
+// 서버가 PACKET_HEADER.type의 압축 비트를 켜고 보낸 패킷을 푼다. (서버의 fastlz와 같은 형식)
+// 압축 패킷 : [헤더(압축 후 길이, id, type | COMPRESSED)][ushort 원래 패킷 길이][헤더를 뺀 본문을 fastlz로 압축한 데이터]
+public static class FastLz
+{
+    public const byte PACKET_TYPE_COMPRESSED = 0x01;
+
+    // 반환 : 푼 바이트 수. 잘못된 데이터이거나 maxOut을 넘으면 0
+    public static int Decompress(byte[] input, int offset, int length, byte[] output, int maxOut)
+    {
+        if (length <= 0) return 0;
+
+        int level = (input[offset] >> 5) + 1;
+        if (level != 1 && level != 2) return 0;
+
+        int ip = offset;
+        int ipLimit = offset + length;
+        int op = 0;
+        int ctrl = input[ip++] & 31;
+        bool loop = true;
+
+        try
+        {
+            do
+            {
+                int len = ctrl >> 5;
+                int ofs = (ctrl & 31) << 8;
+
+                if (ctrl >= 32)
+                {
+                    // 이미 푼 데이터에서 복사
+                    int refPos = op - ofs;
+                    len--;
+
+                    if (level == 1)
+                    {
+                        if (len == 7 - 1) len += input[ip++];
+                        refPos -= input[ip++];
+                    }
+                    else
+                    {
+                        int code;
+                        if (len == 7 - 1)
+                        {
+                            do
+                            {
+                                code = input[ip++];
+                                len += code;
+                            } while (code == 255);
+                        }
+                        code = input[ip++];
+                        refPos -= code;
+
+                        // 16비트 거리
+                        if (code == 255 && ofs == (31 << 8))
+                        {
+                            ofs = input[ip++] << 8;
+                            ofs += input[ip++];
+                            refPos = op - ofs - 8191;
+                        }
+                    }
+
+                    if (op + len + 3 > maxOut) return 0;
+                    if (refPos - 1 < 0) return 0;
+
+                    if (ip < ipLimit) ctrl = input[ip++];
+                    else loop = false;
+
+                    // 겹치는 구간(같은 바이트 반복)도 있으므로 한 바이트씩 앞에서부터 복사한다.
+                    refPos--;
+                    for (int i = 0; i < len + 3; i++)
+                    {
+                        output[op++] = output[refPos++];
+                    }
+                }
+                else
+                {
+                    // 리터럴
+                    ctrl++;
+                    if (op + ctrl > maxOut) return 0;
+                    if (ip + ctrl > ipLimit) return 0;
+
+                    Buffer.BlockCopy(input, ip, output, op, ctrl);
+                    ip += ctrl;
+                    op += ctrl;
+
+                    loop = ip < ipLimit;
+                    if (loop) ctrl = input[ip++];
+                }
+            } while (loop);
+        }
+        catch (IndexOutOfRangeException)
+        {
+            return 0;
+        }
+
+        return op;
+    }
+}
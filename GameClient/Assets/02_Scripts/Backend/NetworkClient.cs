@@ -31,6 +31,15 @@ public unsafe class NetworkClient
 
     public event Action OnDisconnect;
 
+    // TCP: 로그인 후 서버가 UDP 토큰을 보내면 호출된다. (읽기 스레드에서 호출)
+    public event Action<ulong> OnUdpToken;
+
+    // UDP: 서버가 이 소켓의 주소를 TCP 세션에 묶었으면 true. 그 전에는 이동 패킷을 TCP로 보낸다.
+    private const int UDP_BIND_RETRY_MS = 200;
+    private const int UDP_BIND_MAX_RETRY = 25;
+    private volatile bool udpBound;
+    public bool IsUdpBound => udpBound;
+
     public NetworkClient(string ip, int port, ProtocolType protocol)
     {
         endPoint = new IPEndPoint(IPAddress.Parse(ip), port);
@@ -90,11 +99,17 @@ public unsafe class NetworkClient
                 Packet packet = default;
                 packet.pbase = pb;
                 packet.data = UnsafeCode.SubArray(clientBuffer, headerSize, pb.length - headerSize);
+                if (!DecompressPacket(ref packet)) continue;
+
+                if (pb.packet_id == (ushort)E_PACKET.UDP_BIND_RESPONSE)
+                {
+                    var res = UnsafeCode.ByteArrayToStructure<P_UdpBindResponse>(packet.data);
+                    udpBound = (res.Result == 0);
+                    continue;
+                }
 
                 synchronizationContext.Post(_ => HandlePacket(packet), null);
             }
-
-            Thread.Sleep(50);
         }
 
         Close();
@@ -143,7 +158,25 @@ public unsafe class NetworkClient
                     if (offset < packet.pbase.length) continue;
 
                     packet.data = UnsafeCode.SubArray(clientBuffer, headerSize, packet.pbase.length - headerSize);
-                    synchronizationContext.Post(_ => HandlePacket(packet), null);
+
+                    if (!DecompressPacket(ref packet))
+                    {
+                        Debug.LogWarning($"[NetworkClient] 잘못된 압축 패킷을 버림 id={packet.pbase.packet_id}");
+                    }
+                    // 서버 하트비트는 메인 스레드를 거치지 않고 바로 돌려줘야 RTT가 프레임에 묶이지 않는다.
+                    else if (packet.pbase.packet_id == (ushort)E_PACKET.HEARTBEAT_PING)
+                    {
+                        SendData(E_PACKET.HEARTBEAT_PONG, packet.data);
+                    }
+                    else if (packet.pbase.packet_id == (ushort)E_PACKET.UDP_TOKEN_NOTIFY)
+                    {
+                        var notify = UnsafeCode.ByteArrayToStructure<P_UdpTokenNotify>(packet.data);
+                        OnUdpToken?.Invoke(notify.Token);
+                    }
+                    else
+                    {
+                        synchronizationContext.Post(_ => HandlePacket(packet), null);
+                    }
 
                     clientBuffer = null;
                     offset = 0;
@@ -157,6 +190,26 @@ public unsafe class NetworkClient
         OnDisconnect?.Invoke();
     }
 
+    // 서버는 큰 패킷을 압축해서 보낸다. 압축 패킷이면 본문을 풀어 원래 패킷으로 바꾼다.
+    // 반환 : 잘못된 압축 데이터면 false
+    private static bool DecompressPacket(ref Packet packet)
+    {
+        if ((packet.pbase.type & FastLz.PACKET_TYPE_COMPRESSED) == 0) return true;
+
+        int headerSize = Marshal.SizeOf<PacketBase>();
+        if (packet.data.Length <= sizeof(ushort)) return false;
+
+        int originalLength = BitConverter.ToUInt16(packet.data, 0);
+        if (originalLength <= headerSize) return false;
+
+        byte[] body = new byte[originalLength - headerSize];
+        if (FastLz.Decompress(packet.data, sizeof(ushort), packet.data.Length - sizeof(ushort), body, body.Length) != body.Length) return false;
+
+        packet.pbase.length = (ushort)originalLength;
+        packet.pbase.type = (byte)(packet.pbase.type & ~FastLz.PACKET_TYPE_COMPRESSED);
+        packet.data = body;
+        return true;
+    }
 
     public void HandlePacket(Packet packet)
     {
@@ -238,6 +291,24 @@ public unsafe class NetworkClient
         SendData(packetId, data);
     }
 
+    // UDP 묶기 요청은 잃을 수 있으므로 응답을 받을 때까지 다시 보낸다.
+    public void BindUdp(ulong token)
+    {
+        udpBound = false;
+
+        new Thread(() =>
+        {
+            P_UdpBindRequest req = new P_UdpBindRequest { Token = token, IsReliable = 0 }; // 클라이언트는 아직 신뢰성 UDP 헤더를 처리하지 않는다.
+            for (int i = 0; i < UDP_BIND_MAX_RETRY && socket != null && !udpBound; i++)
+            {
+                SendPacket(E_PACKET.UDP_BIND_REQUEST, req);
+                Thread.Sleep(UDP_BIND_RETRY_MS);
+            }
+
+            Debug.Log($"[NetworkClient] UDP 묶기 {(udpBound ? "성공" : "실패 - TCP로 보낸다")}");
+        }).Start();
+    }
+
     public void AddPacketReceiver(IPacketReceiver item)
     {
         if (!packetReceivers.Contains(item))
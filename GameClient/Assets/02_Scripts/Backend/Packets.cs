@@ -1,42 +1,62 @@
-﻿using System.Runtime.InteropServices;
+// Generated from GameServer/GamePacket.pdl by packetgen. Do not edit by hand;
+// change GamePacket.pdl and build the packet_codegen target instead.
+using System.Runtime.InteropServices;
 using UnityEngine;
 
-public enum E_PACKET : ushort
+public enum ITEM_TYPE : ushort
 {
-    PLAYER_NAME = 201,                  // 서버: LOGIN_REQUEST
-    PLAYER_NAME_SUCCESS = 202,          // 서버: LOGIN_RESPONSE
-
-    PLAYER_JOINED = 208,                // 서버: ROOM_NEW_USER_NTF
-    CREATE_MATCH_PLAYER = 209,          // 서버: ROOM_USER_INFO_NTF
-
-    PLAYER_MOVEMENT = 218,              // 서버: PLAYER_MOVEMENT
-    UPDATE_PLAYER_MOVEMENT = 219,       // 서버: UPDATE_PLAYER_MOVEMENT
-
-    SEND_CHAT_MESSAGE = 221,            // 서버: ROOM_CHAT_REQUEST
-    RECEIVE_CHAT_MESSAGE = 223,         // 서버: ROOM_CHAT_NOTIFY
+    NONE = 0,
+    WEAPON = 1,
+    ARMOR = 2,
+    POTION = 3,
+    MATERIAL = 4,
+    QUEST = 5,
+}
 
-    PLAYER_LEFT = 217,                  // 서버: ROOM_LEAVE_USER_NTF
+public enum QUEST_STATE : byte
+{
+    NONE = 0,
+    IN_PROGRESS = 1,
+    COMPLETED = 2,
+}
 
-    // Inventory
+public enum E_PACKET : ushort
+{
+    PLAYER_NAME = 201, // LOGIN_REQUEST
+    PLAYER_NAME_SUCCESS = 202, // LOGIN_RESPONSE
+    HEARTBEAT_PING = 203,
+    HEARTBEAT_PONG = 204,
+    UDP_TOKEN_NOTIFY = 210,
+    UDP_BIND_REQUEST = 211,
+    UDP_BIND_RESPONSE = 212,
+    ROOM_ENTER_REQUEST = 206,
+    ROOM_ENTER_RESPONSE = 207,
+    PLAYER_JOINED = 208, // ROOM_NEW_USER_NTF
+    CREATE_MATCH_PLAYER = 209, // ROOM_USER_INFO_NTF
+    ROOM_LEAVE_REQUEST = 215,
+    ROOM_LEAVE_RESPONSE = 216,
+    PLAYER_LEFT = 217, // ROOM_LEAVE_USER_NTF
+    PLAYER_MOVEMENT = 218,
+    UPDATE_PLAYER_MOVEMENT = 219,
+    SEND_CHAT_MESSAGE = 221, // ROOM_CHAT_REQUEST
+    ROOM_CHAT_RESPONSE = 222,
+    RECEIVE_CHAT_MESSAGE = 223, // ROOM_CHAT_NOTIFY
+    MOVE_PATH_REQUEST = 225,
+    MOVE_PATH_RESPONSE = 226,
     INVENTORY_INFO_REQUEST = 301,
     INVENTORY_INFO_RESPONSE = 302,
     ITEM_ADD_REQUEST = 303,
     ITEM_ADD_RESPONSE = 304,
     ITEM_USE_REQUEST = 306,
     ITEM_USE_RESPONSE = 307,
-
-    // Combat
     PLAYER_ATTACK_REQUEST = 401,
     PLAYER_ATTACK_RESPONSE = 402,
     HIT_REPORT = 404,
-
-    // Enemy
     ENEMY_SPAWN_NOTIFY = 421,
     ENEMY_DESPAWN_NOTIFY = 422,
     ENEMY_PATROL_UPDATE = 423,
     ENEMY_DAMAGE_NOTIFY = 424,
     ENEMY_DEATH_NOTIFY = 425,
-
     QUEST_TALK_REQUEST = 501,
     QUEST_TALK_RESPONSE = 502,
     QUEST_ACCEPT_REQUEST = 503,
@@ -46,72 +66,117 @@ public enum E_PACKET : ushort
     QUEST_COMPLETE_RESPONSE = 507,
 }
 
-public enum ITEM_TYPE : ushort
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct Item // 40 bytes
 {
-    NONE = 0,
-    WEAPON = 1,
-    ARMOR = 2,
-    POTION = 3,
-    MATERIAL = 4,
-    QUEST = 5
+    public uint itemID;
+    public ITEM_TYPE itemType;
+    public ushort quantity;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 32)]
+    public string itemName;
 }
 
-public enum QUEST_STATE : byte
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerName // 201 LOGIN_REQUEST, 66 bytes
 {
-    NONE = 0,
-    IN_PROGRESS = 1,
-    COMPLETED = 2,
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
+    public string name;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
+    public string userPW;
 }
 
-[StructLayout(LayoutKind.Sequential, Size = 16)]
-struct P_PlayerName
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_LoginResponse // 202 LOGIN_RESPONSE, 2 bytes
 {
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 16)]
-    public string name;
+    public ushort Result;
 }
 
-[StructLayout(LayoutKind.Sequential, Size = 24)]
-struct P_PlayerNameSuccess
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_HeartbeatPing // 203 HEARTBEAT_PING, 8 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
-    public long assigned_id;
+    public ulong PingTimeMs;
+}
 
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 16)]
-    public string name;
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_HeartbeatPong // 204 HEARTBEAT_PONG, 8 bytes
+{
+    public ulong PingTimeMs;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_UdpTokenNotify // 210 UDP_TOKEN_NOTIFY, 10 bytes
+{
+    public ulong Token;
+    public ushort UdpPort;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_UdpBindRequest // 211 UDP_BIND_REQUEST, 9 bytes
+{
+    public ulong Token;
+    public byte IsReliable;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-struct P_LoginResponse
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_UdpBindResponse // 212 UDP_BIND_RESPONSE, 3 bytes
 {
     public ushort Result;
+    public byte IsReliable;
 }
 
 [StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
-struct P_PlayerJoined // 208
+public struct P_RoomEnterRequest // 206 ROOM_ENTER_REQUEST, 4 bytes
 {
-    public long id;
+    public int RoomNumber;
+}
 
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_RoomEnterResponse // 207 ROOM_ENTER_RESPONSE, 2 bytes
+{
+    public short Result;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerJoined // 208 ROOM_NEW_USER_NTF, 69 bytes
+{
+    public long id;
     [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
     public string name;
-
     public Vector3 position;
     public Quaternion rotation;
 }
 
 [StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
-struct P_CreateMatchPlayer // 209
+public struct P_CreateMatchPlayer // 209 ROOM_USER_INFO_NTF, 69 bytes
 {
     public long id;
-
     [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
     public string name;
-
     public Vector3 position;
     public Quaternion rotation;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-struct P_PlayerMovement // 218
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_RoomLeaveRequest // 215 ROOM_LEAVE_REQUEST, 0 bytes
+{
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_RoomLeaveResponse // 216 ROOM_LEAVE_RESPONSE, 2 bytes
+{
+    public short Result;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerLeft // 217 ROOM_LEAVE_USER_NTF, 41 bytes
+{
+    public long id;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
+    public string name;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerMovement // 218 PLAYER_MOVEMENT, 32 bytes
 {
     public long player_id;
     public float dx;
@@ -119,269 +184,223 @@ struct P_PlayerMovement // 218
     public Quaternion rotation;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-public struct P_UpdatePlayerMovement // 219
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_UpdatePlayerMovement // 219 UPDATE_PLAYER_MOVEMENT, 48 bytes
 {
     public long player_id;
+    public Vector3 motion;
     public Quaternion rotation;
-    public Vector3 motion; // 서버가 보내는 "이동량(delta)"
+    public Vector3 position;
 }
 
-[StructLayout(LayoutKind.Sequential, Size = 64)]
-struct P_SendChatMessage
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_SendChatMessage // 221 ROOM_CHAT_REQUEST, 257 bytes
 {
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 64)]
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 257)]
     public string message;
 }
 
-[StructLayout(LayoutKind.Sequential, Size = 80)]
-struct P_ReceiveChatMessage
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_RoomChatResponse // 222 ROOM_CHAT_RESPONSE, 2 bytes
 {
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 16)]
-    public string sender;
+    public short Result;
+}
 
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 64)]
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_ReceiveChatMessage // 223 ROOM_CHAT_NOTIFY, 290 bytes
+{
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
+    public string sender;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 257)]
     public string message;
 }
 
 [StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
-struct P_PlayerLeft // 217
+public struct P_MovePathRequest // 225 MOVE_PATH_REQUEST, 32 bytes
 {
-    public long id;
-
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 33)]
-    public string name;
+    public long userUUID;
+    public Vector3 startPos;
+    public Vector3 endPos;
 }
 
-// ================= 이벤토리 =========================
-[StructLayout(LayoutKind.Sequential, Pack = 1, Size = 40, CharSet = CharSet.Ansi)]
-public struct Item
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_MovePathResponse // 226 MOVE_PATH_RESPONSE, 130 bytes
 {
-    [MarshalAs(UnmanagedType.U4)] 
-    public uint itemID;
-    [MarshalAs(UnmanagedType.U2)] 
-    public ITEM_TYPE itemType;
-    [MarshalAs(UnmanagedType.U2)] 
-    public ushort quantity;
+    public long userUUID;
+    [MarshalAs(UnmanagedType.ByValArray, SizeConst = 10)]
+    public Vector3[] path;
+    public short pathCount;
+}
 
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 32)]
-    public string itemName;
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_InventoryInfoRequest // 301 INVENTORY_INFO_REQUEST, 0 bytes
+{
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-struct P_InventoryInfoRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_InventoryInfoResponse // 302 INVENTORY_INFO_RESPONSE, 1604 bytes
 {
-    // 빈 구조체
+    public ushort Result;
+    public ushort itemCount;
+    [MarshalAs(UnmanagedType.ByValArray, SizeConst = 40)]
+    public Item[] items;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-struct P_ItemAddRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_ItemAddRequest // 303 ITEM_ADD_REQUEST, 6 bytes
 {
-    [MarshalAs(UnmanagedType.U4)]
     public uint itemID;
-
-    [MarshalAs(UnmanagedType.U2)]
     public ushort quantity;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-struct P_ItemUseRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_ItemAddResponse // 304 ITEM_ADD_RESPONSE, 44 bytes
 {
-    [MarshalAs(UnmanagedType.U2)]
+    public ushort Result;
+    public Item addedItem;
     public ushort slotIndex;
 }
-// ===================================================
 
-// =================== Attack ===========================
-[StructLayout(LayoutKind.Sequential, Size = 24)]
-public struct P_PlayerAttackRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_ItemUseRequest // 306 ITEM_USE_REQUEST, 2 bytes
 {
-    [MarshalAs(UnmanagedType.Struct)]
-    public Vector3 attackPosition;
+    public ushort slotIndex;
+}
 
-    [MarshalAs(UnmanagedType.Struct)]
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_ItemUseResponse // 307 ITEM_USE_RESPONSE, 6 bytes
+{
+    public ushort Result;
+    public ushort slotIndex;
+    public ushort remainingQuantity;
+}
+
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerAttackRequest // 401 PLAYER_ATTACK_REQUEST, 24 bytes
+{
+    public Vector3 attackPosition;
     public Vector3 attackDirection;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_PlayerAttackResponse
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_PlayerAttackResponse // 402 PLAYER_ATTACK_RESPONSE, 14 bytes
 {
-    [MarshalAs(UnmanagedType.I2)]
     public short result;
-
-    [MarshalAs(UnmanagedType.I8)]
     public long targetEnemyID;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int damageAmount;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-public struct P_HitReport
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_HitReport // 404 HIT_REPORT, 28 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int damage;
-
-    [MarshalAs(UnmanagedType.R4)]
     public float hitX;
-
-    [MarshalAs(UnmanagedType.R4)]
     public float hitY;
-
-    [MarshalAs(UnmanagedType.R4)]
     public float hitZ;
-
-    [MarshalAs(UnmanagedType.U4)]
     public uint seq;
 }
 
-// 적 패킷들
-[StructLayout(LayoutKind.Sequential)]
-public struct P_EnemySpawnNotify
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_EnemySpawnNotify // 421 ENEMY_SPAWN_NOTIFY, 48 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int enemyType;
-
-    [MarshalAs(UnmanagedType.Struct)]
     public Vector3 position;
-
-    [MarshalAs(UnmanagedType.Struct)]
     public Quaternion rotation;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int maxHealth;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int currentHealth;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_EnemyDespawnNotify
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_EnemyDespawnNotify // 422 ENEMY_DESPAWN_NOTIFY, 8 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_EnemyPatrolUpdate
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_EnemyPatrolUpdate // 423 ENEMY_PATROL_UPDATE, 48 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
-
-    [MarshalAs(UnmanagedType.Struct)]
     public Vector3 position;
-
-    [MarshalAs(UnmanagedType.Struct)]
     public Quaternion rotation;
-
-    [MarshalAs(UnmanagedType.Struct)]
     public Vector3 velocity;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_EnemyDamageNotify
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_EnemyDamageNotify // 424 ENEMY_DAMAGE_NOTIFY, 24 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
-
-    [MarshalAs(UnmanagedType.I8)]
     public long attackerID;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int damageAmount;
-
-    [MarshalAs(UnmanagedType.I4)]
     public int remainingHealth;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_EnemyDeathNotify
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_EnemyDeathNotify // 425 ENEMY_DEATH_NOTIFY, 16 bytes
 {
-    [MarshalAs(UnmanagedType.I8)]
     public long enemyID;
-
-    [MarshalAs(UnmanagedType.I8)]
     public long killerID;
 }
 
-// ===================================================
-
-// =================== 퀘스트 ===========================
-[StructLayout(LayoutKind.Sequential)]
-public struct P_QuestTalkRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestTalkRequest // 501 QUEST_TALK_REQUEST, 4 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int npc_id;
+    public int npc_id;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1, Size = 128, CharSet = CharSet.Ansi)]
-public struct P_QuestTalkResponse
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestTalkResponse // 502 QUEST_TALK_RESPONSE, 115 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int npc_id;
-    [MarshalAs(UnmanagedType.I4)] public int quest_id;
-
-    [MarshalAs(UnmanagedType.U1)] public QUEST_STATE state;
-    [MarshalAs(UnmanagedType.U1)] public byte _pad0; // 서버 _pad0
-
-    [MarshalAs(UnmanagedType.U2)] public ushort current;
-    [MarshalAs(UnmanagedType.U2)] public ushort required;
-
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 32)] public string title;
-    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 64)] public string desc;
-
-    [MarshalAs(UnmanagedType.U4)] public uint rewardItemID;
-    [MarshalAs(UnmanagedType.U2)] public ushort rewardQty;
-
-    [MarshalAs(UnmanagedType.ByValArray, SizeConst = 12)] public byte[] _padTail; // 서버 _padTail[12]
+    public int npc_id;
+    public int quest_id;
+    public QUEST_STATE state;
+    public ushort current;
+    public ushort required;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 32)]
+    public string title;
+    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = 64)]
+    public string desc;
+    public uint rewardItemID;
+    public ushort rewardQty;
 }
 
-[StructLayout(LayoutKind.Sequential)]
-public struct P_QuestAcceptRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestAcceptRequest // 503 QUEST_ACCEPT_REQUEST, 8 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int npc_id;
-    [MarshalAs(UnmanagedType.I4)] public int quest_id;
+    public int npc_id;
+    public int quest_id;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1, Size = 16)]
-public struct P_QuestAcceptResponse
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestAcceptResponse // 504 QUEST_ACCEPT_RESPONSE, 10 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int quest_id;
-    [MarshalAs(UnmanagedType.U1)] public byte result;
-    [MarshalAs(UnmanagedType.U1)] public QUEST_STATE state;
-
-    [MarshalAs(UnmanagedType.U2)] public ushort current;
-    [MarshalAs(UnmanagedType.U2)] public ushort required;
-
-    [MarshalAs(UnmanagedType.ByValArray, SizeConst = 6)] public byte[] _padTail;
+    public int quest_id;
+    public byte result;
+    public QUEST_STATE state;
+    public ushort current;
+    public ushort required;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-public struct P_QuestProgressNotify
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestProgressNotify // 505 QUEST_PROGRESS_NOTIFY, 9 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int quest_id;
-    [MarshalAs(UnmanagedType.U2)] public ushort current;
-    [MarshalAs(UnmanagedType.U2)] public ushort required;
-    [MarshalAs(UnmanagedType.U1)] public QUEST_STATE state;
-
-    [MarshalAs(UnmanagedType.ByValArray, SizeConst = 3)] public byte[] _pad; // 서버 _pad[3]
+    public int quest_id;
+    public ushort current;
+    public ushort required;
+    public QUEST_STATE state;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-public struct P_QuestCompleteRequest
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestCompleteRequest // 506 QUEST_COMPLETE_REQUEST, 4 bytes
 {
-    [MarshalAs(UnmanagedType.I4)] public int QuestId;
+    public int QuestId;
 }
 
-[StructLayout(LayoutKind.Sequential, Pack = 1)]
-public struct P_QuestCompleteResponse
+[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]
+public struct P_QuestCompleteResponse // 507 QUEST_COMPLETE_RESPONSE, 7 bytes
 {
-    [MarshalAs(UnmanagedType.U2)] public ushort Result;  // 0 = 성공
-    [MarshalAs(UnmanagedType.I4)] public int QuestId;
-    [MarshalAs(UnmanagedType.U1)] public QUEST_STATE State;
-}
-// ===================================================
\ No newline at end of file
+    public ushort Result;
+    public int QuestId;
+    public QUEST_STATE State;
+}
\ No newline at end of file
@@ -27,6 +27,7 @@ public class EnemyManager : MonoBehaviour, IPacketReceiver
     void Start()
     {
         Client.TCP.AddPacketReceiver(this);
+        Client.UDP.AddPacketReceiver(this); // ENEMY_PATROL_UPDATE는 UDP로 온다.
         Debug.Log("[EnemyManager] Started");
     }
 
@@ -133,7 +134,7 @@ public class EnemyManager : MonoBehaviour, IPacketReceiver
         }
         else
         {
-            //  ̸ ص״ٰ   
+            // ������ �����̸� �����ص״ٰ� ���� �� ����
             pendingDamage[damageData.enemyID] = damageData;
             Debug.LogWarning($"[EnemyManager] Damage arrived before spawn. Cached. enemyID={damageData.enemyID}");
         }
@@ -149,7 +150,7 @@ public class EnemyManager : MonoBehaviour, IPacketReceiver
             enemies.Remove(deathData.enemyID);
 
             if (deathData.killerID == LocalPlayerInfo.ID)
-                Debug.Log(" óġ߽ϴ!");
+                Debug.Log("���� óġ�߽��ϴ�!");
 
             Debug.Log($"[EnemyManager] Enemy died: ID={deathData.enemyID}, Total={enemies.Count}");
         }
@@ -165,6 +166,7 @@ public class EnemyManager : MonoBehaviour, IPacketReceiver
         if (Instance == this)
         {
             Client.TCP.RemovePacketReceiver(this);
+            Client.UDP.RemovePacketReceiver(this);
             Instance = null;
         }
     }
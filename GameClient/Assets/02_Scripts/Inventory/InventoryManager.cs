@@ -98,63 +98,29 @@ public class InventoryManager : MonoBehaviour, IPacketReceiver
                 break;
         }
     }
-    private static string ReadZString(byte[] data, int offset, int maxLen)
-    {
-        int len = 0;
-        for (int i = 0; i < maxLen; i++)
-        {
-            if (data[offset + i] == 0) break;
-            len++;
-        }
-        return System.Text.Encoding.UTF8.GetString(data, offset, len);
-    }
-
     private void HandleInventoryInfoResponse(byte[] data)
     {
-        // payload: Result(2) + itemCount(2) + Item[40]
-        ushort result = System.BitConverter.ToUInt16(data, 0);
-        ushort itemCount = System.BitConverter.ToUInt16(data, 2);
+        P_InventoryInfoResponse res = UnsafeCode.ByteArrayToStructure<P_InventoryInfoResponse>(data);
 
         //  ü  ʱȭ
         for (int i = 0; i < MAX_INVENTORY_SIZE; i++)
             items[i] = new Item();
 
-        if (result != 0)
+        if (res.Result != 0)
         {
             UpdateInventoryUI();
             return;
         }
 
-        const int itemSize = 40;
-        int offset = 4;
-
-        // payload ̶ itemCount   ؼ ϰ
-        int maxReadable = (data.Length - offset) / itemSize;
-        int count = Mathf.Min((int)itemCount, Mathf.Min(MAX_INVENTORY_SIZE, maxReadable));
+        int count = Mathf.Min((int)res.itemCount, Mathf.Min(MAX_INVENTORY_SIZE, res.items.Length));
 
         for (int i = 0; i < count; i++)
         {
-            uint id = System.BitConverter.ToUInt32(data, offset + 0);
-            ushort typeU16 = System.BitConverter.ToUInt16(data, offset + 4);
-            ushort qty = System.BitConverter.ToUInt16(data, offset + 6);
-            string name = ReadZString(data, offset + 8, 32);
-
             //  ̸ ׳   
-            if (id == 0 || qty == 0)
-            {
-                offset += itemSize;
+            if (res.items[i].itemID == 0 || res.items[i].quantity == 0)
                 continue;
-            }
-
-            items[i] = new Item
-            {
-                itemID = id,
-                itemType = (ITEM_TYPE)typeU16,
-                quantity = qty,
-                itemName = name
-            };
 
-            offset += itemSize;
+            items[i] = res.items[i];
         }
 
         UpdateInventoryUI();
@@ -162,20 +128,12 @@ public class InventoryManager : MonoBehaviour, IPacketReceiver
 
     private void HandleItemAddResponse(byte[] data)
     {
-        // payload: Result(2) + Item(40) + slotIndex(2) = 44 bytes
-        if (data == null || data.Length < 44)
-        {
-            Debug.LogWarning("[Inventory] ITEM_ADD_RESPONSE payload too small");
-            return;
-        }
-
-        ushort result = System.BitConverter.ToUInt16(data, 0);
-        ushort slotIndex = System.BitConverter.ToUInt16(data, 42);
+        P_ItemAddResponse res = UnsafeCode.ByteArrayToStructure<P_ItemAddResponse>(data);
 
-        Debug.Log($"[Inventory] ItemAddResponse result={result}, slotIndex={slotIndex}");
+        Debug.Log($"[Inventory] ItemAddResponse result={res.Result}, slotIndex={res.slotIndex}");
 
         // ̸ ֽ κ丮 ٽ û(   )
-        if (result == 0)
+        if (res.Result == 0)
             RequestInventoryInfo();
     }
 
@@ -36,7 +36,9 @@ public class PlayerMovement : MonoBehaviour
 
             if (horizontal != 0 || vertical != 0)
             {
-                Client.TCP.SendPacket(E_PACKET.PLAYER_MOVEMENT, playerMovement);
+                // 잃어도 다음 프레임의 입력이 덮어쓰므로 UDP가 묶였으면 UDP로 보낸다.
+                var channel = Client.UDP.IsUdpBound ? Client.UDP : Client.TCP;
+                channel.SendPacket(E_PACKET.PLAYER_MOVEMENT, playerMovement);
 
                 // 애니메이션
                 if (animator != null)
@@ -4,9 +4,23 @@ using System.Runtime.InteropServices;
 
 public static unsafe class UnsafeCode
 {
+    private static class StructureSize<T>
+    {
+        public static readonly int Value = Marshal.SizeOf<T>();
+    }
+
+    // A packet shorter than the struct (e.g. a trimmed var field) is read as if
+    // the missing tail were zero instead of reading past the array.
     [MethodImpl(MethodImplOptions.AggressiveInlining)]
     public static T ByteArrayToStructure<T>(byte[] data)
     {
+        if (data.Length < StructureSize<T>.Value)
+        {
+            byte[] padded = new byte[StructureSize<T>.Value];
+            Buffer.BlockCopy(data, 0, padded, 0, data.Length);
+            data = padded;
+        }
+
         fixed (byte* ptr = data)
         {
             return Marshal.PtrToStructure<T>((IntPtr)ptr);
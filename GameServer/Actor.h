@@ -77,7 +77,7 @@ public:
 	void SetPosition(const Vector3& pos) { position = pos; }
 	void SetRotation(const Quaternion& rot) { rotation = rot; }
 
-	Vector3 UpdateMovement(float dx, float dy, Quaternion& rotation_)
+	Vector3 UpdateMovement(float dx, float dy, const Quaternion& rotation_)
 	{
 		const float SPEED = 20.0f;
 
@@ -0,0 +1,470 @@
+#pragma once
+
+#include "../Packet.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <sstream>
+
+//ó  .   ϳ ʴ  .
+struct stBotPhase
+{
+	std::string Name = "main";
+	UINT32 DurationSec = 10;
+	double MoveRate = 0;
+	double AttackRate = 0;
+	double HitRate = 0;		//˰ ִ   ϳ HIT_REPORT.    ʴ´.
+	double ChatRate = 0;
+	UINT32 ChatSize = 32;
+	double ReloginRate = 0;	//  ٷ ٽ ؼ αѴ.
+};
+
+//  . ó  ϰ  "̸=" ̰ [̸]    Ѵ.
+//ù [] տ      ⺻ ȴ.  (--̸=)  ó(--scenario=),
+//ó (--script=)  ǰ,  ̸   .
+//
+//	host=127.0.0.1
+//	port=11021
+//	bots=100
+//	threads=1
+//	connect_rate=0			ʴ  ϴ  . 0̸ Ѳ Ѵ.
+//	enter_room=1			α  濡 . 0̸ αθ Ѵ.
+//	room=spread				  ȣ. spread̸  ȣ room_count 濡  .
+//	room_count=1
+//	name_prefix=bot
+//	report_interval=1		߰   ֱ(). 0̸   Ѵ.
+//	timeout_ms=5000			 ̸ŭ ٸ ϸ ð ʰ .
+//	reconnect_ms=1000		  ٽ   ٸ ð. 0̸ ٽ  ʴ´.
+//	[crowd]
+//	duration=30
+//	move_rate=10
+//	attack_rate=1
+//	hit_rate=1
+//	chat_rate=0.2
+//	chat_size=32
+//	relogin_rate=0
+struct BotConfig
+{
+	std::string Host = "127.0.0.1";
+	UINT16 Port = 11021;
+	UINT32 BotCount = 10;
+	UINT32 ThreadCount = 1;
+	double ConnectRate = 0;
+	bool IsEnterRoom = true;
+	bool IsSpreadRoom = true;
+	UINT32 Room = 0;
+	UINT32 RoomCount = 1;
+	std::string NamePrefix = "bot";
+	UINT32 ReportIntervalSec = 1;
+	UINT32 TimeoutMs = 5000;
+	UINT32 ReconnectMs = 1000;
+	std::vector<stBotPhase> Phases;
+
+	//ȯ : ߸   false
+	bool Load(int argc, char* argv[])
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			if (arg.rfind("--scenario=", 0) == 0 && LoadScenario(arg.substr(arg.find('=') + 1)) == false)
+			{
+				return false;
+			}
+		}
+
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			if (arg.rfind("--script=", 0) == 0 && LoadFile(arg.substr(arg.find('=') + 1)) == false)
+			{
+				return false;
+			}
+		}
+
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			if (arg.rfind("--", 0) != 0)
+			{
+				printf("[]     : %s\n", argv[i]);
+				return false;
+			}
+
+			auto pos = arg.find('=');
+			auto name = arg.substr(2, (pos == std::string::npos) ? std::string::npos : pos - 2);
+			auto value = (pos == std::string::npos) ? std::string() : arg.substr(pos + 1);
+			if (name == "scenario" || name == "script")
+			{
+				continue;
+			}
+
+			if (IsPhaseName(name))
+			{
+				if (SetPhase(&mDefaultPhase, name, value) == false)
+				{
+					return false;
+				}
+
+				for (auto& phase : Phases)
+				{
+					SetPhase(&phase, name, value);
+				}
+			}
+			else if (Set(name, value) == false)
+			{
+				return false;
+			}
+		}
+
+		if (Phases.empty())
+		{
+			Phases.push_back(mDefaultPhase);
+		}
+
+		if (ThreadCount > BotCount)
+		{
+			ThreadCount = BotCount;
+		}
+		return true;
+	}
+
+	UINT32 GetTotalDurationSec() const
+	{
+		UINT32 totalSec = 0;
+		for (auto& phase : Phases)
+		{
+			totalSec += phase.DurationSec;
+		}
+		return totalSec;
+	}
+
+	//ۺ elapsedSec_ ʰ    ȣ.  ڿ  
+	UINT32 GetPhaseIndex(const double elapsedSec_) const
+	{
+		double endSec = 0;
+		for (UINT32 i = 0; i < (UINT32)Phases.size(); ++i)
+		{
+			endSec += Phases[i].DurationSec;
+			if (elapsedSec_ < endSec)
+			{
+				return i;
+			}
+		}
+		return (UINT32)Phases.size() - 1;
+	}
+
+	void Print() const
+	{
+		printf("[ ] %s:%u bots(%u) threads(%u) connect_rate(%.1f/s) enter_room(%d) room(%s%u) room_count(%u) timeout(%ums) reconnect(%ums)\n",
+			Host.c_str(), Port, BotCount, ThreadCount, ConnectRate, IsEnterRoom,
+			IsSpreadRoom ? "spread/" : "", Room, RoomCount, TimeoutMs, ReconnectMs);
+
+		for (auto& phase : Phases)
+		{
+			printf("[ ] [%s] %us move(%.1f/s) attack(%.1f/s) hit(%.1f/s) chat(%.1f/s, %uB) relogin(%.2f/s)\n",
+				phase.Name.c_str(), phase.DurationSec, phase.MoveRate, phase.AttackRate, phase.HitRate,
+				phase.ChatRate, phase.ChatSize, phase.ReloginRate);
+		}
+	}
+
+private:
+	// ó.  --max_client --room_user_count   ũ Ѿ Ѵ.
+	bool LoadScenario(const std::string& name_)
+	{
+		if (name_ == "login_storm")
+		{
+			//Ѳ ؼ αϰ, ̾  5ʿ ѹ÷ ٽ αѴ.
+			return LoadText(
+				"bots=300\n"
+				"connect_rate=0\n"
+				"enter_room=0\n"
+				"[storm]\n"
+				"duration=10\n"
+				"[churn]\n"
+				"duration=20\n"
+				"relogin_rate=0.2\n", "login_storm");
+		}
+
+		if (name_ == "crowded_room")
+		{
+			//  濡  ̰ ο. ̵ ˸    þ.
+			return LoadText(
+				"bots=100\n"
+				"connect_rate=200\n"
+				"room=0\n"
+				"[enter]\n"
+				"duration=3\n"
+				"[crowd]\n"
+				"duration=30\n"
+				"move_rate=10\n"
+				"attack_rate=1\n"
+				"hit_rate=2\n"
+				"chat_rate=0.2\n", "crowded_room");
+		}
+
+		if (name_ == "chat_flood")
+		{
+			// ä ӵ (ʴ 5) ٷ Ʒ  ä .
+			return LoadText(
+				"bots=50\n"
+				"room=0\n"
+				"[enter]\n"
+				"duration=2\n"
+				"[flood]\n"
+				"duration=20\n"
+				"chat_rate=4\n"
+				"chat_size=200\n", "chat_flood");
+		}
+
+		if (name_ == "log_bench")
+		{
+			// α ܰ迡  ó 񱳿. 4 濡   ӵ (ʴ 150) Ʒ  δ.
+			// --rate_limit=0 --log_level=trace  --log_level=off    ó ̵   Ѵ.
+			return LoadText(
+				"bots=40\n"
+				"room_count=10\n"
+				"[enter]\n"
+				"duration=3\n"
+				"[bench]\n"
+				"duration=20\n"
+				"move_rate=100\n", "log_bench");
+		}
+
+		if (name_ == "send_bench")
+		{
+			//۽  Ǯ ۽Ÿ Ҵϴ  񱳿. 4 濡    ̹Ƿ ̵ ϳ ۽  .
+			// --max_client=128 --room_count=25 --log_level=warn  --send_pool=1  --send_pool=0  
+			// ó ̵  ,    ۽ Ǯ 踦 Ѵ.
+			return LoadText(
+				"bots=100\n"
+				"threads=2\n"
+				"room_count=25\n"
+				"[enter]\n"
+				"duration=3\n"
+				"[bench]\n"
+				"duration=20\n"
+				"move_rate=50\n", "send_bench");
+		}
+
+		if (name_ == "backend_bench")
+		{
+			//epoll io_uring 鿣 񱳿.  ó    ʴ 5 δ. 4 濡  .
+			// --max_client=512 --room_count=125 --log_level=warn  ⺻(epoll) --io_uring  
+			//̵  (p99)    [IO ] syscall/msg Ѵ. ھ  --bots --room_count ø.
+			return LoadText(
+				"bots=500\n"
+				"threads=4\n"
+				"connect_rate=500\n"
+				"room_count=125\n"
+				"[enter]\n"
+				"duration=10\n"
+				"[bench]\n"
+				"duration=30\n"
+				"move_rate=5\n", "backend_bench");
+		}
+
+		printf("[]    ó : %s (login_storm, crowded_room, chat_flood, log_bench, send_bench, backend_bench)\n", name_.c_str());
+		return false;
+	}
+
+	bool LoadFile(const std::string& path_)
+	{
+		std::ifstream file(path_);
+		if (!file)
+		{
+			printf("[] ó     : %s\n", path_.c_str());
+			return false;
+		}
+
+		std::stringstream text;
+		text << file.rdbuf();
+		return LoadText(text.str(), path_);
+	}
+
+	//ó    ó  .
+	bool LoadText(const std::string& text_, const std::string& sourceName_)
+	{
+		Phases.clear();
+
+		std::istringstream lines(text_);
+		std::string line;
+		UINT32 lineNumber = 0;
+		while (std::getline(lines, line))
+		{
+			++lineNumber;
+
+			line = Trim(line);
+			if (line.empty() || line[0] == '#')
+			{
+				continue;
+			}
+
+			if (line[0] == '[')
+			{
+				auto end = line.find(']');
+				if (end == std::string::npos || end == 1)
+				{
+					printf("[] ߸  ̸ %s:%u\n", sourceName_.c_str(), lineNumber);
+					return false;
+				}
+
+				Phases.push_back(mDefaultPhase);
+				Phases.back().Name = line.substr(1, end - 1);
+				continue;
+			}
+
+			auto pos = line.find('=');
+			auto name = Trim(line.substr(0, pos));
+			auto value = (pos == std::string::npos) ? std::string() : Trim(line.substr(pos + 1));
+
+			bool isValid = false;
+			if (IsPhaseName(name))
+			{
+				isValid = SetPhase(Phases.empty() ? &mDefaultPhase : &Phases.back(), name, value);
+			}
+			else
+			{
+				isValid = Set(name, value);
+			}
+
+			if (isValid == false)
+			{
+				printf("[] ó %s:%u\n", sourceName_.c_str(), lineNumber);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static bool IsPhaseName(const std::string& name_)
+	{
+		return name_ == "duration" || name_ == "move_rate" || name_ == "attack_rate" || name_ == "hit_rate" ||
+			name_ == "chat_rate" || name_ == "chat_size" || name_ == "relogin_rate";
+	}
+
+	bool Set(const std::string& name_, const std::string& value_)
+	{
+		bool isValid = false;
+		UINT32 number = 0;
+
+		if (name_ == "host") { isValid = (value_.empty() == false); Host = value_; }
+		else if (name_ == "port") { isValid = ParseNumber(value_, 1, 65535, &number); Port = (UINT16)number; }
+		else if (name_ == "bots") { isValid = ParseNumber(value_, 1, 65535, &BotCount); }
+		else if (name_ == "threads") { isValid = ParseNumber(value_, 1, 256, &ThreadCount); }
+		else if (name_ == "connect_rate") { isValid = ParseRate(value_, &ConnectRate); }
+		else if (name_ == "enter_room") { isValid = ParseBool(value_, &IsEnterRoom); }
+		else if (name_ == "room")
+		{
+			IsSpreadRoom = (value_ == "spread");
+			isValid = IsSpreadRoom || ParseNumber(value_, 0, 100000, &Room);
+		}
+		else if (name_ == "room_count") { isValid = ParseNumber(value_, 1, 100000, &RoomCount); }
+		else if (name_ == "name_prefix") { isValid = (value_.empty() == false && value_.size() <= 16); NamePrefix = value_; }
+		else if (name_ == "report_interval") { isValid = ParseNumber(value_, 0, 3600, &ReportIntervalSec); }
+		else if (name_ == "timeout_ms") { isValid = ParseNumber(value_, 1, 600000, &TimeoutMs); }
+		else if (name_ == "reconnect_ms") { isValid = ParseNumber(value_, 0, 600000, &ReconnectMs); }
+		else
+		{
+			printf("[]     : %s\n", name_.c_str());
+			return false;
+		}
+
+		if (isValid == false)
+		{
+			printf("[] ߸   : %s=%s\n", name_.c_str(), value_.c_str());
+		}
+		return isValid;
+	}
+
+	static bool SetPhase(stBotPhase* pPhase_, const std::string& name_, const std::string& value_)
+	{
+		bool isValid = false;
+
+		if (name_ == "duration") { isValid = ParseNumber(value_, 1, 86400, &pPhase_->DurationSec); }
+		else if (name_ == "move_rate") { isValid = ParseRate(value_, &pPhase_->MoveRate); }
+		else if (name_ == "attack_rate") { isValid = ParseRate(value_, &pPhase_->AttackRate); }
+		else if (name_ == "hit_rate") { isValid = ParseRate(value_, &pPhase_->HitRate); }
+		else if (name_ == "chat_rate") { isValid = ParseRate(value_, &pPhase_->ChatRate); }
+		else if (name_ == "chat_size") { isValid = ParseNumber(value_, 1, MAX_CHAT_MSG_SIZE, &pPhase_->ChatSize); }
+		else if (name_ == "relogin_rate") { isValid = ParseRate(value_, &pPhase_->ReloginRate); }
+
+		if (isValid == false)
+		{
+			printf("[] ߸   : %s=%s\n", name_.c_str(), value_.c_str());
+		}
+		return isValid;
+	}
+
+	static std::string Trim(const std::string& text_)
+	{
+		auto begin = text_.find_first_not_of(" \t\r\n");
+		if (begin == std::string::npos)
+		{
+			return std::string();
+		}
+
+		auto end = text_.find_last_not_of(" \t\r\n");
+		return text_.substr(begin, end - begin + 1);
+	}
+
+	static bool ParseNumber(const std::string& value_, const UINT32 min_, const UINT32 max_, UINT32* pValue_)
+	{
+		if (value_.empty() || value_[0] < '0' || value_[0] > '9')
+		{
+			return false;
+		}
+
+		char* pEnd = nullptr;
+		auto number = strtoul(value_.c_str(), &pEnd, 10);
+		if (*pEnd != '\0' || number < min_ || number > max_)
+		{
+			return false;
+		}
+
+		*pValue_ = (UINT32)number;
+		return true;
+	}
+
+	//ʴ Ƚ. Ҽ ȴ. (0.2 = 5ʿ ѹ)
+	static bool ParseRate(const std::string& value_, double* pValue_)
+	{
+		if (value_.empty() || ((value_[0] < '0' || value_[0] > '9') && value_[0] != '.'))
+		{
+			return false;
+		}
+
+		char* pEnd = nullptr;
+		auto rate = strtod(value_.c_str(), &pEnd);
+		if (*pEnd != '\0' || rate < 0 || rate > 100000)
+		{
+			return false;
+		}
+
+		*pValue_ = rate;
+		return true;
+	}
+
+	//  ѱ.
+	static bool ParseBool(const std::string& value_, bool* pValue_)
+	{
+		if (value_.empty() || value_ == "1" || value_ == "true" || value_ == "yes")
+		{
+			*pValue_ = true;
+			return true;
+		}
+
+		if (value_ == "0" || value_ == "false" || value_ == "no")
+		{
+			*pValue_ = false;
+			return true;
+		}
+
+		return false;
+	}
+
+	stBotPhase mDefaultPhase;
+};
\ No newline at end of file
@@ -0,0 +1,698 @@
+#pragma once
+
+#include "BotSocket.h"
+#include "BotConfig.h"
+#include "BotStats.h"
+#include "../ErrorCode.h"
+#include "../PacketCompressor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <vector>
+
+
+const UINT32 BOT_RECV_BUFFER_SIZE = 0x20000;			// ū Ŷ(64KB)  
+const UINT32 BOT_MAX_SEND_PENDING = 256 * 1024;		//   Ͱ ̺   ൿ ǳʶڴ.
+const UINT64 BOT_LOGIN_CONFIRM_TIMEOUT_US = 500 * 1000;
+const UINT64 BOT_NEVER_US = ~0ULL;
+
+inline UINT64 GetBotNowUs()
+{
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+enum class BOT_STATE : UINT8
+{
+	IDLE,			// ̰ų . mNextConnectUs Ѵ.
+	CONNECTING,
+	LOGIN,			//LOGIN_RESPONSE ٸ.
+	LOGIN_CONFIRM,	//α    ڵ  ̶  ȮѴ.
+	ENTER,			//ROOM_ENTER_RESPONSE ٸ.
+	LOBBY,			//αθ ߴ. (enter_room=0 ̰ų 濡  )
+	PLAY,			//濡   ൿѴ.
+};
+
+enum class BOT_ACTION : UINT8
+{
+	MOVE,
+	ATTACK,
+	HIT,
+	CHAT,
+	RELOGIN,
+	COUNT
+};
+
+// ϳ. ŷ TCP  ϳ α,  , ൿ ϰ   .
+//  û    ϹǷ û  ð ٿ ְ   տ .
+//   û(ӵ , ̹  ) timeout_ms  ٿ  ð ʰ .
+class BotSession
+{
+public:
+	void Init(const UINT32 botIndex_, const BotConfig* pConfig_, const UINT64 firstConnectUs_)
+	{
+		mBotIndex = botIndex_;
+		mpConfig = pConfig_;
+		char name[MAX_USER_ID_LEN + 1];
+		snprintf(name, sizeof(name), "%s%05u", pConfig_->NamePrefix.c_str(), botIndex_);
+		mName = name;
+		mRoom = pConfig_->IsSpreadRoom ? botIndex_ % pConfig_->RoomCount : pConfig_->Room;
+		mNextConnectUs = firstConnectUs_;
+		mRandom.seed(botIndex_ + 1);
+		mRecvBuffer.resize(BOT_RECV_BUFFER_SIZE);
+	}
+
+	SOCKET GetSocket() const { return mSocket; }
+
+	BOT_STATE GetState() const { return mState; }
+
+	bool IsWantWrite() const { return mState == BOT_STATE::CONNECTING || mSendBuffer.size() > mSendOffset; }
+
+	// ,  ൿ,  ð ʰ óѴ.
+	void Update(const UINT64 nowUs_, const UINT32 phaseIndex_, stBotStats* pStats_)
+	{
+		if (mState == BOT_STATE::IDLE)
+		{
+			if (nowUs_ >= mNextConnectUs)
+			{
+				Connect(nowUs_, pStats_);
+			}
+			return;
+		}
+
+		if (mState == BOT_STATE::LOGIN_CONFIRM && nowUs_ >= mLoginConfirmUs)
+		{
+			OnLoginFailed(nowUs_, pStats_);
+			return;
+		}
+
+		ExpirePendingRequests(nowUs_, pStats_);
+
+		if (mState != BOT_STATE::PLAY && mState != BOT_STATE::LOBBY)
+		{
+			return;
+		}
+
+		if (phaseIndex_ != mPhaseIndex)
+		{
+			mPhaseIndex = phaseIndex_;
+			ScheduleActions(nowUs_);
+		}
+
+		for (int i = 0; i < (int)BOT_ACTION::COUNT; ++i)
+		{
+			if (nowUs_ < mNextActionUs[i])
+			{
+				continue;
+			}
+
+			auto intervalUs = GetActionIntervalUs((BOT_ACTION)i);
+			mNextActionUs[i] += intervalUs;
+			if (mNextActionUs[i] + intervalUs < nowUs_)
+			{
+				//尡 з ʾ и ŭ Ƽ  ʴ´.
+				mNextActionUs[i] = nowUs_ + intervalUs;
+			}
+
+			if (DoAction((BOT_ACTION)i, nowUs_, pStats_) == false)
+			{
+				return;
+			}
+		}
+	}
+
+	void OnWritable(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		if (mState == BOT_STATE::CONNECTING)
+		{
+			auto error = GetBotSocketConnectError(mSocket);
+			if (error != 0)
+			{
+				++pStats_->Counters.ConnectFails;
+				Close(nowUs_, mpConfig->ReconnectMs);
+				return;
+			}
+
+			++pStats_->Counters.Connects;
+			pStats_->AddLatency(BOT_LATENCY::CONNECT, nowUs_ - mConnectStartUs);
+			SendLogin(nowUs_, pStats_);
+			return;
+		}
+
+		FlushSend(nowUs_, pStats_);
+	}
+
+	void OnReadable(const UINT64 nowUs_, stBotStats* pStats_, char* pScratch_)
+	{
+		while (mSocket != INVALID_SOCKET)
+		{
+			auto recvSize = recv(mSocket, mRecvBuffer.data() + mRecvSize, (int)(mRecvBuffer.size() - mRecvSize), 0);
+			if (recvSize == 0)
+			{
+				OnDisconnected(nowUs_, pStats_);
+				return;
+			}
+
+			if (recvSize < 0)
+			{
+				if (IsBotSocketWouldBlock(GetBotSocketError()) == false)
+				{
+					OnDisconnected(nowUs_, pStats_);
+				}
+				return;
+			}
+
+			pStats_->Counters.RecvBytes += recvSize;
+			mRecvSize += (UINT32)recvSize;
+
+			if (ProcessRecvBuffer(nowUs_, pStats_, pScratch_) == false)
+			{
+				return;
+			}
+		}
+	}
+
+	//´. reconnectMs_ ڿ ٽ Ѵ. 0̸ ٽ  ʴ´.
+	void Close(const UINT64 nowUs_, const UINT32 reconnectMs_)
+	{
+		if (mSocket != INVALID_SOCKET)
+		{
+			closesocket(mSocket);
+			mSocket = INVALID_SOCKET;
+		}
+
+		mState = BOT_STATE::IDLE;
+		mNextConnectUs = (reconnectMs_ == 0) ? BOT_NEVER_US : nowUs_ + reconnectMs_ * 1000ULL;
+		mRecvSize = 0;
+		mSendBuffer.clear();
+		mSendOffset = 0;
+		mEnemies.clear();
+		for (auto& pending : mPendingRequests)
+		{
+			pending.clear();
+		}
+	}
+
+private:
+	void Connect(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		mSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (mSocket == INVALID_SOCKET || SetBotSocketNonBlocking(mSocket) == false)
+		{
+			++pStats_->Counters.ConnectFails;
+			Close(nowUs_, (std::max)(mpConfig->ReconnectMs, 1u));
+			return;
+		}
+
+		int noDelay = 1;
+		setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof(noDelay));
+
+		sockaddr_in serverAddr;
+		memset(&serverAddr, 0, sizeof(serverAddr));
+		serverAddr.sin_family = AF_INET;
+		serverAddr.sin_port = htons(mpConfig->Port);
+		inet_pton(AF_INET, mpConfig->Host.c_str(), &serverAddr.sin_addr);
+
+		mConnectStartUs = nowUs_;
+		mState = BOT_STATE::CONNECTING;
+
+		if (connect(mSocket, (sockaddr*)&serverAddr, sizeof(serverAddr)) != 0 && IsBotSocketWouldBlock(GetBotSocketError()) == false)
+		{
+			++pStats_->Counters.ConnectFails;
+			Close(nowUs_, (std::max)(mpConfig->ReconnectMs, 1u));
+		}
+	}
+
+	void OnDisconnected(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		++pStats_->Counters.Disconnects;
+		Close(nowUs_, mpConfig->ReconnectMs);
+	}
+
+	void SendLogin(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		LOGIN_REQUEST_PACKET loginPacket;
+		snprintf(loginPacket.userID, sizeof(loginPacket.userID), "%s", mName.c_str());
+		snprintf(loginPacket.userPW, sizeof(loginPacket.userPW), "bot");
+
+		mState = BOT_STATE::LOGIN;
+		Send(BOT_LATENCY::LOGIN, nowUs_, pStats_, (char*)&loginPacket, sizeof(loginPacket));
+	}
+
+	void OnLoginSucceeded(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		++pStats_->Counters.LoginOks;
+
+		if (mpConfig->IsEnterRoom == false)
+		{
+			EnterLobby(nowUs_);
+			return;
+		}
+
+		ROOM_ENTER_REQUEST_PACKET enterPacket;
+		enterPacket.RoomNumber = (INT32)mRoom;
+
+		mState = BOT_STATE::ENTER;
+		Send(BOT_LATENCY::ENTER, nowUs_, pStats_, (char*)&enterPacket, sizeof(enterPacket));
+	}
+
+	void OnLoginFailed(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		++pStats_->Counters.LoginFails;
+		Close(nowUs_, mpConfig->ReconnectMs);
+	}
+
+	void EnterLobby(const UINT64 nowUs_)
+	{
+		mState = BOT_STATE::LOBBY;
+		mPhaseIndex = ~0u;	// Update()  ൿ Ѵ.
+		UNREFERENCED_PARAMETER(nowUs_);
+	}
+
+	//濡  ϴ ൿ PLAY ¿ Ѵ.
+	void ScheduleActions(const UINT64 nowUs_)
+	{
+		std::uniform_real_distribution<double> phase(0.0, 1.0);
+		for (int i = 0; i < (int)BOT_ACTION::COUNT; ++i)
+		{
+			auto action = (BOT_ACTION)i;
+			auto intervalUs = GetActionIntervalUs(action);
+			if (intervalUs == BOT_NEVER_US || (mState != BOT_STATE::PLAY && action != BOT_ACTION::RELOGIN))
+			{
+				mNextActionUs[i] = BOT_NEVER_US;
+				continue;
+			}
+
+			//    ʰ ù ൿ  ȿ  ´.
+			mNextActionUs[i] = nowUs_ + (UINT64)(phase(mRandom) * (double)intervalUs);
+		}
+	}
+
+	UINT64 GetActionIntervalUs(const BOT_ACTION action_) const
+	{
+		auto& phase = mpConfig->Phases[(std::min)(mPhaseIndex, (UINT32)mpConfig->Phases.size() - 1)];
+
+		double rate = 0;
+		switch (action_)
+		{
+		case BOT_ACTION::MOVE: rate = phase.MoveRate; break;
+		case BOT_ACTION::ATTACK: rate = phase.AttackRate; break;
+		case BOT_ACTION::HIT: rate = phase.HitRate; break;
+		case BOT_ACTION::CHAT: rate = phase.ChatRate; break;
+		case BOT_ACTION::RELOGIN: rate = phase.ReloginRate; break;
+		default: break;
+		}
+
+		return (rate <= 0) ? BOT_NEVER_US : (std::max)((UINT64)(1000000.0 / rate), (UINT64)1);
+	}
+
+	//ȯ :   false
+	bool DoAction(const BOT_ACTION action_, const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		if (action_ == BOT_ACTION::RELOGIN)
+		{
+			++pStats_->Counters.Relogins;
+			Close(nowUs_, 0);
+			mNextConnectUs = nowUs_;
+			return false;
+		}
+
+		if (mSendBuffer.size() - mSendOffset > BOT_MAX_SEND_PENDING)
+		{
+			++pStats_->Counters.Backlogged;
+			return true;
+		}
+
+		auto& phase = mpConfig->Phases[mPhaseIndex];
+		std::uniform_real_distribution<float> axis(-1.0f, 1.0f);
+
+		switch (action_)
+		{
+		case BOT_ACTION::MOVE:
+		{
+			PLAYER_MOVEMENT_PACKET movePacket;
+			movePacket.userUUID = mUserIndex;
+			movePacket.dx = axis(mRandom);
+			movePacket.dy = axis(mRandom);
+			movePacket.rotation = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+			++pStats_->Counters.Moves;
+			return Send(BOT_LATENCY::MOVE, nowUs_, pStats_, (char*)&movePacket, sizeof(movePacket));
+		}
+
+		case BOT_ACTION::ATTACK:
+		{
+			PLAYER_ATTACK_REQUEST_PACKET attackPacket;
+			attackPacket.attackPosition = mPosition;
+			attackPacket.attackDirection = { axis(mRandom), 0.0f, axis(mRandom) };
+
+			++pStats_->Counters.Attacks;
+			return Send(BOT_LATENCY::COUNT, nowUs_, pStats_, (char*)&attackPacket, sizeof(attackPacket));
+		}
+
+		case BOT_ACTION::HIT:
+		{
+			if (mEnemies.empty())
+			{
+				return true;
+			}
+
+			HIT_REPORT_PACKET hitPacket;
+			hitPacket.enemyID = mEnemies[mRandom() % mEnemies.size()];
+			hitPacket.damage = 1;
+			hitPacket.hitX = mPosition.x;
+			hitPacket.hitY = mPosition.y;
+			hitPacket.hitZ = mPosition.z;
+			hitPacket.seq = ++mHitSeq;
+
+			++pStats_->Counters.Hits;
+			return Send(BOT_LATENCY::HIT, nowUs_, pStats_, (char*)&hitPacket, sizeof(hitPacket));
+		}
+
+		case BOT_ACTION::CHAT:
+		{
+			//'/' ϸ   óѴ.
+			ROOM_CHAT_REQUEST_PACKET chatPacket;
+			for (UINT32 i = 0; i < phase.ChatSize; ++i)
+			{
+				chatPacket.Message[i] = (char)('a' + (mChatSeq + i) % 26);
+			}
+			++mChatSeq;
+
+			++pStats_->Counters.Chats;
+			return Send(BOT_LATENCY::CHAT, nowUs_, pStats_, (char*)&chatPacket, sizeof(chatPacket));
+		}
+
+		default:
+			return true;
+		}
+	}
+
+	//latencyType_ :    û̸  .   COUNT
+	//ȯ : ٰ  false
+	bool Send(const BOT_LATENCY latencyType_, const UINT64 nowUs_, stBotStats* pStats_, const char* pPacket_, const UINT32 packetSize_)
+	{
+		if (latencyType_ != BOT_LATENCY::COUNT)
+		{
+			mPendingRequests[(int)latencyType_].push_back(nowUs_);
+		}
+
+		++pStats_->Counters.SentPackets;
+		mSendBuffer.insert(mSendBuffer.end(), pPacket_, pPacket_ + packetSize_);
+		return FlushSend(nowUs_, pStats_);
+	}
+
+	bool FlushSend(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		while (mSendOffset < mSendBuffer.size())
+		{
+			auto sentSize = send(mSocket, mSendBuffer.data() + mSendOffset, (int)(mSendBuffer.size() - mSendOffset), 0);
+			if (sentSize <= 0)
+			{
+				if (sentSize < 0 && IsBotSocketWouldBlock(GetBotSocketError()))
+				{
+					return true;
+				}
+
+				OnDisconnected(nowUs_, pStats_);
+				return false;
+			}
+
+			pStats_->Counters.SentBytes += sentSize;
+			mSendOffset += (UINT32)sentSize;
+		}
+
+		mSendBuffer.clear();
+		mSendOffset = 0;
+		return true;
+	}
+
+	// Ϳ ϼ Ŷ  óϰ    .
+	//ȯ : óϴٰ  false
+	bool ProcessRecvBuffer(const UINT64 nowUs_, stBotStats* pStats_, char* pScratch_)
+	{
+		UINT32 readPos = 0;
+		while (mRecvSize - readPos >= PACKET_HEADER_LENGTH)
+		{
+			auto pPacket = mRecvBuffer.data() + readPos;
+			auto pHeader = (PACKET_HEADER*)pPacket;
+			if (pHeader->PacketLength < PACKET_HEADER_LENGTH)
+			{
+				OnDisconnected(nowUs_, pStats_);
+				return false;
+			}
+
+			if (pHeader->PacketLength > mRecvSize - readPos)
+			{
+				break;
+			}
+
+			readPos += pHeader->PacketLength;
+			++pStats_->Counters.RecvPackets;
+
+			UINT32 packetSize = pHeader->PacketLength;
+			if (IsCompressedPacket(pPacket))
+			{
+				packetSize = PacketCompressor::Instance().Decompress(pPacket, packetSize, pScratch_, PACKET_DECOMPRESS_BUFFER_SIZE);
+				if (packetSize == 0)
+				{
+					continue;
+				}
+				pPacket = pScratch_;
+			}
+
+			ProcessPacket(nowUs_, pStats_, pPacket, packetSize);
+			if (mSocket == INVALID_SOCKET)
+			{
+				return false;
+			}
+		}
+
+		if (readPos > 0)
+		{
+			memmove(mRecvBuffer.data(), mRecvBuffer.data() + readPos, mRecvSize - readPos);
+			mRecvSize -= readPos;
+		}
+		return true;
+	}
+
+	void ProcessPacket(const UINT64 nowUs_, stBotStats* pStats_, const char* pPacket_, const UINT32 packetSize_)
+	{
+		auto packetId = (PACKET_ID)((PACKET_HEADER*)pPacket_)->PacketId;
+
+		//LOGIN_CONFIRM α  ڿ ٷ  UDP ū  ٸ Ŷ  д.
+		if (mState == BOT_STATE::LOGIN_CONFIRM && packetId != PACKET_ID::UDP_TOKEN_NOTIFY && packetId != PACKET_ID::HEARTBEAT_PING)
+		{
+			OnLoginFailed(nowUs_, pStats_);
+			return;
+		}
+
+		switch (packetId)
+		{
+		case PACKET_ID::HEARTBEAT_PING:
+		{
+			if (packetSize_ < sizeof(HEARTBEAT_PING_PACKET))
+			{
+				return;
+			}
+
+			HEARTBEAT_PONG_PACKET pongPacket;
+			pongPacket.PingTimeMs = ((HEARTBEAT_PING_PACKET*)pPacket_)->PingTimeMs;
+			Send(BOT_LATENCY::COUNT, nowUs_, pStats_, (char*)&pongPacket, sizeof(pongPacket));
+			return;
+		}
+
+		case PACKET_ID::LOGIN_RESPONSE:
+		{
+			if (mState != BOT_STATE::LOGIN || packetSize_ < sizeof(LOGIN_RESPONSE_PACKET))
+			{
+				return;
+			}
+
+			RecordLatency(BOT_LATENCY::LOGIN, nowUs_, pStats_);
+
+			//ϸ Result  ȣ ´.  ڵ  ȣ  Ƿ ׶ ڵ UDP ū ȮѴ.
+			auto result = ((LOGIN_RESPONSE_PACKET*)pPacket_)->Result;
+			mUserIndex = result;
+			if (result == (UINT16)ERROR_CODE::LOGIN_USER_ALREADY || result == (UINT16)ERROR_CODE::LOGIN_USER_USED_ALL_OBJ ||
+				result == (UINT16)ERROR_CODE::LOGIN_USER_INVALID_PW)
+			{
+				mState = BOT_STATE::LOGIN_CONFIRM;
+				mLoginConfirmUs = nowUs_ + BOT_LOGIN_CONFIRM_TIMEOUT_US;
+				return;
+			}
+
+			OnLoginSucceeded(nowUs_, pStats_);
+			return;
+		}
+
+		case PACKET_ID::UDP_TOKEN_NOTIFY:
+			if (mState == BOT_STATE::LOGIN_CONFIRM)
+			{
+				OnLoginSucceeded(nowUs_, pStats_);
+			}
+			return;
+
+		case PACKET_ID::ROOM_ENTER_RESPONSE:
+		{
+			if (mState != BOT_STATE::ENTER || packetSize_ < sizeof(ROOM_ENTER_RESPONSE_PACKET))
+			{
+				return;
+			}
+
+			RecordLatency(BOT_LATENCY::ENTER, nowUs_, pStats_);
+
+			if (((ROOM_ENTER_RESPONSE_PACKET*)pPacket_)->Result != (INT16)ERROR_CODE::NONE)
+			{
+				++pStats_->Counters.EnterFails;
+				EnterLobby(nowUs_);
+				return;
+			}
+
+			++pStats_->Counters.EnterOks;
+			mState = BOT_STATE::PLAY;
+			mPhaseIndex = ~0u;
+			return;
+		}
+
+		case PACKET_ID::UPDATE_PLAYER_MOVEMENT:
+		{
+			auto pMovePacket = (UPDATE_PLAYER_MOVEMENT_PACKET*)pPacket_;
+			if (packetSize_ >= sizeof(UPDATE_PLAYER_MOVEMENT_PACKET) && pMovePacket->player_id == mUserIndex)
+			{
+				mPosition = pMovePacket->position;
+				RecordLatency(BOT_LATENCY::MOVE, nowUs_, pStats_);
+			}
+			return;
+		}
+
+		case PACKET_ID::ROOM_CHAT_RESPONSE:
+		{
+			if (packetSize_ < sizeof(ROOM_CHAT_RESPONSE_PACKET))
+			{
+				return;
+			}
+
+			if (((ROOM_CHAT_RESPONSE_PACKET*)pPacket_)->Result == (INT16)ERROR_CODE::NONE)
+			{
+				RecordLatency(BOT_LATENCY::CHAT, nowUs_, pStats_);
+				return;
+			}
+
+			if (((ROOM_CHAT_RESPONSE_PACKET*)pPacket_)->Result == (INT16)ERROR_CODE::ROOM_TOO_MANY_PACKET)
+			{
+				++pStats_->Counters.ChatLimited;
+			}
+
+			auto& pending = mPendingRequests[(int)BOT_LATENCY::CHAT];
+			if (pending.empty() == false)
+			{
+				pending.pop_front();
+			}
+			return;
+		}
+
+		case PACKET_ID::ENEMY_SPAWN_NOTIFY:
+			if (packetSize_ >= sizeof(ENEMY_SPAWN_NOTIFY_PACKET))
+			{
+				AddEnemy(((ENEMY_SPAWN_NOTIFY_PACKET*)pPacket_)->enemyID);
+			}
+			return;
+
+		case PACKET_ID::ENEMY_DESPAWN_NOTIFY:
+			if (packetSize_ >= sizeof(ENEMY_DESPAWN_NOTIFY_PACKET))
+			{
+				RemoveEnemy(((ENEMY_DESPAWN_NOTIFY_PACKET*)pPacket_)->enemyID);
+			}
+			return;
+
+		case PACKET_ID::ENEMY_DEATH_NOTIFY:
+			if (packetSize_ >= sizeof(ENEMY_DEATH_NOTIFY_PACKET))
+			{
+				RemoveEnemy(((ENEMY_DEATH_NOTIFY_PACKET*)pPacket_)->enemyID);
+			}
+			return;
+
+		case PACKET_ID::ENEMY_DAMAGE_NOTIFY:
+			if (packetSize_ >= sizeof(ENEMY_DAMAGE_NOTIFY_PACKET) && ((ENEMY_DAMAGE_NOTIFY_PACKET*)pPacket_)->attackerID == mUserIndex)
+			{
+				RecordLatency(BOT_LATENCY::HIT, nowUs_, pStats_);
+			}
+			return;
+
+		default:
+			return;
+		}
+	}
+
+	void RecordLatency(const BOT_LATENCY type_, const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		auto& pending = mPendingRequests[(int)type_];
+		if (pending.empty())
+		{
+			return;
+		}
+
+		pStats_->AddLatency(type_, nowUs_ - pending.front());
+		pending.pop_front();
+	}
+
+	void ExpirePendingRequests(const UINT64 nowUs_, stBotStats* pStats_)
+	{
+		auto timeoutUs = mpConfig->TimeoutMs * 1000ULL;
+		for (auto& pending : mPendingRequests)
+		{
+			while (pending.empty() == false && pending.front() + timeoutUs < nowUs_)
+			{
+				pending.pop_front();
+				++pStats_->Counters.Timeouts;
+			}
+		}
+	}
+
+	void AddEnemy(const INT64 enemyId_)
+	{
+		if (std::find(mEnemies.begin(), mEnemies.end(), enemyId_) == mEnemies.end())
+		{
+			mEnemies.push_back(enemyId_);
+		}
+	}
+
+	void RemoveEnemy(const INT64 enemyId_)
+	{
+		auto iter = std::find(mEnemies.begin(), mEnemies.end(), enemyId_);
+		if (iter != mEnemies.end())
+		{
+			*iter = mEnemies.back();
+			mEnemies.pop_back();
+		}
+	}
+
+	UINT32 mBotIndex = 0;
+	const BotConfig* mpConfig = nullptr;
+	std::string mName;
+	UINT32 mRoom = 0;
+
+	SOCKET mSocket = INVALID_SOCKET;
+	BOT_STATE mState = BOT_STATE::IDLE;
+	UINT64 mNextConnectUs = 0;
+	UINT64 mConnectStartUs = 0;
+	UINT64 mLoginConfirmUs = 0;
+	INT64 mUserIndex = -1;
+
+	UINT32 mPhaseIndex = ~0u;
+	UINT64 mNextActionUs[(int)BOT_ACTION::COUNT] = { 0, };
+	std::deque<UINT64> mPendingRequests[(int)BOT_LATENCY::COUNT];
+
+	std::vector<char> mRecvBuffer;
+	UINT32 mRecvSize = 0;
+	std::vector<char> mSendBuffer;
+	UINT32 mSendOffset = 0;
+
+	std::mt19937 mRandom;
+	std::vector<INT64> mEnemies;	//濡 ִ 
+	Vector3 mPosition = { 0.0f, 0.0f, 0.0f };
+	UINT32 mHitSeq = 0;
+	UINT32 mChatSeq = 0;
+};
\ No newline at end of file
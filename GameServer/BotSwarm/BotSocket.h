@@ -0,0 +1,103 @@
+#pragma once
+
+//  ŷ  Լ   ش.   ϳ   poll ٸ.
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+
+typedef WSAPOLLFD BOT_POLLFD;
+
+inline bool InitBotSocket()
+{
+	WSADATA wsaData;
+	return WSAStartup(MAKEWORD(2, 2), &wsaData) == 0;
+}
+
+inline void CleanupBotSocket()
+{
+	WSACleanup();
+}
+
+inline int PollBotSockets(BOT_POLLFD* pFds_, const UINT32 count_, const int timeoutMs_)
+{
+	return WSAPoll(pFds_, (ULONG)count_, timeoutMs_);
+}
+
+inline int GetBotSocketError()
+{
+	return WSAGetLastError();
+}
+
+inline bool IsBotSocketWouldBlock(const int error_)
+{
+	return error_ == WSAEWOULDBLOCK || error_ == WSAEINPROGRESS;
+}
+
+inline bool SetBotSocketNonBlocking(SOCKET socket_)
+{
+	u_long mode = 1;
+	return ioctlsocket(socket_, FIONBIO, &mode) == 0;
+}
+
+#else
+#include "../ServerNetwork/LinuxDefine.h"
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+typedef pollfd BOT_POLLFD;
+
+//   Ͽ  μ  ʰ Ѵ.
+inline bool InitBotSocket()
+{
+	signal(SIGPIPE, SIG_IGN);
+	return true;
+}
+
+inline void CleanupBotSocket()
+{
+}
+
+inline int PollBotSockets(BOT_POLLFD* pFds_, const UINT32 count_, const int timeoutMs_)
+{
+	return poll(pFds_, (nfds_t)count_, timeoutMs_);
+}
+
+inline int GetBotSocketError()
+{
+	return errno;
+}
+
+inline bool IsBotSocketWouldBlock(const int error_)
+{
+	return error_ == EWOULDBLOCK || error_ == EAGAIN || error_ == EINPROGRESS;
+}
+
+inline bool SetBotSocketNonBlocking(SOCKET socket_)
+{
+	auto flags = fcntl(socket_, F_GETFL, 0);
+	return flags != -1 && fcntl(socket_, F_SETFL, flags | O_NONBLOCK) != -1;
+}
+#endif
+
+//ŷ connect()  ( ) . 0̸ 
+inline int GetBotSocketConnectError(SOCKET socket_)
+{
+	int error = 0;
+#ifdef _WIN32
+	int length = sizeof(error);
+#else
+	socklen_t length = sizeof(error);
+#endif
+	if (getsockopt(socket_, SOL_SOCKET, SO_ERROR, (char*)&error, &length) != 0)
+	{
+		return GetBotSocketError();
+	}
+	return error;
+}
\ No newline at end of file
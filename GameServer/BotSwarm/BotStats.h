@@ -0,0 +1,206 @@
+#pragma once
+
+#include "../Packet.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+
+
+//û   ޱ  ׸
+enum class BOT_LATENCY : UINT8
+{
+	CONNECT,	//connect() ~  Ϸ
+	LOGIN,		//LOGIN_REQUEST ~ LOGIN_RESPONSE
+	ENTER,		//ROOM_ENTER_REQUEST ~ ROOM_ENTER_RESPONSE
+	MOVE,		//PLAYER_MOVEMENT ~ ڱ UPDATE_PLAYER_MOVEMENT
+	CHAT,		//ROOM_CHAT_REQUEST ~ ROOM_CHAT_RESPONSE
+	HIT,		//HIT_REPORT ~ ڱⰡ  ENEMY_DAMAGE_NOTIFY
+	COUNT
+};
+
+const char* const BOT_LATENCY_NAMES[(int)BOT_LATENCY::COUNT] = { "connect", "login", "enter", "move", "chat", "hit" };
+
+//ũ  . 2 ŵ  16ĭ    6% ̴.
+class LatencyHistogram
+{
+public:
+	void Add(const UINT64 latencyUs_)
+	{
+		++mBuckets[GetBucketIndex(latencyUs_)];
+		++mCount;
+		mSumUs += latencyUs_;
+		mMaxUs = (std::max)(mMaxUs, latencyUs_);
+	}
+
+	void Merge(const LatencyHistogram& other_)
+	{
+		for (UINT32 i = 0; i < BUCKET_COUNT; ++i)
+		{
+			mBuckets[i] += other_.mBuckets[i];
+		}
+		mCount += other_.mCount;
+		mSumUs += other_.mSumUs;
+		mMaxUs = (std::max)(mMaxUs, other_.mMaxUs);
+	}
+
+	UINT64 GetCount() const { return mCount; }
+
+	UINT64 GetMaxUs() const { return mMaxUs; }
+
+	UINT64 GetAverageUs() const { return (mCount == 0) ? 0 : mSumUs / mCount; }
+
+	//percent_ : 0 ~ 100.  ĭ  ū  ش.
+	UINT64 GetPercentileUs(const double percent_) const
+	{
+		if (mCount == 0)
+		{
+			return 0;
+		}
+
+		auto rank = (UINT64)(percent_ / 100.0 * (double)mCount + 0.5);
+		rank = (std::max)(rank, (UINT64)1);
+
+		UINT64 count = 0;
+		for (UINT32 i = 0; i < BUCKET_COUNT; ++i)
+		{
+			count += mBuckets[i];
+			if (count >= rank)
+			{
+				return (std::min)(GetBucketMaxUs(i), mMaxUs);
+			}
+		}
+		return mMaxUs;
+	}
+
+private:
+	static const UINT32 SUB_BUCKET_BITS = 4;
+	static const UINT32 SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static const UINT32 BUCKET_COUNT = SUB_BUCKET_COUNT * 61;
+
+	//16 ̸  ״,   (ֻ Ʈ ġ,  4Ʈ) ĭ .
+	static UINT32 GetBucketIndex(const UINT64 valueUs_)
+	{
+		if (valueUs_ < SUB_BUCKET_COUNT)
+		{
+			return (UINT32)valueUs_;
+		}
+
+		UINT32 topBit = 63;
+		while ((valueUs_ >> topBit) == 0)
+		{
+			--topBit;
+		}
+
+		auto shift = topBit - SUB_BUCKET_BITS;
+		auto subIndex = (UINT32)(valueUs_ >> shift) & (SUB_BUCKET_COUNT - 1);
+		return SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT + subIndex;
+	}
+
+	static UINT64 GetBucketMaxUs(const UINT32 index_)
+	{
+		if (index_ < SUB_BUCKET_COUNT)
+		{
+			return index_;
+		}
+
+		auto shift = (index_ - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+		auto subIndex = (index_ - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+		return ((UINT64)(SUB_BUCKET_COUNT + subIndex + 1) << shift) - 1;
+	}
+
+	UINT64 mBuckets[BUCKET_COUNT] = { 0, };
+	UINT64 mCount = 0;
+	UINT64 mSumUs = 0;
+	UINT64 mMaxUs = 0;
+};
+
+struct stBotCounters
+{
+	UINT64 SentPackets = 0;
+	UINT64 SentBytes = 0;
+	UINT64 RecvPackets = 0;
+	UINT64 RecvBytes = 0;
+
+	UINT64 Connects = 0;
+	UINT64 ConnectFails = 0;
+	UINT64 LoginOks = 0;
+	UINT64 LoginFails = 0;
+	UINT64 EnterOks = 0;
+	UINT64 EnterFails = 0;
+	UINT64 Disconnects = 0;		//  ʾҴµ  
+	UINT64 Relogins = 0;
+
+	UINT64 Moves = 0;
+	UINT64 Attacks = 0;
+	UINT64 Hits = 0;
+	UINT64 Chats = 0;
+	UINT64 ChatLimited = 0;		// ä ӵ   
+	UINT64 Timeouts = 0;		//timeout_ms ȿ    û 
+	UINT64 Backlogged = 0;		// Ͱ з ǳʶ ൿ 
+
+	void Merge(const stBotCounters& other_)
+	{
+		auto pDest = (UINT64*)this;
+		auto pSrc = (const UINT64*)&other_;
+		for (size_t i = 0; i < sizeof(stBotCounters) / sizeof(UINT64); ++i)
+		{
+			pDest[i] += pSrc[i];
+		}
+	}
+};
+
+//  ϳ    
+struct stBotStats
+{
+	stBotCounters Counters;
+	LatencyHistogram Latency[(int)BOT_LATENCY::COUNT];
+
+	void AddLatency(const BOT_LATENCY type_, const UINT64 latencyUs_)
+	{
+		Latency[(int)type_].Add(latencyUs_);
+	}
+
+	void Merge(const stBotStats& other_)
+	{
+		Counters.Merge(other_.Counters);
+		for (int i = 0; i < (int)BOT_LATENCY::COUNT; ++i)
+		{
+			Latency[i].Merge(other_.Latency[i]);
+		}
+	}
+
+	void Print(const char* pName_, const double elapsedSec_) const
+	{
+		auto& c = Counters;
+		auto seconds = (elapsedSec_ > 0) ? elapsedSec_ : 1.0;
+
+		printf("[ ] [%s] %.1fs send(%llu pkt, %.0f pkt/s, %.1f KB/s) recv(%llu pkt, %.0f pkt/s, %.1f KB/s)\n",
+			pName_, elapsedSec_,
+			(unsigned long long)c.SentPackets, (double)c.SentPackets / seconds, (double)c.SentBytes / 1024.0 / seconds,
+			(unsigned long long)c.RecvPackets, (double)c.RecvPackets / seconds, (double)c.RecvBytes / 1024.0 / seconds);
+		printf("[ ] [%s] connect(%llu, fail %llu) login(%llu, fail %llu) enter(%llu, fail %llu) disconnect(%llu) relogin(%llu)\n",
+			pName_, (unsigned long long)c.Connects, (unsigned long long)c.ConnectFails,
+			(unsigned long long)c.LoginOks, (unsigned long long)c.LoginFails,
+			(unsigned long long)c.EnterOks, (unsigned long long)c.EnterFails,
+			(unsigned long long)c.Disconnects, (unsigned long long)c.Relogins);
+		printf("[ ] [%s] move(%llu) attack(%llu) hit(%llu) chat(%llu, limited %llu) timeout(%llu) backlogged(%llu)\n",
+			pName_, (unsigned long long)c.Moves, (unsigned long long)c.Attacks, (unsigned long long)c.Hits,
+			(unsigned long long)c.Chats, (unsigned long long)c.ChatLimited,
+			(unsigned long long)c.Timeouts, (unsigned long long)c.Backlogged);
+
+		for (int i = 0; i < (int)BOT_LATENCY::COUNT; ++i)
+		{
+			auto& latency = Latency[i];
+			if (latency.GetCount() == 0)
+			{
+				continue;
+			}
+
+			printf("[ ] [%s] %-7s count(%llu) avg(%.2fms) p50(%.2fms) p90(%.2fms) p99(%.2fms) p99.9(%.2fms) max(%.2fms)\n",
+				pName_, BOT_LATENCY_NAMES[i], (unsigned long long)latency.GetCount(),
+				latency.GetAverageUs() / 1000.0, latency.GetPercentileUs(50) / 1000.0, latency.GetPercentileUs(90) / 1000.0,
+				latency.GetPercentileUs(99) / 1000.0, latency.GetPercentileUs(99.9) / 1000.0, latency.GetMaxUs() / 1000.0);
+		}
+	}
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#include "BotWorker.h"
+
+//  ݷ ϴ  . ó , α,  , ̵, , ä 
+// ó   (p50/p90/p99/p99.9) Ѵ.  BotConfig.h 
+//
+//	botswarm --scenario=crowded_room --bots=200 --threads=2
+//	botswarm --script=storm.txt --host=10.0.0.5
+int main(int argc, char* argv[])
+{
+	BotConfig config;
+	if (config.Load(argc, argv) == false)
+	{
+		return 1;
+	}
+	config.Print();
+
+	if (InitBotSocket() == false)
+	{
+		printf("[]  ʱȭ \n");
+		return 1;
+	}
+
+	auto startUs = GetBotNowUs();
+
+	// i  i % threads ô´. connect_rate    ð  ȣ   ´.
+	std::vector<std::unique_ptr<BotWorker>> workers;
+	for (UINT32 i = 0; i < config.ThreadCount; ++i)
+	{
+		workers.push_back(std::make_unique<BotWorker>());
+		workers.back()->Init(&config);
+	}
+
+	for (UINT32 i = 0; i < config.BotCount; ++i)
+	{
+		auto connectDelayUs = (config.ConnectRate > 0) ? (UINT64)(i * 1000000.0 / config.ConnectRate) : 0;
+		workers[i % config.ThreadCount]->AddBot(i, startUs + connectDelayUs);
+	}
+
+	for (auto& worker : workers)
+	{
+		worker->Start(startUs);
+	}
+
+	auto collectStats = [&workers](const UINT32 phaseIndex_, stBotStats* pStats_)
+	{
+		for (auto& worker : workers)
+		{
+			worker->GetStats(phaseIndex_, pStats_);
+		}
+	};
+
+	//߰     þ ŭ ش.
+	auto totalUs = config.GetTotalDurationSec() * 1000000ULL;
+	auto nextReportUs = startUs + config.ReportIntervalSec * 1000000ULL;
+	auto lastReportUs = startUs;
+	auto lastPhaseIndex = 0u;
+	stBotStats lastStats;
+
+	while (true)
+	{
+		auto nowUs = GetBotNowUs();
+		if (nowUs - startUs >= totalUs)
+		{
+			break;
+		}
+
+		if (config.ReportIntervalSec == 0 || nowUs < nextReportUs)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			continue;
+		}
+		nextReportUs += config.ReportIntervalSec * 1000000ULL;
+
+		auto phaseIndex = config.GetPhaseIndex((double)(nowUs - startUs) / 1000000.0);
+		if (phaseIndex != lastPhaseIndex)
+		{
+			lastPhaseIndex = phaseIndex;
+			lastStats = stBotStats();
+		}
+
+		stBotStats phaseStats;
+		collectStats(phaseIndex, &phaseStats);
+
+		UINT32 activeBotCount = 0;
+		for (auto& worker : workers)
+		{
+			activeBotCount += worker->GetActiveBotCount();
+		}
+
+		// 迡      ̹   .
+		auto& c = phaseStats.Counters;
+		auto& l = lastStats.Counters;
+		auto intervalSec = (double)(nowUs - lastReportUs) / 1000000.0;
+		printf("[] %5.1fs [%s] active(%u/%u) send(%.0f pkt/s) recv(%.0f pkt/s) login(+%llu) disconnect(+%llu) timeout(+%llu) chat_limited(+%llu)\n",
+			(double)(nowUs - startUs) / 1000000.0, config.Phases[phaseIndex].Name.c_str(), activeBotCount, config.BotCount,
+			(double)(c.SentPackets - l.SentPackets) / intervalSec, (double)(c.RecvPackets - l.RecvPackets) / intervalSec,
+			(unsigned long long)(c.LoginOks - l.LoginOks), (unsigned long long)(c.Disconnects - l.Disconnects),
+			(unsigned long long)(c.Timeouts - l.Timeouts), (unsigned long long)(c.ChatLimited - l.ChatLimited));
+
+		lastStats = phaseStats;
+		lastReportUs = nowUs;
+	}
+
+	for (auto& worker : workers)
+	{
+		worker->End();
+	}
+
+	stBotStats totalStats;
+	for (UINT32 i = 0; i < (UINT32)config.Phases.size(); ++i)
+	{
+		stBotStats phaseStats;
+		collectStats(i, &phaseStats);
+		phaseStats.Print(config.Phases[i].Name.c_str(), config.Phases[i].DurationSec);
+		totalStats.Merge(phaseStats);
+	}
+
+	if (config.Phases.size() > 1)
+	{
+		totalStats.Print("total", config.GetTotalDurationSec());
+	}
+
+	CleanupBotSocket();
+	return 0;
+}
\ No newline at end of file
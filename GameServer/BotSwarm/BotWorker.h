@@ -0,0 +1,163 @@
+#pragma once
+
+#include "BotSession.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+
+const int BOT_POLL_TIMEOUT_MS = 5;	//ൿ  ð    Ų.
+
+//  ϳ.    poll ٸ ְް,  踦  .
+//  GetStats() 踦   Ѵ.
+class BotWorker
+{
+public:
+	void Init(const BotConfig* pConfig_)
+	{
+		mpConfig = pConfig_;
+		mPhaseStats.resize(pConfig_->Phases.size());
+		mScratchBuffer = std::make_unique<char[]>(PACKET_DECOMPRESS_BUFFER_SIZE);
+	}
+
+	void AddBot(const UINT32 botIndex_, const UINT64 firstConnectUs_)
+	{
+		mBots.emplace_back();
+		mBots.back().Init(botIndex_, mpConfig, firstConnectUs_);
+	}
+
+	void Start(const UINT64 startUs_)
+	{
+		mStartUs = startUs_;
+		mIsRunning = true;
+		mThread = std::thread([this]() { Run(); });
+	}
+
+	void End()
+	{
+		mIsRunning = false;
+		if (mThread.joinable())
+		{
+			mThread.join();
+		}
+
+		auto nowUs = GetBotNowUs();
+		for (auto& bot : mBots)
+		{
+			bot.Close(nowUs, 0);
+		}
+	}
+
+	//phaseIndex_  踦 pStats_ Ѵ.
+	void GetStats(const UINT32 phaseIndex_, stBotStats* pStats_)
+	{
+		std::lock_guard<std::mutex> guard(mLock);
+		pStats_->Merge(mPhaseStats[phaseIndex_]);
+	}
+
+	//濡 (enter_room=0̸ αؼ) ൿϰ ִ  
+	UINT32 GetActiveBotCount() const { return mActiveBotCount.load(std::memory_order_relaxed); }
+
+private:
+	void Run()
+	{
+		std::vector<BOT_POLLFD> pollFds;
+		std::vector<UINT32> pollBots;
+		pollFds.reserve(mBots.size());
+		pollBots.reserve(mBots.size());
+
+		while (mIsRunning)
+		{
+			pollFds.clear();
+			pollBots.clear();
+			for (UINT32 i = 0; i < (UINT32)mBots.size(); ++i)
+			{
+				auto& bot = mBots[i];
+				if (bot.GetSocket() == INVALID_SOCKET)
+				{
+					continue;
+				}
+
+				BOT_POLLFD pollFd;
+				pollFd.fd = bot.GetSocket();
+				pollFd.events = (short)(POLLIN | (bot.IsWantWrite() ? POLLOUT : 0));
+				pollFd.revents = 0;
+				pollFds.push_back(pollFd);
+				pollBots.push_back(i);
+			}
+
+			if (pollFds.empty())
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(BOT_POLL_TIMEOUT_MS));
+			}
+			else if (PollBotSockets(pollFds.data(), (UINT32)pollFds.size(), BOT_POLL_TIMEOUT_MS) < 0)
+			{
+				printf("[] poll()  : %d\n", GetBotSocketError());
+				std::this_thread::sleep_for(std::chrono::milliseconds(BOT_POLL_TIMEOUT_MS));
+				continue;
+			}
+
+			auto nowUs = GetBotNowUs();
+			auto phaseIndex = mpConfig->GetPhaseIndex((double)(nowUs - mStartUs) / 1000000.0);
+
+			std::lock_guard<std::mutex> guard(mLock);
+			auto pStats = &mPhaseStats[phaseIndex];
+
+			for (UINT32 i = 0; i < (UINT32)pollFds.size(); ++i)
+			{
+				auto& pollFd = pollFds[i];
+				auto& bot = mBots[pollBots[i]];
+
+				//տ ó    ȣ ٸ  ٽ ޾  ִ.
+				if (pollFd.revents == 0 || bot.GetSocket() != pollFd.fd)
+				{
+					continue;
+				}
+
+				//connect() д 쿡   ƴ϶ POLLERRθ ˷ش.
+				if (bot.GetState() == BOT_STATE::CONNECTING)
+				{
+					bot.OnWritable(nowUs, pStats);
+					continue;
+				}
+
+				if (pollFd.revents & POLLOUT)
+				{
+					bot.OnWritable(nowUs, pStats);
+				}
+
+				if ((pollFd.revents & (POLLIN | POLLERR | POLLHUP)) && bot.GetSocket() == pollFd.fd)
+				{
+					bot.OnReadable(nowUs, pStats, mScratchBuffer.get());
+				}
+			}
+
+			UINT32 activeBotCount = 0;
+			for (auto& bot : mBots)
+			{
+				bot.Update(nowUs, phaseIndex, pStats);
+
+				auto state = bot.GetState();
+				if (state == BOT_STATE::PLAY || (state == BOT_STATE::LOBBY && mpConfig->IsEnterRoom == false))
+				{
+					++activeBotCount;
+				}
+			}
+			mActiveBotCount.store(activeBotCount, std::memory_order_relaxed);
+		}
+	}
+
+	const BotConfig* mpConfig = nullptr;
+	std::vector<BotSession> mBots;
+	std::unique_ptr<char[]> mScratchBuffer;	// Ŷ Ǯ 
+
+	UINT64 mStartUs = 0;
+	std::atomic<bool> mIsRunning = false;
+	std::thread mThread;
+
+	std::mutex mLock;
+	std::vector<stBotStats> mPhaseStats;
+	std::atomic<UINT32> mActiveBotCount = 0;
+};
\ No newline at end of file
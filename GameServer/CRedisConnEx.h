@@ -42,33 +42,54 @@ namespace RedisCpp
 				freeReplyObject(reply);
 				return false;
 			}
+
+			freeReplyObject(reply);
+			return true;
 		}
 
-		void subscribe(std::string& message/*output*/)
+		//ȯ :  ų shutdownSocket()  false
+		bool subscribe(std::string& message/*output*/)
 		{
 			redisReply* reply = NULL;
 			freeReplyObject(reply);
 
-			if (redisGetReply(_getCtx(), (void**)&reply) ==  REDIS_OK)
+			if (redisGetReply(_getCtx(), (void**)&reply) != REDIS_OK)
 			{
-				std::string channelName;
-				// 0: "message"
-				// 1: [channel name]
-				// 2: [message string]
-				for (int i = 0; i < reply->elements; i++) {
-					if (i == 1)
-					{
-						channelName = reply->element[i]->str;
-					}
-					else if (i == 2)
-					{
-						message = reply->element[i]->str;
-						printf("[Redis Subscribe] (%s) : %s\n", channelName.c_str(), message.c_str());
-					}
+				return false;
+			}
+
+			std::string channelName;
+			// 0: "message"
+			// 1: [channel name]
+			// 2: [message string]
+			for (int i = 0; i < reply->elements; i++) {
+				if (i == 1)
+				{
+					channelName = reply->element[i]->str;
+				}
+				else if (i == 2)
+				{
+					message = reply->element[i]->str;
+					printf("[Redis Subscribe] (%s) : %s\n", channelName.c_str(), message.c_str());
 				}
 			}
 
 			freeReplyObject(reply);
+			return true;
+		}
+
+		//ٸ 尡 subscribe() ٸ  .   尡   disConnect() ݾƾ Ѵ.
+		void shutdownSocket()
+		{
+			if (_getCtx() == NULL)
+			{
+				return;
+			}
+#ifdef _WIN32
+			shutdown(_getCtx()->fd, SD_BOTH);
+#else
+			shutdown(_getCtx()->fd, SHUT_RDWR);
+#endif
 		}
     };
 
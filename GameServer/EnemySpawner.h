@@ -1,5 +1,6 @@
 #pragma once
 #include "Enemy.h"
+#include "ServerNetwork/AsyncLogger.h"
 
 class EnemySpawner
 {
@@ -21,7 +22,7 @@ public:
     {
         if (mCurrentEnemy != nullptr)
         {
-            printf("[Spawner %lld] Already has an enemy!\n", mSpawnerID);
+            ALOG_WARN("[Spawner %lld] Already has an enemy!\n", mSpawnerID);
             return nullptr;
         }
 
@@ -30,7 +31,7 @@ public:
         mCurrentEnemy = enemy;
         mIsWaitingRespawn = false;
 
-        printf("[Spawner %lld] Spawned enemy %lld (Type:%d) at (%.1f, %.1f, %.1f)\n",
+        ALOG_DEBUG("[Spawner %lld] Spawned enemy %lld (Type:%d) at (%.1f, %.1f, %.1f)\n",
             mSpawnerID, enemyID, (int)mEnemyType,
             mSpawnPosition.x, mSpawnPosition.y, mSpawnPosition.z);
 
@@ -44,7 +45,7 @@ public:
         mIsWaitingRespawn = true;
         mRespawnTimer = mRespawnTime;
 
-        printf("[Spawner %lld] Enemy died. Respawning in %.1f seconds...\n",
+        ALOG_DEBUG("[Spawner %lld] Enemy died. Respawning in %.1f seconds...\n",
             mSpawnerID, mRespawnTime);
     }
 
@@ -28,6 +28,8 @@ enum class ERROR_CODE : unsigned short
 
 	CHAT_ROOM_INVALID_ROOM_NUMBER = 81,
 
+	UDP_BIND_INVALID_TOKEN = 91,
+
 	// Inventory
 	INVENTORY_FULL = 401,
 	ITEM_NOT_FOUND = 402,
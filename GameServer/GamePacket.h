@@ -0,0 +1,812 @@
+//GamePacket.pdl packetgen  ̴.  ġ  GamePacket.pdl ģ  packet_codegen Ÿ ٽ .
+#pragma once
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include "ServerNetwork/LinuxDefine.h"
+#endif
+#include "unity.h"
+
+#include <stddef.h>
+#include <string.h>
+#include <algorithm>
+#include <string_view>
+
+//ʵ ġ ˻(offsetof) PACKET_HEADER  ü .  ̶ ġ  ִ.
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winvalid-offsetof"
+#endif
+
+const INT32 MAX_USER_ID_LEN = 32;
+const INT32 MAX_USER_PW_LEN = 32;
+const INT32 MAX_CHAT_MSG_SIZE = 256;
+const INT32 MAX_QUEST_TITLE_LEN = 32;
+const INT32 MAX_QUEST_DESC_LEN = 64;
+const UINT32 MAX_INVENTORY_SIZE = 40;	// κ丮 ִ 
+
+enum class ITEM_TYPE : UINT16
+{
+	NONE = 0,
+	WEAPON = 1,	// 
+	ARMOR = 2,	// 
+	POTION = 3,	// 
+	MATERIAL = 4,	// 
+	QUEST = 5,	// Ʈ 
+};
+
+enum class QUEST_STATE : UINT8
+{
+	NOT_ACCEPTED = 0,
+	IN_PROGRESS = 1,
+	COMPLETED = 2,	// Ϸ ư ()
+};
+
+enum class PACKET_ID : UINT16
+{
+	//SYSTEM
+	SYS_USER_CONNECT = 11,
+	SYS_USER_DISCONNECT = 12,
+	SYS_RATE_LIMITED = 13,	// ӵ   Ŷ. I/O 尡      ٲ㼭  尡 ǳʶٰ Ѵ.
+	SYS_ROOM_ENTER = 14,	//   ->  Ŀ.  stRoomEnterInfo
+	SYS_ROOM_LEAVE = 15,	//   ->  Ŀ.  
+	SYS_ROOM_NOTICE = 16,	//   ->  Ŀ.   ü  Ŷ
+	SYS_ROOM_LEFT = 17,	//  Ŀ ->  .  stRoomLeftInfo
+	SYS_END = 30,
+
+	//DB
+	DB_END = 199,
+
+	LOGIN_REQUEST = 201,
+	LOGIN_RESPONSE = 202,
+
+	HEARTBEAT_PING = 203,	//  .     Ȯϰ RTT .
+	HEARTBEAT_PONG = 204,	//   ð ״ ش.
+
+	UDP_TOKEN_NOTIFY = 210,	// αϸ TCP . Ŭ̾Ʈ  ū UDP ּҸ ǿ ´.
+	UDP_BIND_REQUEST = 211,	// UDP ޴´.
+	UDP_BIND_RESPONSE = 212,	// UDP .   Ŭ̾Ʈ û ٽ .
+	UDP_RELIABLE_SEGMENT = 213,	// ŷڼ UDP ׸Ʈ.  Ŷ ư ִ. (ServerNetwork/ReliableUdp.h)
+
+	ROOM_ENTER_REQUEST = 206,
+	ROOM_ENTER_RESPONSE = 207,
+	ROOM_NEW_USER_NTF = 208,	// ϴ Ե 
+	ROOM_USER_INFO_NTF = 209,	// Zone ִ   (ϴ Ը )
+
+	ROOM_LEAVE_REQUEST = 215,
+	ROOM_LEAVE_RESPONSE = 216,
+	ROOM_LEAVE_USER_NTF = 217,
+
+	PLAYER_MOVEMENT = 218,
+	UPDATE_PLAYER_MOVEMENT = 219,
+
+	ROOM_CHAT_REQUEST = 221,
+	ROOM_CHAT_RESPONSE = 222,
+	ROOM_CHAT_NOTIFY = 223,
+
+	MOVE_PATH_REQUEST = 225,
+	MOVE_PATH_RESPONSE = 226,
+	MOVE_PATH_NOTIFY = 227,
+
+	INVENTORY_INFO_REQUEST = 301,	// κ丮  û
+	INVENTORY_INFO_RESPONSE = 302,	// κ丮  
+	ITEM_ADD_REQUEST = 303,	//  ߰ û
+	ITEM_ADD_RESPONSE = 304,	//  ߰ 
+	ITEM_ADD_NOTIFY = 305,	//  ߰ ˸ (ٸ )
+	ITEM_USE_REQUEST = 306,	//   û
+	ITEM_USE_RESPONSE = 307,	//   
+	ITEM_DROP_REQUEST = 308,	//   û
+	ITEM_DROP_RESPONSE = 309,	//   
+	ITEM_MOVE_REQUEST = 310,	//  ̵ ( )
+	ITEM_MOVE_RESPONSE = 311,	//  ̵ 
+
+	PLAYER_ATTACK_REQUEST = 401,	// ÷̾  û
+	PLAYER_ATTACK_RESPONSE = 402,	// ÷̾  
+	HIT_REPORT = 404,
+	ENEMY_SPAWN_NOTIFY = 421,	//   ˸
+	ENEMY_DESPAWN_NOTIFY = 422,	//   ˸
+	ENEMY_PATROL_UPDATE = 423,	//  Ʈ Ʈ
+	ENEMY_DAMAGE_NOTIFY = 424,
+	ENEMY_DEATH_NOTIFY = 425,	//   ˸
+
+	QUEST_TALK_REQUEST = 501,
+	QUEST_TALK_RESPONSE = 502,
+	QUEST_ACCEPT_REQUEST = 503,
+	QUEST_ACCEPT_RESPONSE = 504,
+	QUEST_PROGRESS_NOTIFY = 505,
+	QUEST_COMPLETE_REQUEST = 506,
+	QUEST_COMPLETE_RESPONSE = 507,
+};
+
+#pragma pack(push,1)
+struct PACKET_HEADER
+{
+	const UINT16 PacketLength;
+	const UINT16 PacketId;
+	const UINT8 Type = 0; //࿩ ȣȭ  Ӽ ˾Ƴ 
+	PACKET_HEADER(UINT16 PacketLength, PACKET_ID PacketId, UINT8 Type = 0) : PacketLength{ PacketLength }, PacketId{ (UINT16)PacketId }, Type{ Type }
+	{
+	}
+};
+const UINT32 PACKET_HEADER_LENGTH = sizeof(PACKET_HEADER);
+static_assert(sizeof(PACKET_HEADER) == 5, "GamePacket.pdl: PACKET_HEADER");
+
+//var ڿ ʵ带  ũ ȿ д´.  ڰ  capacity_ - 1 ڸ  ʴ´.
+inline std::string_view ReadPacketString(const char* pPacket_, const UINT16 packetSize_, const size_t offset_, const size_t capacity_)
+{
+	if (packetSize_ <= offset_)
+	{
+		return std::string_view();
+	}
+
+	auto maxLen = std::min<size_t>(packetSize_ - offset_, capacity_ - 1);
+	return std::string_view(pPacket_ + offset_, strnlen(pPacket_ + offset_, maxLen));
+}
+
+//var 迭 ʵ   ũ ȿ   ִ  
+inline UINT16 GetPacketArrayCount(const UINT16 packetSize_, const size_t offset_, const size_t elementSize_, const size_t capacity_)
+{
+	if (packetSize_ <= offset_)
+	{
+		return 0;
+	}
+
+	return (UINT16)std::min<size_t>((packetSize_ - offset_) / elementSize_, capacity_);
+}
+
+struct Item
+{
+	UINT32 itemID = 0;	//   ID
+	ITEM_TYPE itemType = {};	//  Ÿ
+	UINT16 quantity = 0;	// 
+	char itemName[32] = { 0, };	//  ̸
+};
+static_assert(sizeof(Item) == 40, "GamePacket.pdl: Item");
+static_assert(offsetof(Item, itemID) == 0, "GamePacket.pdl: Item::itemID");
+static_assert(offsetof(Item, itemType) == 4, "GamePacket.pdl: Item::itemType");
+static_assert(offsetof(Item, quantity) == 6, "GamePacket.pdl: Item::quantity");
+static_assert(offsetof(Item, itemName) == 8, "GamePacket.pdl: Item::itemName");
+
+//- α û
+struct LOGIN_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 71;
+
+	char userID[MAX_USER_ID_LEN + 1] = { 0, };
+	char userPW[MAX_USER_PW_LEN + 1] = { 0, };
+
+	LOGIN_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::LOGIN_REQUEST) {}
+};
+static_assert(sizeof(LOGIN_REQUEST_PACKET) == 71, "GamePacket.pdl: LOGIN_REQUEST_PACKET");
+static_assert(offsetof(LOGIN_REQUEST_PACKET, userID) == 5, "GamePacket.pdl: LOGIN_REQUEST_PACKET::userID");
+static_assert(offsetof(LOGIN_REQUEST_PACKET, userPW) == 38, "GamePacket.pdl: LOGIN_REQUEST_PACKET::userPW");
+
+struct LOGIN_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 7;
+
+	UINT16 Result = 0;
+
+	LOGIN_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::LOGIN_RESPONSE) {}
+};
+static_assert(sizeof(LOGIN_RESPONSE_PACKET) == 7, "GamePacket.pdl: LOGIN_RESPONSE_PACKET");
+static_assert(offsetof(LOGIN_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: LOGIN_RESPONSE_PACKET::Result");
+
+//- ƮƮ. PingTimeMs  ð̶ Ŭ̾Ʈ ؼ ʰ ֱ⸸ Ѵ.
+struct HEARTBEAT_PING_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 13;
+
+	UINT64 PingTimeMs = 0;
+
+	HEARTBEAT_PING_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::HEARTBEAT_PING) {}
+};
+static_assert(sizeof(HEARTBEAT_PING_PACKET) == 13, "GamePacket.pdl: HEARTBEAT_PING_PACKET");
+static_assert(offsetof(HEARTBEAT_PING_PACKET, PingTimeMs) == 5, "GamePacket.pdl: HEARTBEAT_PING_PACKET::PingTimeMs");
+
+//   ð ״ ش.
+struct HEARTBEAT_PONG_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 13;
+
+	UINT64 PingTimeMs = 0;
+
+	HEARTBEAT_PONG_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::HEARTBEAT_PONG) {}
+};
+static_assert(sizeof(HEARTBEAT_PONG_PACKET) == 13, "GamePacket.pdl: HEARTBEAT_PONG_PACKET");
+static_assert(offsetof(HEARTBEAT_PONG_PACKET, PingTimeMs) == 5, "GamePacket.pdl: HEARTBEAT_PONG_PACKET::PingTimeMs");
+
+//- UDP ä. Ҿ  Ŷ  ̵/ġ Ŷ UDP ְް  TCP .
+//UDP Ŷ ϳ  Ŷ ϳ ´.
+struct UDP_TOKEN_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 15;
+
+	UINT64 Token = 0;
+	UINT16 UdpPort = 0;
+
+	UDP_TOKEN_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::UDP_TOKEN_NOTIFY) {}
+};
+static_assert(sizeof(UDP_TOKEN_NOTIFY_PACKET) == 15, "GamePacket.pdl: UDP_TOKEN_NOTIFY_PACKET");
+static_assert(offsetof(UDP_TOKEN_NOTIFY_PACKET, Token) == 5, "GamePacket.pdl: UDP_TOKEN_NOTIFY_PACKET::Token");
+static_assert(offsetof(UDP_TOKEN_NOTIFY_PACKET, UdpPort) == 13, "GamePacket.pdl: UDP_TOKEN_NOTIFY_PACKET::UdpPort");
+
+// UDP ޴´.
+struct UDP_BIND_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 14;
+
+	UINT64 Token = 0;
+	UINT8 IsReliable = 0;	// 1̸ ŷڼ UDP  Ŷ ְ޴´. 0̸ ̵/ġ Ŷ UDP ְ޴´.
+
+	UDP_BIND_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::UDP_BIND_REQUEST) {}
+};
+static_assert(sizeof(UDP_BIND_REQUEST_PACKET) == 14, "GamePacket.pdl: UDP_BIND_REQUEST_PACKET");
+static_assert(offsetof(UDP_BIND_REQUEST_PACKET, Token) == 5, "GamePacket.pdl: UDP_BIND_REQUEST_PACKET::Token");
+static_assert(offsetof(UDP_BIND_REQUEST_PACKET, IsReliable) == 13, "GamePacket.pdl: UDP_BIND_REQUEST_PACKET::IsReliable");
+
+// UDP .   Ŭ̾Ʈ û ٽ .
+struct UDP_BIND_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 8;
+
+	UINT16 Result = 0;
+	UINT8 IsReliable = 0;	//  ŷڼ UDP ߴ.
+
+	UDP_BIND_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::UDP_BIND_RESPONSE) {}
+};
+static_assert(sizeof(UDP_BIND_RESPONSE_PACKET) == 8, "GamePacket.pdl: UDP_BIND_RESPONSE_PACKET");
+static_assert(offsetof(UDP_BIND_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: UDP_BIND_RESPONSE_PACKET::Result");
+static_assert(offsetof(UDP_BIND_RESPONSE_PACKET, IsReliable) == 7, "GamePacket.pdl: UDP_BIND_RESPONSE_PACKET::IsReliable");
+
+//- 뿡  û
+struct ROOM_ENTER_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 9;
+
+	INT32 RoomNumber = 0;
+
+	ROOM_ENTER_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_ENTER_REQUEST) {}
+};
+static_assert(sizeof(ROOM_ENTER_REQUEST_PACKET) == 9, "GamePacket.pdl: ROOM_ENTER_REQUEST_PACKET");
+static_assert(offsetof(ROOM_ENTER_REQUEST_PACKET, RoomNumber) == 5, "GamePacket.pdl: ROOM_ENTER_REQUEST_PACKET::RoomNumber");
+
+struct ROOM_ENTER_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 7;
+
+	INT16 Result = 0;
+
+	ROOM_ENTER_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_ENTER_RESPONSE) {}
+};
+static_assert(sizeof(ROOM_ENTER_RESPONSE_PACKET) == 7, "GamePacket.pdl: ROOM_ENTER_RESPONSE_PACKET");
+static_assert(offsetof(ROOM_ENTER_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: ROOM_ENTER_RESPONSE_PACKET::Result");
+
+// ϴ Ե 
+struct ROOM_NEW_USER_NTF_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 74;
+
+	INT64 userUUID = 0;
+	char userID[MAX_USER_ID_LEN + 1] = { 0, };
+	Vector3 position = {};
+	Quaternion rotation = {};
+
+	ROOM_NEW_USER_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_NEW_USER_NTF) {}
+};
+static_assert(sizeof(ROOM_NEW_USER_NTF_PACKET) == 74, "GamePacket.pdl: ROOM_NEW_USER_NTF_PACKET");
+static_assert(offsetof(ROOM_NEW_USER_NTF_PACKET, userUUID) == 5, "GamePacket.pdl: ROOM_NEW_USER_NTF_PACKET::userUUID");
+static_assert(offsetof(ROOM_NEW_USER_NTF_PACKET, userID) == 13, "GamePacket.pdl: ROOM_NEW_USER_NTF_PACKET::userID");
+static_assert(offsetof(ROOM_NEW_USER_NTF_PACKET, position) == 46, "GamePacket.pdl: ROOM_NEW_USER_NTF_PACKET::position");
+static_assert(offsetof(ROOM_NEW_USER_NTF_PACKET, rotation) == 58, "GamePacket.pdl: ROOM_NEW_USER_NTF_PACKET::rotation");
+
+// Zone ִ   (ϴ Ը )
+struct ROOM_USER_INFO_NTF_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 74;
+
+	INT64 userUUID = 0;
+	char userID[MAX_USER_ID_LEN + 1] = { 0, };
+	Vector3 position = {};
+	Quaternion rotation = {};
+
+	ROOM_USER_INFO_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_USER_INFO_NTF) {}
+};
+static_assert(sizeof(ROOM_USER_INFO_NTF_PACKET) == 74, "GamePacket.pdl: ROOM_USER_INFO_NTF_PACKET");
+static_assert(offsetof(ROOM_USER_INFO_NTF_PACKET, userUUID) == 5, "GamePacket.pdl: ROOM_USER_INFO_NTF_PACKET::userUUID");
+static_assert(offsetof(ROOM_USER_INFO_NTF_PACKET, userID) == 13, "GamePacket.pdl: ROOM_USER_INFO_NTF_PACKET::userID");
+static_assert(offsetof(ROOM_USER_INFO_NTF_PACKET, position) == 46, "GamePacket.pdl: ROOM_USER_INFO_NTF_PACKET::position");
+static_assert(offsetof(ROOM_USER_INFO_NTF_PACKET, rotation) == 58, "GamePacket.pdl: ROOM_USER_INFO_NTF_PACKET::rotation");
+
+//-   û
+struct ROOM_LEAVE_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 5;
+	ROOM_LEAVE_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_REQUEST) {}
+};
+static_assert(sizeof(ROOM_LEAVE_REQUEST_PACKET) == 5, "GamePacket.pdl: ROOM_LEAVE_REQUEST_PACKET");
+
+struct ROOM_LEAVE_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 7;
+
+	INT16 Result = 0;
+
+	ROOM_LEAVE_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_RESPONSE) {}
+};
+static_assert(sizeof(ROOM_LEAVE_RESPONSE_PACKET) == 7, "GamePacket.pdl: ROOM_LEAVE_RESPONSE_PACKET");
+static_assert(offsetof(ROOM_LEAVE_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: ROOM_LEAVE_RESPONSE_PACKET::Result");
+
+struct ROOM_LEAVE_USER_NTF_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 46;
+
+	INT64 userUUID = 0;
+	char userID[MAX_USER_ID_LEN + 1] = { 0, };
+
+	ROOM_LEAVE_USER_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_USER_NTF) {}
+};
+static_assert(sizeof(ROOM_LEAVE_USER_NTF_PACKET) == 46, "GamePacket.pdl: ROOM_LEAVE_USER_NTF_PACKET");
+static_assert(offsetof(ROOM_LEAVE_USER_NTF_PACKET, userUUID) == 5, "GamePacket.pdl: ROOM_LEAVE_USER_NTF_PACKET::userUUID");
+static_assert(offsetof(ROOM_LEAVE_USER_NTF_PACKET, userID) == 13, "GamePacket.pdl: ROOM_LEAVE_USER_NTF_PACKET::userID");
+
+//- ̵
+struct PLAYER_MOVEMENT_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 37;
+
+	INT64 userUUID = 0;
+	float dx = {};
+	float dy = {};
+	Quaternion rotation = {};
+
+	PLAYER_MOVEMENT_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_MOVEMENT) {}
+};
+static_assert(sizeof(PLAYER_MOVEMENT_PACKET) == 37, "GamePacket.pdl: PLAYER_MOVEMENT_PACKET");
+static_assert(offsetof(PLAYER_MOVEMENT_PACKET, userUUID) == 5, "GamePacket.pdl: PLAYER_MOVEMENT_PACKET::userUUID");
+static_assert(offsetof(PLAYER_MOVEMENT_PACKET, dx) == 13, "GamePacket.pdl: PLAYER_MOVEMENT_PACKET::dx");
+static_assert(offsetof(PLAYER_MOVEMENT_PACKET, dy) == 17, "GamePacket.pdl: PLAYER_MOVEMENT_PACKET::dy");
+static_assert(offsetof(PLAYER_MOVEMENT_PACKET, rotation) == 21, "GamePacket.pdl: PLAYER_MOVEMENT_PACKET::rotation");
+
+struct UPDATE_PLAYER_MOVEMENT_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 53;
+
+	INT64 player_id = 0;
+	Vector3 motion = {};	// ̹ ̵
+	Quaternion rotation = {};
+	Vector3 position = {};	//   ġ
+
+	UPDATE_PLAYER_MOVEMENT_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::UPDATE_PLAYER_MOVEMENT) {}
+};
+static_assert(sizeof(UPDATE_PLAYER_MOVEMENT_PACKET) == 53, "GamePacket.pdl: UPDATE_PLAYER_MOVEMENT_PACKET");
+static_assert(offsetof(UPDATE_PLAYER_MOVEMENT_PACKET, player_id) == 5, "GamePacket.pdl: UPDATE_PLAYER_MOVEMENT_PACKET::player_id");
+static_assert(offsetof(UPDATE_PLAYER_MOVEMENT_PACKET, motion) == 13, "GamePacket.pdl: UPDATE_PLAYER_MOVEMENT_PACKET::motion");
+static_assert(offsetof(UPDATE_PLAYER_MOVEMENT_PACKET, rotation) == 25, "GamePacket.pdl: UPDATE_PLAYER_MOVEMENT_PACKET::rotation");
+static_assert(offsetof(UPDATE_PLAYER_MOVEMENT_PACKET, position) == 41, "GamePacket.pdl: UPDATE_PLAYER_MOVEMENT_PACKET::position");
+
+//-  ä
+struct ROOM_CHAT_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 6;	//var ʵ   ̻ ޾ƾ Ѵ.
+
+	char Message[MAX_CHAT_MSG_SIZE + 1] = { 0, };
+
+	ROOM_CHAT_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_REQUEST) {}
+};
+static_assert(sizeof(ROOM_CHAT_REQUEST_PACKET) == 262, "GamePacket.pdl: ROOM_CHAT_REQUEST_PACKET");
+static_assert(offsetof(ROOM_CHAT_REQUEST_PACKET, Message) == 5, "GamePacket.pdl: ROOM_CHAT_REQUEST_PACKET::Message");
+
+//ROOM_CHAT_REQUEST_PACKET  ʰ  ũ ȿ д´.  ۸ Ű⸸ ϹǷ ۺ     ȴ.
+class ROOM_CHAT_REQUEST_VIEW
+{
+public:
+	static constexpr UINT16 MIN_SIZE = ROOM_CHAT_REQUEST_PACKET::MIN_SIZE;
+
+	ROOM_CHAT_REQUEST_VIEW(const char* pPacket_, const UINT16 packetSize_) : mpPacket(pPacket_), mPacketSize(packetSize_)
+	{
+	}
+
+	UINT16 GetPacketSize() const { return mPacketSize; }
+
+	std::string_view Message() const { return ReadPacketString(mpPacket, mPacketSize, offsetof(ROOM_CHAT_REQUEST_PACKET, Message), sizeof(ROOM_CHAT_REQUEST_PACKET::Message)); }
+
+private:
+	const ROOM_CHAT_REQUEST_PACKET& Get() const { return *reinterpret_cast<const ROOM_CHAT_REQUEST_PACKET*>(mpPacket); }
+
+	const char* mpPacket = nullptr;
+	UINT16 mPacketSize = 0;
+};
+
+struct ROOM_CHAT_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 7;
+
+	INT16 Result = 0;
+
+	ROOM_CHAT_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_RESPONSE) {}
+};
+static_assert(sizeof(ROOM_CHAT_RESPONSE_PACKET) == 7, "GamePacket.pdl: ROOM_CHAT_RESPONSE_PACKET");
+static_assert(offsetof(ROOM_CHAT_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: ROOM_CHAT_RESPONSE_PACKET::Result");
+
+struct ROOM_CHAT_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 295;
+
+	char userID[MAX_USER_ID_LEN + 1] = { 0, };
+	char Msg[MAX_CHAT_MSG_SIZE + 1] = { 0, };
+
+	ROOM_CHAT_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_NOTIFY) {}
+};
+static_assert(sizeof(ROOM_CHAT_NOTIFY_PACKET) == 295, "GamePacket.pdl: ROOM_CHAT_NOTIFY_PACKET");
+static_assert(offsetof(ROOM_CHAT_NOTIFY_PACKET, userID) == 5, "GamePacket.pdl: ROOM_CHAT_NOTIFY_PACKET::userID");
+static_assert(offsetof(ROOM_CHAT_NOTIFY_PACKET, Msg) == 38, "GamePacket.pdl: ROOM_CHAT_NOTIFY_PACKET::Msg");
+
+//- ã
+struct MOVE_PATH_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 37;
+
+	INT64 userUUID = 0;
+	Vector3 startPos = {};
+	Vector3 endPos = {};
+
+	MOVE_PATH_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::MOVE_PATH_REQUEST) {}
+};
+static_assert(sizeof(MOVE_PATH_REQUEST_PACKET) == 37, "GamePacket.pdl: MOVE_PATH_REQUEST_PACKET");
+static_assert(offsetof(MOVE_PATH_REQUEST_PACKET, userUUID) == 5, "GamePacket.pdl: MOVE_PATH_REQUEST_PACKET::userUUID");
+static_assert(offsetof(MOVE_PATH_REQUEST_PACKET, startPos) == 13, "GamePacket.pdl: MOVE_PATH_REQUEST_PACKET::startPos");
+static_assert(offsetof(MOVE_PATH_REQUEST_PACKET, endPos) == 25, "GamePacket.pdl: MOVE_PATH_REQUEST_PACKET::endPos");
+
+struct MOVE_PATH_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 135;
+
+	INT64 userUUID = 0;
+	Vector3 path[10] = {};
+	INT16 pathCount = 0;
+
+	MOVE_PATH_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::MOVE_PATH_RESPONSE) {}
+};
+static_assert(sizeof(MOVE_PATH_RESPONSE_PACKET) == 135, "GamePacket.pdl: MOVE_PATH_RESPONSE_PACKET");
+static_assert(offsetof(MOVE_PATH_RESPONSE_PACKET, userUUID) == 5, "GamePacket.pdl: MOVE_PATH_RESPONSE_PACKET::userUUID");
+static_assert(offsetof(MOVE_PATH_RESPONSE_PACKET, path) == 13, "GamePacket.pdl: MOVE_PATH_RESPONSE_PACKET::path");
+static_assert(offsetof(MOVE_PATH_RESPONSE_PACKET, pathCount) == 133, "GamePacket.pdl: MOVE_PATH_RESPONSE_PACKET::pathCount");
+
+// ================= κ丮 =========================
+struct INVENTORY_INFO_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 5;
+	INVENTORY_INFO_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::INVENTORY_INFO_REQUEST) {}
+};
+static_assert(sizeof(INVENTORY_INFO_REQUEST_PACKET) == 5, "GamePacket.pdl: INVENTORY_INFO_REQUEST_PACKET");
+
+// κ丮  
+struct INVENTORY_INFO_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 1609;
+
+	UINT16 Result = 0;
+	UINT16 itemCount = 0;
+	Item items[MAX_INVENTORY_SIZE] = {};
+
+	INVENTORY_INFO_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::INVENTORY_INFO_RESPONSE) {}
+};
+static_assert(sizeof(INVENTORY_INFO_RESPONSE_PACKET) == 1609, "GamePacket.pdl: INVENTORY_INFO_RESPONSE_PACKET");
+static_assert(offsetof(INVENTORY_INFO_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: INVENTORY_INFO_RESPONSE_PACKET::Result");
+static_assert(offsetof(INVENTORY_INFO_RESPONSE_PACKET, itemCount) == 7, "GamePacket.pdl: INVENTORY_INFO_RESPONSE_PACKET::itemCount");
+static_assert(offsetof(INVENTORY_INFO_RESPONSE_PACKET, items) == 9, "GamePacket.pdl: INVENTORY_INFO_RESPONSE_PACKET::items");
+
+//  ߰ û
+struct ITEM_ADD_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 11;
+
+	UINT32 itemID = 0;
+	UINT16 quantity = 0;
+
+	ITEM_ADD_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_ADD_REQUEST) {}
+};
+static_assert(sizeof(ITEM_ADD_REQUEST_PACKET) == 11, "GamePacket.pdl: ITEM_ADD_REQUEST_PACKET");
+static_assert(offsetof(ITEM_ADD_REQUEST_PACKET, itemID) == 5, "GamePacket.pdl: ITEM_ADD_REQUEST_PACKET::itemID");
+static_assert(offsetof(ITEM_ADD_REQUEST_PACKET, quantity) == 9, "GamePacket.pdl: ITEM_ADD_REQUEST_PACKET::quantity");
+
+//  ߰ 
+struct ITEM_ADD_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 49;
+
+	UINT16 Result = 0;
+	Item addedItem = {};
+	UINT16 slotIndex = 0;	// ߰  ε
+
+	ITEM_ADD_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_ADD_RESPONSE) {}
+};
+static_assert(sizeof(ITEM_ADD_RESPONSE_PACKET) == 49, "GamePacket.pdl: ITEM_ADD_RESPONSE_PACKET");
+static_assert(offsetof(ITEM_ADD_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: ITEM_ADD_RESPONSE_PACKET::Result");
+static_assert(offsetof(ITEM_ADD_RESPONSE_PACKET, addedItem) == 7, "GamePacket.pdl: ITEM_ADD_RESPONSE_PACKET::addedItem");
+static_assert(offsetof(ITEM_ADD_RESPONSE_PACKET, slotIndex) == 47, "GamePacket.pdl: ITEM_ADD_RESPONSE_PACKET::slotIndex");
+
+//   û
+struct ITEM_USE_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 7;
+
+	UINT16 slotIndex = 0;
+
+	ITEM_USE_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_USE_REQUEST) {}
+};
+static_assert(sizeof(ITEM_USE_REQUEST_PACKET) == 7, "GamePacket.pdl: ITEM_USE_REQUEST_PACKET");
+static_assert(offsetof(ITEM_USE_REQUEST_PACKET, slotIndex) == 5, "GamePacket.pdl: ITEM_USE_REQUEST_PACKET::slotIndex");
+
+//   
+struct ITEM_USE_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 11;
+
+	UINT16 Result = 0;
+	UINT16 slotIndex = 0;
+	UINT16 remainingQuantity = 0;
+
+	ITEM_USE_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_USE_RESPONSE) {}
+};
+static_assert(sizeof(ITEM_USE_RESPONSE_PACKET) == 11, "GamePacket.pdl: ITEM_USE_RESPONSE_PACKET");
+static_assert(offsetof(ITEM_USE_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: ITEM_USE_RESPONSE_PACKET::Result");
+static_assert(offsetof(ITEM_USE_RESPONSE_PACKET, slotIndex) == 7, "GamePacket.pdl: ITEM_USE_RESPONSE_PACKET::slotIndex");
+static_assert(offsetof(ITEM_USE_RESPONSE_PACKET, remainingQuantity) == 9, "GamePacket.pdl: ITEM_USE_RESPONSE_PACKET::remainingQuantity");
+
+// ===================== Attack =========================
+struct PLAYER_ATTACK_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 29;
+
+	Vector3 attackPosition = {};
+	Vector3 attackDirection = {};
+
+	PLAYER_ATTACK_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_ATTACK_REQUEST) {}
+};
+static_assert(sizeof(PLAYER_ATTACK_REQUEST_PACKET) == 29, "GamePacket.pdl: PLAYER_ATTACK_REQUEST_PACKET");
+static_assert(offsetof(PLAYER_ATTACK_REQUEST_PACKET, attackPosition) == 5, "GamePacket.pdl: PLAYER_ATTACK_REQUEST_PACKET::attackPosition");
+static_assert(offsetof(PLAYER_ATTACK_REQUEST_PACKET, attackDirection) == 17, "GamePacket.pdl: PLAYER_ATTACK_REQUEST_PACKET::attackDirection");
+
+// ÷̾  
+struct PLAYER_ATTACK_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 19;
+
+	INT16 Result = 0;
+	INT64 targetEnemyID = 0;
+	INT32 damageAmount = 0;
+
+	PLAYER_ATTACK_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_ATTACK_RESPONSE) {}
+};
+static_assert(sizeof(PLAYER_ATTACK_RESPONSE_PACKET) == 19, "GamePacket.pdl: PLAYER_ATTACK_RESPONSE_PACKET");
+static_assert(offsetof(PLAYER_ATTACK_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: PLAYER_ATTACK_RESPONSE_PACKET::Result");
+static_assert(offsetof(PLAYER_ATTACK_RESPONSE_PACKET, targetEnemyID) == 7, "GamePacket.pdl: PLAYER_ATTACK_RESPONSE_PACKET::targetEnemyID");
+static_assert(offsetof(PLAYER_ATTACK_RESPONSE_PACKET, damageAmount) == 15, "GamePacket.pdl: PLAYER_ATTACK_RESPONSE_PACKET::damageAmount");
+
+struct HIT_REPORT_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 33;
+
+	INT64 enemyID = 0;
+	INT32 damage = 0;
+	float hitX = {};	// 
+	float hitY = {};
+	float hitZ = {};
+	UINT32 seq = 0;	// 
+
+	HIT_REPORT_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::HIT_REPORT) {}
+};
+static_assert(sizeof(HIT_REPORT_PACKET) == 33, "GamePacket.pdl: HIT_REPORT_PACKET");
+static_assert(offsetof(HIT_REPORT_PACKET, enemyID) == 5, "GamePacket.pdl: HIT_REPORT_PACKET::enemyID");
+static_assert(offsetof(HIT_REPORT_PACKET, damage) == 13, "GamePacket.pdl: HIT_REPORT_PACKET::damage");
+static_assert(offsetof(HIT_REPORT_PACKET, hitX) == 17, "GamePacket.pdl: HIT_REPORT_PACKET::hitX");
+static_assert(offsetof(HIT_REPORT_PACKET, hitY) == 21, "GamePacket.pdl: HIT_REPORT_PACKET::hitY");
+static_assert(offsetof(HIT_REPORT_PACKET, hitZ) == 25, "GamePacket.pdl: HIT_REPORT_PACKET::hitZ");
+static_assert(offsetof(HIT_REPORT_PACKET, seq) == 29, "GamePacket.pdl: HIT_REPORT_PACKET::seq");
+
+//   ˸
+struct ENEMY_SPAWN_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 53;
+
+	INT64 enemyID = 0;
+	INT32 enemyType = 0;
+	Vector3 position = {};
+	Quaternion rotation = {};
+	INT32 maxHealth = 0;
+	INT32 currentHealth = 0;
+
+	ENEMY_SPAWN_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_SPAWN_NOTIFY) {}
+};
+static_assert(sizeof(ENEMY_SPAWN_NOTIFY_PACKET) == 53, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, enemyID) == 5, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::enemyID");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, enemyType) == 13, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::enemyType");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, position) == 17, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::position");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, rotation) == 29, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::rotation");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, maxHealth) == 45, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::maxHealth");
+static_assert(offsetof(ENEMY_SPAWN_NOTIFY_PACKET, currentHealth) == 49, "GamePacket.pdl: ENEMY_SPAWN_NOTIFY_PACKET::currentHealth");
+
+//   ˸
+struct ENEMY_DESPAWN_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 13;
+
+	INT64 enemyID = 0;
+
+	ENEMY_DESPAWN_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DESPAWN_NOTIFY) {}
+};
+static_assert(sizeof(ENEMY_DESPAWN_NOTIFY_PACKET) == 13, "GamePacket.pdl: ENEMY_DESPAWN_NOTIFY_PACKET");
+static_assert(offsetof(ENEMY_DESPAWN_NOTIFY_PACKET, enemyID) == 5, "GamePacket.pdl: ENEMY_DESPAWN_NOTIFY_PACKET::enemyID");
+
+//  Ʈ Ʈ
+struct ENEMY_PATROL_UPDATE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 53;
+
+	INT64 enemyID = 0;
+	Vector3 position = {};
+	Quaternion rotation = {};
+	Vector3 velocity = {};
+
+	ENEMY_PATROL_UPDATE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_PATROL_UPDATE) {}
+};
+static_assert(sizeof(ENEMY_PATROL_UPDATE_PACKET) == 53, "GamePacket.pdl: ENEMY_PATROL_UPDATE_PACKET");
+static_assert(offsetof(ENEMY_PATROL_UPDATE_PACKET, enemyID) == 5, "GamePacket.pdl: ENEMY_PATROL_UPDATE_PACKET::enemyID");
+static_assert(offsetof(ENEMY_PATROL_UPDATE_PACKET, position) == 13, "GamePacket.pdl: ENEMY_PATROL_UPDATE_PACKET::position");
+static_assert(offsetof(ENEMY_PATROL_UPDATE_PACKET, rotation) == 25, "GamePacket.pdl: ENEMY_PATROL_UPDATE_PACKET::rotation");
+static_assert(offsetof(ENEMY_PATROL_UPDATE_PACKET, velocity) == 41, "GamePacket.pdl: ENEMY_PATROL_UPDATE_PACKET::velocity");
+
+struct ENEMY_DAMAGE_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 29;
+
+	INT64 enemyID = 0;
+	INT64 attackerID = 0;
+	INT32 damageAmount = 0;
+	INT32 remainingHealth = 0;
+
+	ENEMY_DAMAGE_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DAMAGE_NOTIFY) {}
+};
+static_assert(sizeof(ENEMY_DAMAGE_NOTIFY_PACKET) == 29, "GamePacket.pdl: ENEMY_DAMAGE_NOTIFY_PACKET");
+static_assert(offsetof(ENEMY_DAMAGE_NOTIFY_PACKET, enemyID) == 5, "GamePacket.pdl: ENEMY_DAMAGE_NOTIFY_PACKET::enemyID");
+static_assert(offsetof(ENEMY_DAMAGE_NOTIFY_PACKET, attackerID) == 13, "GamePacket.pdl: ENEMY_DAMAGE_NOTIFY_PACKET::attackerID");
+static_assert(offsetof(ENEMY_DAMAGE_NOTIFY_PACKET, damageAmount) == 21, "GamePacket.pdl: ENEMY_DAMAGE_NOTIFY_PACKET::damageAmount");
+static_assert(offsetof(ENEMY_DAMAGE_NOTIFY_PACKET, remainingHealth) == 25, "GamePacket.pdl: ENEMY_DAMAGE_NOTIFY_PACKET::remainingHealth");
+
+//   ˸
+struct ENEMY_DEATH_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 21;
+
+	INT64 enemyID = 0;
+	INT64 killerID = 0;
+
+	ENEMY_DEATH_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DEATH_NOTIFY) {}
+};
+static_assert(sizeof(ENEMY_DEATH_NOTIFY_PACKET) == 21, "GamePacket.pdl: ENEMY_DEATH_NOTIFY_PACKET");
+static_assert(offsetof(ENEMY_DEATH_NOTIFY_PACKET, enemyID) == 5, "GamePacket.pdl: ENEMY_DEATH_NOTIFY_PACKET::enemyID");
+static_assert(offsetof(ENEMY_DEATH_NOTIFY_PACKET, killerID) == 13, "GamePacket.pdl: ENEMY_DEATH_NOTIFY_PACKET::killerID");
+
+// ===================== Quest =========================
+struct QUEST_TALK_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 9;
+
+	INT32 npc_id = 0;
+
+	QUEST_TALK_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_TALK_REQUEST) {}
+};
+static_assert(sizeof(QUEST_TALK_REQUEST_PACKET) == 9, "GamePacket.pdl: QUEST_TALK_REQUEST_PACKET");
+static_assert(offsetof(QUEST_TALK_REQUEST_PACKET, npc_id) == 5, "GamePacket.pdl: QUEST_TALK_REQUEST_PACKET::npc_id");
+
+struct QUEST_TALK_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 120;
+
+	INT32 npc_id = 0;
+	INT32 quest_id = 1;
+	QUEST_STATE state = {};
+	UINT16 current = 0;
+	UINT16 required = 1;
+	char title[MAX_QUEST_TITLE_LEN] = { 0, };
+	char desc[MAX_QUEST_DESC_LEN] = { 0, };
+	UINT32 rewardItemID = 0;
+	UINT16 rewardQty = 0;
+
+	QUEST_TALK_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_TALK_RESPONSE) {}
+};
+static_assert(sizeof(QUEST_TALK_RESPONSE_PACKET) == 120, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, npc_id) == 5, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::npc_id");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, quest_id) == 9, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::quest_id");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, state) == 13, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::state");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, current) == 14, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::current");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, required) == 16, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::required");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, title) == 18, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::title");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, desc) == 50, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::desc");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, rewardItemID) == 114, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::rewardItemID");
+static_assert(offsetof(QUEST_TALK_RESPONSE_PACKET, rewardQty) == 118, "GamePacket.pdl: QUEST_TALK_RESPONSE_PACKET::rewardQty");
+
+struct QUEST_ACCEPT_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 13;
+
+	INT32 npc_id = 0;
+	INT32 quest_id = 1;
+
+	QUEST_ACCEPT_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_ACCEPT_REQUEST) {}
+};
+static_assert(sizeof(QUEST_ACCEPT_REQUEST_PACKET) == 13, "GamePacket.pdl: QUEST_ACCEPT_REQUEST_PACKET");
+static_assert(offsetof(QUEST_ACCEPT_REQUEST_PACKET, npc_id) == 5, "GamePacket.pdl: QUEST_ACCEPT_REQUEST_PACKET::npc_id");
+static_assert(offsetof(QUEST_ACCEPT_REQUEST_PACKET, quest_id) == 9, "GamePacket.pdl: QUEST_ACCEPT_REQUEST_PACKET::quest_id");
+
+struct QUEST_ACCEPT_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 15;
+
+	INT32 quest_id = 1;
+	UINT8 result = 0;	// 1=
+	QUEST_STATE state = {};
+	UINT16 current = 0;
+	UINT16 required = 1;
+
+	QUEST_ACCEPT_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_ACCEPT_RESPONSE) {}
+};
+static_assert(sizeof(QUEST_ACCEPT_RESPONSE_PACKET) == 15, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET");
+static_assert(offsetof(QUEST_ACCEPT_RESPONSE_PACKET, quest_id) == 5, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET::quest_id");
+static_assert(offsetof(QUEST_ACCEPT_RESPONSE_PACKET, result) == 9, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET::result");
+static_assert(offsetof(QUEST_ACCEPT_RESPONSE_PACKET, state) == 10, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET::state");
+static_assert(offsetof(QUEST_ACCEPT_RESPONSE_PACKET, current) == 11, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET::current");
+static_assert(offsetof(QUEST_ACCEPT_RESPONSE_PACKET, required) == 13, "GamePacket.pdl: QUEST_ACCEPT_RESPONSE_PACKET::required");
+
+struct QUEST_PROGRESS_NOTIFY_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 14;
+
+	INT32 quest_id = 0;
+	UINT16 current = 0;
+	UINT16 required = 0;
+	QUEST_STATE state = {};
+
+	QUEST_PROGRESS_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_PROGRESS_NOTIFY) {}
+};
+static_assert(sizeof(QUEST_PROGRESS_NOTIFY_PACKET) == 14, "GamePacket.pdl: QUEST_PROGRESS_NOTIFY_PACKET");
+static_assert(offsetof(QUEST_PROGRESS_NOTIFY_PACKET, quest_id) == 5, "GamePacket.pdl: QUEST_PROGRESS_NOTIFY_PACKET::quest_id");
+static_assert(offsetof(QUEST_PROGRESS_NOTIFY_PACKET, current) == 9, "GamePacket.pdl: QUEST_PROGRESS_NOTIFY_PACKET::current");
+static_assert(offsetof(QUEST_PROGRESS_NOTIFY_PACKET, required) == 11, "GamePacket.pdl: QUEST_PROGRESS_NOTIFY_PACKET::required");
+static_assert(offsetof(QUEST_PROGRESS_NOTIFY_PACKET, state) == 13, "GamePacket.pdl: QUEST_PROGRESS_NOTIFY_PACKET::state");
+
+struct QUEST_COMPLETE_REQUEST_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 9;
+
+	INT32 QuestId = 1;
+
+	QUEST_COMPLETE_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_COMPLETE_REQUEST) {}
+};
+static_assert(sizeof(QUEST_COMPLETE_REQUEST_PACKET) == 9, "GamePacket.pdl: QUEST_COMPLETE_REQUEST_PACKET");
+static_assert(offsetof(QUEST_COMPLETE_REQUEST_PACKET, QuestId) == 5, "GamePacket.pdl: QUEST_COMPLETE_REQUEST_PACKET::QuestId");
+
+struct QUEST_COMPLETE_RESPONSE_PACKET : public PACKET_HEADER
+{
+	static constexpr UINT16 MIN_SIZE = 12;
+
+	UINT16 Result = 0;	// 0=,  = ڵ
+	INT32 QuestId = 1;
+	QUEST_STATE State = QUEST_STATE::NOT_ACCEPTED;
+
+	QUEST_COMPLETE_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_COMPLETE_RESPONSE) {}
+};
+static_assert(sizeof(QUEST_COMPLETE_RESPONSE_PACKET) == 12, "GamePacket.pdl: QUEST_COMPLETE_RESPONSE_PACKET");
+static_assert(offsetof(QUEST_COMPLETE_RESPONSE_PACKET, Result) == 5, "GamePacket.pdl: QUEST_COMPLETE_RESPONSE_PACKET::Result");
+static_assert(offsetof(QUEST_COMPLETE_RESPONSE_PACKET, QuestId) == 7, "GamePacket.pdl: QUEST_COMPLETE_RESPONSE_PACKET::QuestId");
+static_assert(offsetof(QUEST_COMPLETE_RESPONSE_PACKET, State) == 11, "GamePacket.pdl: QUEST_COMPLETE_RESPONSE_PACKET::State");
+
+#pragma pack(pop) //  ŷ 
+
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
\ No newline at end of file
@@ -1,8 +1,13 @@
 #pragma once
 
 #include "./ServerNetwork/IOCPServer.h"
+#include "./ServerNetwork/UdpChannel.h"
+#include "./ServerNetwork/ReliableUdp.h"
+#include "./ServerNetwork/AsyncLogger.h"
 #include "PacketManager.h"
+#include "ServerConfig.h"
 #include "Packet.h"
+#include "ErrorCode.h"
 
 #include <vector>
 #include <deque>
@@ -19,55 +24,174 @@ public:
 	virtual ~GameServer() = default;
 	
 
-	virtual void OnConnect(const UINT32 clientIndex_) override 
+	virtual void OnConnect(const UINT32 sessionId_) override 
 	{
-		printf("[OnConnect] Ŭ̾Ʈ: Index(%d)\n", clientIndex_);
+		ALOG_INFO("[OnConnect] Ŭ̾Ʈ: Index(%d) Session(%u)\n", GetSessionIndex(sessionId_), sessionId_);
 
-		PacketInfo packet{ clientIndex_, (UINT16)PACKET_ID::SYS_USER_CONNECT, 0 };
+		PacketInfo packet{ sessionId_, (UINT16)PACKET_ID::SYS_USER_CONNECT, 0 };
 		m_pPacketManager->PushSystemPacket(packet);
 	}
 
-	virtual void OnClose(const UINT32 clientIndex_) override 
+	virtual void OnClose(const UINT32 sessionId_) override 
 	{
-		printf("[OnClose] Ŭ̾Ʈ: Index(%d)\n", clientIndex_);
+		ALOG_INFO("[OnClose] Ŭ̾Ʈ: Index(%d) Session(%u)\n", GetSessionIndex(sessionId_), sessionId_);
 
-		PacketInfo packet{ clientIndex_, (UINT16)PACKET_ID::SYS_USER_DISCONNECT, 0 };
+		mReliableUdp.Close(sessionId_);
+		mUdpChannel.OnClose(sessionId_);
+
+		PacketInfo packet{ sessionId_, (UINT16)PACKET_ID::SYS_USER_DISCONNECT, 0 };
 		m_pPacketManager->PushSystemPacket(packet);
 	}
 
-	virtual void OnReceive(const UINT32 clientIndex_, const UINT32 size_, char* pData_) override  
+	virtual void OnReceive(const UINT32 sessionId_, const UINT32 size_) override  
+	{
+		ALOG_TRACE("[OnReceive] Index(%d), size(%d)\n", GetSessionIndex(sessionId_), size_);
+
+		m_pPacketManager->ReceivePacketData(sessionId_);
+	}
+
+	//ƮƮ 忡 ȣȴ. Ŭ̾Ʈ PingTimeMs  ָ RTT .
+	virtual void OnPing(const UINT32 sessionId_, const UINT64 pingTimeMs_) override
 	{
-		printf("[OnReceive] Index(%d), size(%d)\n", clientIndex_, size_);
+		HEARTBEAT_PING_PACKET pingPacket;
+		pingPacket.PingTimeMs = pingTimeMs_;
+		SendMsg(sessionId_, sizeof(pingPacket), (char*)&pingPacket);
+	}
+
+	//UDP  忡 ȣȴ.  û ⼭ ϰ,   Ŷ   ѱ.
+	//ŷڼ UDP ׸Ʈ ReliableUdp Ǯ  ° ѱ.
+	void OnUdpReceive(const UINT32 sessionId_, const stUdpEndpoint& from_, const UINT32 size_, char* pData_)
+	{
+		if (size_ < PACKET_HEADER_LENGTH)
+		{
+			return;
+		}
 
-		if (size_ >= 5) {
-			auto* h = reinterpret_cast<PACKET_HEADER*>(pData_);
-			printf("[HDR] len=%u id=%u type=%u\n", h->PacketLength, h->PacketId, h->Type);
+		auto pHeader = (PACKET_HEADER*)pData_;
+		if (pHeader->PacketId == (UINT16)PACKET_ID::UDP_BIND_REQUEST)
+		{
+			if (size_ != sizeof(UDP_BIND_REQUEST_PACKET))
+			{
+				return;
+			}
+
+			auto pBindReqPacket = (UDP_BIND_REQUEST_PACKET*)pData_;
+			auto boundSessionId = mUdpChannel.Bind(pBindReqPacket->Token, from_);
+
+			UDP_BIND_RESPONSE_PACKET bindResPacket;
+			bindResPacket.Result = (UINT16)((boundSessionId != 0) ? ERROR_CODE::NONE : ERROR_CODE::UDP_BIND_INVALID_TOKEN);
+			if (boundSessionId != 0)
+			{
+				bindResPacket.IsReliable = (pBindReqPacket->IsReliable != 0 && mIsReliableUdp) ? 1 : 0;
+				if (bindResPacket.IsReliable)
+				{
+					mReliableUdp.Open(boundSessionId);
+				}
+				else
+				{
+					mReliableUdp.Close(boundSessionId);
+				}
+			}
+
+			mUdpChannel.SendToEndpoint(from_, sizeof(bindResPacket), (char*)&bindResPacket);
+			return;
+		}
+
+		if (sessionId_ == 0)
+		{
+			return;
 		}
 
-		m_pPacketManager->ReceivePacketData(clientIndex_, size_, pData_);
+		if (pHeader->PacketId == (UINT16)PACKET_ID::UDP_RELIABLE_SEGMENT)
+		{
+			mReliableUdp.OnReceive(sessionId_, size_, pData_);
+			return;
+		}
+
+		m_pPacketManager->ReceiveUdpPacket(sessionId_, size_, pData_, false);
 	}
 
-	void Run(const UINT32 maxClient)
+	//ŷڼ UDP  ̸  Ŷ Ʈ  , ƴϸ ̵/ġ Ŷ UDP  ǿ .
+	//ȯ : UDP  ʾ false. TCP  Ѵ.
+	bool SendUdp(const UINT32 sessionId_, const UINT32 size_, char* pData_)
 	{
-		auto sendPacketFunc = [&](UINT32 clientIndex_, UINT16 packetSize, char* pSendPacket)
+		auto packetId = ((PACKET_HEADER*)pData_)->PacketId;
+
+		if (mReliableUdp.IsOpen(sessionId_))
 		{
-			SendMsg(clientIndex_, packetSize, pSendPacket);
+			return mReliableUdp.Send(sessionId_, (UINT8)GetUdpStream(packetId), size_, pData_);
+		}
+
+		return IsUnreliablePacket(packetId) && mUdpChannel.SendTo(sessionId_, size_, pData_);
+	}
+
+	void Run(const ServerConfig& config_)
+	{
+		auto sendPacketFunc = [&](UINT32 sessionId_, UINT16 packetSize, char* pSendPacket)
+		{
+			SendMsg(sessionId_, packetSize, pSendPacket);
+		};
+
+		auto sendBroadcastFunc = [&](UINT32 sessionId_, stBroadcastBuffer* pBuffer)
+		{
+			SendMsg(sessionId_, pBuffer);
 		};
 
 		m_pPacketManager = std::make_unique<PacketManager>();
 		m_pPacketManager->SendPacketFunc = sendPacketFunc;
-		m_pPacketManager->Init(maxClient);
+		m_pPacketManager->SendBroadcastFunc = sendBroadcastFunc;
+		m_pPacketManager->GetRecvRingFunc = [&](UINT32 sessionId_) { return GetRecvRing(sessionId_); };
+		m_pPacketManager->ReportPongFunc = [&](UINT32 sessionId_, UINT64 pingTimeMs_) { return ReportPong(sessionId_, pingTimeMs_); };
+		m_pPacketManager->DisconnectFunc = [&](UINT32 sessionId_) { return Disconnect(sessionId_); };
+		m_pPacketManager->IssueUdpTokenFunc = [&](UINT32 sessionId_) { return mUdpChannel.IssueToken(sessionId_); };
+		m_pPacketManager->SendUdpFunc = [&](UINT32 sessionId_, UINT32 size_, char* pData_) { return SendUdp(sessionId_, size_, pData_); };
+		m_pPacketManager->Init(config_);
+
+		//Ʈ ȣ UDP_STREAM .
+		mReliableUdp.SendDatagramFunc = [&](UINT32 sessionId_, UINT32 size_, char* pData_) { return mUdpChannel.SendTo(sessionId_, size_, pData_); };
+		mReliableUdp.DeliverFunc = [&](UINT32 sessionId_, UINT8 stream_, UINT32 size_, char* pData_) { m_pPacketManager->ReceiveUdpPacket(sessionId_, size_, pData_, true); };
+		mReliableUdp.CloseFunc = [&](UINT32 sessionId_) { Disconnect(sessionId_); };
+		mReliableUdp.Init(config_.MaxClient, (UINT16)PACKET_ID::UDP_RELIABLE_SEGMENT,
+			{ RUDP_DELIVERY::UNRELIABLE_SEQUENCED, RUDP_DELIVERY::RELIABLE_UNORDERED, RUDP_DELIVERY::RELIABLE_ORDERED, RUDP_DELIVERY::RELIABLE_ORDERED });
+
+		//UDP  ϸ  Ŷ TCP .
+		mUdpChannel.ReceiveFunc = [&](UINT32 sessionId_, const stUdpEndpoint& from_, UINT32 size_, char* pData_) { OnUdpReceive(sessionId_, from_, size_, pData_); };
+		if (config_.UdpPort != 0 && mUdpChannel.Init(config_.UdpPort, config_.MaxClient))
+		{
+			mIsReliableUdp = config_.IsUdpReliable;
+			if (mIsReliableUdp)
+			{
+				mReliableUdp.Start();
+			}
+
+			mUdpChannel.SetNetworkSimulation(config_.UdpDropPercent, config_.UdpDelayMs, config_.UdpJitterMs);
+			mUdpChannel.Start();
+		}
 
 		if (m_pPacketManager->Run() == false)
 		{
 			printf("[GameServer] PacketManager start failed. Server not started.\n");
 		}
 
-		StartServer(maxClient);
+		ThreadStatMonitor::Instance().Start(config_.ThreadStatIntervalSec);
+		PacketLatencyMonitor::Instance().Start(config_.LatencyIntervalSec, config_.LatencyFile);
+
+		StartServer(config_.MaxClient);
 	}
 
 	void End()
 	{
+		ThreadStatMonitor::Instance().Stop();
+		PacketLatencyMonitor::Instance().Stop();
+
+		mReliableUdp.Stop();
+		mUdpChannel.Stop();
+		mUdpChannel.Print();
+		if (mIsReliableUdp)
+		{
+			mReliableUdp.Print();
+		}
+
 		m_pPacketManager->End();
 		
 		DestroyThread();
@@ -76,4 +200,8 @@ public:
 
 private:	
 	std::unique_ptr<PacketManager> m_pPacketManager;
+
+	UdpChannel mUdpChannel;
+	ReliableUdp mReliableUdp;
+	bool mIsReliableUdp = false;
 };
\ No newline at end of file
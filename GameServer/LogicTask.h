@@ -0,0 +1,19 @@
+#pragma once
+
+#include <coroutine>
+#include <exception>
+
+//  ڵ鷯 ڷƾ   ȯ Ÿ. θ  ٸ ʰ,    ȴ.
+//co_await     ٸ Ŷ óϰ, ٸ    忡 ̾ Ѵ.
+//  Ŷ ù co_await ڿ   Ƿ   ʿ   ־ Ѵ.
+struct LogicTask
+{
+	struct promise_type
+	{
+		LogicTask get_return_object() { return LogicTask(); }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
\ No newline at end of file
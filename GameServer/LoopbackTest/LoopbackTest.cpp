@@ -0,0 +1,870 @@
+#include "TestServer.h"
+#include "TestClient.h"
+#include "TestRudpClient.h"
+#include "../ErrorCode.h"
+#include "../PacketRateLimiter.h"
+#include "../PacketCompressor.h"
+#include "../ServerNetwork/Define.h"
+
+#include <functional>
+#include <map>
+#include <random>
+
+//gameserver    ְ Ȯϴ . ctest    ο  ̸ ѱ.
+// ̸  ڴ  ״ ѱ. 踶 Ʈ  ,   ٸ ڷ  ͳ ctest RESOURCE_LOCK ġ ʰ Ѵ.
+//
+//	loopbacktest <gameserver > frame_split
+//	loopbacktest <gameserver > frame_split --io_uring
+//	loopbacktest <gameserver > udp_loss
+//	loopbacktest <gameserver > reliable_udp
+//	loopbacktest <gameserver > heartbeat
+//	loopbacktest <gameserver > rate_limit
+//	loopbacktest <gameserver > compress
+//	loopbacktest <gameserver > relogin
+
+#define TEST_CHECK(condition_, ...) \
+	if (!(condition_)) \
+	{ \
+		printf("[] %s:%d : ", __FILE__, __LINE__); \
+		printf(__VA_ARGS__); \
+		printf("\n"); \
+		return false; \
+	}
+
+
+//ȯ : αο ϸ true. pUserIndex_     ȣ ´.
+//ϸ Result  ȣ ´.  max_client  ڵ庸 ۰ ֹǷ  ڵ ġ ʴ´.
+bool Login(TestClient* pClient_, const char* pName_, UINT16* pUserIndex_ = nullptr)
+{
+	LOGIN_REQUEST_PACKET loginPacket;
+	snprintf(loginPacket.userID, sizeof(loginPacket.userID), "%s", pName_);
+	snprintf(loginPacket.userPW, sizeof(loginPacket.userPW), "test");
+
+	std::vector<char> packet;
+	if (pClient_->Send(loginPacket) == false || pClient_->WaitPacket(PACKET_ID::LOGIN_RESPONSE, &packet) == false)
+	{
+		return false;
+	}
+
+	auto result = ((LOGIN_RESPONSE_PACKET*)packet.data())->Result;
+	if (pUserIndex_ != nullptr)
+	{
+		*pUserIndex_ = result;
+	}
+	return result < (UINT16)ERROR_CODE::LOGIN_USER_ALREADY;
+}
+
+bool EnterRoom(TestClient* pClient_, const INT32 roomNumber_)
+{
+	ROOM_ENTER_REQUEST_PACKET enterPacket;
+	enterPacket.RoomNumber = roomNumber_;
+
+	std::vector<char> packet;
+	if (pClient_->Send(enterPacket) == false || pClient_->WaitPacket(PACKET_ID::ROOM_ENTER_RESPONSE, &packet) == false)
+	{
+		return false;
+	}
+	return ((ROOM_ENTER_RESPONSE_PACKET*)packet.data())->Result == (INT16)ERROR_CODE::NONE;
+}
+
+
+const UINT16 FRAME_SPLIT_PORT = 11121;
+const UINT32 FRAME_SPLIT_WINDOW = 20;		// ٸ ʰ ̾  ä 
+const UINT32 FRAME_SPLIT_WINDOW_COUNT = 12;
+static_assert(FRAME_SPLIT_WINDOW * sizeof(ROOM_CHAT_REQUEST_PACKET) < RECV_RING_BUFFER_SIZE, "      Ѵ");
+
+//    , ƹ Ʈ ߶ ,  Ʈ ⸦   ޴ ʿ    .
+// ġ     ó        .   ġ ӵ .
+bool TestFrameSplit(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=0", "--rate_limit=0", "--compress_threshold=0", "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, FRAME_SPLIT_PORT, serverArgs_), " ");
+
+	TestClient sender;
+	TestClient receiver;
+	TEST_CHECK(sender.Connect(FRAME_SPLIT_PORT) && receiver.Connect(FRAME_SPLIT_PORT), "");
+	TEST_CHECK(Login(&sender, "split_a") && Login(&receiver, "split_b"), "α");
+	TEST_CHECK(EnterRoom(&sender, 0) && EnterRoom(&receiver, 0), " ");
+
+	std::mt19937 random(24);
+	std::uniform_int_distribution<UINT32> cutSize(1, 300);
+	UINT32 sentBytes = 0;
+
+	for (UINT32 window = 0; window < FRAME_SPLIT_WINDOW_COUNT; ++window)
+	{
+		auto firstSeq = window * FRAME_SPLIT_WINDOW;
+
+		std::vector<char> data;
+		for (UINT32 i = 0; i < FRAME_SPLIT_WINDOW; ++i)
+		{
+			ROOM_CHAT_REQUEST_PACKET chatPacket;
+			snprintf(chatPacket.Message, sizeof(chatPacket.Message), "seq%05u", firstSeq + i);
+			data.insert(data.end(), (char*)&chatPacket, (char*)&chatPacket + sizeof(chatPacket));
+		}
+		sentBytes += (UINT32)data.size();
+
+		//   ٲ۴.  ̿     ް Ѵ.
+		UINT32 offset = 0;
+		switch (window % 3)
+		{
+		case 0:
+			TEST_CHECK(sender.SendRaw(data.data(), (UINT32)data.size()), "  ");
+			break;
+
+		case 1:
+			while (offset < data.size())
+			{
+				auto size = (std::min)(cutSize(random), (UINT32)data.size() - offset);
+				TEST_CHECK(sender.SendRaw(data.data() + offset, size), "߶ ");
+				offset += size;
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			break;
+
+		default:
+			for (; offset < sizeof(ROOM_CHAT_REQUEST_PACKET); ++offset)
+			{
+				TEST_CHECK(sender.SendRaw(data.data() + offset, 1), " Ʈ ");
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			TEST_CHECK(sender.SendRaw(data.data() + offset, (UINT32)data.size() - offset), " ");
+			break;
+		}
+
+		for (UINT32 i = 0; i < FRAME_SPLIT_WINDOW; ++i)
+		{
+			std::vector<char> packet;
+			TEST_CHECK(sender.WaitPacket(PACKET_ID::ROOM_CHAT_RESPONSE, &packet), "ä   : seq(%u) closed(%d)", firstSeq + i, sender.IsClosedByPeer());
+			TEST_CHECK(((ROOM_CHAT_RESPONSE_PACKET*)packet.data())->Result == (INT16)ERROR_CODE::NONE, "ä  : seq(%u)", firstSeq + i);
+
+			TEST_CHECK(receiver.WaitPacket(PACKET_ID::ROOM_CHAT_NOTIFY, &packet), "ä ˸  : seq(%u)", firstSeq + i);
+
+			char expectedMessage[16];
+			snprintf(expectedMessage, sizeof(expectedMessage), "seq%05u", firstSeq + i);
+			auto pNotify = (ROOM_CHAT_NOTIFY_PACKET*)packet.data();
+			TEST_CHECK(strcmp(pNotify->Msg, expectedMessage) == 0, " ٸ : (%s) (%.16s)", expectedMessage, pNotify->Msg);
+		}
+	}
+
+	TEST_CHECK(sender.IsClosedByPeer() == false && receiver.IsClosedByPeer() == false, "  ");
+	TEST_CHECK(server.Stop(), "   ");
+
+	printf("[frame_split] ä %u, %uƮ (  %.1f)\n", FRAME_SPLIT_WINDOW * FRAME_SPLIT_WINDOW_COUNT, sentBytes,
+		(double)sentBytes / RECV_RING_BUFFER_SIZE);
+	return true;
+}
+
+
+const UINT16 UDP_LOSS_PORT = 11122;
+const UINT16 UDP_LOSS_UDP_PORT = 11123;
+const UINT32 UDP_LOSS_DROP_PERCENT = 30;
+const UINT32 UDP_LOSS_BIND_MAX_TRY = 50;
+const UINT32 UDP_LOSS_BIND_WAIT_MS = 100;
+const UINT32 UDP_LOSS_MOVE_COUNT = 200;
+const UINT32 UDP_LOSS_CHAT_COUNT = 10;
+
+//UDP  û    ٽ .
+//ȯ : ⿡    . ϸ 0
+UINT32 BindUdp(TestClient* pClient_, TestUdpClient* pUdpClient_)
+{
+	std::vector<char> packet;
+	if (pClient_->WaitPacket(PACKET_ID::UDP_TOKEN_NOTIFY, &packet) == false)
+	{
+		return 0;
+	}
+
+	UDP_BIND_REQUEST_PACKET bindPacket;
+	bindPacket.Token = ((UDP_TOKEN_NOTIFY_PACKET*)packet.data())->Token;
+
+	for (UINT32 tryCount = 1; tryCount <= UDP_LOSS_BIND_MAX_TRY; ++tryCount)
+	{
+		pUdpClient_->Send(bindPacket);
+
+		while (pUdpClient_->RecvPacket(&packet, UDP_LOSS_BIND_WAIT_MS))
+		{
+			auto pBindRes = (UDP_BIND_RESPONSE_PACKET*)packet.data();
+			if (pBindRes->PacketId == (UINT16)PACKET_ID::UDP_BIND_RESPONSE && pBindRes->Result == (UINT16)ERROR_CODE::NONE)
+			{
+				return tryCount;
+			}
+		}
+	}
+	return 0;
+}
+
+//durationMs_  TCP UDP  Ŷ ID .   ˸  Ƿ ⸦ ٸ ʴ´.
+void CountPackets(TestClient* pClient_, TestUdpClient* pUdpClient_, const UINT32 durationMs_,
+	std::map<UINT16, UINT32>* pTcpCounts_, std::map<UINT16, UINT32>* pUdpCounts_)
+{
+	auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(durationMs_);
+	std::vector<char> packet;
+	while (true)
+	{
+		while (pClient_->RecvPacket(&packet, 0))
+		{
+			++(*pTcpCounts_)[((PACKET_HEADER*)packet.data())->PacketId];
+		}
+
+		auto remainMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - std::chrono::steady_clock::now()).count();
+		if (remainMs <= 0)
+		{
+			return;
+		}
+
+		if (pUdpClient_->RecvPacket(&packet, (UINT32)remainMs))
+		{
+			++(*pUdpCounts_)[((PACKET_HEADER*)packet.data())->PacketId];
+		}
+	}
+}
+
+//UDP ս (udp_drop)   UDP ä ȮѴ.
+//- Ҿ  û/ Ŭ̾Ʈ ٽ  δ.
+//-   ̵   ˸ UDPθ  սǸŭ .
+//- ä ս  TCPθ ´.
+bool TestUdpLoss(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=" + std::to_string(UDP_LOSS_UDP_PORT),
+		"--udp_drop=" + std::to_string(UDP_LOSS_DROP_PERCENT), "--rate_limit=0", "--compress_threshold=0", "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, UDP_LOSS_PORT, serverArgs_), " ");
+
+	TestClient sender;
+	TestClient receiver;
+	TestUdpClient senderUdp;
+	TestUdpClient receiverUdp;
+	TEST_CHECK(sender.Connect(UDP_LOSS_PORT) && receiver.Connect(UDP_LOSS_PORT), "");
+	TEST_CHECK(senderUdp.Connect(UDP_LOSS_UDP_PORT) && receiverUdp.Connect(UDP_LOSS_UDP_PORT), "UDP ");
+	UINT16 senderIndex = 0;
+	TEST_CHECK(Login(&sender, "udp_a", &senderIndex) && Login(&receiver, "udp_b"), "α");
+
+	auto senderBindTry = BindUdp(&sender, &senderUdp);
+	auto receiverBindTry = BindUdp(&receiver, &receiverUdp);
+	TEST_CHECK(senderBindTry > 0 && receiverBindTry > 0, "UDP   : %u, %u ", senderBindTry, receiverBindTry);
+	TEST_CHECK(EnterRoom(&sender, 0) && EnterRoom(&receiver, 0), " ");
+
+	std::map<UINT16, UINT32> tcpCounts;
+	std::map<UINT16, UINT32> udpCounts;
+	CountPackets(&receiver, &receiverUdp, 0, &tcpCounts, &udpCounts);
+	tcpCounts.clear();
+	udpCounts.clear();
+
+	for (UINT32 i = 0; i < UDP_LOSS_MOVE_COUNT; ++i)
+	{
+		PLAYER_MOVEMENT_PACKET movePacket;
+		movePacket.userUUID = senderIndex;
+		movePacket.dx = 0.1f;
+		movePacket.rotation = { 0.0f, 0.0f, 0.0f, 1.0f };
+		senderUdp.Send(movePacket);
+
+		if (i % (UDP_LOSS_MOVE_COUNT / UDP_LOSS_CHAT_COUNT) == 0)
+		{
+			ROOM_CHAT_REQUEST_PACKET chatPacket;
+			snprintf(chatPacket.Message, sizeof(chatPacket.Message), "udp_loss");
+			TEST_CHECK(sender.Send(chatPacket), "ä ");
+		}
+
+		CountPackets(&receiver, &receiverUdp, 5, &tcpCounts, &udpCounts);
+	}
+	CountPackets(&receiver, &receiverUdp, 300, &tcpCounts, &udpCounts);
+
+	auto udpMoveCount = udpCounts[(UINT16)PACKET_ID::UPDATE_PLAYER_MOVEMENT];
+	auto udpPatrolCount = udpCounts[(UINT16)PACKET_ID::ENEMY_PATROL_UPDATE];
+	auto tcpChatCount = tcpCounts[(UINT16)PACKET_ID::ROOM_CHAT_NOTIFY];
+	printf("[udp_loss] drop(%u%%) bind try(%u, %u) move : sent(%u) udp(%u) tcp(%u), patrol : udp(%u) tcp(%u), chat : tcp(%u/%u) udp(%u)\n",
+		UDP_LOSS_DROP_PERCENT, senderBindTry, receiverBindTry, UDP_LOSS_MOVE_COUNT, udpMoveCount, tcpCounts[(UINT16)PACKET_ID::UPDATE_PLAYER_MOVEMENT],
+		udpPatrolCount, tcpCounts[(UINT16)PACKET_ID::ENEMY_PATROL_UPDATE], tcpChatCount, UDP_LOSS_CHAT_COUNT, udpCounts[(UINT16)PACKET_ID::ROOM_CHAT_NOTIFY]);
+
+	// ʰ ޴ ʿ   Ƿ  (1 - 0.3)^2 = 49% Ѵ. 밪  а ´.
+	TEST_CHECK(udpMoveCount > 0 && udpMoveCount < UDP_LOSS_MOVE_COUNT, "UDP ̵ ˸  սǰ   : %u", udpMoveCount);
+	TEST_CHECK(udpMoveCount >= UDP_LOSS_MOVE_COUNT / 4, "UDP ̵ ˸ ʹ  : %u", udpMoveCount);
+	TEST_CHECK(tcpCounts[(UINT16)PACKET_ID::UPDATE_PLAYER_MOVEMENT] == 0, " ǿ ̵ ˸ TCP ");
+	TEST_CHECK(udpPatrolCount > 0, "UDP   ˸  ");
+	TEST_CHECK(tcpCounts[(UINT16)PACKET_ID::ENEMY_PATROL_UPDATE] == 0, " ǿ   ˸ TCP ");
+	TEST_CHECK(tcpChatCount == UDP_LOSS_CHAT_COUNT, "TCP ä ˸  ٸ : %u", tcpChatCount);
+	TEST_CHECK(udpCounts[(UINT16)PACKET_ID::ROOM_CHAT_NOTIFY] == 0, "ä ˸ UDP ");
+
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+
+const UINT16 RELIABLE_UDP_PORT = 11124;
+const UINT16 RELIABLE_UDP_UDP_PORT = 11125;
+const UINT32 RELIABLE_UDP_DROP_PERCENT = 30;
+const UINT32 RELIABLE_UDP_CHAT_COUNT = 40;		//Ʈ (RUDP_WINDOW_SIZE)  .
+const UINT32 RELIABLE_UDP_ITEM_COUNT = 3;
+const UINT32 RELIABLE_UDP_FIRST_ITEM_ID = 1001;
+const UINT32 RELIABLE_UDP_WAIT_MS = 10000;
+static_assert(sizeof(INVENTORY_INFO_RESPONSE_PACKET) > RUDP_MAX_PAYLOAD_SIZE, "κ丮    Ѵ");
+
+//pClient_ packetId_ Ŷ deliveredCount_ Ѱ ޵  . (pPeer_)   ۰ Ȯ  .
+//ȯ : ð ȿ ޵ ʾ false
+bool WaitRudpDelivered(TestRudpClient* pClient_, TestRudpClient* pPeer_, const PACKET_ID packetId_, const UINT32 deliveredCount_, std::vector<std::vector<char>>* pPackets_)
+{
+	auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(RELIABLE_UDP_WAIT_MS);
+	while (std::chrono::steady_clock::now() < endTime)
+	{
+		pPeer_->Update(0);
+		pClient_->Update(5);
+
+		auto& delivered = pClient_->GetDelivered();
+		for (auto iter = delivered.begin(); iter != delivered.end();)
+		{
+			if (((PACKET_HEADER*)iter->Packet.data())->PacketId != (UINT16)packetId_)
+			{
+				++iter;
+				continue;
+			}
+
+			if (iter->Stream != (UINT8)GetUdpStream((UINT16)packetId_))
+			{
+				printf("[reliable_udp] Ʈ ٸ : packet(%u) stream(%u)\n", (UINT16)packetId_, iter->Stream);
+				return false;
+			}
+
+			pPackets_->push_back(std::move(iter->Packet));
+			iter = delivered.erase(iter);
+		}
+
+		if (pPackets_->size() >= deliveredCount_)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+//UDP ս    ŷڼ UDP(udp_reliable) ȮѴ.
+//- ä Ʈ(ŷڼ,  )  ä    ,   ˸ ´.
+//-  Ʈ   ߰   , ׸Ʈ ū κ丮   ļ  ´.
+//- ŷڼ UDP  ǿ ä ˸ TCP  ʴ´.
+bool TestReliableUdp(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=" + std::to_string(RELIABLE_UDP_UDP_PORT), "--udp_reliable=1",
+		"--udp_drop=" + std::to_string(RELIABLE_UDP_DROP_PERCENT), "--rate_limit=0", "--compress_threshold=0", "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, RELIABLE_UDP_PORT, serverArgs_), " ");
+
+	TestClient sender;
+	TestClient receiver;
+	TestRudpClient senderUdp;
+	TestRudpClient receiverUdp;
+	TEST_CHECK(sender.Connect(RELIABLE_UDP_PORT) && receiver.Connect(RELIABLE_UDP_PORT), "");
+	TEST_CHECK(senderUdp.Connect(RELIABLE_UDP_UDP_PORT) && receiverUdp.Connect(RELIABLE_UDP_UDP_PORT), "UDP ");
+
+	// ڿ  Ŷ ŷڼ UDP Ƿ ū ޾Ƶΰ   TCP ģ  ´.
+	std::vector<char> packet;
+	UINT64 senderToken = 0;
+	UINT64 receiverToken = 0;
+	TEST_CHECK(Login(&sender, "rudp_a") && sender.WaitPacket(PACKET_ID::UDP_TOKEN_NOTIFY, &packet), "α");
+	senderToken = ((UDP_TOKEN_NOTIFY_PACKET*)packet.data())->Token;
+	TEST_CHECK(Login(&receiver, "rudp_b") && receiver.WaitPacket(PACKET_ID::UDP_TOKEN_NOTIFY, &packet), "α");
+	receiverToken = ((UDP_TOKEN_NOTIFY_PACKET*)packet.data())->Token;
+	TEST_CHECK(EnterRoom(&sender, 0) && EnterRoom(&receiver, 0), " ");
+
+	TEST_CHECK(senderUdp.Bind(senderToken, UDP_LOSS_BIND_MAX_TRY) && receiverUdp.Bind(receiverToken, UDP_LOSS_BIND_MAX_TRY), "ŷڼ UDP  ");
+
+	for (UINT32 i = 0; i < RELIABLE_UDP_CHAT_COUNT; ++i)
+	{
+		ROOM_CHAT_REQUEST_PACKET chatPacket;
+		snprintf(chatPacket.Message, sizeof(chatPacket.Message), "rudp%05u", i);
+		senderUdp.Send(chatPacket);
+	}
+
+	std::vector<std::vector<char>> notifies;
+	std::vector<std::vector<char>> responses;
+	TEST_CHECK(WaitRudpDelivered(&receiverUdp, &senderUdp, PACKET_ID::ROOM_CHAT_NOTIFY, RELIABLE_UDP_CHAT_COUNT, &notifies), "ä ˸    : %u/%u",
+		(UINT32)notifies.size(), RELIABLE_UDP_CHAT_COUNT);
+	TEST_CHECK(WaitRudpDelivered(&senderUdp, &receiverUdp, PACKET_ID::ROOM_CHAT_RESPONSE, RELIABLE_UDP_CHAT_COUNT, &responses), "ä     : %u/%u",
+		(UINT32)responses.size(), RELIABLE_UDP_CHAT_COUNT);
+
+	for (UINT32 i = 0; i < RELIABLE_UDP_CHAT_COUNT; ++i)
+	{
+		TEST_CHECK(((ROOM_CHAT_RESPONSE_PACKET*)responses[i].data())->Result == (INT16)ERROR_CODE::NONE, "ä  : seq(%u)", i);
+
+		char expectedMessage[16];
+		snprintf(expectedMessage, sizeof(expectedMessage), "rudp%05u", i);
+		auto pNotify = (ROOM_CHAT_NOTIFY_PACKET*)notifies[i].data();
+		TEST_CHECK(strcmp(pNotify->Msg, expectedMessage) == 0, " ٸ : (%s) (%.16s)", expectedMessage, pNotify->Msg);
+	}
+
+	for (UINT32 i = 0; i < RELIABLE_UDP_ITEM_COUNT; ++i)
+	{
+		ITEM_ADD_REQUEST_PACKET itemPacket;
+		itemPacket.itemID = RELIABLE_UDP_FIRST_ITEM_ID + i;
+		itemPacket.quantity = (UINT16)(i + 1);
+		senderUdp.Send(itemPacket);
+	}
+	senderUdp.Send(INVENTORY_INFO_REQUEST_PACKET());
+
+	std::vector<std::vector<char>> itemResponses;
+	std::vector<std::vector<char>> inventoryResponses;
+	TEST_CHECK(WaitRudpDelivered(&senderUdp, &receiverUdp, PACKET_ID::ITEM_ADD_RESPONSE, RELIABLE_UDP_ITEM_COUNT, &itemResponses), " ߰    ");
+	TEST_CHECK(WaitRudpDelivered(&senderUdp, &receiverUdp, PACKET_ID::INVENTORY_INFO_RESPONSE, 1, &inventoryResponses), "κ丮   ");
+
+	for (UINT32 i = 0; i < RELIABLE_UDP_ITEM_COUNT; ++i)
+	{
+		auto pItemRes = (ITEM_ADD_RESPONSE_PACKET*)itemResponses[i].data();
+		TEST_CHECK(pItemRes->Result == (UINT16)ERROR_CODE::NONE && pItemRes->addedItem.itemID == RELIABLE_UDP_FIRST_ITEM_ID + i,
+			" ߰  ٸ : result(%u) itemID(%u)", pItemRes->Result, pItemRes->addedItem.itemID);
+	}
+
+	TEST_CHECK(inventoryResponses[0].size() == sizeof(INVENTORY_INFO_RESPONSE_PACKET), "κ丮  ũⰡ ٸ : %u", (UINT32)inventoryResponses[0].size());
+	auto pInventory = (INVENTORY_INFO_RESPONSE_PACKET*)inventoryResponses[0].data();
+	TEST_CHECK(pInventory->PacketLength == sizeof(INVENTORY_INFO_RESPONSE_PACKET) && pInventory->Result == (UINT16)ERROR_CODE::NONE &&
+		pInventory->itemCount == RELIABLE_UDP_ITEM_COUNT, "κ丮  ٸ : result(%u) count(%u)", pInventory->Result, pInventory->itemCount);
+	for (UINT32 i = 0; i < RELIABLE_UDP_ITEM_COUNT; ++i)
+	{
+		TEST_CHECK(pInventory->items[i].itemID == RELIABLE_UDP_FIRST_ITEM_ID + i && pInventory->items[i].quantity == i + 1,
+			"κ丮  ٸ : slot(%u) itemID(%u) quantity(%u)", i, pInventory->items[i].itemID, pInventory->items[i].quantity);
+	}
+
+	//ʰ     ޵ ʴ  Ȯ   ְ  .
+	for (UINT32 i = 0; i < RELIABLE_UDP_WAIT_MS / 10 && (senderUdp.GetUnackedCount() > 0 || receiverUdp.GetUnackedCount() > 0); ++i)
+	{
+		senderUdp.Update(5);
+		receiverUdp.Update(5);
+	}
+	senderUdp.Update(300);
+	receiverUdp.Update(300);
+	TEST_CHECK(senderUdp.GetUnackedCount() == 0, "Ȯ    ׸Ʈ : %u", senderUdp.GetUnackedCount());
+
+	// ʵ 濡 Ƿ ڱ ä ˸ ޴´. ̰͵    ; Ѵ.
+	std::vector<std::vector<char>> senderNotifies;
+	for (auto& delivered : senderUdp.GetDelivered())
+	{
+		auto packetId = ((PACKET_HEADER*)delivered.Packet.data())->PacketId;
+		if (packetId == (UINT16)PACKET_ID::ROOM_CHAT_NOTIFY)
+		{
+			senderNotifies.push_back(delivered.Packet);
+		}
+		TEST_CHECK(packetId != (UINT16)PACKET_ID::ROOM_CHAT_RESPONSE && packetId != (UINT16)PACKET_ID::ITEM_ADD_RESPONSE &&
+			packetId != (UINT16)PACKET_ID::INVENTORY_INFO_RESPONSE, "  ޵ : packet(%u)", packetId);
+	}
+	for (auto& delivered : receiverUdp.GetDelivered())
+	{
+		TEST_CHECK(((PACKET_HEADER*)delivered.Packet.data())->PacketId != (UINT16)PACKET_ID::ROOM_CHAT_NOTIFY, "ä ˸   ޵");
+	}
+
+	TEST_CHECK(senderNotifies.size() == RELIABLE_UDP_CHAT_COUNT, "  ä ˸  ٸ : %u", (UINT32)senderNotifies.size());
+	for (UINT32 i = 0; i < RELIABLE_UDP_CHAT_COUNT; ++i)
+	{
+		char expectedMessage[16];
+		snprintf(expectedMessage, sizeof(expectedMessage), "rudp%05u", i);
+		auto pNotify = (ROOM_CHAT_NOTIFY_PACKET*)senderNotifies[i].data();
+		TEST_CHECK(strcmp(pNotify->Msg, expectedMessage) == 0, "  ˸  ٸ : (%s) (%.16s)", expectedMessage, pNotify->Msg);
+	}
+
+	UINT32 tcpChatCount = 0;
+	while (receiver.RecvPacket(&packet, 0))
+	{
+		tcpChatCount += ((PACKET_HEADER*)packet.data())->PacketId == (UINT16)PACKET_ID::ROOM_CHAT_NOTIFY ? 1 : 0;
+	}
+	TEST_CHECK(tcpChatCount == 0, "ŷڼ UDP  ǿ ä ˸ TCP  : %u", tcpChatCount);
+
+	printf("[reliable_udp] drop(%u%%) chat(%u) item(%u) inventory(%uƮ) retransmit : sender(%u) receiver(%u)\n", RELIABLE_UDP_DROP_PERCENT,
+		RELIABLE_UDP_CHAT_COUNT, RELIABLE_UDP_ITEM_COUNT, (UINT32)sizeof(INVENTORY_INFO_RESPONSE_PACKET), senderUdp.GetRetransmitCount(), receiverUdp.GetRetransmitCount());
+
+	TEST_CHECK(sender.IsClosedByPeer() == false && receiver.IsClosedByPeer() == false, "  ");
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+const UINT16 HEARTBEAT_PORT = 11126;
+const UINT32 HEARTBEAT_PING_SEC = 7;		//Ÿ̸  ù ܰ(64ƽ) Ѱܼ  ܰ迡 ɸ Ѵ.
+const UINT32 HEARTBEAT_TIMEOUT_SEC = 8;
+const UINT32 HEARTBEAT_EARLY_MS = 200;		//ƽ  øϹǷ  ̸ŭ  ͵ ȴ.
+const UINT32 HEARTBEAT_LATE_MS = 1000;
+static_assert(HEARTBEAT_PING_SEC * 1000 / HEARTBEAT_TICK_MS >= 64, " Ÿ̸Ӱ Ÿ̸   ܰ迡 ɷ Ѵ");
+
+//ƮƮ(heartbeat_ping, heartbeat_timeout) ȮѴ.
+//- α  ƹ͵    ݿ   ´.  Ÿ̸Ӵ 64ƽ ־ Ÿ̸  Cascade() ľ  ȴ.
+//- ο  ʴ  ŸӾƿ  .
+//- ο  ϴ  ŸӾƿ   ʴ´.
+bool TestHeartbeat(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=0", "--rate_limit=0", "--compress_threshold=0", "--log_level=warn",
+		"--heartbeat_ping=" + std::to_string(HEARTBEAT_PING_SEC), "--heartbeat_timeout=" + std::to_string(HEARTBEAT_TIMEOUT_SEC) });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, HEARTBEAT_PORT, serverArgs_), " ");
+
+	TestClient alive;
+	TestClient dead;
+	TEST_CHECK(alive.Connect(HEARTBEAT_PORT) && dead.Connect(HEARTBEAT_PORT), "");
+	TEST_CHECK(Login(&alive, "beat_alive") && Login(&dead, "beat_dead"), "α");
+
+	//    α û̴.
+	auto startTime = std::chrono::steady_clock::now();
+	auto getElapsedMs = [&startTime]() {
+		return (INT64)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - startTime).count();
+	};
+
+	INT64 alivePingMs = -1;
+	INT64 deadPingMs = -1;
+	INT64 deadClosedMs = -1;
+	UINT32 pongCount = 0;
+
+	std::vector<char> packet;
+	while (getElapsedMs() < (INT64)(HEARTBEAT_TIMEOUT_SEC * 1000 + HEARTBEAT_LATE_MS * 2))
+	{
+		while (alive.RecvPacket(&packet, 10))
+		{
+			auto pPing = (HEARTBEAT_PING_PACKET*)packet.data();
+			if (pPing->PacketId != (UINT16)PACKET_ID::HEARTBEAT_PING)
+			{
+				continue;
+			}
+
+			if (alivePingMs < 0)
+			{
+				alivePingMs = getElapsedMs();
+			}
+
+			HEARTBEAT_PONG_PACKET pongPacket;
+			pongPacket.PingTimeMs = pPing->PingTimeMs;
+			TEST_CHECK(alive.Send(pongPacket), " ");
+			++pongCount;
+		}
+
+		while (deadClosedMs < 0 && dead.RecvPacket(&packet, 10))
+		{
+			if (deadPingMs < 0 && ((PACKET_HEADER*)packet.data())->PacketId == (UINT16)PACKET_ID::HEARTBEAT_PING)
+			{
+				deadPingMs = getElapsedMs();
+			}
+		}
+
+		if (deadClosedMs < 0 && dead.IsClosedByPeer())
+		{
+			deadClosedMs = getElapsedMs();
+		}
+	}
+
+	printf("[heartbeat] ping(%us) timeout(%us) alive : ping(%lldms) pong(%u) closed(%d), dead : ping(%lldms) closed(%lldms)\n", HEARTBEAT_PING_SEC,
+		HEARTBEAT_TIMEOUT_SEC, (long long)alivePingMs, pongCount, alive.IsClosedByPeer(), (long long)deadPingMs, (long long)deadClosedMs);
+
+	const INT64 pingMs = HEARTBEAT_PING_SEC * 1000;
+	const INT64 timeoutMs = HEARTBEAT_TIMEOUT_SEC * 1000;
+	TEST_CHECK(deadPingMs >= pingMs - HEARTBEAT_EARLY_MS && deadPingMs <= pingMs + HEARTBEAT_LATE_MS, "    : %lldms", (long long)deadPingMs);
+	TEST_CHECK(alivePingMs >= pingMs - HEARTBEAT_EARLY_MS && alivePingMs <= pingMs + HEARTBEAT_LATE_MS, "    : %lldms", (long long)alivePingMs);
+	TEST_CHECK(deadClosedMs >= timeoutMs - HEARTBEAT_EARLY_MS && deadClosedMs <= timeoutMs + HEARTBEAT_LATE_MS, " ʴ     : %lldms",
+		(long long)deadClosedMs);
+	TEST_CHECK(alive.IsClosedByPeer() == false, "   ");
+
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+const UINT16 RATE_LIMIT_PORT = 11127;
+const UINT32 RATE_LIMIT_CHAT_BURST = RATE_LIMIT_RULES[(int)RATE_LIMIT_CLASS::CHAT].Burst;
+const UINT32 RATE_LIMIT_FIRST_CHAT_COUNT = RATE_LIMIT_CHAT_BURST * 2;	// ġ ȿ ġ .
+const UINT32 RATE_LIMIT_FLOOD_CHAT_COUNT = RATE_LIMIT_VIOLATION_BURST * 3;	// ġ Ѱܼ  .
+const UINT32 RATE_LIMIT_COUNT_MS = 500;
+
+//ä .      ð(ms) ˻ϰ Ѵ.
+bool SendChats(TestClient* pClient_, const UINT32 count_)
+{
+	std::vector<char> data;
+	for (UINT32 i = 0; i < count_; ++i)
+	{
+		ROOM_CHAT_REQUEST_PACKET chatPacket;
+		snprintf(chatPacket.Message, sizeof(chatPacket.Message), "flood%05u", i);
+		data.insert(data.end(), (char*)&chatPacket, (char*)&chatPacket + sizeof(chatPacket));
+	}
+	return pClient_->SendRaw(data.data(), (UINT32)data.size());
+}
+
+//RATE_LIMIT_COUNT_MS   ä ˸  .   ˸  Ƿ ⸦ ٸ ʴ´.
+UINT32 CountChatNotify(TestClient* pClient_)
+{
+	auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(RATE_LIMIT_COUNT_MS);
+	UINT32 count = 0;
+	std::vector<char> packet;
+	while (std::chrono::steady_clock::now() < endTime)
+	{
+		if (pClient_->RecvPacket(&packet, 10))
+		{
+			count += ((PACKET_HEADER*)packet.data())->PacketId == (UINT16)PACKET_ID::ROOM_CHAT_NOTIFY ? 1 : 0;
+		}
+	}
+	return count;
+}
+
+//Ŷ ӵ (rate_limit) ȮѴ.
+//- ä Ŷ ѱ ä ROOM_TOO_MANY_PACKET 丸 ް ä ڵ鷯  ʴ´. ( ٸ  ˸  ʴ´)
+//-  ġ Ѱ ̸  , ׶  ģ äõ ڵ鷯  ʴ´.
+//-   ٸ    ʴ´.
+bool TestRateLimit(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=0", "--rate_limit=1", "--compress_threshold=0", "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, RATE_LIMIT_PORT, serverArgs_), " ");
+
+	TestClient flooder;
+	TestClient receiver;
+	TEST_CHECK(flooder.Connect(RATE_LIMIT_PORT) && receiver.Connect(RATE_LIMIT_PORT), "");
+	TEST_CHECK(Login(&flooder, "flood_a") && Login(&receiver, "flood_b"), "α");
+	TEST_CHECK(EnterRoom(&flooder, 0) && EnterRoom(&receiver, 0), " ");
+	CountChatNotify(&receiver);
+
+	//1. Ŷ  踦 . Ŷŭ óǰ  ROOM_TOO_MANY_PACKET ޴´.
+	TEST_CHECK(SendChats(&flooder, RATE_LIMIT_FIRST_CHAT_COUNT), "ä ");
+
+	UINT32 passCount = 0;
+	UINT32 limitedCount = 0;
+	std::vector<char> packet;
+	for (UINT32 i = 0; i < RATE_LIMIT_FIRST_CHAT_COUNT; ++i)
+	{
+		TEST_CHECK(flooder.WaitPacket(PACKET_ID::ROOM_CHAT_RESPONSE, &packet), "ä   : %u/%u", i, RATE_LIMIT_FIRST_CHAT_COUNT);
+
+		auto result = ((ROOM_CHAT_RESPONSE_PACKET*)packet.data())->Result;
+		passCount += result == (INT16)ERROR_CODE::NONE ? 1 : 0;
+		limitedCount += result == (INT16)ERROR_CODE::ROOM_TOO_MANY_PACKET ? 1 : 0;
+	}
+
+	auto firstNotifyCount = CountChatNotify(&receiver);
+	printf("[rate_limit] burst(%u) sent(%u) pass(%u) too many(%u) notify(%u)\n", RATE_LIMIT_CHAT_BURST, RATE_LIMIT_FIRST_CHAT_COUNT, passCount,
+		limitedCount, firstNotifyCount);
+
+	TEST_CHECK(passCount + limitedCount == RATE_LIMIT_FIRST_CHAT_COUNT, "𸣴 ä  : pass(%u) too many(%u)", passCount, limitedCount);
+	TEST_CHECK(passCount >= RATE_LIMIT_CHAT_BURST && limitedCount > 0, "Ŷŭ ó  : pass(%u) too many(%u)", passCount, limitedCount);
+	TEST_CHECK(firstNotifyCount == passCount, "ģ ä ڵ鷯  : notify(%u) pass(%u)", firstNotifyCount, passCount);
+	TEST_CHECK(flooder.IsClosedByPeer() == false, "ġ   ");
+
+	//2.  ġ Ѱ . ܾ ϰ,   óǴ ä Ŷ ٽ  ŭ̴.
+	TEST_CHECK(SendChats(&flooder, RATE_LIMIT_FLOOD_CHAT_COUNT), "ä ");
+
+	limitedCount = 0;
+	auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(TEST_RECV_TIMEOUT_MS);
+	while (flooder.IsClosedByPeer() == false && std::chrono::steady_clock::now() < endTime)
+	{
+		if (flooder.RecvPacket(&packet, 100) && ((PACKET_HEADER*)packet.data())->PacketId == (UINT16)PACKET_ID::ROOM_CHAT_RESPONSE)
+		{
+			limitedCount += ((ROOM_CHAT_RESPONSE_PACKET*)packet.data())->Result == (INT16)ERROR_CODE::ROOM_TOO_MANY_PACKET ? 1 : 0;
+		}
+	}
+
+	auto floodNotifyCount = CountChatNotify(&receiver);
+	printf("[rate_limit] flood sent(%u) too many(%u) notify(%u) closed(%d)\n", RATE_LIMIT_FLOOD_CHAT_COUNT, limitedCount, floodNotifyCount,
+		flooder.IsClosedByPeer());
+
+	TEST_CHECK(flooder.IsClosedByPeer(), " ġ Ѱµ  ");
+	TEST_CHECK(floodNotifyCount <= RATE_LIMIT_CHAT_BURST, "ģ ä ڵ鷯  : notify(%u)", floodNotifyCount);
+	TEST_CHECK(receiver.IsClosedByPeer() == false, "  ٸ  ");
+
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+const UINT16 COMPRESS_PORT = 11128;
+const UINT32 COMPRESS_THRESHOLD = 64;
+const UINT32 COMPRESS_ITEM_COUNT = 3;
+const UINT32 COMPRESS_FIRST_ITEM_ID = 2001;
+static_assert(sizeof(ITEM_ADD_RESPONSE_PACKET) < COMPRESS_THRESHOLD, " ߰   ʾƾ Ѵ");
+static_assert(sizeof(INVENTORY_INFO_RESPONSE_PACKET) >= COMPRESS_THRESHOLD, "κ丮  Ǿ Ѵ");
+
+//packetId_ Ŷ   ް, Ǿ  Ǯ ش.
+//ȯ : ð ȿ  ʾҰų Ǯ   false. pIsCompressed_ Ǿ Դ ´.
+bool WaitDecompressedPacket(TestClient* pClient_, const PACKET_ID packetId_, std::vector<char>* pPacket_, bool* pIsCompressed_)
+{
+	std::vector<char> packet;
+	if (pClient_->WaitPacket(packetId_, &packet) == false)
+	{
+		return false;
+	}
+
+	*pIsCompressed_ = IsCompressedPacket(packet.data());
+	if (*pIsCompressed_ == false)
+	{
+		*pPacket_ = std::move(packet);
+		return true;
+	}
+
+	pPacket_->resize(PacketCompressor::GetOriginalSize(packet.data(), (UINT32)packet.size()));
+	return PacketCompressor::Instance().Decompress(packet.data(), (UINT32)packet.size(), pPacket_->data(), (UINT32)pPacket_->size()) > 0;
+}
+
+// Ʈ  Ŷ . [][originalSize_][pBody_]
+std::vector<char> MakeCompressedFrame(const PACKET_ID packetId_, const UINT16 originalSize_, const std::vector<char>& body_)
+{
+	std::vector<char> frame(PACKET_COMPRESS_INFO_LENGTH + body_.size());
+	PACKET_HEADER header((UINT16)frame.size(), packetId_, PACKET_TYPE_COMPRESSED);
+	CopyMemory(frame.data(), &header, PACKET_HEADER_LENGTH);
+	CopyMemory(frame.data() + PACKET_HEADER_LENGTH, &originalSize_, sizeof(originalSize_));
+	std::copy(body_.begin(), body_.end(), frame.begin() + PACKET_COMPRESS_INFO_LENGTH);
+	return frame;
+}
+
+//Ŷ (compress_threshold) ȮѴ.
+//- غ ū κ丮  Ǿ , Ǯ  ߰   ۰ Ʈ  .
+//- Ŭ̾Ʈ ؼ  ä Ǯ óȴ.
+//- ߸  Ŷ( ̰  ª,  , Ǯ  ̰  ,  )    ״δ.
+bool TestCompress(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=8", "--udp_port=0", "--rate_limit=0",
+		"--compress_threshold=" + std::to_string(COMPRESS_THRESHOLD), "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, COMPRESS_PORT, serverArgs_), " ");
+
+	TestClient client;
+	TEST_CHECK(client.Connect(COMPRESS_PORT), "");
+	TEST_CHECK(Login(&client, "compress_a") && EnterRoom(&client, 0), "α,  ");
+
+	//1.   κ丮 
+	INVENTORY_INFO_RESPONSE_PACKET expectedInventory;
+	expectedInventory.Result = (UINT16)ERROR_CODE::NONE;
+
+	std::vector<char> packet;
+	bool isCompressed = false;
+	for (UINT32 i = 0; i < COMPRESS_ITEM_COUNT; ++i)
+	{
+		ITEM_ADD_REQUEST_PACKET itemPacket;
+		itemPacket.itemID = COMPRESS_FIRST_ITEM_ID + i;
+		itemPacket.quantity = (UINT16)(i + 1);
+		TEST_CHECK(client.Send(itemPacket) && WaitDecompressedPacket(&client, PACKET_ID::ITEM_ADD_RESPONSE, &packet, &isCompressed), " ߰  ");
+
+		auto pItemRes = (ITEM_ADD_RESPONSE_PACKET*)packet.data();
+		TEST_CHECK(isCompressed == false && pItemRes->Result == (UINT16)ERROR_CODE::NONE, " ߰  : result(%u) compressed(%d)", pItemRes->Result, isCompressed);
+		expectedInventory.items[expectedInventory.itemCount++] = pItemRes->addedItem;
+	}
+
+	std::vector<char> compressedInventory;
+	TEST_CHECK(client.Send(INVENTORY_INFO_REQUEST_PACKET()) && client.WaitPacket(PACKET_ID::INVENTORY_INFO_RESPONSE, &compressedInventory), "κ丮  ");
+	TEST_CHECK(IsCompressedPacket(compressedInventory.data()) && compressedInventory.size() < sizeof(INVENTORY_INFO_RESPONSE_PACKET),
+		"κ丮    : %uƮ", (UINT32)compressedInventory.size());
+
+	std::vector<char> inventory(PacketCompressor::GetOriginalSize(compressedInventory.data(), (UINT32)compressedInventory.size()));
+	TEST_CHECK(inventory.size() == sizeof(INVENTORY_INFO_RESPONSE_PACKET), " ̰ ٸ : %u", (UINT32)inventory.size());
+	TEST_CHECK(PacketCompressor::Instance().Decompress(compressedInventory.data(), (UINT32)compressedInventory.size(), inventory.data(),
+		(UINT32)inventory.size()) == sizeof(INVENTORY_INFO_RESPONSE_PACKET), "κ丮  Ǯ  ");
+	TEST_CHECK(memcmp(inventory.data(), &expectedInventory, sizeof(expectedInventory)) == 0, "Ǭ κ丮  ٸ");
+
+	//2. ߸  Ŷ. ϳ  ڵ  û   .
+	ROOM_CHAT_REQUEST_PACKET chatPacket;
+	snprintf(chatPacket.Message, sizeof(chatPacket.Message), "compressed chat");
+	PacketCompressor::Instance().Init(COMPRESS_THRESHOLD);
+	char compressedChat[PACKET_COMPRESS_BUFFER_SIZE];
+	auto compressedChatSize = PacketCompressor::Instance().Compress((char*)&chatPacket, sizeof(chatPacket), compressedChat);
+	TEST_CHECK(compressedChatSize > 0, "ä   ");
+	std::vector<char> chatBody(compressedChat + PACKET_COMPRESS_INFO_LENGTH, compressedChat + compressedChatSize);
+
+	std::vector<char> garbage(64);
+	std::mt19937 random(16);
+	for (auto& value : garbage)
+	{
+		value = (char)random();
+	}
+
+	const std::pair<const char*, std::vector<char>> malformedFrames[] =
+	{
+		{ " ̰  ª", MakeCompressedFrame(PACKET_ID::ROOM_CHAT_REQUEST, PACKET_HEADER_LENGTH, chatBody) },
+		{ " ", MakeCompressedFrame(PACKET_ID::ROOM_CHAT_REQUEST, sizeof(ROOM_CHAT_REQUEST_PACKET), {}) },
+		{ " ̺ ª Ǯ", MakeCompressedFrame(PACKET_ID::ROOM_CHAT_REQUEST, sizeof(ROOM_CHAT_REQUEST_PACKET) + 100, chatBody) },
+		{ " ̺  Ǯ", MakeCompressedFrame(PACKET_ID::ROOM_CHAT_REQUEST, sizeof(ROOM_CHAT_REQUEST_PACKET) - 100, chatBody) },
+		{ " ", MakeCompressedFrame(PACKET_ID::ROOM_CHAT_REQUEST, sizeof(ROOM_CHAT_REQUEST_PACKET), garbage) },
+		{ "ִ    ", MakeCompressedFrame(PACKET_ID::INVENTORY_INFO_REQUEST, 0xFFFF, garbage) },
+	};
+
+	for (auto& malformed : malformedFrames)
+	{
+		TEST_CHECK(client.SendRaw(malformed.second.data(), (UINT32)malformed.second.size()), " : %s", malformed.first);
+		TEST_CHECK(client.Send(INVENTORY_INFO_REQUEST_PACKET()) && client.WaitPacket(PACKET_ID::INVENTORY_INFO_RESPONSE, &packet), "߸  Ŷ ڿ   : %s",
+			malformed.first);
+		TEST_CHECK(client.RecvPacket(&packet, 100) == false || ((PACKET_HEADER*)packet.data())->PacketId != (UINT16)PACKET_ID::ROOM_CHAT_RESPONSE,
+			"߸  Ŷ ó : %s", malformed.first);
+	}
+
+	//3. Ŭ̾Ʈ   ä óȴ. ˸ غ Ŀ Ǿ ´.
+	TEST_CHECK(client.SendRaw(compressedChat, compressedChatSize), " ä ");
+	TEST_CHECK(WaitDecompressedPacket(&client, PACKET_ID::ROOM_CHAT_NOTIFY, &packet, &isCompressed), " ä ˸ ");
+	auto pNotify = (ROOM_CHAT_NOTIFY_PACKET*)packet.data();
+	TEST_CHECK(isCompressed && strcmp(pNotify->Msg, chatPacket.Message) == 0, "ä ˸ ٸ : compressed(%d) msg(%.32s)", isCompressed, pNotify->Msg);
+
+	printf("[compress] threshold(%u) inventory(%u -> %uƮ) chat(%u -> %uƮ) malformed(%u)\n", COMPRESS_THRESHOLD,
+		(UINT32)sizeof(INVENTORY_INFO_RESPONSE_PACKET), (UINT32)compressedInventory.size(), (UINT32)sizeof(chatPacket), compressedChatSize,
+		(UINT32)(sizeof(malformedFrames) / sizeof(malformedFrames[0])));
+
+	TEST_CHECK(client.IsClosedByPeer() == false, "  ");
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+const UINT16 RELOGIN_PORT = 11129;
+const UINT32 RELOGIN_MAX_CLIENT = 4;
+const UINT32 RELOGIN_COUNT = RELOGIN_MAX_CLIENT * 3;
+const UINT32 RELOGIN_CLOSE_WAIT_MS = 100;	// 尡      ð
+
+//αߴٰ  ٽ αϱ⸦ max_client  Ѵ.       max_client° LOGIN_USER_USED_ALL_OBJ ޴´.
+//  ID   ID ٽ α  ִ.
+bool TestRelogin(const std::string& serverPath_, std::vector<std::string> serverArgs_)
+{
+	serverArgs_.insert(serverArgs_.begin(), { "--max_client=" + std::to_string(RELOGIN_MAX_CLIENT), "--udp_port=0", "--rate_limit=0",
+		"--compress_threshold=0", "--log_level=warn" });
+
+	TestServer server;
+	TEST_CHECK(server.Start(serverPath_, RELOGIN_PORT, serverArgs_), " ");
+
+	//    ־   0 ư ʰ Ѵ.
+	TestClient stay;
+	TEST_CHECK(stay.Connect(RELOGIN_PORT) && Login(&stay, "relogin_stay"), "α");
+
+	for (UINT32 i = 0; i < RELOGIN_COUNT; ++i)
+	{
+		TestClient client;
+		TEST_CHECK(client.Connect(RELOGIN_PORT), " : %u°", i + 1);
+
+		LOGIN_REQUEST_PACKET loginPacket;
+		snprintf(loginPacket.userID, sizeof(loginPacket.userID), "relogin");
+		snprintf(loginPacket.userPW, sizeof(loginPacket.userPW), "test");
+
+		std::vector<char> packet;
+		TEST_CHECK(client.Send(loginPacket) && client.WaitPacket(PACKET_ID::LOGIN_RESPONSE, &packet), "α   : %u°", i + 1);
+		auto result = ((LOGIN_RESPONSE_PACKET*)packet.data())->Result;
+		TEST_CHECK(result < RELOGIN_MAX_CLIENT, "ٽ α  : %u° result(%u)", i + 1, result);
+
+		client.Close();
+		std::this_thread::sleep_for(std::chrono::milliseconds(RELOGIN_CLOSE_WAIT_MS));
+	}
+
+	printf("[relogin] max_client(%u) relogin(%u)\n", RELOGIN_MAX_CLIENT, RELOGIN_COUNT);
+
+	TEST_CHECK(stay.IsClosedByPeer() == false, "  ");
+	TEST_CHECK(server.Stop(), "   ");
+	return true;
+}
+
+int main(int argc, char* argv[])
+{
+	std::map<std::string, std::function<bool(const std::string&, std::vector<std::string>)>> tests =
+	{
+		{ "frame_split", TestFrameSplit },
+		{ "udp_loss", TestUdpLoss },
+		{ "reliable_udp", TestReliableUdp },
+		{ "heartbeat", TestHeartbeat },
+		{ "rate_limit", TestRateLimit },
+		{ "compress", TestCompress },
+		{ "relogin", TestRelogin },
+	};
+
+	if (argc < 3 || tests.find(argv[2]) == tests.end())
+	{
+		printf(" : loopbacktest <gameserver > < ̸>\n");
+		for (auto& test : tests)
+		{
+			printf("\t%s\n", test.first.c_str());
+		}
+		return 2;
+	}
+
+	auto isPassed = tests[argv[2]](argv[1], std::vector<std::string>(argv + 3, argv + argc));
+	printf("[%s] %s\n", isPassed ? "" : "", argv[2]);
+	return isPassed ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+#pragma once
+
+#include "../Packet.h"
+
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+
+const UINT32 TEST_RECV_TIMEOUT_MS = 3000;
+
+// TCP Ŭ̾Ʈ.  ʹ ִ ״ Ͽ ,  ʹ Ŷ   ش.
+class TestClient
+{
+public:
+	~TestClient()
+	{
+		Close();
+	}
+
+	bool Connect(const UINT16 port_)
+	{
+		mSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+		//    ⸦ .
+		int noDelay = 1;
+		setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&noDelay, sizeof(noDelay));
+
+		sockaddr_in serverAddr = {};
+		serverAddr.sin_family = AF_INET;
+		serverAddr.sin_port = htons(port_);
+		inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+
+		if (connect(mSocket, (sockaddr*)&serverAddr, sizeof(serverAddr)) != 0)
+		{
+			printf("[]   : port(%u) errno(%d)\n", port_, errno);
+			Close();
+			return false;
+		}
+		return true;
+	}
+
+	void Close()
+	{
+		if (mSocket != INVALID_SOCKET)
+		{
+			close(mSocket);
+			mSocket = INVALID_SOCKET;
+		}
+	}
+
+	bool SendRaw(const char* pData_, const UINT32 size_)
+	{
+		UINT32 sentSize = 0;
+		while (sentSize < size_)
+		{
+			auto result = send(mSocket, pData_ + sentSize, size_ - sentSize, MSG_NOSIGNAL);
+			if (result <= 0)
+			{
+				printf("[] send()  : errno(%d)\n", errno);
+				return false;
+			}
+			sentSize += (UINT32)result;
+		}
+		return true;
+	}
+
+	template <typename PacketT>
+	bool Send(const PacketT& packet_)
+	{
+		return SendRaw((const char*)&packet_, sizeof(packet_));
+	}
+
+	// Ŷ ϳ pPacket_ ´. timeoutMs_ 0̸ ̹ ޾Ƶ ͸ .
+	//ȯ : ð ȿ  ʾҰų   false
+	bool RecvPacket(std::vector<char>* pPacket_, const UINT32 timeoutMs_ = TEST_RECV_TIMEOUT_MS)
+	{
+		auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs_);
+		while (true)
+		{
+			if (mRecvData.size() >= PACKET_HEADER_LENGTH)
+			{
+				auto packetLength = ((PACKET_HEADER*)mRecvData.data())->PacketLength;
+				if (packetLength >= PACKET_HEADER_LENGTH && mRecvData.size() >= packetLength)
+				{
+					pPacket_->assign(mRecvData.begin(), mRecvData.begin() + packetLength);
+					mRecvData.erase(mRecvData.begin(), mRecvData.begin() + packetLength);
+					return true;
+				}
+			}
+
+			if (mIsClosedByPeer)
+			{
+				return false;
+			}
+
+			auto remainMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - std::chrono::steady_clock::now()).count();
+			pollfd pollFd = { mSocket, POLLIN, 0 };
+			if (poll(&pollFd, 1, (int)(remainMs > 0 ? remainMs : 0)) <= 0)
+			{
+				if (remainMs <= 0)
+				{
+					return false;
+				}
+				continue;
+			}
+
+			char buffer[8192];
+			auto recvSize = recv(mSocket, buffer, sizeof(buffer), 0);
+			if (recvSize <= 0)
+			{
+				mIsClosedByPeer = true;
+				continue;
+			}
+			mRecvData.insert(mRecvData.end(), buffer, buffer + recvSize);
+		}
+	}
+
+	//packetId_ Ŷ   ޴´.  ̿  ٸ Ŷ .
+	bool WaitPacket(const PACKET_ID packetId_, std::vector<char>* pPacket_, const UINT32 timeoutMs_ = TEST_RECV_TIMEOUT_MS)
+	{
+		auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs_);
+		while (true)
+		{
+			auto remainMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - std::chrono::steady_clock::now()).count();
+			if (remainMs <= 0 || RecvPacket(pPacket_, (UINT32)remainMs) == false)
+			{
+				return false;
+			}
+
+			if (((PACKET_HEADER*)pPacket_->data())->PacketId == (UINT16)packetId_)
+			{
+				return true;
+			}
+		}
+	}
+
+	//  .
+	bool IsClosedByPeer() const { return mIsClosedByPeer; }
+
+private:
+	SOCKET mSocket = INVALID_SOCKET;
+	std::vector<char> mRecvData;	// Ŷ    
+	bool mIsClosedByPeer = false;
+};
+
+
+// UDP Ŭ̾Ʈ.  UDP Ʈ ְ޴´. UDP Ŷ ϳ  Ŷ ϳ ִ.
+class TestUdpClient
+{
+public:
+	~TestUdpClient()
+	{
+		if (mSocket != INVALID_SOCKET)
+		{
+			close(mSocket);
+		}
+	}
+
+	bool Connect(const UINT16 udpPort_)
+	{
+		mSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+
+		sockaddr_in serverAddr = {};
+		serverAddr.sin_family = AF_INET;
+		serverAddr.sin_port = htons(udpPort_);
+		inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+
+		return connect(mSocket, (sockaddr*)&serverAddr, sizeof(serverAddr)) == 0;
+	}
+
+	bool SendRaw(const char* pData_, const UINT32 size_)
+	{
+		return send(mSocket, pData_, size_, 0) == (ssize_t)size_;
+	}
+
+	template <typename PacketT>
+	bool Send(const PacketT& packet_)
+	{
+		return SendRaw((const char*)&packet_, sizeof(packet_));
+	}
+
+	//ȯ : ð ȿ  ʾ false
+	bool RecvPacket(std::vector<char>* pPacket_, const UINT32 timeoutMs_)
+	{
+		pollfd pollFd = { mSocket, POLLIN, 0 };
+		if (poll(&pollFd, 1, (int)timeoutMs_) <= 0)
+		{
+			return false;
+		}
+
+		char buffer[1024];
+		auto recvSize = recv(mSocket, buffer, sizeof(buffer), 0);
+		if (recvSize < (ssize_t)PACKET_HEADER_LENGTH)
+		{
+			return false;
+		}
+
+		pPacket_->assign(buffer, buffer + recvSize);
+		return true;
+	}
+
+private:
+	SOCKET mSocket = INVALID_SOCKET;
+};
\ No newline at end of file
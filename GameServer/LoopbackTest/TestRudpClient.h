@@ -0,0 +1,296 @@
+#pragma once
+
+#include "TestClient.h"
+#include "../ErrorCode.h"
+#include "../ServerNetwork/ReliableUdp.h"
+
+#include <deque>
+#include <map>
+
+const UINT32 TEST_RUDP_RETRANSMIT_MS = 50;
+
+// ŷڼ UDP Ŭ̾Ʈ.  ReliableUdp  ּ Ѵ.
+//Ʈ  (UDP_STREAM) .  Ŷ ׸Ʈ ϳ  ͸ ٷ, ޴   ģ.
+class TestRudpClient
+{
+public:
+	struct stDelivered
+	{
+		UINT8 Stream = 0;
+		std::vector<char> Packet;
+	};
+
+	bool Connect(const UINT16 udpPort_)
+	{
+		return mUdp.Connect(udpPort_);
+	}
+
+	//ŷڼ UDP ûϸ ´. Ҿ û/ ٽ .
+	//ȯ :  ŷڼ UDP ؼ  true
+	bool Bind(const UINT64 token_, const UINT32 maxTry_)
+	{
+		UDP_BIND_REQUEST_PACKET bindPacket;
+		bindPacket.Token = token_;
+		bindPacket.IsReliable = 1;
+
+		std::vector<char> packet;
+		for (UINT32 i = 0; i < maxTry_; ++i)
+		{
+			mUdp.Send(bindPacket);
+
+			while (mUdp.RecvPacket(&packet, 100))
+			{
+				auto pBindRes = (UDP_BIND_RESPONSE_PACKET*)packet.data();
+				if (pBindRes->PacketId == (UINT16)PACKET_ID::UDP_BIND_RESPONSE)
+				{
+					return pBindRes->Result == (UINT16)ERROR_CODE::NONE && pBindRes->IsReliable == 1;
+				}
+			}
+		}
+		return false;
+	}
+
+	//Ŷ  Ŷ Ʈ . Ȯ    Update() ٽ .
+	template <typename PacketT>
+	void Send(const PacketT& packet_)
+	{
+		static_assert(sizeof(PacketT) <= RUDP_MAX_PAYLOAD_SIZE, "׸Ʈ ϳ  Ѵ");
+
+		auto streamIndex = (UINT8)GetUdpStream(packet_.PacketId);
+		mStreams[streamIndex].Pending.emplace_back((const char*)&packet_, (const char*)&packet_ + sizeof(packet_));
+		Flush(streamIndex);
+	}
+
+	//timeoutMs_ (0̸ ̹  ִ ͸)  ׸Ʈ óϰ, ۰ Ȯ  . ޵ Ŷ GetDelivered() δ.
+	void Update(const UINT32 timeoutMs_)
+	{
+		auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs_);
+		std::vector<char> datagram;
+		while (true)
+		{
+			auto remainMs = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - std::chrono::steady_clock::now()).count();
+			auto isReceived = mUdp.RecvPacket(&datagram, (UINT32)(remainMs > 0 ? remainMs : 0));
+			if (isReceived)
+			{
+				OnDatagram(datagram);
+			}
+
+			Tick();
+
+			if (isReceived == false && remainMs <= 0)
+			{
+				return;
+			}
+		}
+	}
+
+	std::deque<stDelivered>& GetDelivered() { return mDelivered; }
+
+	//  Ȯ    ׸Ʈ 
+	UINT32 GetUnackedCount() const
+	{
+		UINT32 count = 0;
+		for (auto& stream : mStreams)
+		{
+			count += (UINT32)(stream.Inflight.size() + stream.Pending.size());
+		}
+		return count;
+	}
+
+	UINT32 GetRetransmitCount() const { return mRetransmitCount; }
+
+private:
+	struct stInflight
+	{
+		std::vector<char> Datagram;
+		std::chrono::steady_clock::time_point SentTime;
+	};
+
+	struct stStream
+	{
+		UINT16 NextSeq = 0;
+		std::deque<std::vector<char>> Pending;
+		std::map<UINT16, stInflight> Inflight;	// -> Ȯ  ٸ ׸Ʈ
+
+		UINT16 RecvExpected = 0;
+		UINT32 RecvMask = 0;
+		std::map<UINT16, std::vector<char>> RecvBuffer;	// ->  ٸ ׸Ʈ( )
+		std::vector<char> Reassembly;
+		bool IsAckPending = false;
+	};
+
+	RUDP_DELIVERY GetDelivery(const UINT8 stream_) const
+	{
+		const RUDP_DELIVERY deliveries[] = { RUDP_DELIVERY::UNRELIABLE_SEQUENCED, RUDP_DELIVERY::RELIABLE_UNORDERED,
+			RUDP_DELIVERY::RELIABLE_ORDERED, RUDP_DELIVERY::RELIABLE_ORDERED };
+		return deliveries[stream_];
+	}
+
+	void SendDatagram(const UINT8 streamIndex_, std::vector<char>* pDatagram_)
+	{
+		auto& stream = mStreams[streamIndex_];
+		auto pHeader = (stRudpHeader*)pDatagram_->data();
+		pHeader->Flags |= RUDP_FLAG_ACK;
+		pHeader->AckSeq = stream.RecvExpected;
+		pHeader->AckBits = stream.RecvMask;
+		stream.IsAckPending = false;
+
+		mUdp.SendRaw(pDatagram_->data(), (UINT32)pDatagram_->size());
+	}
+
+	std::vector<char> BuildDatagram(const UINT8 streamIndex_, const UINT8 flags_, const UINT16 seq_, const std::vector<char>& payload_)
+	{
+		std::vector<char> datagram(RUDP_HEADER_SIZE + payload_.size());
+		auto pHeader = (stRudpHeader*)datagram.data();
+		pHeader->DatagramLength = (UINT16)datagram.size();
+		pHeader->SegmentPacketId = (UINT16)PACKET_ID::UDP_RELIABLE_SEGMENT;
+		pHeader->Type = 0;
+		pHeader->Stream = streamIndex_;
+		pHeader->Flags = flags_;
+		pHeader->Seq = seq_;
+		pHeader->AckSeq = 0;
+		pHeader->AckBits = 0;
+		std::copy(payload_.begin(), payload_.end(), datagram.begin() + RUDP_HEADER_SIZE);
+		return datagram;
+	}
+
+	//  츦  ʰ .
+	void Flush(const UINT8 streamIndex_)
+	{
+		auto& stream = mStreams[streamIndex_];
+		while (stream.Pending.empty() == false && stream.Inflight.size() < RUDP_WINDOW_SIZE)
+		{
+			auto seq = stream.NextSeq++;
+			auto& inflight = stream.Inflight[seq];
+			inflight.Datagram = BuildDatagram(streamIndex_, RUDP_FLAG_DATA, seq, stream.Pending.front());
+			inflight.SentTime = std::chrono::steady_clock::now();
+			stream.Pending.pop_front();
+
+			SendDatagram(streamIndex_, &inflight.Datagram);
+		}
+	}
+
+	void Tick()
+	{
+		auto now = std::chrono::steady_clock::now();
+		for (UINT8 i = 0; i < (UINT8)UDP_STREAM::COUNT; ++i)
+		{
+			auto& stream = mStreams[i];
+			for (auto& inflight : stream.Inflight)
+			{
+				if (now - inflight.second.SentTime >= std::chrono::milliseconds(TEST_RUDP_RETRANSMIT_MS))
+				{
+					++mRetransmitCount;
+					inflight.second.SentTime = now;
+					SendDatagram(i, &inflight.second.Datagram);
+				}
+			}
+
+			if (stream.IsAckPending)
+			{
+				auto ackDatagram = BuildDatagram(i, 0, 0, {});
+				SendDatagram(i, &ackDatagram);
+			}
+		}
+	}
+
+	void OnDatagram(const std::vector<char>& datagram_)
+	{
+		auto pHeader = (stRudpHeader*)datagram_.data();
+		if (datagram_.size() < RUDP_HEADER_SIZE || pHeader->SegmentPacketId != (UINT16)PACKET_ID::UDP_RELIABLE_SEGMENT ||
+			pHeader->Stream >= (UINT8)UDP_STREAM::COUNT)
+		{
+			return;
+		}
+
+		auto& stream = mStreams[pHeader->Stream];
+		if (pHeader->Flags & RUDP_FLAG_ACK)
+		{
+			for (auto iter = stream.Inflight.begin(); iter != stream.Inflight.end();)
+			{
+				auto seq = iter->first;
+				UINT16 bit = seq - pHeader->AckSeq - 1;
+				auto isAcked = (INT16)(seq - pHeader->AckSeq) < 0 || (bit < 32 && (pHeader->AckBits & (1u << bit)));
+				iter = isAcked ? stream.Inflight.erase(iter) : std::next(iter);
+			}
+			Flush(pHeader->Stream);
+		}
+
+		if ((pHeader->Flags & RUDP_FLAG_DATA) == 0)
+		{
+			return;
+		}
+
+		if (GetDelivery(pHeader->Stream) == RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+		{
+			Deliver(pHeader->Stream, datagram_.data() + RUDP_HEADER_SIZE, (UINT32)datagram_.size() - RUDP_HEADER_SIZE);
+			return;
+		}
+
+		stream.IsAckPending = true;
+
+		UINT16 distance = pHeader->Seq - stream.RecvExpected;
+		if (distance > RUDP_WINDOW_SIZE || (distance > 0 && (stream.RecvMask & (1u << (distance - 1)))))
+		{
+			++mDuplicateCount;
+			return;
+		}
+
+		if (distance > 0)
+		{
+			stream.RecvMask |= 1u << (distance - 1);
+			stream.RecvBuffer[pHeader->Seq] = datagram_;
+			return;
+		}
+
+		OnInOrder(pHeader->Stream, datagram_);
+		stream.RecvExpected++;
+
+		while (stream.RecvMask & 1)
+		{
+			stream.RecvMask >>= 1;
+			auto node = stream.RecvBuffer.extract(stream.RecvExpected);
+			OnInOrder(pHeader->Stream, node.mapped());
+			stream.RecvExpected++;
+		}
+		stream.RecvMask >>= 1;
+	}
+
+	//  ׸Ʈ. ŷڼ  Ʈ  ģ.
+	void OnInOrder(const UINT8 streamIndex_, const std::vector<char>& datagram_)
+	{
+		auto pHeader = (stRudpHeader*)datagram_.data();
+		auto pPayload = datagram_.data() + RUDP_HEADER_SIZE;
+		auto payloadSize = (UINT32)datagram_.size() - RUDP_HEADER_SIZE;
+
+		auto& stream = mStreams[streamIndex_];
+		if (GetDelivery(streamIndex_) == RUDP_DELIVERY::RELIABLE_UNORDERED ||
+			((pHeader->Flags & RUDP_FLAG_MORE_FRAGMENTS) == 0 && stream.Reassembly.empty()))
+		{
+			Deliver(streamIndex_, pPayload, payloadSize);
+			return;
+		}
+
+		stream.Reassembly.insert(stream.Reassembly.end(), pPayload, pPayload + payloadSize);
+		if ((pHeader->Flags & RUDP_FLAG_MORE_FRAGMENTS) == 0)
+		{
+			Deliver(streamIndex_, stream.Reassembly.data(), (UINT32)stream.Reassembly.size());
+			stream.Reassembly.clear();
+		}
+	}
+
+	void Deliver(const UINT8 streamIndex_, const char* pData_, const UINT32 size_)
+	{
+		stDelivered delivered;
+		delivered.Stream = streamIndex_;
+		delivered.Packet.assign(pData_, pData_ + size_);
+		mDelivered.push_back(std::move(delivered));
+	}
+
+	TestUdpClient mUdp;
+	stStream mStreams[(UINT8)UDP_STREAM::COUNT];
+	std::deque<stDelivered> mDelivered;
+
+	UINT32 mRetransmitCount = 0;
+	UINT32 mDuplicateCount = 0;
+};
\ No newline at end of file
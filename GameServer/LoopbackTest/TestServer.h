@@ -0,0 +1,156 @@
+#pragma once
+
+#include "../ServerNetwork/LinuxDefine.h"
+
+#include <spawn.h>
+#include <signal.h>
+#include <stdio.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+
+extern char** environ;
+
+const UINT32 TEST_SERVER_START_TIMEOUT_MS = 10000;
+const UINT32 TEST_SERVER_STOP_TIMEOUT_MS = 10000;
+
+// gameserver μ. ǥ Է   ִٰ ܼ  quit .
+class TestServer
+{
+public:
+	~TestServer()
+	{
+		Stop();
+	}
+
+	//ȯ :   port_   true
+	bool Start(const std::string& path_, const UINT16 port_, const std::vector<std::string>& args_)
+	{
+		int inputPipe[2];
+		if (pipe(inputPipe) != 0)
+		{
+			printf("[] pipe()  : %d\n", errno);
+			return false;
+		}
+
+		posix_spawn_file_actions_t actions;
+		posix_spawn_file_actions_init(&actions);
+		posix_spawn_file_actions_adddup2(&actions, inputPipe[0], STDIN_FILENO);
+		posix_spawn_file_actions_addclose(&actions, inputPipe[1]);
+
+		std::vector<std::string> args = { path_, "--port=" + std::to_string(port_) };
+		args.insert(args.end(), args_.begin(), args_.end());
+
+		std::vector<char*> argv;
+		for (auto& arg : args)
+		{
+			argv.push_back(arg.data());
+		}
+		argv.push_back(nullptr);
+
+		auto result = posix_spawn(&mPid, path_.c_str(), &actions, nullptr, argv.data(), environ);
+		posix_spawn_file_actions_destroy(&actions);
+		close(inputPipe[0]);
+
+		if (result != 0)
+		{
+			printf("[]   (%d) : %s\n", result, path_.c_str());
+			close(inputPipe[1]);
+			mPid = 0;
+			return false;
+		}
+		mInputFd = inputPipe[1];
+
+		return WaitForListen(port_);
+	}
+
+	//quit  ⸦ ٸ. ð ȿ   δ.
+	//ȯ :    0 ָ true
+	bool Stop()
+	{
+		if (mPid <= 0)
+		{
+			return true;
+		}
+
+		const char quitCommand[] = "quit\n";
+		if (write(mInputFd, quitCommand, sizeof(quitCommand) - 1) < 0)
+		{
+			printf("[]  quit   : %d\n", errno);
+		}
+
+		int status = 0;
+		auto isExited = WaitForExit(TEST_SERVER_STOP_TIMEOUT_MS, &status);
+		if (isExited == false)
+		{
+			printf("[]  %ums ȿ  ʾƼ \n", TEST_SERVER_STOP_TIMEOUT_MS);
+			kill(mPid, SIGKILL);
+			waitpid(mPid, &status, 0);
+		}
+
+		close(mInputFd);
+		mInputFd = -1;
+		mPid = 0;
+
+		return isExited && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+	}
+
+private:
+	bool WaitForListen(const UINT16 port_)
+	{
+		auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(TEST_SERVER_START_TIMEOUT_MS);
+		while (std::chrono::steady_clock::now() < endTime)
+		{
+			int status = 0;
+			if (waitpid(mPid, &status, WNOHANG) == mPid)
+			{
+				printf("[]  ϴٰ  : status(%d)\n", status);
+				close(mInputFd);
+				mInputFd = -1;
+				mPid = 0;
+				return false;
+			}
+
+			auto probeSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+			sockaddr_in serverAddr = {};
+			serverAddr.sin_family = AF_INET;
+			serverAddr.sin_port = htons(port_);
+			inet_pton(AF_INET, "127.0.0.1", &serverAddr.sin_addr);
+
+			auto result = connect(probeSocket, (sockaddr*)&serverAddr, sizeof(serverAddr));
+			close(probeSocket);
+			if (result == 0)
+			{
+				return true;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		}
+
+		printf("[]  %ums ȿ Ʈ(%u)  \n", TEST_SERVER_START_TIMEOUT_MS, port_);
+		return false;
+	}
+
+	bool WaitForExit(const UINT32 timeoutMs_, int* pStatus_)
+	{
+		auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs_);
+		while (std::chrono::steady_clock::now() < endTime)
+		{
+			if (waitpid(mPid, pStatus_, WNOHANG) == mPid)
+			{
+				return true;
+			}
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+		}
+		return false;
+	}
+
+	pid_t mPid = 0;
+	int mInputFd = -1;	// ǥ Է
+};
\ No newline at end of file
@@ -8,6 +8,10 @@
 #include "DetourCommon.h"
 #include "unity.h"
 
+#ifndef _WIN32
+#include "ServerNetwork/LinuxDefine.h"
+#endif
+
 // -----------------------------------------------------------
 // RecastDemo  ˿   ü (ʼ)
 // -----------------------------------------------------------
@@ -1,8 +1,13 @@
 #pragma once
 
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include "ServerNetwork/LinuxDefine.h"
+#endif
 #include "unity.h"
+#include "GamePacket.h"	//Ŷ ID Ŷ ü. GamePacket.pdl .
 
 struct RawPacketData
 {
@@ -41,544 +46,47 @@ struct PacketInfo
 	UINT16 PacketId = 0;
 	UINT16 DataSize = 0;
 	char* pDataPtr = nullptr;
+	UINT64 RecvTimeNs = 0;	//I/O 尡  ð. Ŷ  Ͽ̰  ʾ 0
 };
 
-// ================= ̺丮 =========================
-
-enum class ITEM_TYPE : UINT16
+//UDP  ǿ UDP  Ŷ
+inline bool IsUnreliablePacket(const UINT16 packetId_)
 {
-	NONE = 0,
-	WEAPON = 1,      // 
-	ARMOR = 2,       // 
-	POTION = 3,      // 
-	MATERIAL = 4,    // 
-	QUEST = 5        // Ʈ 
-};
+	return packetId_ == (UINT16)PACKET_ID::UPDATE_PLAYER_MOVEMENT || packetId_ == (UINT16)PACKET_ID::ENEMY_PATROL_UPDATE;
+}
 
-struct Item
+//UDP ޴ Ŷ.  .
+inline bool IsUnreliableRecvPacket(const UINT16 packetId_)
 {
-	UINT32 itemID;           //   ID
-	ITEM_TYPE itemType;      //  Ÿ
-	UINT16 quantity;         // 
-	char itemName[32];       //  ̸
-};
-
-const UINT32 MAX_INVENTORY_SIZE = 40; // κ丮 ִ 
+	return packetId_ == (UINT16)PACKET_ID::PLAYER_MOVEMENT;
+}
 
-enum class QUEST_STATE : UINT8
+//ŷڼ UDP  Ʈ. Ʈ   ζ  ̵ Ŷ ڿ ä, κ丮, Ʈ Ŷ  ʴ´.
+enum class UDP_STREAM : UINT8
 {
-	NOT_ACCEPTED = 0,
-	IN_PROGRESS = 1,
-	COMPLETED = 2, // Ϸ ư ()
-};
-
-// ====================================================
-
-enum class  PACKET_ID : UINT16
-{
-	//SYSTEM
-	SYS_USER_CONNECT = 11,
-	SYS_USER_DISCONNECT = 12,
-	SYS_END = 30,
-
-	//DB
-	DB_END = 199,
-
-	//Client
-	LOGIN_REQUEST = 201,
-	LOGIN_RESPONSE = 202,
-
-	// Enter
-	ROOM_ENTER_REQUEST = 206,
-	ROOM_ENTER_RESPONSE = 207,
-	ROOM_NEW_USER_NTF = 208, // ϴ Ե 
-	ROOM_USER_INFO_NTF = 209, // Zone ִ   (ϴ Ը )
-
-	// Leave
-	ROOM_LEAVE_REQUEST = 215,
-	ROOM_LEAVE_RESPONSE = 216,
-	ROOM_LEAVE_USER_NTF = 217,
-
-	// Move
-	PLAYER_MOVEMENT,
-	UPDATE_PLAYER_MOVEMENT,
-
-	ROOM_CHAT_REQUEST = 221,
-	ROOM_CHAT_RESPONSE = 222,
-	ROOM_CHAT_NOTIFY = 223,
-
-	// Path
-	MOVE_PATH_REQUEST = 225,
-	MOVE_PATH_RESPONSE = 226,
-	MOVE_PATH_NOTIFY = 227,
-
-	// Inventory
-	INVENTORY_INFO_REQUEST = 301,      // κ丮  û
-	INVENTORY_INFO_RESPONSE = 302,     // κ丮  
-
-	ITEM_ADD_REQUEST = 303,            //  ߰ û
-	ITEM_ADD_RESPONSE = 304,           //  ߰ 
-	ITEM_ADD_NOTIFY = 305,             //  ߰ ˸ (ٸ )
-
-	ITEM_USE_REQUEST = 306,            //   û
-	ITEM_USE_RESPONSE = 307,           //   
-
-	ITEM_DROP_REQUEST = 308,           //   û
-	ITEM_DROP_RESPONSE = 309,          //   
-
-	ITEM_MOVE_REQUEST = 310,           //  ̵ ( )
-	ITEM_MOVE_RESPONSE = 311,          //  ̵ 
-
-	// Combat System
-	PLAYER_ATTACK_REQUEST = 401,
-	PLAYER_ATTACK_RESPONSE = 402,
-	HIT_REPORT = 404,
-
-	// Enemy System
-	ENEMY_SPAWN_NOTIFY = 421,
-	ENEMY_DESPAWN_NOTIFY = 422,
-	ENEMY_PATROL_UPDATE = 423,
-	ENEMY_DAMAGE_NOTIFY = 424,
-	ENEMY_DEATH_NOTIFY = 425,
-
-	// Quest
-	QUEST_TALK_REQUEST = 501,
-	QUEST_TALK_RESPONSE = 502,
-	QUEST_ACCEPT_REQUEST = 503,
-	QUEST_ACCEPT_RESPONSE = 504,
-	QUEST_PROGRESS_NOTIFY = 505,
-	QUEST_COMPLETE_REQUEST = 506,
-	QUEST_COMPLETE_RESPONSE = 507,
+	MOVEMENT = 0,	// .   .
+	COMBAT = 1,		// ŷڼ,  
+	CHAT = 2,		// ŷڼ,  
+	GAME = 3,		// ŷڼ,  . , κ丮, Ʈ  
+	COUNT
 };
 
-#pragma pack(push,1)
-struct PACKET_HEADER
+inline UDP_STREAM GetUdpStream(const UINT16 packetId_)
 {
-	const UINT16 PacketLength;
-	const UINT16 PacketId;
-	const UINT8 Type = 0; //࿩ ȣȭ  Ӽ ˾Ƴ 
-	PACKET_HEADER(UINT16 PacketLength, PACKET_ID PacketId, UINT8 Type = 0) : PacketLength{ PacketLength }, PacketId{ (UINT16)PacketId }, Type{ Type }
+	if (packetId_ == (UINT16)PACKET_ID::PLAYER_MOVEMENT || IsUnreliablePacket(packetId_))
 	{
+		return UDP_STREAM::MOVEMENT;
 	}
-};
-const UINT32 PACKET_HEADER_LENGTH = sizeof(PACKET_HEADER);
-
-//- α û
-const int MAX_USER_ID_LEN = 32;
-const int MAX_USER_PW_LEN = 32;
-
-struct LOGIN_REQUEST_PACKET : public PACKET_HEADER
-{
-	char userID[MAX_USER_ID_LEN + 1];
-	char userPW[MAX_USER_PW_LEN + 1];
-
-	LOGIN_REQUEST_PACKET() : userID{ 0, }, PACKET_HEADER(sizeof(*this), PACKET_ID::LOGIN_REQUEST) {}
-};
-const size_t LOGIN_REQUEST_PACKET_SIZE = sizeof(LOGIN_REQUEST_PACKET);
-
-
-struct LOGIN_RESPONSE_PACKET : public PACKET_HEADER
-{
-	UINT16 Result;
-
-	LOGIN_RESPONSE_PACKET() : Result{ 0 }, PACKET_HEADER(sizeof(*this), PACKET_ID::LOGIN_RESPONSE) {}
-};
-
-
-//- 뿡  û
-//const int MAX_ROOM_TITLE_SIZE = 32;
-struct ROOM_ENTER_REQUEST_PACKET : public PACKET_HEADER
-{
-	INT32 RoomNumber;
-	ROOM_ENTER_REQUEST_PACKET() : RoomNumber{ 0 },PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_ENTER_REQUEST) {}
-};
-
-struct ROOM_ENTER_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT16 Result;
-	//char RivaluserID[MAX_USER_ID_LEN + 1] = { 0, };
-	ROOM_ENTER_RESPONSE_PACKET() : Result{ 0 }, PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_ENTER_RESPONSE) {}
-};
-
-struct ROOM_NEW_USER_NTF_PACKET : public PACKET_HEADER
-{
-	INT64 userUUID;
-	char userID[MAX_USER_ID_LEN + 1];
-	Vector3 position;
-	Quaternion rotation;
-
-	ROOM_NEW_USER_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_NEW_USER_NTF) {}
-};
-
-struct ROOM_USER_INFO_NTF_PACKET : public PACKET_HEADER
-{
-	
-	INT64 userUUID;
-	char userID[MAX_USER_ID_LEN + 1];
-	Vector3 position;
-	Quaternion rotation;
-
-	ROOM_USER_INFO_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_USER_INFO_NTF) {}
-};
-
-struct PLAYER_MOVEMENT_PACKET : public PACKET_HEADER
-{
-	INT64 userUUID;
-	float dx;
-	float dy;
-	Quaternion rotation;
-
-	PLAYER_MOVEMENT_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_MOVEMENT) {}
-};
-
-
-struct UPDATE_PLAYER_MOVEMENT_PACKET : public PACKET_HEADER
-{
-	INT64 player_id;
-	Vector3 motion;
-	Quaternion rotation;
-
-	Vector3 position;
-
-	UPDATE_PLAYER_MOVEMENT_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::UPDATE_PLAYER_MOVEMENT) {}
-};
-
-
-//-   û
-struct ROOM_LEAVE_REQUEST_PACKET : public PACKET_HEADER
-{
-	ROOM_LEAVE_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_REQUEST) {}
-};
-
-
-struct ROOM_LEAVE_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT16 Result;
-	ROOM_LEAVE_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_RESPONSE) {}
-};
-
-
-struct ROOM_LEAVE_USER_NTF_PACKET : public PACKET_HEADER
-{
-	INT64 userUUID;
-	char userID[MAX_USER_ID_LEN + 1];
-	ROOM_LEAVE_USER_NTF_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_LEAVE_USER_NTF) {}
-};
-
-
-//  ä
-const static int MAX_CHAT_MSG_SIZE = 256;
-struct ROOM_CHAT_REQUEST_PACKET : public PACKET_HEADER
-{
-	char Message[MAX_CHAT_MSG_SIZE + 1] = { 0, };
-
-	ROOM_CHAT_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_REQUEST) {}
-};
-
-
-struct ROOM_CHAT_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT16 Result;
-
-	ROOM_CHAT_RESPONSE_PACKET() : Result{ 0 }, PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_RESPONSE) {}
-};
-
-
-struct ROOM_CHAT_NOTIFY_PACKET : public PACKET_HEADER
-{
-	char userID[MAX_USER_ID_LEN + 1] = { 0, };
-	char Msg[MAX_CHAT_MSG_SIZE + 1] = { 0, };
-
-	ROOM_CHAT_NOTIFY_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::ROOM_CHAT_NOTIFY) {}
-};
-
-
-struct MOVE_PATH_REQUEST_PACKET : public PACKET_HEADER
-{
-	INT64 userUUID;
-	Vector3 startPos;
-	Vector3 endPos;
-
-	MOVE_PATH_REQUEST_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::MOVE_PATH_REQUEST) {}
-};
-
-
-struct MOVE_PATH_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT64 userUUID;
-	Vector3 path[10];
-	INT16 pathCount;
-
-	MOVE_PATH_RESPONSE_PACKET() : PACKET_HEADER(sizeof(*this), PACKET_ID::MOVE_PATH_RESPONSE) {}
-};
-
-// ================= κ丮 =========================
-// κ丮  û
-struct INVENTORY_INFO_REQUEST_PACKET : public PACKET_HEADER
-{
-	INVENTORY_INFO_REQUEST_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::INVENTORY_INFO_REQUEST) {
-	}
-};
-
-// κ丮  
-struct INVENTORY_INFO_RESPONSE_PACKET : public PACKET_HEADER
-{
-	UINT16 Result;
-	UINT16 itemCount;
-	Item items[MAX_INVENTORY_SIZE];
-
-	INVENTORY_INFO_RESPONSE_PACKET()
-		: Result(0), itemCount(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::INVENTORY_INFO_RESPONSE) {
-	}
-};
-
-//  ߰ û
-struct ITEM_ADD_REQUEST_PACKET : public PACKET_HEADER
-{
-	UINT32 itemID;
-	UINT16 quantity;
-
-	ITEM_ADD_REQUEST_PACKET()
-		: itemID(0), quantity(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_ADD_REQUEST) {
-	}
-};
-
-//  ߰ 
-struct ITEM_ADD_RESPONSE_PACKET : public PACKET_HEADER
-{
-	UINT16 Result;
-	Item addedItem;
-	UINT16 slotIndex;  // ߰  ε
-
-	ITEM_ADD_RESPONSE_PACKET()
-		: Result(0), slotIndex(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_ADD_RESPONSE) {
-	}
-};
-
-//   û
-struct ITEM_USE_REQUEST_PACKET : public PACKET_HEADER
-{
-	UINT16 slotIndex;
-
-	ITEM_USE_REQUEST_PACKET()
-		: slotIndex(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_USE_REQUEST) {
-	}
-};
-
-//   
-struct ITEM_USE_RESPONSE_PACKET : public PACKET_HEADER
-{
-	UINT16 Result;
-	UINT16 slotIndex;
-	UINT16 remainingQuantity;
-
-	ITEM_USE_RESPONSE_PACKET()
-		: Result(0), slotIndex(0), remainingQuantity(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::ITEM_USE_RESPONSE) {
-	}
-};
-// ====================================================
-
-// ===================== Attack =========================
-// ÷̾  û
-struct PLAYER_ATTACK_REQUEST_PACKET : public PACKET_HEADER
-{
-	Vector3 attackPosition;
-	Vector3 attackDirection;
-
-	PLAYER_ATTACK_REQUEST_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_ATTACK_REQUEST) {
-	}
-};
-
-// ÷̾  
-struct PLAYER_ATTACK_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT16 Result;
-	INT64 targetEnemyID;
-	INT32 damageAmount;
-
-	PLAYER_ATTACK_RESPONSE_PACKET()
-		: Result(0), targetEnemyID(0), damageAmount(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::PLAYER_ATTACK_RESPONSE) {
-	}
-};
-
-//   ˸
-struct ENEMY_SPAWN_NOTIFY_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;
-	INT32 enemyType;
-	Vector3 position;
-	Quaternion rotation;
-	INT32 maxHealth;
-	INT32 currentHealth;
-
-	ENEMY_SPAWN_NOTIFY_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_SPAWN_NOTIFY) {
-	}
-};
-
-//   ˸
-struct ENEMY_DESPAWN_NOTIFY_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;
-
-	ENEMY_DESPAWN_NOTIFY_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DESPAWN_NOTIFY) {
-	}
-};
-
-//  Ʈ Ʈ
-struct ENEMY_PATROL_UPDATE_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;
-	Vector3 position;
-	Quaternion rotation;
-	Vector3 velocity;
-
-	ENEMY_PATROL_UPDATE_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_PATROL_UPDATE) {
-	}
-};
-
-struct ENEMY_DAMAGE_NOTIFY_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;
-	INT64 attackerID;
-	INT32 damageAmount;
-	INT32 remainingHealth;
 
-	ENEMY_DAMAGE_NOTIFY_PACKET()
-		: enemyID(0), attackerID(0), damageAmount(0), remainingHealth(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DAMAGE_NOTIFY) {
-	}
-};
-
-//   ˸
-struct ENEMY_DEATH_NOTIFY_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;
-	INT64 killerID;
-
-	ENEMY_DEATH_NOTIFY_PACKET()
-		: PACKET_HEADER(sizeof(*this), PACKET_ID::ENEMY_DEATH_NOTIFY) {
-	}
-};
-
-struct HIT_REPORT_PACKET : public PACKET_HEADER
-{
-	INT64 enemyID;     // INT64
-	INT32 damage;
-	float hitX, hitY, hitZ;   // 
-	UINT32 seq;               // 
-	HIT_REPORT_PACKET() : enemyID(0), damage(0), hitX(0), hitY(0), hitZ(0), seq(0),
-		PACKET_HEADER(sizeof(*this), PACKET_ID::HIT_REPORT) {
-	}
-};
-// ====================================================
-
-
-// ===================== Quest =========================
-const int MAX_QUEST_TITLE_LEN = 32;
-const int MAX_QUEST_DESC_LEN = 64;
-
-struct QUEST_TALK_REQUEST_PACKET : public PACKET_HEADER
-{
-	INT32 npc_id;
-	QUEST_TALK_REQUEST_PACKET() : npc_id{ 0 }, PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_TALK_REQUEST) {}
-};
-
-struct QUEST_TALK_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT32 npc_id;
-	INT32 quest_id;
-	UINT8 state;
-	UINT8 _pad0;        // (Ŭ  padding )
-
-	UINT16 current;
-	UINT16 required;
-
-	char title[MAX_QUEST_TITLE_LEN]; // 32
-	char desc[MAX_QUEST_DESC_LEN];   // 64
-
-	UINT32 rewardItemID;
-	UINT16 rewardQty;
-
-	// Unity  Size=128 ־ payload 128 ǰ padding ( )
-	char _padTail[12];
-
-	QUEST_TALK_RESPONSE_PACKET()
-		: npc_id{ 0 }, quest_id{ 1 }, state{ 0 }, _pad0{ 0 }, current{ 0 }, required{ 1 },
-		title{ 0, }, desc{ 0, }, rewardItemID{ 0 }, rewardQty{ 0 }, _padTail{ 0, },
-		PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_TALK_RESPONSE) {
-	}
-};
-
-struct QUEST_ACCEPT_REQUEST_PACKET : public PACKET_HEADER
-{
-	INT32 npc_id;
-	INT32 quest_id;
-	QUEST_ACCEPT_REQUEST_PACKET() : npc_id{ 0 }, quest_id{ 1 }, PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_ACCEPT_REQUEST) {}
-};
-
-struct QUEST_ACCEPT_RESPONSE_PACKET : public PACKET_HEADER
-{
-	INT32 quest_id;
-	UINT8 result;   // Unity: 1=
-	UINT8 state;
-
-	UINT16 current;
-	UINT16 required;
-
-	char _padTail[6]; // payload 16 bytes ϰ
-
-	QUEST_ACCEPT_RESPONSE_PACKET()
-		: quest_id{ 1 }, result{ 0 }, state{ 0 }, current{ 0 }, required{ 1 }, _padTail{ 0, },
-		PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_ACCEPT_RESPONSE) {
-	}
-};
-
-struct QUEST_COMPLETE_REQUEST_PACKET : public PACKET_HEADER
-{
-	INT32 QuestId;
-	QUEST_COMPLETE_REQUEST_PACKET()
-		: QuestId{ 1 }, PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_COMPLETE_REQUEST) {
-	}
-};
-
-struct QUEST_COMPLETE_RESPONSE_PACKET : public PACKET_HEADER
-{
-	UINT16 Result; // 0=,  = ڵ
-	INT32 QuestId;
-	UINT8 State;
-
-	QUEST_COMPLETE_RESPONSE_PACKET()
-		: Result{ 0 }, QuestId{ 1 }, State{ (UINT8)QUEST_STATE::NOT_ACCEPTED },
-		PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_COMPLETE_RESPONSE) {
+	if (packetId_ >= (UINT16)PACKET_ID::ROOM_CHAT_REQUEST && packetId_ <= (UINT16)PACKET_ID::ROOM_CHAT_NOTIFY)
+	{
+		return UDP_STREAM::CHAT;
 	}
-};
 
-struct QUEST_PROGRESS_NOTIFY_PACKET : public PACKET_HEADER
-{
-	INT32 quest_id;
-	UINT16 current;
-	UINT16 required;
-	UINT8 state;
-	UINT8 _pad[3]; // ŷ 
-
-	QUEST_PROGRESS_NOTIFY_PACKET()
-		: quest_id(0), current(0), required(0), state(0), _pad{ 0,0,0 },
-		PACKET_HEADER(sizeof(*this), PACKET_ID::QUEST_PROGRESS_NOTIFY) {
+	if (packetId_ >= (UINT16)PACKET_ID::PLAYER_ATTACK_REQUEST && packetId_ <= (UINT16)PACKET_ID::ENEMY_DEATH_NOTIFY)
+	{
+		return UDP_STREAM::COMBAT;
 	}
-};
-
-// ====================================================
-
-#pragma pack(pop) //  ŷ 
 
+	return UDP_STREAM::GAME;
+}
\ No newline at end of file
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Packet.h"
+#include "recastnavigation/RecastDemo/Contrib/fastlz/fastlz.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+
+
+//PACKET_HEADER::Type  Ʈ.  Ŷ  ڿ  Ŷ (UINT16)    fastlz( 1)  Ͱ ´.
+//	[PACKET_HEADER(  ,  PacketId, Type | PACKET_TYPE_COMPRESSED)][UINT16  ][ ]
+const UINT8 PACKET_TYPE_COMPRESSED = 0x01;
+const UINT32 PACKET_COMPRESS_INFO_LENGTH = PACKET_HEADER_LENGTH + sizeof(UINT16);
+
+const UINT32 PACKET_COMPRESS_MAX_SIZE = 8192;			//̺ ū Ŷ  ʴ´. ۽    ũ⸦ д.
+//fastlz  ʴ Է¿ 32Ʈ 1Ʈ ð,  ۰ 66Ʈ   ȴ.
+const UINT32 PACKET_COMPRESS_BUFFER_SIZE = PACKET_COMPRESS_INFO_LENGTH + PACKET_COMPRESS_MAX_SIZE + PACKET_COMPRESS_MAX_SIZE / 16 + 66;
+const UINT32 PACKET_DECOMPRESS_BUFFER_SIZE = 0xFFFF;	// ̴ UINT16̹Ƿ  ũ   Ŷ̵ Ǯ  ִ.
+const UINT32 PACKET_COMPRESS_STAT_ID_COUNT = 1024;		//踦  PacketId 
+
+inline bool IsCompressedPacket(const char* pPacket_)
+{
+	return (((PACKET_HEADER*)pPacket_)->Type & PACKET_TYPE_COMPRESSED) != 0;
+}
+
+//ũⰡ ū Ŷ fastlz ϰ   Ŷ Ǭ. Ŷ ID  Ʈ .
+//۽ ,  忡,  , UDP 忡 Բ θǷ ´    ̴.
+class PacketCompressor
+{
+public:
+	static PacketCompressor& Instance()
+	{
+		static PacketCompressor instance;
+		return instance;
+	}
+
+	//threshold_ : ̺  Ŷ  ʴ´. 0̸     Ŷ Ǭ.
+	void Init(const UINT32 threshold_)
+	{
+		mThreshold = threshold_;
+	}
+
+	//pOut_ : PACKET_COMPRESS_BUFFER_SIZE ̻
+	//ȯ :  Ŷ ũ.  ʾҰų  ʾ 0̰  Ŷ ״  ȴ.
+	UINT32 Compress(const char* pPacket_, const UINT32 packetSize_, char* pOut_)
+	{
+		if (mThreshold == 0 || packetSize_ < mThreshold || packetSize_ > PACKET_COMPRESS_MAX_SIZE || IsCompressedPacket(pPacket_))
+		{
+			return 0;
+		}
+
+		auto pHeader = (PACKET_HEADER*)pPacket_;
+		auto bodySize = packetSize_ - PACKET_HEADER_LENGTH;
+		auto compressedSize = (UINT32)fastlz_compress_level(1, pPacket_ + PACKET_HEADER_LENGTH, (int)bodySize, pOut_ + PACKET_COMPRESS_INFO_LENGTH);
+		auto outSize = PACKET_COMPRESS_INFO_LENGTH + compressedSize;
+
+		auto pStat = GetStat(pHeader->PacketId);
+		if (compressedSize == 0 || outSize >= packetSize_)
+		{
+			if (pStat != nullptr)
+			{
+				pStat->SkippedCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			return 0;
+		}
+
+		PACKET_HEADER header((UINT16)outSize, (PACKET_ID)pHeader->PacketId, (UINT8)(pHeader->Type | PACKET_TYPE_COMPRESSED));
+		CopyMemory(pOut_, &header, PACKET_HEADER_LENGTH);
+		auto originalSize = (UINT16)packetSize_;
+		CopyMemory(pOut_ + PACKET_HEADER_LENGTH, &originalSize, sizeof(originalSize));
+
+		if (pStat != nullptr)
+		{
+			pStat->CompressedCount.fetch_add(1, std::memory_order_relaxed);
+			pStat->OriginalBytes.fetch_add(packetSize_, std::memory_order_relaxed);
+			pStat->CompressedBytes.fetch_add(outSize, std::memory_order_relaxed);
+		}
+		return outSize;
+	}
+
+	// Ŷ տ   Ŷ ũ. Ǯ ۸  ũ⸸ŭ   .    0
+	static UINT16 GetOriginalSize(const char* pPacket_, const UINT32 packetSize_)
+	{
+		if (packetSize_ <= PACKET_COMPRESS_INFO_LENGTH)
+		{
+			return 0;
+		}
+
+		UINT16 originalSize = 0;
+		CopyMemory(&originalSize, pPacket_ + PACKET_HEADER_LENGTH, sizeof(originalSize));
+		return originalSize;
+	}
+
+	// Ŷ  Ŷ Ǯ pOut_ .   Ʈ .
+	//ȯ :  Ŷ ũ.  Ͱ ߸Ǿų outCapacity_  ũ 0
+	UINT32 Decompress(const char* pPacket_, const UINT32 packetSize_, char* pOut_, const UINT32 outCapacity_)
+	{
+		auto pHeader = (PACKET_HEADER*)pPacket_;
+		auto originalSize = GetOriginalSize(pPacket_, packetSize_);
+		if (originalSize <= PACKET_HEADER_LENGTH || originalSize > outCapacity_)
+		{
+			return Fail();
+		}
+
+		auto bodySize = (int)(originalSize - PACKET_HEADER_LENGTH);
+		auto decompressedSize = fastlz_decompress(pPacket_ + PACKET_COMPRESS_INFO_LENGTH, (int)(packetSize_ - PACKET_COMPRESS_INFO_LENGTH),
+			pOut_ + PACKET_HEADER_LENGTH, bodySize);
+		if (decompressedSize != bodySize)
+		{
+			return Fail();
+		}
+
+		PACKET_HEADER header(originalSize, (PACKET_ID)pHeader->PacketId, (UINT8)(pHeader->Type & ~PACKET_TYPE_COMPRESSED));
+		CopyMemory(pOut_, &header, PACKET_HEADER_LENGTH);
+
+		mDecompressedCount.fetch_add(1, std::memory_order_relaxed);
+		return originalSize;
+	}
+
+	// Ŷ ޴     ѹ .
+	void Print()
+	{
+		UINT64 totalOriginalBytes = 0;
+		UINT64 totalCompressedBytes = 0;
+
+		for (UINT32 packetId = 0; packetId < PACKET_COMPRESS_STAT_ID_COUNT; ++packetId)
+		{
+			auto& stat = mStats[packetId];
+			auto compressedCount = stat.CompressedCount.load(std::memory_order_relaxed);
+			auto skippedCount = stat.SkippedCount.load(std::memory_order_relaxed);
+			if (compressedCount == 0 && skippedCount == 0)
+			{
+				continue;
+			}
+
+			auto originalBytes = stat.OriginalBytes.load(std::memory_order_relaxed);
+			auto compressedBytes = stat.CompressedBytes.load(std::memory_order_relaxed);
+			totalOriginalBytes += originalBytes;
+			totalCompressedBytes += compressedBytes;
+
+			printf("[] id(%u) compressed(%llu) skipped(%llu) bytes(%llu -> %llu) saved(%llu, %.1f%%)\n",
+				packetId, (unsigned long long)compressedCount, (unsigned long long)skippedCount,
+				(unsigned long long)originalBytes, (unsigned long long)compressedBytes, (unsigned long long)(originalBytes - compressedBytes),
+				(originalBytes == 0) ? 0.0 : 100.0 * (double)(originalBytes - compressedBytes) / (double)originalBytes);
+		}
+
+		printf("[] threshold(%u) saved(%llu bytes) decompressed(%llu) failed(%llu)\n",
+			mThreshold, (unsigned long long)(totalOriginalBytes - totalCompressedBytes),
+			(unsigned long long)mDecompressedCount.load(std::memory_order_relaxed), (unsigned long long)mFailedCount.load(std::memory_order_relaxed));
+	}
+
+private:
+	struct stCompressStat
+	{
+		std::atomic<UINT64> CompressedCount{ 0 };
+		std::atomic<UINT64> SkippedCount{ 0 };	//ص  ʾƼ ״  
+		std::atomic<UINT64> OriginalBytes{ 0 };
+		std::atomic<UINT64> CompressedBytes{ 0 };
+	};
+
+	stCompressStat* GetStat(const UINT16 packetId_)
+	{
+		return (packetId_ < PACKET_COMPRESS_STAT_ID_COUNT) ? &mStats[packetId_] : nullptr;
+	}
+
+	UINT32 Fail()
+	{
+		mFailedCount.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	UINT32 mThreshold = 0;
+	stCompressStat mStats[PACKET_COMPRESS_STAT_ID_COUNT];
+	std::atomic<UINT64> mDecompressedCount{ 0 };
+	std::atomic<UINT64> mFailedCount{ 0 };
+};
\ No newline at end of file
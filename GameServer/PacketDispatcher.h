@@ -0,0 +1,128 @@
+#pragma once
+
+#include "Packet.h"
+
+#include <type_traits>
+
+
+//Ŷ ID ε ٷ ã ڵ鷯 ǥ ũ. Redis  ID(1001~) ´.
+const UINT16 PACKET_DISPATCH_TABLE_SIZE = 1024;
+
+//Ŷ ID ޴ ü ּ ũ. ޴ Ŷ PACKET_TYPE...() ũη Ưȭؾ   ִ.
+//Type void̸   Ŷ̴( Ͱ nullptr  ִ).
+template<UINT16 PacketId>
+struct stPacketType;
+
+//GamePacket.h Ŷ  MIN_SIZE  ִ.  ü ũ⸦ .
+template<typename PacketT, typename = void>
+struct stPacketMinSize
+{
+	static constexpr UINT16 VALUE = (UINT16)sizeof(PacketT);
+};
+
+template<typename PacketT>
+struct stPacketMinSize<PacketT, std::void_t<decltype(PacketT::MIN_SIZE)>>
+{
+	static constexpr UINT16 VALUE = PacketT::MIN_SIZE;
+};
+
+#define PACKET_TYPE(packetId_, type_) \
+	template<> struct stPacketType<(UINT16)(packetId_)> { typedef type_ Type; static constexpr UINT16 MIN_SIZE = stPacketMinSize<type_>::VALUE; }
+
+//  Ŷ. ڵ鷯  ũ ȿ о Ѵ.
+#define PACKET_TYPE_MIN_SIZE(packetId_, type_, minSize_) \
+	template<> struct stPacketType<(UINT16)(packetId_)> { typedef type_ Type; static constexpr UINT16 MIN_SIZE = (UINT16)(minSize_); }
+
+#define PACKET_TYPE_NO_BODY(packetId_) \
+	template<> struct stPacketType<(UINT16)(packetId_)> { typedef void Type; static constexpr UINT16 MIN_SIZE = 0; }
+
+enum class PACKET_DISPATCH_RESULT : UINT8
+{
+	SUCCESS,
+	NO_HANDLER,
+	TOO_SHORT,	//ϵ ü  Ŷ. ڵ鷯 θ ʴ´.
+};
+
+//Ŷ ID ٷ ã ڵ鷯 ǥ. Init()  ϰ  ڿ б⸸ ϹǷ  忡 Dispatch()ص ȴ.
+//ڵ鷯 OwnerT  Լ (ContextT...,  ȣ, ü)  (ContextT...,  ȣ, ũ, ü)  ޴´.
+//  Ŷ ڵ鷯 (ContextT...,  ȣ)  ޴´.   Ŷ ̸_VIEW ϸ 並 ޴´.
+template<typename OwnerT, typename... ContextT>
+class PacketDispatcher
+{
+public:
+	typedef void(*DISPATCH_FUNCTION)(OwnerT&, ContextT..., UINT32, UINT16, char*);
+
+	template<auto PacketId, auto Handler>
+	void Register()
+	{
+		constexpr auto packetId = (UINT16)PacketId;
+		static_assert(packetId < PACKET_DISPATCH_TABLE_SIZE, "packet id out of dispatch table");
+
+		typedef stPacketType<packetId> PacketType;
+		mTable[packetId].Func = &Invoke<typename PacketType::Type, Handler>;
+		mTable[packetId].MinSize = PacketType::MIN_SIZE;
+	}
+
+	PACKET_DISPATCH_RESULT Check(const UINT16 packetId_, const UINT16 packetSize_) const
+	{
+		if (packetId_ >= PACKET_DISPATCH_TABLE_SIZE || mTable[packetId_].Func == nullptr)
+		{
+			return PACKET_DISPATCH_RESULT::NO_HANDLER;
+		}
+
+		if (packetSize_ < mTable[packetId_].MinSize)
+		{
+			return PACKET_DISPATCH_RESULT::TOO_SHORT;
+		}
+
+		return PACKET_DISPATCH_RESULT::SUCCESS;
+	}
+
+	UINT16 GetMinSize(const UINT16 packetId_) const
+	{
+		return packetId_ < PACKET_DISPATCH_TABLE_SIZE ? mTable[packetId_].MinSize : 0;
+	}
+
+	PACKET_DISPATCH_RESULT Dispatch(OwnerT& owner_, ContextT... context_, const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_) const
+	{
+		auto result = Check(packetId_, packetSize_);
+		if (result == PACKET_DISPATCH_RESULT::SUCCESS)
+		{
+			mTable[packetId_].Func(owner_, context_..., clientIndex_, packetSize_, pPacket_);
+		}
+		return result;
+	}
+
+private:
+	struct stEntry
+	{
+		DISPATCH_FUNCTION Func = nullptr;
+		UINT16 MinSize = 0;
+	};
+
+	template<typename PacketT, auto Handler>
+	static void Invoke(OwnerT& owner_, ContextT... context_, UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+	{
+		if constexpr (std::is_void_v<PacketT>)
+		{
+			UNREFERENCED_PARAMETER(packetSize_);
+			UNREFERENCED_PARAMETER(pPacket_);
+			(owner_.*Handler)(context_..., clientIndex_);
+		}
+		else if constexpr (std::is_constructible_v<PacketT, const char*, UINT16>)
+		{
+			(owner_.*Handler)(context_..., clientIndex_, PacketT(pPacket_, packetSize_));
+		}
+		else if constexpr (std::is_invocable_v<decltype(Handler), OwnerT&, ContextT..., UINT32, const PacketT&>)
+		{
+			UNREFERENCED_PARAMETER(packetSize_);
+			(owner_.*Handler)(context_..., clientIndex_, *reinterpret_cast<const PacketT*>(pPacket_));
+		}
+		else
+		{
+			(owner_.*Handler)(context_..., clientIndex_, packetSize_, *reinterpret_cast<const PacketT*>(pPacket_));
+		}
+	}
+
+	stEntry mTable[PACKET_DISPATCH_TABLE_SIZE];
+};
\ No newline at end of file
@@ -0,0 +1,321 @@
+#pragma once
+
+#include "PacketSchema.h"
+
+//Ű  GamePacket.h .  ü 1Ʈ ̰ ũ ʵ ġ static_assert Ѵ.
+//var ʵ尡 ִ Ŷ  ũ ȿ д ̸_VIEW .
+class PacketCppWriter
+{
+public:
+	std::string Write(const PacketSchema& schema_)
+	{
+		mOut.clear();
+
+		Line("//GamePacket.pdl packetgen  ̴.  ġ  GamePacket.pdl ģ  packet_codegen Ÿ ٽ .");
+		Line("#pragma once");
+		Line("");
+		Line("#ifdef _WIN32");
+		Line("#define WIN32_LEAN_AND_MEAN");
+		Line("#include <windows.h>");
+		Line("#else");
+		Line("#include \"ServerNetwork/LinuxDefine.h\"");
+		Line("#endif");
+		Line("#include \"unity.h\"");
+		Line("");
+		Line("#include <stddef.h>");
+		Line("#include <string.h>");
+		Line("#include <algorithm>");
+		Line("#include <string_view>");
+		Line("");
+		Line("//ʵ ġ ˻(offsetof) PACKET_HEADER  ü .  ̶ ġ  ִ.");
+		Line("#if defined(__GNUC__)");
+		Line("#pragma GCC diagnostic push");
+		Line("#pragma GCC diagnostic ignored \"-Winvalid-offsetof\"");
+		Line("#endif");
+
+		for (auto& decl : schema_.GetDecls())
+		{
+			if (decl.Kind == SCHEMA_DECL::CONST)
+			{
+				WriteConst(schema_, schema_.GetConsts()[decl.Index]);
+			}
+			else if (decl.Kind == SCHEMA_DECL::ENUM)
+			{
+				WriteEnum(schema_, schema_.GetEnums()[decl.Index]);
+			}
+		}
+
+		WritePacketIdEnum(schema_);
+
+		Line("");
+		Line("#pragma pack(push,1)");
+		Line("struct PACKET_HEADER");
+		Line("{");
+		Line("\tconst UINT16 PacketLength;");
+		Line("\tconst UINT16 PacketId;");
+		Line("\tconst UINT8 Type = 0; //࿩ ȣȭ  Ӽ ˾Ƴ ");
+		Line("\tPACKET_HEADER(UINT16 PacketLength, PACKET_ID PacketId, UINT8 Type = 0) : PacketLength{ PacketLength }, PacketId{ (UINT16)PacketId }, Type{ Type }");
+		Line("\t{");
+		Line("\t}");
+		Line("};");
+		Line("const UINT32 PACKET_HEADER_LENGTH = sizeof(PACKET_HEADER);");
+		Line("static_assert(sizeof(PACKET_HEADER) == 5, \"GamePacket.pdl: PACKET_HEADER\");");
+
+		bool hasView = false;
+		for (auto& schemaStruct : schema_.GetStructs())
+		{
+			hasView |= schemaStruct.HasVarField();
+		}
+		if (hasView)
+		{
+			WriteViewHelper();
+		}
+
+		for (auto& decl : schema_.GetDecls())
+		{
+			if (decl.Kind == SCHEMA_DECL::STRUCT)
+			{
+				WriteStruct(schema_, schema_.GetStructs()[decl.Index]);
+			}
+		}
+
+		Line("");
+		Line("#pragma pack(pop) //  ŷ ");
+		Line("");
+		Line("#if defined(__GNUC__)");
+		Line("#pragma GCC diagnostic pop");
+		Line("#endif");
+
+		// ٸ ҽó  ٹٲ  ʴ´.
+		mOut.pop_back();
+		return mOut;
+	}
+
+private:
+	void Line(const std::string& text_)
+	{
+		mOut += text_;
+		mOut += '\n';
+	}
+
+	void WriteLeading(const stSchemaComment& comment_, const char* pIndent_)
+	{
+		if (comment_.IsBlankBefore)
+		{
+			Line("");
+		}
+		for (auto& text : comment_.Leading)
+		{
+			Line(pIndent_ + text);
+		}
+	}
+
+	static std::string WithTrailing(const std::string& code_, const stSchemaComment& comment_)
+	{
+		return comment_.Trailing.empty() ? code_ : code_ + "\t" + comment_.Trailing;
+	}
+
+	void WriteConst(const PacketSchema& schema_, const stSchemaConst& constant_)
+	{
+		WriteLeading(constant_.Comment, "");
+		Line(WithTrailing("const " + schema_.GetType(constant_.TypeName).CppName + " " + constant_.Name + " = " + constant_.ValueText + ";", constant_.Comment));
+	}
+
+	void WriteEnum(const PacketSchema& schema_, const stSchemaEnum& schemaEnum_)
+	{
+		WriteLeading(schemaEnum_.Comment, "");
+		Line(WithTrailing("enum class " + schemaEnum_.Name + " : " + schema_.GetType(schemaEnum_.TypeName).CppName, schemaEnum_.Comment));
+		Line("{");
+		for (auto& member : schemaEnum_.Members)
+		{
+			WriteLeading(member.Comment, "\t");
+			Line(WithTrailing("\t" + member.Name + " = " + member.ValueText + ",", member.Comment));
+		}
+		Line("};");
+	}
+
+	// ּ ִ 𿡼  ٷ  . id   ּ ⿡  packet   ּ ü տ .
+	void WritePacketIdEnum(const PacketSchema& schema_)
+	{
+		Line("");
+		Line("enum class PACKET_ID : UINT16");
+		Line("{");
+		bool isFirst = true;
+		for (auto& packetId : schema_.GetPacketIds())
+		{
+			auto& leading = (packetId.StructIndex < 0) ? packetId.Comment.Leading : schema_.GetStructs()[packetId.StructIndex].Comment.Leading;
+			if (leading.empty() == false && isFirst == false)
+			{
+				Line("");
+			}
+			if (packetId.StructIndex < 0)
+			{
+				for (auto& text : leading)
+				{
+					Line("\t" + text);
+				}
+			}
+			isFirst = false;
+
+			Line(WithTrailing("\t" + packetId.Name + " = " + packetId.ValueText + ",", packetId.Comment));
+		}
+		Line("};");
+	}
+
+	void WriteViewHelper()
+	{
+		Line("");
+		Line("//var ڿ ʵ带  ũ ȿ д´.  ڰ  capacity_ - 1 ڸ  ʴ´.");
+		Line("inline std::string_view ReadPacketString(const char* pPacket_, const UINT16 packetSize_, const size_t offset_, const size_t capacity_)");
+		Line("{");
+		Line("\tif (packetSize_ <= offset_)");
+		Line("\t{");
+		Line("\t\treturn std::string_view();");
+		Line("\t}");
+		Line("");
+		Line("\tauto maxLen = std::min<size_t>(packetSize_ - offset_, capacity_ - 1);");
+		Line("\treturn std::string_view(pPacket_ + offset_, strnlen(pPacket_ + offset_, maxLen));");
+		Line("}");
+		Line("");
+		Line("//var 迭 ʵ   ũ ȿ   ִ  ");
+		Line("inline UINT16 GetPacketArrayCount(const UINT16 packetSize_, const size_t offset_, const size_t elementSize_, const size_t capacity_)");
+		Line("{");
+		Line("\tif (packetSize_ <= offset_)");
+		Line("\t{");
+		Line("\t\treturn 0;");
+		Line("\t}");
+		Line("");
+		Line("\treturn (UINT16)std::min<size_t>((packetSize_ - offset_) / elementSize_, capacity_);");
+		Line("}");
+	}
+
+	void WriteStruct(const PacketSchema& schema_, const stSchemaStruct& schemaStruct_)
+	{
+		if (schemaStruct_.Comment.IsBlankBefore == false)
+		{
+			Line("");
+		}
+		WriteLeading(schemaStruct_.Comment, "");
+
+		// ּ  Ŷ PACKET_ID  ּ  .
+		if (schemaStruct_.IsPacket && schemaStruct_.Comment.Leading.empty())
+		{
+			for (auto& packetId : schema_.GetPacketIds())
+			{
+				if (packetId.Name == schemaStruct_.PacketName && packetId.Comment.Trailing.empty() == false)
+				{
+					Line(packetId.Comment.Trailing);
+				}
+			}
+		}
+
+		Line(schemaStruct_.IsPacket ? "struct " + schemaStruct_.Name + " : public PACKET_HEADER" : "struct " + schemaStruct_.Name);
+		Line("{");
+		if (schemaStruct_.IsPacket)
+		{
+			Line("\tstatic constexpr UINT16 MIN_SIZE = " + std::to_string(schemaStruct_.MinSize) + ";" + (schemaStruct_.HasVarField() ? "\t//var ʵ   ̻ ޾ƾ Ѵ." : ""));
+			if (schemaStruct_.Fields.empty() == false)
+			{
+				Line("");
+			}
+		}
+
+		for (auto& field : schemaStruct_.Fields)
+		{
+			WriteLeading(field.Comment, "\t");
+			Line(WithTrailing("\t" + GetFieldDeclaration(schema_, field) + ";", field.Comment));
+		}
+
+		if (schemaStruct_.IsPacket)
+		{
+			if (schemaStruct_.Fields.empty() == false)
+			{
+				Line("");
+			}
+			Line("\t" + schemaStruct_.Name + "() : PACKET_HEADER(sizeof(*this), PACKET_ID::" + schemaStruct_.PacketName + ") {}");
+		}
+		Line("};");
+
+		auto assertName = "\"GamePacket.pdl: " + schemaStruct_.Name;
+		Line("static_assert(sizeof(" + schemaStruct_.Name + ") == " + std::to_string(schemaStruct_.Size) + ", " + assertName + "\");");
+		for (auto& field : schemaStruct_.Fields)
+		{
+			Line("static_assert(offsetof(" + schemaStruct_.Name + ", " + field.Name + ") == " + std::to_string(field.Offset) + ", " + assertName + "::" + field.Name + "\");");
+		}
+
+		if (schemaStruct_.HasVarField())
+		{
+			WriteView(schema_, schemaStruct_);
+		}
+	}
+
+	std::string GetFieldDeclaration(const PacketSchema& schema_, const stSchemaField& field_) const
+	{
+		auto& type = schema_.GetType(field_.TypeName);
+
+		auto declaration = type.CppName + " " + field_.Name;
+		if (field_.IsArray())
+		{
+			return declaration + "[" + field_.CountText + "]" + (type.IsChar ? " = { 0, }" : " = {}");
+		}
+
+		if (field_.DefaultText.empty() == false)
+		{
+			return declaration + " = " + (type.Kind == SCHEMA_TYPE_KIND::ENUM ? type.CppName + "::" + field_.DefaultText : field_.DefaultText);
+		}
+
+		return declaration + (type.IsInteger ? " = 0" : " = {}");
+	}
+
+	// ۸ ״ Ų. var  ʵ MIN_SIZE ȿ Ƿ ٷ а var ʵ  ũ д´.
+	void WriteView(const PacketSchema& schema_, const stSchemaStruct& schemaStruct_)
+	{
+		auto viewName = schemaStruct_.PacketName + "_VIEW";
+		auto& packetName = schemaStruct_.Name;
+
+		Line("");
+		Line("//" + packetName + "  ʰ  ũ ȿ д´.  ۸ Ű⸸ ϹǷ ۺ     ȴ.");
+		Line("class " + viewName);
+		Line("{");
+		Line("public:");
+		Line("\tstatic constexpr UINT16 MIN_SIZE = " + packetName + "::MIN_SIZE;");
+		Line("");
+		Line("\t" + viewName + "(const char* pPacket_, const UINT16 packetSize_) : mpPacket(pPacket_), mPacketSize(packetSize_)");
+		Line("\t{");
+		Line("\t}");
+		Line("");
+		Line("\tUINT16 GetPacketSize() const { return mPacketSize; }");
+
+		for (auto& field : schemaStruct_.Fields)
+		{
+			auto& type = schema_.GetType(field.TypeName);
+			auto offset = "offsetof(" + packetName + ", " + field.Name + ")";
+
+			Line("");
+			if (type.IsChar)
+			{
+				auto capacity = field.IsVar ? "sizeof(" + packetName + "::" + field.Name + ")" : "sizeof(" + packetName + "::" + field.Name + ") + 1";
+				Line("\tstd::string_view " + field.Name + "() const { return ReadPacketString(mpPacket, " + (field.IsVar ? "mPacketSize" : "MIN_SIZE") + ", " + offset + ", " + capacity + "); }");
+			}
+			else if (field.IsArray())
+			{
+				Line("\tUINT16 " + field.Name + "Count() const { return " + (field.IsVar ? "GetPacketArrayCount(mPacketSize, " + offset + ", sizeof(" + type.CppName + "), " + field.CountText + ")" : field.CountText) + "; }");
+				Line("\t" + type.CppName + " " + field.Name + "(const UINT16 index_) const { return Get()." + field.Name + "[index_]; }");
+			}
+			else
+			{
+				Line("\t" + type.CppName + " " + field.Name + "() const { return Get()." + field.Name + "; }");
+			}
+		}
+
+		Line("");
+		Line("private:");
+		Line("\tconst " + packetName + "& Get() const { return *reinterpret_cast<const " + packetName + "*>(mpPacket); }");
+		Line("");
+		Line("\tconst char* mpPacket = nullptr;");
+		Line("\tUINT16 mPacketSize = 0;");
+		Line("};");
+	}
+
+	std::string mOut;
+};
\ No newline at end of file
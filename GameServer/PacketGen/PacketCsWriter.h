@@ -0,0 +1,101 @@
+#pragma once
+
+#include "PacketSchema.h"
+
+//Ű Unity Ŭ̾Ʈ Packets.cs .  ü  1Ʈ  ü Marshal ٷ а .
+//Unity   ڵ  ־ ּ  ASCIIθ .
+class PacketCsWriter
+{
+public:
+	std::string Write(const PacketSchema& schema_)
+	{
+		mOut.clear();
+
+		Line("// Generated from GameServer/GamePacket.pdl by packetgen. Do not edit by hand;");
+		Line("// change GamePacket.pdl and build the packet_codegen target instead.");
+		Line("using System.Runtime.InteropServices;");
+		Line("using UnityEngine;");
+
+		for (auto& schemaEnum : schema_.GetEnums())
+		{
+			Line("");
+			Line("public enum " + schemaEnum.Name + " : " + schema_.GetType(schemaEnum.TypeName).CsName);
+			Line("{");
+			for (auto& member : schemaEnum.Members)
+			{
+				Line("    " + member.CsName + " = " + std::to_string(member.Value) + ",");
+			}
+			Line("}");
+		}
+
+		Line("");
+		Line("public enum E_PACKET : ushort");
+		Line("{");
+		for (auto& packetId : schema_.GetPacketIds())
+		{
+			if (packetId.CsName.empty())
+			{
+				continue;
+			}
+
+			auto line = "    " + packetId.CsName + " = " + std::to_string(packetId.Value) + ",";
+			Line(packetId.CsName == packetId.Name ? line : line + " // " + packetId.Name);
+		}
+		Line("}");
+
+		for (auto& schemaStruct : schema_.GetStructs())
+		{
+			WriteStruct(schema_, schemaStruct);
+		}
+
+		mOut.pop_back();
+		return mOut;
+	}
+
+private:
+	void Line(const std::string& text_)
+	{
+		mOut += text_;
+		mOut += '\n';
+	}
+
+	void WriteStruct(const PacketSchema& schema_, const stSchemaStruct& schemaStruct_)
+	{
+		Line("");
+		Line("[StructLayout(LayoutKind.Sequential, Pack = 1, CharSet = CharSet.Ansi)]");
+		if (schemaStruct_.IsPacket)
+		{
+			Line("public struct " + schemaStruct_.CsName + " // " + std::to_string(schemaStruct_.PacketId) + " " + schemaStruct_.PacketName + ", " + std::to_string(schemaStruct_.Size - PACKET_HEADER_SIZE) + " bytes");
+		}
+		else
+		{
+			Line("public struct " + schemaStruct_.CsName + " // " + std::to_string(schemaStruct_.Size) + " bytes");
+		}
+		Line("{");
+
+		for (auto& field : schemaStruct_.Fields)
+		{
+			auto& type = schema_.GetType(field.TypeName);
+			if (type.IsChar)
+			{
+				Line("    [MarshalAs(UnmanagedType.ByValTStr, SizeConst = " + std::to_string(field.Count) + ")]");
+				Line("    public string " + field.CsName + ";");
+			}
+			else if (field.IsArray())
+			{
+				Line("    [MarshalAs(UnmanagedType.ByValArray, SizeConst = " + std::to_string(field.Count) + ")]");
+				Line("    public " + type.CsName + "[] " + field.CsName + ";");
+			}
+			else
+			{
+				Line("    public " + type.CsName + " " + field.CsName + ";");
+			}
+		}
+
+		Line("}");
+	}
+
+	static const UINT32 PACKET_HEADER_SIZE = 5;
+
+	std::string mOut;
+};
\ No newline at end of file
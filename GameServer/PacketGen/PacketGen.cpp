@@ -0,0 +1,93 @@
+#include "PacketCppWriter.h"
+#include "PacketCsWriter.h"
+
+//   ǵ帮 ʴ´. isCheck_̸  ʰ ٸ Ѵ.
+static bool WriteOutput(const std::string& path_, const std::string& content_, const bool isCheck_)
+{
+	std::string current;
+	{
+		std::ifstream file(path_, std::ios::binary);
+		if (file.is_open())
+		{
+			std::stringstream buffer;
+			buffer << file.rdbuf();
+			current = buffer.str();
+		}
+	}
+
+	if (current == content_)
+	{
+		return true;
+	}
+
+	if (isCheck_)
+	{
+		printf("[] %s  Ű ٸ. packet_codegen Ÿ ٽ  Ѵ.\n", path_.c_str());
+		return false;
+	}
+
+	std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+	if (file.is_open() == false)
+	{
+		printf("[]     : %s\n", path_.c_str());
+		return false;
+	}
+	file << content_;
+
+	printf("[packetgen] %s\n", path_.c_str());
+	return true;
+}
+
+//Ŷ Ű(GamePacket.pdl)  GamePacket.h Unity Ŭ̾Ʈ Packets.cs .
+//--check̸   ʰ   ٸ 1 ش.  尡 ̰ɷ Ű ߳  ´.
+//
+//	packetgen GamePacket.pdl --cpp=GamePacket.h --cs=../GameClient/Assets/02_Scripts/Backend/Packets.cs
+//	packetgen GamePacket.pdl --cpp=GamePacket.h --check
+int main(int argc, char* argv[])
+{
+	std::string schemaPath;
+	std::string cppPath;
+	std::string csPath;
+	bool isCheck = false;
+
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg.rfind("--cpp=", 0) == 0) { cppPath = arg.substr(6); }
+		else if (arg.rfind("--cs=", 0) == 0) { csPath = arg.substr(5); }
+		else if (arg == "--check") { isCheck = true; }
+		else if (arg.rfind("--", 0) != 0 && schemaPath.empty()) { schemaPath = arg; }
+		else
+		{
+			printf("[]     : %s\n", arg.c_str());
+			return 1;
+		}
+	}
+
+	if (schemaPath.empty() || (cppPath.empty() && csPath.empty()))
+	{
+		printf(" : packetgen <Ű> [--cpp=<>] [--cs=<C# >] [--check]\n");
+		return 1;
+	}
+
+	PacketSchema schema;
+	if (schema.Load(schemaPath) == false)
+	{
+		return 1;
+	}
+
+	bool isSuccess = true;
+	if (cppPath.empty() == false)
+	{
+		PacketCppWriter writer;
+		isSuccess &= WriteOutput(cppPath, writer.Write(schema), isCheck);
+	}
+
+	if (csPath.empty() == false)
+	{
+		PacketCsWriter writer;
+		isSuccess &= WriteOutput(csPath, writer.Write(schema), isCheck);
+	}
+
+	return isSuccess ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,921 @@
+#pragma once
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include "../ServerNetwork/LinuxDefine.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <string.h>
+#include <ctype.h>
+#include <fstream>
+#include <sstream>
+
+//  ּ.  ٷ  ٵ ּ Leading,     ּ Trailing̴.
+// ٷ  ּ  𿡵  ʴ´(Ű ,   ǥ ).
+struct stSchemaComment
+{
+	std::vector<std::string> Leading;
+	std::string Trailing;
+	bool IsBlankBefore = false;	//տ   ־.  Ͽ   д.
+};
+
+enum class SCHEMA_TYPE_KIND : UINT8
+{
+	PRIMITIVE,
+	ENUM,
+	STRUCT,
+};
+
+struct stSchemaType
+{
+	SCHEMA_TYPE_KIND Kind = SCHEMA_TYPE_KIND::PRIMITIVE;
+	std::string CppName;
+	std::string CsName;
+	UINT32 Size = 0;
+	bool IsChar = false;	//迭θ . C# string̴.
+	bool IsInteger = false;
+};
+
+struct stSchemaField
+{
+	std::string TypeName;
+	std::string Name;
+	std::string CsName;
+	std::string CountText;	//迭 ƴϸ  ִ.
+	UINT32 Count = 0;		//迭 ƴϸ 0
+	std::string DefaultText;
+	bool IsVar = false;
+	UINT32 Offset = 0;		//ü ۺ. Ŷ̸  Ѵ.
+	UINT32 ElementSize = 0;
+	stSchemaComment Comment;
+
+	bool IsArray() const { return Count > 0; }
+	UINT32 GetSize() const { return ElementSize * (IsArray() ? Count : 1); }
+};
+
+struct stSchemaConst
+{
+	std::string TypeName;
+	std::string Name;
+	std::string ValueText;
+	INT64 Value = 0;
+	stSchemaComment Comment;
+};
+
+struct stSchemaEnumMember
+{
+	std::string Name;
+	std::string CsName;
+	std::string ValueText;
+	INT64 Value = 0;
+	stSchemaComment Comment;
+};
+
+struct stSchemaEnum
+{
+	std::string Name;
+	std::string TypeName;
+	std::vector<stSchemaEnumMember> Members;
+	stSchemaComment Comment;
+};
+
+struct stSchemaStruct
+{
+	std::string Name;			//C++ ü ̸. Ŷ̸ ̸_PACKET
+	std::string CsName;
+	std::vector<stSchemaField> Fields;
+	UINT32 Size = 0;
+	UINT32 MinSize = 0;			//Ŷ. var ʵ尡  var ʵ   ũ
+	bool IsPacket = false;
+	std::string PacketName;		//PACKET_ID ̸
+	INT64 PacketId = 0;
+	stSchemaComment Comment;
+
+	bool HasVarField() const { return Fields.empty() == false && Fields.back().IsVar; }
+};
+
+struct stSchemaPacketId
+{
+	std::string Name;
+	std::string CsName;		//Unity E_PACKET ̸.   Ŭ̾Ʈ  ʴ´.
+	std::string ValueText;
+	INT64 Value = 0;
+	INT32 StructIndex = -1;	//packet ̸  ü
+	stSchemaComment Comment;	//packet ̸ Trailing . Leading ü տ .
+};
+
+enum class SCHEMA_DECL : UINT8
+{
+	CONST,
+	ENUM,
+	STRUCT,
+};
+
+struct stSchemaDecl
+{
+	SCHEMA_DECL Kind = SCHEMA_DECL::CONST;
+	size_t Index = 0;
+};
+
+//Ŷ Ű(GamePacket.pdl) о ü ġ Ѵ.  GamePacket.pdl    
+class PacketSchema
+{
+public:
+	PacketSchema()
+	{
+		AddPrimitive("u8", "UINT8", "byte", 1, true);
+		AddPrimitive("i8", "INT8", "sbyte", 1, true);
+		AddPrimitive("u16", "UINT16", "ushort", 2, true);
+		AddPrimitive("i16", "INT16", "short", 2, true);
+		AddPrimitive("u32", "UINT32", "uint", 4, true);
+		AddPrimitive("i32", "INT32", "int", 4, true);
+		AddPrimitive("u64", "UINT64", "ulong", 8, true);
+		AddPrimitive("i64", "INT64", "long", 8, true);
+		AddPrimitive("f32", "float", "float", 4, false);
+		AddPrimitive("Vector3", "Vector3", "Vector3", 12, false);
+		AddPrimitive("Quaternion", "Quaternion", "Quaternion", 16, false);
+		AddPrimitive("char", "char", "string", 1, false);
+		mTypes["char"].IsChar = true;
+	}
+
+	bool Load(const std::string& path_)
+	{
+		std::ifstream file(path_, std::ios::binary);
+		if (file.is_open() == false)
+		{
+			printf("[] Ű     : %s\n", path_.c_str());
+			return false;
+		}
+
+		std::stringstream buffer;
+		buffer << file.rdbuf();
+
+		mPath = path_;
+		if (Tokenize(buffer.str()) == false)
+		{
+			return false;
+		}
+
+		while (IsEnd() == false)
+		{
+			stSchemaComment comment;
+			TakeLeadingComment(&comment);
+			if (IsEnd())
+			{
+				break;
+			}
+
+			auto& keyword = Peek();
+			bool isParsed = false;
+			if (keyword.Text == "const") { isParsed = ParseConst(comment); }
+			else if (keyword.Text == "enum") { isParsed = ParseEnum(comment); }
+			else if (keyword.Text == "struct") { isParsed = ParseStruct(comment, false); }
+			else if (keyword.Text == "packet") { isParsed = ParseStruct(comment, true); }
+			else if (keyword.Text == "id") { isParsed = ParsePacketId(comment); }
+			else { return Error(keyword, "const, enum, struct, packet, id  ϳ Ѵ"); }
+
+			if (isParsed == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	const std::vector<stSchemaDecl>& GetDecls() const { return mDecls; }
+	const std::vector<stSchemaConst>& GetConsts() const { return mConsts; }
+	const std::vector<stSchemaEnum>& GetEnums() const { return mEnums; }
+	const std::vector<stSchemaStruct>& GetStructs() const { return mStructs; }
+	const std::vector<stSchemaPacketId>& GetPacketIds() const { return mPacketIds; }
+
+	const stSchemaType& GetType(const std::string& name_) const { return mTypes.at(name_); }
+
+private:
+	enum class TOKEN : UINT8
+	{
+		IDENT,
+		NUMBER,
+		PUNCT,
+		COMMENT,
+	};
+
+	struct stToken
+	{
+		TOKEN Kind = TOKEN::PUNCT;
+		std::string Text;
+		UINT32 Line = 0;
+	};
+
+	void AddPrimitive(const char* pName_, const char* pCppName_, const char* pCsName_, const UINT32 size_, const bool isInteger_)
+	{
+		stSchemaType type;
+		type.CppName = pCppName_;
+		type.CsName = pCsName_;
+		type.Size = size_;
+		type.IsInteger = isInteger_;
+		mTypes[pName_] = type;
+	}
+
+	bool Tokenize(const std::string& text_)
+	{
+		UINT32 line = 1;
+		size_t i = 0;
+		while (i < text_.size())
+		{
+			auto c = text_[i];
+			if (c == '\n')
+			{
+				++line;
+				++i;
+			}
+			else if (c == ' ' || c == '\t' || c == '\r')
+			{
+				++i;
+			}
+			else if (c == '/' && i + 1 < text_.size() && text_[i + 1] == '/')
+			{
+				auto end = text_.find('\n', i);
+				if (end == std::string::npos)
+				{
+					end = text_.size();
+				}
+
+				auto comment = text_.substr(i, end - i);
+				while (comment.empty() == false && (comment.back() == '\r' || comment.back() == ' ' || comment.back() == '\t'))
+				{
+					comment.pop_back();
+				}
+
+				mTokens.push_back({ TOKEN::COMMENT, comment, line });
+				i = end;
+			}
+			else if (isalpha((unsigned char)c) || c == '_')
+			{
+				auto start = i;
+				while (i < text_.size() && (isalnum((unsigned char)text_[i]) || text_[i] == '_'))
+				{
+					++i;
+				}
+				mTokens.push_back({ TOKEN::IDENT, text_.substr(start, i - start), line });
+			}
+			else if (isdigit((unsigned char)c))
+			{
+				auto start = i;
+				while (i < text_.size() && isalnum((unsigned char)text_[i]))
+				{
+					++i;
+				}
+				mTokens.push_back({ TOKEN::NUMBER, text_.substr(start, i - start), line });
+			}
+			else if (strchr("=;{}[],:+-()@", c) != nullptr)
+			{
+				mTokens.push_back({ TOKEN::PUNCT, std::string(1, c), line });
+				++i;
+			}
+			else
+			{
+				printf("[] %s:%u:     '%c'\n", mPath.c_str(), line, c);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool IsEnd() const { return mPos >= mTokens.size(); }
+
+	const stToken& Peek() const
+	{
+		static const stToken END_TOKEN = { TOKEN::PUNCT, "<>", 0 };
+		return IsEnd() ? END_TOKEN : mTokens[mPos];
+	}
+
+	bool IsPeek(const char* pText_) const
+	{
+		return IsEnd() == false && Peek().Kind != TOKEN::COMMENT && Peek().Text == pText_;
+	}
+
+	const stToken& Next()
+	{
+		auto& token = Peek();
+		if (IsEnd() == false)
+		{
+			mLastLine = token.Line;
+			++mPos;
+		}
+		return token;
+	}
+
+	bool Error(const stToken& token_, const std::string& message_) const
+	{
+		printf("[] %s:%u: %s ('%s')\n", mPath.c_str(), token_.Line, message_.c_str(), token_.Text.c_str());
+		return false;
+	}
+
+	bool Expect(const char* pText_)
+	{
+		if (IsPeek(pText_) == false)
+		{
+			return Error(Peek(), std::string("'") + pText_ + "'  ; Ѵ");
+		}
+		Next();
+		return true;
+	}
+
+	bool ExpectIdent(std::string* pIdent_)
+	{
+		if (Peek().Kind != TOKEN::IDENT)
+		{
+			return Error(Peek(), "̸ ; Ѵ");
+		}
+		*pIdent_ = Next().Text;
+		return true;
+	}
+
+	// ٷ  ٵ ּ . ߰      ּ .
+	void TakeLeadingComment(stSchemaComment* pComment_)
+	{
+		auto lastLine = mLastLine;
+		while (IsEnd() == false && Peek().Kind == TOKEN::COMMENT)
+		{
+			auto& comment = mTokens[mPos++];
+			if (pComment_->Leading.empty() == false && comment.Line > lastLine + 1)
+			{
+				pComment_->Leading.clear();
+			}
+			if (pComment_->Leading.empty())
+			{
+				pComment_->IsBlankBefore = (mLastLine > 0 && comment.Line > mLastLine + 1);
+			}
+			pComment_->Leading.push_back(comment.Text);
+			lastLine = comment.Line;
+		}
+
+		if (IsEnd())
+		{
+			return;
+		}
+
+		if (pComment_->Leading.empty())
+		{
+			pComment_->IsBlankBefore = (mLastLine > 0 && Peek().Line > mLastLine + 1);
+		}
+		else if (Peek().Line > lastLine + 1)
+		{
+			pComment_->Leading.clear();
+			pComment_->IsBlankBefore = true;
+		}
+	}
+
+	//  ū   ּ .
+	void TakeTrailingComment(stSchemaComment* pComment_)
+	{
+		if (IsEnd() == false && Peek().Kind == TOKEN::COMMENT && Peek().Line == mLastLine)
+		{
+			pComment_->Trailing = mTokens[mPos++].Text;
+		}
+	}
+
+	// const ̸ + -   
+	bool ParseExpression(std::string* pText_, INT64* pValue_)
+	{
+		pText_->clear();
+		*pValue_ = 0;
+
+		INT64 sign = 1;
+		while (true)
+		{
+			if (IsPeek("-") && pText_->empty())
+			{
+				Next();
+				*pText_ += "-";
+				sign = -1;
+			}
+
+			auto& token = Next();
+			INT64 value = 0;
+			if (token.Kind == TOKEN::NUMBER)
+			{
+				char* pEnd = nullptr;
+				value = strtoll(token.Text.c_str(), &pEnd, 0);
+				if (*pEnd != '\0')
+				{
+					return Error(token, "ڰ ƴϴ");
+				}
+			}
+			else if (token.Kind == TOKEN::IDENT)
+			{
+				auto iter = mConstValues.find(token.Text);
+				if (iter == mConstValues.end())
+				{
+					return Error(token, "  const");
+				}
+				value = iter->second;
+			}
+			else
+			{
+				return Error(token, "ڳ const ̸ ; Ѵ");
+			}
+
+			*pText_ += token.Text;
+			*pValue_ += sign * value;
+
+			if (IsPeek("+") == false && IsPeek("-") == false)
+			{
+				return true;
+			}
+
+			auto& op = Next();
+			sign = (op.Text == "+") ? 1 : -1;
+			*pText_ += " " + op.Text + " ";
+		}
+	}
+
+	//@cs(̸, ...).   
+	bool ParseCsNames(std::vector<std::string>* pNames_)
+	{
+		if (IsPeek("@") == false)
+		{
+			return true;
+		}
+		Next();
+
+		std::string attribute;
+		if (ExpectIdent(&attribute) == false)
+		{
+			return false;
+		}
+		if (attribute != "cs")
+		{
+			return Error(mTokens[mPos - 1], "@cs(...)    ִ");
+		}
+
+		if (Expect("(") == false)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			std::string name;
+			if (ExpectIdent(&name) == false)
+			{
+				return false;
+			}
+			pNames_->push_back(name);
+
+			if (IsPeek(",") == false)
+			{
+				break;
+			}
+			Next();
+		}
+
+		return Expect(")");
+	}
+
+	bool CheckNewName(const stToken& token_, const std::string& name_)
+	{
+		if (mNames.insert(name_).second == false)
+		{
+			return Error(token_, "̹  ̸");
+		}
+		return true;
+	}
+
+	bool ParseConst(const stSchemaComment& comment_)
+	{
+		Next();
+
+		stSchemaConst constant;
+		constant.Comment = comment_;
+
+		auto& typeToken = Peek();
+		if (ExpectIdent(&constant.TypeName) == false)
+		{
+			return false;
+		}
+		auto typeIter = mTypes.find(constant.TypeName);
+		if (typeIter == mTypes.end() || typeIter->second.IsInteger == false)
+		{
+			return Error(typeToken, "const  Ÿ̾ Ѵ");
+		}
+
+		auto& nameToken = Peek();
+		if (ExpectIdent(&constant.Name) == false || CheckNewName(nameToken, constant.Name) == false)
+		{
+			return false;
+		}
+
+		if (Expect("=") == false || ParseExpression(&constant.ValueText, &constant.Value) == false || Expect(";") == false)
+		{
+			return false;
+		}
+		TakeTrailingComment(&constant.Comment);
+
+		mConstValues[constant.Name] = constant.Value;
+		mDecls.push_back({ SCHEMA_DECL::CONST, mConsts.size() });
+		mConsts.push_back(constant);
+		return true;
+	}
+
+	bool ParseEnum(const stSchemaComment& comment_)
+	{
+		Next();
+
+		stSchemaEnum schemaEnum;
+		schemaEnum.Comment = comment_;
+
+		auto& nameToken = Peek();
+		if (ExpectIdent(&schemaEnum.Name) == false || CheckNewName(nameToken, schemaEnum.Name) == false || Expect(":") == false)
+		{
+			return false;
+		}
+
+		auto& typeToken = Peek();
+		if (ExpectIdent(&schemaEnum.TypeName) == false)
+		{
+			return false;
+		}
+		auto typeIter = mTypes.find(schemaEnum.TypeName);
+		if (typeIter == mTypes.end() || typeIter->second.IsInteger == false)
+		{
+			return Error(typeToken, "enum  Ÿ̾ Ѵ");
+		}
+		TakeTrailingComment(&schemaEnum.Comment);
+
+		if (Expect("{") == false)
+		{
+			return false;
+		}
+
+		while (true)
+		{
+			stSchemaEnumMember member;
+			TakeLeadingComment(&member.Comment);
+			if (IsPeek("}"))
+			{
+				Next();
+				break;
+			}
+
+			auto& memberToken = Peek();
+			if (ExpectIdent(&member.Name) == false)
+			{
+				return false;
+			}
+			for (auto& other : schemaEnum.Members)
+			{
+				if (other.Name == member.Name)
+				{
+					return Error(memberToken, "̹  enum ");
+				}
+			}
+
+			std::vector<std::string> csNames;
+			if (Expect("=") == false || ParseExpression(&member.ValueText, &member.Value) == false || ParseCsNames(&csNames) == false)
+			{
+				return false;
+			}
+			member.CsName = csNames.empty() ? member.Name : csNames[0];
+
+			if (IsPeek("}") == false && Expect(",") == false)
+			{
+				return false;
+			}
+			TakeTrailingComment(&member.Comment);
+
+			schemaEnum.Members.push_back(member);
+		}
+
+		stSchemaType type = typeIter->second;
+		type.Kind = SCHEMA_TYPE_KIND::ENUM;
+		type.CppName = schemaEnum.Name;
+		type.CsName = schemaEnum.Name;
+		type.IsInteger = false;
+		mTypes[schemaEnum.Name] = type;
+
+		mDecls.push_back({ SCHEMA_DECL::ENUM, mEnums.size() });
+		mEnums.push_back(schemaEnum);
+		return true;
+	}
+
+	bool ParseField(stSchemaStruct* pStruct_, stSchemaField* pField_)
+	{
+		if (IsPeek("var"))
+		{
+			Next();
+			pField_->IsVar = true;
+		}
+
+		auto& typeToken = Peek();
+		if (ExpectIdent(&pField_->TypeName) == false)
+		{
+			return false;
+		}
+		auto typeIter = mTypes.find(pField_->TypeName);
+		if (typeIter == mTypes.end())
+		{
+			return Error(typeToken, "  Ÿ");
+		}
+		auto& type = typeIter->second;
+
+		auto& nameToken = Peek();
+		if (ExpectIdent(&pField_->Name) == false)
+		{
+			return false;
+		}
+		for (auto& other : pStruct_->Fields)
+		{
+			if (other.Name == pField_->Name)
+			{
+				return Error(nameToken, "̹  ʵ");
+			}
+		}
+
+		if (IsPeek("["))
+		{
+			Next();
+
+			auto& countToken = Peek();
+			INT64 count = 0;
+			if (ParseExpression(&pField_->CountText, &count) == false || Expect("]") == false)
+			{
+				return false;
+			}
+			if (count <= 0 || count > 0xFFFF)
+			{
+				return Error(countToken, "迭 ũⰡ ߸ƴ");
+			}
+			pField_->Count = (UINT32)count;
+		}
+
+		if (type.IsChar && pField_->IsArray() == false)
+		{
+			return Error(nameToken, "char 迭θ ");
+		}
+		if (pField_->IsVar && pField_->IsArray() == false)
+		{
+			return Error(nameToken, "var ʵ 迭̾ Ѵ");
+		}
+		if (pField_->IsVar && pStruct_->IsPacket == false)
+		{
+			return Error(nameToken, "var ʵ packet   ִ");
+		}
+
+		if (IsPeek("="))
+		{
+			Next();
+
+			auto& defaultToken = Peek();
+			if (pField_->IsArray() || type.Kind == SCHEMA_TYPE_KIND::STRUCT || (type.Kind == SCHEMA_TYPE_KIND::PRIMITIVE && type.IsInteger == false))
+			{
+				return Error(defaultToken, " enum ʵ常 ⺻   ִ");
+			}
+
+			if (type.Kind == SCHEMA_TYPE_KIND::ENUM)
+			{
+				if (ExpectIdent(&pField_->DefaultText) == false)
+				{
+					return false;
+				}
+				if (FindEnumMember(pField_->TypeName, pField_->DefaultText) == false)
+				{
+					return Error(defaultToken, pField_->TypeName + "  ƴϴ");
+				}
+			}
+			else
+			{
+				INT64 value = 0;
+				if (ParseExpression(&pField_->DefaultText, &value) == false)
+				{
+					return false;
+				}
+			}
+		}
+
+		std::vector<std::string> csNames;
+		if (ParseCsNames(&csNames) == false || Expect(";") == false)
+		{
+			return false;
+		}
+		pField_->CsName = csNames.empty() ? pField_->Name : csNames[0];
+		TakeTrailingComment(&pField_->Comment);
+
+		pField_->ElementSize = type.Size;
+		return true;
+	}
+
+	bool FindEnumMember(const std::string& enumName_, const std::string& memberName_) const
+	{
+		for (auto& schemaEnum : mEnums)
+		{
+			if (schemaEnum.Name != enumName_)
+			{
+				continue;
+			}
+			for (auto& member : schemaEnum.Members)
+			{
+				if (member.Name == memberName_)
+				{
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	bool ParseStruct(const stSchemaComment& comment_, const bool isPacket_)
+	{
+		Next();
+
+		stSchemaStruct schemaStruct;
+		schemaStruct.IsPacket = isPacket_;
+		schemaStruct.Comment = comment_;
+
+		auto& nameToken = Peek();
+		std::string name;
+		if (ExpectIdent(&name) == false)
+		{
+			return false;
+		}
+
+		stSchemaPacketId packetId;
+		std::vector<std::string> csNames;
+		if (isPacket_)
+		{
+			schemaStruct.Name = name + "_PACKET";
+			schemaStruct.PacketName = name;
+
+			if (Expect("=") == false || ParseExpression(&packetId.ValueText, &packetId.Value) == false || ParseCsNames(&csNames) == false)
+			{
+				return false;
+			}
+			if (csNames.size() > 2)
+			{
+				return Error(nameToken, "packet @cs (ü ̸, E_PACKET ̸)̴");
+			}
+
+			schemaStruct.CsName = csNames.size() > 0 ? csNames[0] : GetDefaultCsStructName(name);
+			schemaStruct.PacketId = packetId.Value;
+
+			packetId.Name = name;
+			packetId.CsName = csNames.size() > 1 ? csNames[1] : name;
+			packetId.StructIndex = (INT32)mStructs.size();
+			TakeTrailingComment(&packetId.Comment);
+			if (AddPacketId(nameToken, packetId) == false)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			schemaStruct.Name = name;
+			if (ParseCsNames(&csNames) == false)
+			{
+				return false;
+			}
+			schemaStruct.CsName = csNames.empty() ? name : csNames[0];
+		}
+
+		if (CheckNewName(nameToken, schemaStruct.Name) == false || Expect("{") == false)
+		{
+			return false;
+		}
+
+		auto offset = isPacket_ ? PACKET_HEADER_SIZE : 0u;
+		while (true)
+		{
+			stSchemaField field;
+			TakeLeadingComment(&field.Comment);
+			if (IsPeek("}"))
+			{
+				Next();
+				break;
+			}
+
+			auto& fieldToken = Peek();
+			if (schemaStruct.HasVarField())
+			{
+				return Error(fieldToken, "var ʵ  ʵ忩 Ѵ");
+			}
+			if (ParseField(&schemaStruct, &field) == false)
+			{
+				return false;
+			}
+
+			field.Offset = offset;
+			offset += field.GetSize();
+			if (offset > 0xFFFF)
+			{
+				return Error(fieldToken, "ü 64KB Ѵ´");
+			}
+
+			schemaStruct.Fields.push_back(field);
+		}
+
+		schemaStruct.Size = offset;
+		schemaStruct.MinSize = schemaStruct.HasVarField() ? schemaStruct.Fields.back().Offset + schemaStruct.Fields.back().ElementSize : offset;
+
+		if (isPacket_ == false)
+		{
+			stSchemaType type;
+			type.Kind = SCHEMA_TYPE_KIND::STRUCT;
+			type.CppName = schemaStruct.Name;
+			type.CsName = schemaStruct.CsName;
+			type.Size = schemaStruct.Size;
+			mTypes[schemaStruct.Name] = type;
+		}
+
+		mDecls.push_back({ SCHEMA_DECL::STRUCT, mStructs.size() });
+		mStructs.push_back(schemaStruct);
+		return true;
+	}
+
+	bool ParsePacketId(const stSchemaComment& comment_)
+	{
+		Next();
+
+		stSchemaPacketId packetId;
+		packetId.Comment = comment_;
+
+		auto& nameToken = Peek();
+		std::vector<std::string> csNames;
+		if (ExpectIdent(&packetId.Name) == false || Expect("=") == false || ParseExpression(&packetId.ValueText, &packetId.Value) == false
+			|| ParseCsNames(&csNames) == false || Expect(";") == false)
+		{
+			return false;
+		}
+		packetId.CsName = csNames.empty() ? "" : csNames[0];
+		TakeTrailingComment(&packetId.Comment);
+
+		return AddPacketId(nameToken, packetId);
+	}
+
+	bool AddPacketId(const stToken& token_, const stSchemaPacketId& packetId_)
+	{
+		if (packetId_.Value <= 0 || packetId_.Value > 0xFFFF)
+		{
+			return Error(token_, "Ŷ ID UINT16  ");
+		}
+
+		for (auto& other : mPacketIds)
+		{
+			if (other.Name == packetId_.Name)
+			{
+				return Error(token_, "̹  Ŷ ID ̸");
+			}
+			if (other.Value == packetId_.Value)
+			{
+				return Error(token_, "Ŷ ID  " + other.Name + " ");
+			}
+		}
+
+		mPacketIds.push_back(packetId_);
+		return true;
+	}
+
+	//ROOM_ENTER_REQUEST -> P_RoomEnterRequest
+	static std::string GetDefaultCsStructName(const std::string& packetName_)
+	{
+		std::string name = "P_";
+		bool isWordStart = true;
+		for (auto c : packetName_)
+		{
+			if (c == '_')
+			{
+				isWordStart = true;
+				continue;
+			}
+			name += isWordStart ? (char)toupper((unsigned char)c) : (char)tolower((unsigned char)c);
+			isWordStart = false;
+		}
+		return name;
+	}
+
+	static const UINT32 PACKET_HEADER_SIZE = 5;
+
+	std::string mPath;
+	std::vector<stToken> mTokens;
+	size_t mPos = 0;
+	UINT32 mLastLine = 0;	//  ּ ƴ ū 
+
+	std::unordered_map<std::string, stSchemaType> mTypes;
+	std::unordered_map<std::string, INT64> mConstValues;
+	std::unordered_set<std::string> mNames;
+
+	std::vector<stSchemaDecl> mDecls;
+	std::vector<stSchemaConst> mConsts;
+	std::vector<stSchemaEnum> mEnums;
+	std::vector<stSchemaStruct> mStructs;
+	std::vector<stSchemaPacketId> mPacketIds;
+};
\ No newline at end of file
@@ -7,58 +7,119 @@
 #include "RoomManager.h"
 #include "PacketManager.h"
 #include "RedisManager.h"
+#include "PacketCompressor.h"
+#include "ServerNetwork/ThreadStat.h"
+#include "ServerNetwork/PacketLatency.h"
+#include "ServerNetwork/AsyncLogger.h"
 
+#ifdef _WIN32
 #include <strsafe.h>
-
-
-void PacketManager::Init(const UINT32 maxClient_)
+#endif
+
+
+//   Ŀ ޴ Ŷ ü. ڵ鷯 Ϸ ⿡ ־ Ѵ.
+PACKET_TYPE_NO_BODY(PACKET_ID::SYS_USER_CONNECT);
+PACKET_TYPE_NO_BODY(PACKET_ID::SYS_USER_DISCONNECT);
+PACKET_TYPE(PACKET_ID::SYS_ROOM_ENTER, stRoomEnterInfo);
+PACKET_TYPE_NO_BODY(PACKET_ID::SYS_ROOM_LEAVE);
+PACKET_TYPE_MIN_SIZE(PACKET_ID::SYS_ROOM_NOTICE, PACKET_HEADER, PACKET_HEADER_LENGTH);	// 濡 Ѹ Ŷ ״
+PACKET_TYPE(PACKET_ID::SYS_ROOM_LEFT, stRoomLeftInfo);
+PACKET_TYPE(RedisTaskID::RESPONSE_NOTICE, RedisNoticeRes);
+
+PACKET_TYPE(PACKET_ID::LOGIN_REQUEST, LOGIN_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::HEARTBEAT_PONG, HEARTBEAT_PONG_PACKET);
+PACKET_TYPE(PACKET_ID::ROOM_ENTER_REQUEST, ROOM_ENTER_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::ROOM_NEW_USER_NTF, ROOM_NEW_USER_NTF_PACKET);
+PACKET_TYPE(PACKET_ID::ROOM_LEAVE_REQUEST, ROOM_LEAVE_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::ROOM_CHAT_REQUEST, ROOM_CHAT_REQUEST_VIEW);	// Message  ŭ ´
+PACKET_TYPE(PACKET_ID::PLAYER_MOVEMENT, PLAYER_MOVEMENT_PACKET);
+PACKET_TYPE(PACKET_ID::PLAYER_ATTACK_REQUEST, PLAYER_ATTACK_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::HIT_REPORT, HIT_REPORT_PACKET);
+PACKET_TYPE(PACKET_ID::INVENTORY_INFO_REQUEST, INVENTORY_INFO_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::ITEM_ADD_REQUEST, ITEM_ADD_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::ITEM_USE_REQUEST, ITEM_USE_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::QUEST_TALK_REQUEST, QUEST_TALK_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::QUEST_ACCEPT_REQUEST, QUEST_ACCEPT_REQUEST_PACKET);
+PACKET_TYPE(PACKET_ID::QUEST_COMPLETE_REQUEST, QUEST_COMPLETE_REQUEST_PACKET);
+
+
+void PacketManager::Init(const ServerConfig& config_)
 {
-	mRecvFuntionDictionary = std::unordered_map<int, PROCESS_RECV_PACKET_FUNCTION>();
-
-	mRecvFuntionDictionary[(int)PACKET_ID::SYS_USER_CONNECT] = &PacketManager::ProcessUserConnect;
-	mRecvFuntionDictionary[(int)PACKET_ID::SYS_USER_DISCONNECT] = &PacketManager::ProcessUserDisConnect;
-
-	mRecvFuntionDictionary[(int)PACKET_ID::LOGIN_REQUEST] = &PacketManager::ProcessLogin;
-	mRecvFuntionDictionary[(int)RedisTaskID::RESPONSE_LOGIN] = &PacketManager::ProcessLoginDBResult;
-	mRecvFuntionDictionary[(int)RedisTaskID::RESPONSE_NOTICE] = &PacketManager::ProcessNoticeDBResult;
+	//  ȿ  Ŷ . Ŭ̾Ʈ  Ŷ  ǥ ã ʴ´.
+	mSystemDispatcher.Register<PACKET_ID::SYS_USER_CONNECT, &PacketManager::ProcessUserConnect>();
+	mSystemDispatcher.Register<PACKET_ID::SYS_USER_DISCONNECT, &PacketManager::ProcessUserDisConnect>();
+	mSystemDispatcher.Register<PACKET_ID::SYS_ROOM_LEFT, &PacketManager::ProcessRoomLeft>();
+	mSystemDispatcher.Register<RedisTaskID::RESPONSE_NOTICE, &PacketManager::ProcessNoticeDBResult>();
+
+	mRecvDispatcher.Register<PACKET_ID::LOGIN_REQUEST, &PacketManager::ProcessLogin>();
+	mRecvDispatcher.Register<PACKET_ID::HEARTBEAT_PONG, &PacketManager::ProcessHeartbeatPong>();
 	
-	mRecvFuntionDictionary[(int)PACKET_ID::ROOM_ENTER_REQUEST] = &PacketManager::ProcessEnterRoom;
-	mRecvFuntionDictionary[(int)PACKET_ID::ROOM_NEW_USER_NTF] = &PacketManager::ProcessEnterRoomByPlayerJoined;
-	mRecvFuntionDictionary[(int)PACKET_ID::ROOM_LEAVE_REQUEST] = &PacketManager::ProcessLeaveRoom;
-	mRecvFuntionDictionary[(int)PACKET_ID::ROOM_CHAT_REQUEST] = &PacketManager::ProcessRoomChatMessage;
-	mRecvFuntionDictionary[(int)PACKET_ID::PLAYER_MOVEMENT] = &PacketManager::ProcessPlayerMovement;
+	mRecvDispatcher.Register<PACKET_ID::ROOM_ENTER_REQUEST, &PacketManager::ProcessEnterRoom>();
+	mRecvDispatcher.Register<PACKET_ID::ROOM_NEW_USER_NTF, &PacketManager::ProcessEnterRoomByPlayerJoined>();
+	mRecvDispatcher.Register<PACKET_ID::ROOM_LEAVE_REQUEST, &PacketManager::ProcessLeaveRoom>();
+
+	//  Ŀ óϴ Ŷ 
+	mRoomDispatcher.Register<PACKET_ID::SYS_ROOM_ENTER, &PacketManager::ProcessRoomEnter>();
+	mRoomDispatcher.Register<PACKET_ID::SYS_ROOM_LEAVE, &PacketManager::ProcessRoomLeave>();
+	mRoomDispatcher.Register<PACKET_ID::SYS_ROOM_NOTICE, &PacketManager::ProcessRoomNotice>();
+	mRoomDispatcher.Register<PACKET_ID::ROOM_CHAT_REQUEST, &PacketManager::ProcessRoomChatMessage>();
+	mRoomDispatcher.Register<PACKET_ID::PLAYER_MOVEMENT, &PacketManager::ProcessPlayerMovement>();
+	mRoomDispatcher.Register<PACKET_ID::PLAYER_ATTACK_REQUEST, &PacketManager::ProcessPlayerAttack>();
+	mRoomDispatcher.Register<PACKET_ID::HIT_REPORT, &PacketManager::ProcessHitReport>();
+	mRoomDispatcher.Register<PACKET_ID::QUEST_ACCEPT_REQUEST, &PacketManager::ProcessRoomQuestAccept>();
 
 	// κ丮 Ŷ ڵ鷯 
-	mRecvFuntionDictionary[(int)PACKET_ID::INVENTORY_INFO_REQUEST] = &PacketManager::ProcessInventoryInfoRequest;
-	mRecvFuntionDictionary[(int)PACKET_ID::ITEM_ADD_REQUEST] = &PacketManager::ProcessItemAddRequest;
-	mRecvFuntionDictionary[(int)PACKET_ID::ITEM_USE_REQUEST] = &PacketManager::ProcessItemUseRequest;
-
-	// Ʈ Ŷ ųʸ 
-	mRecvFuntionDictionary[(int)PACKET_ID::QUEST_TALK_REQUEST] = &PacketManager::ProcessQuestTalk;
-	mRecvFuntionDictionary[(int)PACKET_ID::QUEST_ACCEPT_REQUEST] = &PacketManager::ProcessQuestAccept;
-	mRecvFuntionDictionary[(int)PACKET_ID::QUEST_COMPLETE_REQUEST] = &PacketManager::ProcessQuestComplete;
-
-	//  Ŷ 
-	mRecvFuntionDictionary[(int)PACKET_ID::PLAYER_ATTACK_REQUEST] = &PacketManager::ProcessPlayerAttack;
-	mRecvFuntionDictionary[(int)PACKET_ID::HIT_REPORT] = &PacketManager::ProcessHitReport;
-
-	CreateCompent(maxClient_);
+	mRecvDispatcher.Register<PACKET_ID::INVENTORY_INFO_REQUEST, &PacketManager::ProcessInventoryInfoRequest>();
+	mRecvDispatcher.Register<PACKET_ID::ITEM_ADD_REQUEST, &PacketManager::ProcessItemAddRequest>();
+	mRecvDispatcher.Register<PACKET_ID::ITEM_USE_REQUEST, &PacketManager::ProcessItemUseRequest>();
+
+	// Ʈ Ŷ ڵ鷯 
+	mRecvDispatcher.Register<PACKET_ID::QUEST_TALK_REQUEST, &PacketManager::ProcessQuestTalk>();
+	mRecvDispatcher.Register<PACKET_ID::QUEST_ACCEPT_REQUEST, &PacketManager::ProcessQuestAccept>();
+	mRecvDispatcher.Register<PACKET_ID::QUEST_COMPLETE_REQUEST, &PacketManager::ProcessQuestComplete>();
+
+	mLogicCpus = config_.LogicCpus;
+	mRateLimiter.Init(config_.MaxClient, config_.IsRateLimit);
+	mUdpRateLimiter.Init(config_.MaxClient, config_.IsRateLimit);
+	mUdpPort = config_.UdpPort;
+	PacketCompressor::Instance().Init(config_.CompressThreshold);
+	PacketLatencyMonitor::Instance().SetEnable(config_.IsPacketLatency);
+	mDecompressBuffer = new char[PACKET_DECOMPRESS_BUFFER_SIZE];
+
+	mInComingPacketUserIndex.Init(INCOMING_PACKET_QUEUE_SIZE);
+	mSystemPacketQueue.Init(SYSTEM_PACKET_QUEUE_SIZE);
+	mUdpPacketQueue.Init(UDP_PACKET_QUEUE_SIZE);
+	mLogicWakeup.Init();
+
+	CreateCompent(config_);
 
 	mRedisMgr = new RedisManager;// std::make_unique<RedisManager>();
+	mRedisMgr->ResponseNotifyFunc = [this]() { mLogicWakeup.Notify(); };
 }
 
-void PacketManager::CreateCompent(const UINT32 maxClient_)
+void PacketManager::CreateCompent(const ServerConfig& config_)
 {
 	mUserManager = new UserManager;
-	mUserManager->Init(maxClient_);
+	mUserManager->Init(config_.MaxClient);
 
 		
 	UINT32 startRoomNummber = 0;
-	UINT32 maxRoomCount = 10;
-	UINT32 maxRoomUserCount = 4;
+	UINT32 maxRoomCount = config_.RoomCount;
+	UINT32 maxRoomUserCount = config_.RoomUserCount;
 	mRoomManager = new RoomManager;
-	mRoomManager->SendPacketFunc = SendPacketFunc;
-	mRoomManager->Init(startRoomNummber, maxRoomCount, maxRoomUserCount);
+	mRoomManager->SendPacketFunc = [this](UINT32 sessionId_, UINT16 packetSize_, char* pPacket_) { SendPacketToSession(sessionId_, packetSize_, pPacket_); };
+	mRoomManager->SendBroadcastFunc = [this](UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		//UDP  ̸ UDP   ִ Ŷ UDP .
+		if (SendUdpFunc(sessionId_, pBuffer_->GetDataSize(), pBuffer_->GetData()))
+		{
+			return;
+		}
+
+		SendBroadcastFunc(sessionId_, pBuffer_);
+	};
+	mRoomManager->ProcessTaskFunc = [this](Room* pRoom_, const stRoomTask& task_) { ProcessRoomTask(pRoom_, task_); };
+	mRoomManager->Init(startRoomNummber, maxRoomCount, maxRoomUserCount, config_.LogicThreadCount, config_.RoomCpus);
 }
 
 bool PacketManager::Run()
@@ -77,14 +138,46 @@ bool PacketManager::Run()
 
 void PacketManager::End()
 {
+	//Redis 带  缭  尡  ڿ   ʰ Ѵ.
 	mRedisMgr->End();
 
 	mIsRunProcessThread = false;
+	mLogicWakeup.Notify();
 
 	if (mProcessThread.joinable())
 	{
 		mProcessThread.join();
 	}
+
+	// Redis  ٸ ڵ鷯 ڷƾ  Ѵ.
+	mRedisMgr->DestroyWaiters();
+
+	// 尡  ڶ  Ѿ  .
+	mRoomManager->End();
+
+	delete[] mDecompressBuffer;
+	mDecompressBuffer = nullptr;
+
+	//ó  UDP Ŷ ý Ŷ 纻 Ѵ.
+	PacketInfo udpPacket;
+	while (mUdpPacketQueue.TryPop(&udpPacket))
+	{
+		delete[] udpPacket.pDataPtr;
+	}
+
+	PacketInfo systemPacket;
+	while (mSystemPacketQueue.TryPop(&systemPacket))
+	{
+		delete[] systemPacket.pDataPtr;
+	}
+
+	printf("[ ť] wakeup(%llu) full : tcp(%llu) system(%llu) udp(%llu)\n", (unsigned long long)mLogicWakeup.GetNotifyCount(),
+		(unsigned long long)mInComingPacketUserIndex.GetFullCount(), (unsigned long long)mSystemPacketQueue.GetFullCount(), (unsigned long long)mUdpPacketQueue.GetFullCount());
+
+	mRateLimiter.Print("tcp");
+	mUdpRateLimiter.Print("udp");
+	PacketCompressor::Instance().Print();
+	PacketLatencyMonitor::Instance().Print(stdout);
 }
 
 void PacketManager::ClearConnectionInfo(INT32 clientIndex_)
@@ -100,194 +193,584 @@ void PacketManager::ClearConnectionInfo(INT32 clientIndex_)
 	if (pReqUser->GetDomainState() != User::DOMAIN_STATE::NONE)
 	{
 		mUserManager->DeleteUserInfo(pReqUser);
+
+		//α  IncreaseUserCnt()   ش. ߸ max_client α ڷδ ƹ α  .
+		mUserManager->DecreaseUserCnt();
 	}
 }
 
-void PacketManager::ReceivePacketData(const UINT32 clientIndex_, const UINT32 size_, char* pData_)
+// ID   Կ δ.  忡   ó         ͸ Ѵ.
+//ȯ :   . ̹   ID̸ nullptr
+RecvRingBuffer* PacketManager::BindSession(const UINT32 sessionId_)
 {
-	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
-	pUser->SetPacketData(size_, pData_);
+	auto pRecvRing = GetRecvRingFunc(sessionId_);
+	if (pRecvRing == nullptr)
+	{
+		return nullptr;
+	}
 
-	EnqueuePacketData(clientIndex_);
+	auto userIndex = GetSessionIndex(sessionId_);
+	auto pUser = mUserManager->GetUserByConnIdx(userIndex);
+	if (pUser->GetSessionId() != sessionId_)
+	{
+		//   뺸   Ͱ    ִ.
+		ClearConnectionInfo(userIndex);
+		pUser->Clear();
+		pUser->SetSessionId(sessionId_);
+		pRecvRing->SkipToSessionStart();
+	}
+
+	return pRecvRing;
 }
 
-void PacketManager::EnqueuePacketData(const UINT32 clientIndex_)
+//    ȣ    ID ٲ㼭 .  Դ  ʴ´.
+//ū Ŷ ؼ . ۽ Լ ϹǷ  ۿ ص ȴ.
+void PacketManager::SendPacket(const UINT32 userIndex_, const UINT32 packetSize_, char* pPacket_)
 {
-	std::lock_guard<std::mutex> guard(mLock);
-	mInComingPacketUserIndex.push_back(clientIndex_);
+	SendPacketToSession(mUserManager->GetUserByConnIdx(userIndex_)->GetSessionId(), packetSize_, pPacket_);
 }
 
-PacketInfo PacketManager::DequePacketData()
+// Ŀ User  Ƿ      ID ٷ .
+void PacketManager::SendPacketToSession(const UINT32 sessionId_, const UINT32 packetSize_, char* pPacket_)
 {
-	UINT32 userIndex = 0;
+	auto packetSize = packetSize_;
+	auto pPacket = pPacket_;
+	char compressedPacket[PACKET_COMPRESS_BUFFER_SIZE];
+	if (auto compressedSize = PacketCompressor::Instance().Compress(pPacket_, packetSize_, compressedPacket); compressedSize > 0)
+	{
+		packetSize = compressedSize;
+		pPacket = compressedPacket;
+	}
 
+	if (SendUdpFunc(sessionId_, packetSize, pPacket))
 	{
-		std::lock_guard<std::mutex> guard(mLock);
-		if (mInComingPacketUserIndex.empty())
+		return;
+	}
+
+	SendPacketFunc(sessionId_, packetSize, pPacket);
+}
+
+//α  UDP ū TCP ˸. Ŭ̾Ʈ  ū UDP   ּҷ ̵/ġ Ŷ .
+void PacketManager::SendUdpToken(const UINT32 userIndex_)
+{
+	auto sessionId = mUserManager->GetUserByConnIdx(userIndex_)->GetSessionId();
+
+	UDP_TOKEN_NOTIFY_PACKET udpTokenPacket;
+	udpTokenPacket.Token = IssueUdpTokenFunc(sessionId);
+	udpTokenPacket.UdpPort = mUdpPort;
+	if (udpTokenPacket.Token == 0)
+	{
+		return;
+	}
+
+	SendPacketFunc(sessionId, sizeof(udpTokenPacket), (char*)&udpTokenPacket);
+}
+
+//I/O 忡 ȣȴ.  ʹ ̹    ִ.
+// ϼ Ŷ ӵ  ˻ؼ ģ Ŷ  尡 ǳʶٵ ǥϰ, ϼ Ŷ  뺸 ϳ  忡 ˸.
+//  뺸  ŭ Ƿ  ˻  Ŷ д  .
+void PacketManager::ReceivePacketData(const UINT32 sessionId_)
+{
+	auto pRecvRing = GetRecvRingFunc(sessionId_);
+	if (pRecvRing == nullptr)
+	{
+		return;
+	}
+
+	auto nowMs = PacketRateLimiter::GetNowMs();
+	auto recvTimeNs = PacketLatencyMonitor::Instance().Stamp();
+	UINT32 packetCount = 0;
+
+	while (pRecvRing->GetUnscannedSize() >= PACKET_HEADER_LENGTH)
+	{
+		char headerData[PACKET_HEADER_LENGTH];
+		pRecvRing->PeekUnscanned(headerData, PACKET_HEADER_LENGTH);
+		auto pHeader = (PACKET_HEADER*)headerData;
+
+		// ū Ŷ    .
+		if (pHeader->PacketLength < PACKET_HEADER_LENGTH || pHeader->PacketLength > RECV_RING_BUFFER_SIZE)
+		{
+			ALOG_WARN("[] ߸ Ŷ (%u)  : Session(%u)\n", pHeader->PacketLength, sessionId_);
+			DisconnectFunc(sessionId_);
+			break;
+		}
+
+		if (pHeader->PacketLength > pRecvRing->GetUnscannedSize())
+		{
+			break;
+		}
+
+		auto result = mRateLimiter.Check(sessionId_, pHeader->PacketId, nowMs);
+		if (result != RATE_LIMIT_RESULT::PASS)
 		{
-			return PacketInfo();
+			PACKET_HEADER droppedHeader(pHeader->PacketLength, PACKET_ID::SYS_RATE_LIMITED, pHeader->Type);
+			pRecvRing->OverwriteUnscanned((char*)&droppedHeader, PACKET_HEADER_LENGTH);
+
+			if (result == RATE_LIMIT_RESULT::DISCONNECT)
+			{
+				ALOG_WARN("[˸] Ŷ ӵ    : Session(%u)\n", sessionId_);
+				DisconnectFunc(sessionId_);
+			}
+			else if (pHeader->PacketId == (UINT16)PACKET_ID::ROOM_CHAT_REQUEST)
+			{
+				ROOM_CHAT_RESPONSE_PACKET roomChatResPacket;
+				roomChatResPacket.Result = (INT16)ERROR_CODE::ROOM_TOO_MANY_PACKET;
+				SendPacketFunc(sessionId_, sizeof(ROOM_CHAT_RESPONSE_PACKET), (char*)&roomChatResPacket);
+			}
 		}
 
-		userIndex = mInComingPacketUserIndex.front();
-		mInComingPacketUserIndex.pop_front();
+		pRecvRing->CommitScan(pHeader->PacketLength);
+		++packetCount;
+	}
+
+	EnqueuePacketData(sessionId_, packetCount, recvTimeNs);
+}
+
+void PacketManager::EnqueuePacketData(const UINT32 sessionId_, const UINT32 packetCount_, const UINT64 recvTimeNs_)
+{
+	if (packetCount_ == 0)
+	{
+		return;
 	}
 
+	mInComingPacketUserIndex.Push({ sessionId_, packetCount_, recvTimeNs_ });
+	mLogicWakeup.Notify();
+}
+
+// 뺸     Ŷ .
+//ȯ :     뺸̸ DataSize 0 Ŷ
+PacketInfo PacketManager::GetInComingPacket(const stInComingPacket& inComingPacket_)
+{
+	auto pRecvRing = BindSession(inComingPacket_.SessionId);
+	if (pRecvRing == nullptr)
+	{
+		return PacketInfo();
+	}
+
+	auto userIndex = GetSessionIndex(inComingPacket_.SessionId);
 	auto pUser = mUserManager->GetUserByConnIdx(userIndex);
-	auto packetData = pUser->GetPacket();
-	packetData.ClientIndex = userIndex;
-	return packetData;
+	auto packet = pUser->GetPacket(pRecvRing);
+	packet.ClientIndex = userIndex;
+	packet.RecvTimeNs = inComingPacket_.RecvTimeNs;
+
+	PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::QUEUE, packet.PacketId, packet.RecvTimeNs);
+	return packet;
+}
+
+//ó  Ŷ ϴ    ش.
+//  翬Ǿ  ʴ´.     SkipToSessionStart() ǳʶڴ.
+void PacketManager::ReleasePacketData(const PacketInfo& packet_)
+{
+	auto pUser = mUserManager->GetUserByConnIdx(packet_.ClientIndex);
+	auto pRecvRing = GetRecvRingFunc(pUser->GetSessionId());
+	if (pRecvRing == nullptr)
+	{
+		return;
+	}
+
+	pUser->ReleasePacket(pRecvRing, packet_);
 }
 
+//pDataPtr Ѱܹ޾Ƽ ó  Ѵ.
 void PacketManager::PushSystemPacket(PacketInfo packet_)
 {
-	std::lock_guard<std::mutex> guard(mLock);
-	mSystemPacketQueue.push_back(packet_);
+	packet_.RecvTimeNs = PacketLatencyMonitor::Instance().Stamp();
+
+	mSystemPacketQueue.Push(packet_);
+	mLogicWakeup.Notify();
 }
 
-PacketInfo PacketManager::DequeSystemPacketData()
+//UDP  忡 ȣȴ. ǿ  ּҿ  Ŷ̴.
+//isReliableUdp_ : ŷڼ UDP  Ŷ̸ Ŭ̾Ʈ Ŷ  ޴´. ƴϸ UDP ޱ  Ŷ ޴´.
+//ӵ  ˻  ؼ  忡 ѱ.
+void PacketManager::ReceiveUdpPacket(const UINT32 sessionId_, const UINT32 packetSize_, char* pPacket_, const bool isReliableUdp_)
 {
+	if (packetSize_ < PACKET_HEADER_LENGTH || packetSize_ > RECV_RING_BUFFER_SIZE)
+	{
+		return;
+	}
 
-	std::lock_guard<std::mutex> guard(mLock);
-	if (mSystemPacketQueue.empty())
+	auto pHeader = (PACKET_HEADER*)pPacket_;
+	auto isAccepted = isReliableUdp_ ?
+		(pHeader->PacketLength == packetSize_ && pHeader->PacketId > (UINT16)PACKET_ID::DB_END) :
+		IsUnreliableRecvPacket(pHeader->PacketId);
+	if (isAccepted == false)
 	{
-		return PacketInfo();
+		return;
 	}
 
-	auto packetData = mSystemPacketQueue.front();
-	mSystemPacketQueue.pop_front();
+	auto result = mUdpRateLimiter.Check(sessionId_, pHeader->PacketId, PacketRateLimiter::GetNowMs());
+	if (result != RATE_LIMIT_RESULT::PASS)
+	{
+		if (result == RATE_LIMIT_RESULT::DISCONNECT)
+		{
+			ALOG_WARN("[˸] Ŷ ӵ    : Session(%u)\n", sessionId_);
+			DisconnectFunc(sessionId_);
+		}
+		return;
+	}
 
-	return packetData;
+	// Ŷ ⼭ Ǯ ѱ.
+	if (IsCompressedPacket(pPacket_))
+	{
+		auto originalSize = PacketCompressor::GetOriginalSize(pPacket_, packetSize_);
+		PacketInfo packet{ sessionId_, pHeader->PacketId, originalSize, new char[originalSize], PacketLatencyMonitor::Instance().Stamp() };
+		if (PacketCompressor::Instance().Decompress(pPacket_, packetSize_, packet.pDataPtr, originalSize) == 0)
+		{
+			ALOG_WARN("[˸] ߸  Ŷ(%u)  : Session(%u)\n", pHeader->PacketId, sessionId_);
+			delete[] packet.pDataPtr;
+			return;
+		}
+
+		mUdpPacketQueue.Push(packet);
+		mLogicWakeup.Notify();
+		return;
+	}
+
+	PacketInfo packet{ sessionId_, pHeader->PacketId, (UINT16)packetSize_, new char[packetSize_], PacketLatencyMonitor::Instance().Stamp() };
+	CopyMemory(packet.pDataPtr, pPacket_, packetSize_);
+
+	mUdpPacketQueue.Push(packet);
+	mLogicWakeup.Notify();
 }
 
-void PacketManager::RedisReqNotice(User& user, const std::string noticeMsg)
+bool PacketManager::DequeUdpPacketData(PacketInfo* pPacket_)
 {
-	RedisNoticeReq dbReq;
-	CopyUserID(dbReq.UserID, "[GM]");
-	StringCbCopyA(dbReq.UserID, sizeof(dbReq.UserID), "[GM]");
-	StringCbCopyA(dbReq.Message, sizeof(dbReq.Message), noticeMsg.c_str());
+	if (mUdpPacketQueue.TryPop(pPacket_) == false)
+	{
+		return false;
+	}
 
-	RedisTask task;
-	task.UserIndex = user.GetNetConnIdx();
-	task.TaskID = RedisTaskID::REQUEST_NOTICE;
-	task.DataSize = sizeof(RedisNoticeReq);
-	task.pData = new char[task.DataSize];
-	CopyMemory(task.pData, (char*)&dbReq, task.DataSize);
-	mRedisMgr->PushTask(task);
+	PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::QUEUE, pPacket_->PacketId, pPacket_->RecvTimeNs);
+	return true;
+}
 
-	printf("[Redis Request] Notice. userUUID(%d), userID(%s), msg:%s\n", user.GetNetConnIdx(), user.GetUserId(), noticeMsg.c_str());
+bool PacketManager::DequeSystemPacketData(PacketInfo* pPacket_)
+{
+	if (mSystemPacketQueue.TryPop(pPacket_) == false)
+	{
+		return false;
+	}
+
+	PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::QUEUE, pPacket_->PacketId, pPacket_->RecvTimeNs);
+	return true;
+}
+
+bool PacketManager::IsInboundEmpty()
+{
+	return mInComingPacketUserIndex.IsEmpty() && mSystemPacketQueue.IsEmpty() && mUdpPacketQueue.IsEmpty() && mRedisMgr->IsResponseEmpty();
+}
+
+void PacketManager::RedisReqNotice(Actor& user, const std::string noticeMsg)
+{
+	mRedisMgr->Publish(REDIS_NOTICE_CHANNEL, noticeMsg.substr(0, MAX_CHAT_MSG_SIZE));
+
+	ALOG_DEBUG("[Redis Request] Notice. userUUID(%d), userID(%s), msg:%s\n", user.GetNetConnIdx(), user.GetUserId().c_str(), noticeMsg.c_str());
 }
 
 
 void PacketManager::ProcessPacket()
 {
+	PinCurrentThread(mLogicCpus, 0, "logic");
+	auto pStat = ThreadStatMonitor::Instance().Register("logic", 0);
+
 	while (mIsRunProcessThread)
 	{
-		bool isIdle = true;
+		//ť LOGIC_BATCH_SIZE   ť ٸ ť  ʰ Ѵ.
+		auto dequeCount = ProcessInComingPackets(pStat) + ProcessSystemPackets(pStat) + ProcessUdpPackets(pStat) + ProcessRedisResponses(pStat);
+		if (dequeCount > 0)
+		{
+			continue;
+		}
 
-		if (auto packetData = DequePacketData(); packetData.PacketId > (UINT16)PACKET_ID::SYS_END)
+		//ڴٰ ˸  ť ٽ Ȯؾ  ̿  Ŷ ġ ʴ´.
+		mLogicWakeup.PrepareWait();
+		if (IsInboundEmpty() == false || mIsRunProcessThread == false)
 		{
-			isIdle = false;
-			ProcessRecvPacket(packetData.ClientIndex, packetData.PacketId, packetData.DataSize, packetData.pDataPtr);
+			mLogicWakeup.CancelWait();
+			continue;
 		}
 
-		if (auto packetData = DequeSystemPacketData(); packetData.PacketId != 0)
+		auto idleBeginNs = pStat->BeginIdle();
+		mLogicWakeup.Wait(LOGIC_WAIT_TIMEOUT_MS);
+		pStat->EndIdle(idleBeginNs);
+	}
+
+	ThreadStatMonitor::Instance().Unregister(pStat);
+}
+
+//Ʒ Process...() Լ ȯ : ť  
+
+UINT32 PacketManager::ProcessInComingPackets(stThreadStat* pStat_)
+{
+	UINT32 dequeCount = 0;
+	stInComingPacket inComingPacket;
+	while (dequeCount < LOGIC_BATCH_SIZE && mInComingPacketUserIndex.TryPop(&inComingPacket))
+	{
+		//   Ŷ ٸ  Ŷ  ʰ   ̾ óѴ.
+		//  Ƿ LOGIC_BATCH_SIZE  ѱ  ִ.
+		for (UINT32 i = 0; i < inComingPacket.PacketCount; ++i)
+		{
+			++dequeCount;
+			auto packetData = GetInComingPacket(inComingPacket);
+			if (packetData.DataSize == 0)
+			{
+				// Ŷ   ̴.
+				break;
+			}
+
+			if (packetData.PacketId > (UINT16)PACKET_ID::SYS_END)
+			{
+				pStat_->AddCompletion();
+				ProcessClientPacket(packetData);
+			}
+
+			ReleasePacketData(packetData);
+		}
+	}
+	return dequeCount;
+}
+
+UINT32 PacketManager::ProcessSystemPackets(stThreadStat* pStat_)
+{
+	UINT32 dequeCount = 0;
+	PacketInfo packetData;
+	while (dequeCount < LOGIC_BATCH_SIZE && DequeSystemPacketData(&packetData))
+	{
+		++dequeCount;
+		pStat_->AddCompletion();
+		ProcessSystemPacket(packetData.ClientIndex, packetData.PacketId, packetData.DataSize, packetData.pDataPtr);
+		delete[] packetData.pDataPtr;
+	}
+	return dequeCount;
+}
+
+UINT32 PacketManager::ProcessUdpPackets(stThreadStat* pStat_)
+{
+	UINT32 dequeCount = 0;
+	PacketInfo packetData;
+	while (dequeCount < LOGIC_BATCH_SIZE && DequeUdpPacketData(&packetData))
+	{
+		++dequeCount;
+		pStat_->AddCompletion();
+
+		//     Ŷ .
+		auto userIndex = GetSessionIndex(packetData.ClientIndex);
+		if (mUserManager->GetUserByConnIdx(userIndex)->GetSessionId() == packetData.ClientIndex)
 		{
-			isIdle = false;
-			ProcessRecvPacket(packetData.ClientIndex, packetData.PacketId, packetData.DataSize, packetData.pDataPtr);
+			ProcessRecvPacket(userIndex, packetData.PacketId, packetData.DataSize, packetData.pDataPtr);
 		}
 
-		if (auto task = mRedisMgr->TakeResponseTask(); task.TaskID != RedisTaskID::INVALID)
+		delete[] packetData.pDataPtr;
+	}
+	return dequeCount;
+}
+
+UINT32 PacketManager::ProcessRedisResponses(stThreadStat* pStat_)
+{
+	UINT32 dequeCount = 0;
+	while (dequeCount < LOGIC_BATCH_SIZE)
+	{
+		auto waiter = mRedisMgr->TakeResume();
+		if (!waiter)
 		{
-			isIdle = false;
-			ProcessRecvPacket(task.UserIndex, (UINT16)task.TaskID, task.DataSize, task.pData);
-			task.Release();
+			break;
 		}
 
-		if(isIdle)
+		++dequeCount;
+		pStat_->AddCompletion();
+		waiter.resume();
+	}
+
+	while (dequeCount < LOGIC_BATCH_SIZE)
+	{
+		auto task = mRedisMgr->TakeResponseTask();
+		if (task.TaskID == RedisTaskID::INVALID)
 		{
-			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			break;
 		}
+
+		++dequeCount;
+		pStat_->AddCompletion();
+		ProcessSystemPacket(task.UserIndex, (UINT16)task.TaskID, task.DataSize, task.pData);
+		task.Release();
 	}
+	return dequeCount;
 }
 
+// Ŷ Ǯ óѴ.    ReleasePacketData()  ũ ״ ش.
+void PacketManager::ProcessClientPacket(const PacketInfo& packet_)
+{
+	if (IsCompressedPacket(packet_.pDataPtr) == false)
+	{
+		ProcessRecvPacket(packet_.ClientIndex, packet_.PacketId, packet_.DataSize, packet_.pDataPtr);
+		return;
+	}
+
+	auto packetSize = PacketCompressor::Instance().Decompress(packet_.pDataPtr, packet_.DataSize, mDecompressBuffer, PACKET_DECOMPRESS_BUFFER_SIZE);
+	if (packetSize == 0)
+	{
+		ALOG_WARN("[˸] ߸  Ŷ(%u)  : User(%u)\n", packet_.PacketId, packet_.ClientIndex);
+		return;
+	}
+
+	ProcessRecvPacket(packet_.ClientIndex, packet_.PacketId, (UINT16)packetSize, mDecompressBuffer);
+}
+
+//ý ť Redis ˸ ȣѴ.
+void PacketManager::ProcessSystemPacket(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_)
+{
+	auto beginNs = PacketLatencyMonitor::Instance().Stamp();
+	auto result = mSystemDispatcher.Dispatch(*this, clientIndex_, packetId_, packetSize_, pPacket_);
+	if (result != PACKET_DISPATCH_RESULT::SUCCESS)
+	{
+		ALOG_WARN("[WARN] System packet dropped(%u). packetId=%u size=%u client=%u\n", (UINT32)result, packetId_, packetSize_, clientIndex_);
+		return;
+	}
+	PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::HANDLER, packetId_, beginNs);
+}
+
+//Ŭ̾Ʈ  Ŷ.  Ŀ ó Ŷ ũ⸦ ⼭  ˻ؼ ߸ Ŷ  ѱ ʴ´.
+// ȿ  ID(SYS_END )  Ŀ ǥ Ƿ ⼭ .
 void PacketManager::ProcessRecvPacket(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_)
 {
-	auto iter = mRecvFuntionDictionary.find(packetId_);
-	if (iter != mRecvFuntionDictionary.end())
+	if (packetId_ <= (UINT16)PACKET_ID::SYS_END)
+	{
+		ALOG_WARN("[WARN] Internal packet id from client. packetId=%u client=%u\n", packetId_, clientIndex_);
+		return;
+	}
+
+	auto beginNs = PacketLatencyMonitor::Instance().Stamp();
+	auto result = mRecvDispatcher.Dispatch(*this, clientIndex_, packetId_, packetSize_, pPacket_);
+	if (result == PACKET_DISPATCH_RESULT::SUCCESS)
 	{
-		(this->*(iter->second))(clientIndex_, packetSize_, pPacket_);
+		PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::HANDLER, packetId_, beginNs);
+		return;
+	}
+
+	if (result == PACKET_DISPATCH_RESULT::NO_HANDLER)
+	{
+		result = mRoomDispatcher.Check(packetId_, packetSize_);
+		if (result == PACKET_DISPATCH_RESULT::SUCCESS)
+		{
+			PostToRoom(clientIndex_, packetId_, packetSize_, pPacket_);
+			return;
+		}
+	}
+
+	if (result == PACKET_DISPATCH_RESULT::TOO_SHORT)
+	{
+		ALOG_WARN("[WARN] Too short packet. packetId=%u size=%u client=%u\n", packetId_, packetSize_, clientIndex_);
 	}
 	else
 	{
-		printf("[WARN] No handler. packetId=%u size=%u client=%u\n", packetId_, packetSize_, clientIndex_);
+		ALOG_WARN("[WARN] No handler. packetId=%u size=%u client=%u\n", packetId_, packetSize_, clientIndex_);
 	}
 }
 
-void PacketManager::ProcessUserConnect(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+// ִ  Ŀ Ŷ ؼ ѱ.   濡 ִ  常 ˰ ִ.
+//ȯ : 濡  ̸ false
+bool PacketManager::PostToRoom(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_)
 {
-	printf("[ProcessUserConnect] clientIndex: %d\n", clientIndex_);
 	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
-	pUser->Clear();
+	if (pUser->GetDomainState() == User::DOMAIN_STATE::ROOM &&
+		mRoomManager->PostToRoom(pUser->GetCurrentRoom(), clientIndex_, packetId_, packetSize_, pPacket_))
+	{
+		return true;
+	}
+
+	ALOG_WARN("[PostToRoom] user not in room. packetId=%u client=%u\n", packetId_, clientIndex_);
+
+	if (packetId_ == (UINT16)PACKET_ID::ROOM_CHAT_REQUEST)
+	{
+		ROOM_CHAT_RESPONSE_PACKET roomChatResPacket;
+		roomChatResPacket.Result = (INT16)ERROR_CODE::CHAT_ROOM_INVALID_ROOM_NUMBER;
+		SendPacket(clientIndex_, sizeof(ROOM_CHAT_RESPONSE_PACKET), (char*)&roomChatResPacket);
+	}
+	return false;
 }
 
-void PacketManager::ProcessUserDisConnect(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+// Ŀ 忡 ȣȴ.
+void PacketManager::ProcessRoomTask(Room* pRoom_, const stRoomTask& task_)
 {
-	printf("[ProcessUserDisConnect] clientIndex: %d\n", clientIndex_);
-	ClearConnectionInfo(clientIndex_);
+	auto beginNs = PacketLatencyMonitor::Instance().Stamp();
+	auto result = mRoomDispatcher.Dispatch(*this, *pRoom_, task_.UserIndex, task_.PacketId, task_.DataSize, task_.pData);
+	if (result != PACKET_DISPATCH_RESULT::SUCCESS)
+	{
+		ALOG_WARN("[WARN] Room task dropped(%u). packetId=%u size=%u client=%u\n", (UINT32)result, task_.PacketId, task_.DataSize, task_.UserIndex);
+		return;
+	}
+	PacketLatencyMonitor::Instance().AddSince(PACKET_LATENCY_STAGE::HANDLER, task_.PacketId, beginNs);
 }
 
-void PacketManager::ProcessLogin(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
-{ 
-	if (packetSize_ < PACKET_HEADER_LENGTH)
+//ý Ŷ ClientIndex  ID.
+void PacketManager::ProcessUserConnect(UINT32 sessionId_)
+{
+	ALOG_INFO("[ProcessUserConnect] clientIndex: %d\n", GetSessionIndex(sessionId_));
+	BindSession(sessionId_);
+}
+
+void PacketManager::ProcessUserDisConnect(UINT32 sessionId_)
+{
+	auto userIndex = GetSessionIndex(sessionId_);
+	ALOG_INFO("[ProcessUserDisConnect] clientIndex: %d\n", userIndex);
+
+	//̹       BindSession() Ǿ.
+	auto pUser = mUserManager->GetUserByConnIdx(userIndex);
+	if (pUser->GetSessionId() != sessionId_)
 	{
 		return;
 	}
 
+	ClearConnectionInfo(userIndex);
+	pUser->SetSessionId(0);
+}
+
+//Redis  йȣ co_await ޾ ȮѴ. ٸ    ٸ Ŷ óѴ.
+//Redis  ̰ų Redis   Ȯ  ޾ش.
+LogicTask PacketManager::ProcessLogin(UINT32 clientIndex_, const LOGIN_REQUEST_PACKET& packet_)
+{ 
+	//  ڰ  ͵  ũ⿡ ߸
 	char userId[MAX_USER_ID_LEN + 1] = { 0 };
 	char userPw[MAX_USER_PW_LEN + 1] = { 0 };
+	StringCbCopyA(userId, sizeof(userId), packet_.userID);
+	StringCbCopyA(userPw, sizeof(userPw), packet_.userPW);
 
-	// 1)  α Ŷ(201: LOGIN_REQUEST_PACKET) ũ   Ľ
-	if (packetSize_ == (UINT16)LOGIN_REQUEST_PACKET_SIZE)
-	{
-		auto pLoginReqPacket = reinterpret_cast<LOGIN_REQUEST_PACKET*>(pPacket_);
-		StringCbCopyA(userId, sizeof(userId), pLoginReqPacket->userID);
-		StringCbCopyA(userPw, sizeof(userPw), pLoginReqPacket->userPW);
-	}
-	// 2) Unity ӽ α: 201 body "̸/ID"   (  )
-	else
-	{
-		const UINT16 bodySize = packetSize_ - (UINT16)PACKET_HEADER_LENGTH;
-		const UINT16 copyLen = (bodySize > MAX_USER_ID_LEN) ? MAX_USER_ID_LEN : bodySize;
+	ALOG_INFO("[ProcessLogin] client=%u, userId=%s\n", clientIndex_, userId);
 
-		if (copyLen == 0)
-		{
-			// ٵ  䵵 ǹ 
-			return;
-		}
+	auto sessionId = mUserManager->GetUserByConnIdx(clientIndex_)->GetSessionId();
+	auto reply = co_await mRedisMgr->Get(userId);
 
-		CopyMemory(userId, pPacket_ + PACKET_HEADER_LENGTH, copyLen);
-		userId[copyLen] = '\0';
-		// userPw  ڿ 
+	//ٸ   ٸ       ִ.
+	if (mUserManager->GetUserByConnIdx(clientIndex_)->GetSessionId() != sessionId)
+	{
+		ALOG_INFO("[ProcessLogin] session changed while waiting redis. client=%u\n", clientIndex_);
+		co_return;
 	}
 
-	printf("[ProcessLogin] client=%u, userId=%s, packetSize=%u\n", clientIndex_, userId, packetSize_);
-
 	LOGIN_RESPONSE_PACKET loginResPacket;
 
+	if (reply.Result == REDIS_REPLY_RESULT::OK && reply.Value != userPw)
+	{
+		loginResPacket.Result = (UINT16)ERROR_CODE::LOGIN_USER_INVALID_PW;
+		SendPacket(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+		co_return;
+	}
+
 	//  ִ  üũ (  )
 	if (mUserManager->GetCurrentUserCnt() >= mUserManager->GetMaxUserCnt())
 	{
 		loginResPacket.Result = (UINT16)ERROR_CODE::LOGIN_USER_USED_ALL_OBJ;
-		SendPacketFunc(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
-		return;
+		SendPacket(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+		co_return;
 	}
 
 	// ̹  ID üũ ( Ϻ   ǵ )
 	if (mUserManager->FindUserIndexByID(userId) != -1)
 	{
 		loginResPacket.Result = (UINT16)ERROR_CODE::LOGIN_USER_ALREADY;
-		SendPacketFunc(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
-		return;
+		SendPacket(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+		co_return;
 	}
 
 	mUserManager->AddUser(userId, clientIndex_);
@@ -295,51 +778,42 @@ void PacketManager::ProcessLogin(UINT32 clientIndex_, UINT16 packetSize_, char*
 
 	// Unity :  ڵ尡  Result clientIndex_ ְ ־
 	loginResPacket.Result = (UINT16)clientIndex_;
-	SendPacketFunc(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+	SendPacket(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+	SendUdpToken(clientIndex_);
 
-	printf("[ProcessLogin] Sent 202(LoginResponse). client=%u result=%u\n", clientIndex_, loginResPacket.Result);
+	ALOG_DEBUG("[ProcessLogin] Sent 202(LoginResponse). client=%u result=%u\n", clientIndex_, loginResPacket.Result);
 }
 
-void PacketManager::ProcessLoginDBResult(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+//ο  RTT  Ѵ.    ü  ִ  Ʈũ ʿ ̹ ߴ.
+void PacketManager::ProcessHeartbeatPong(UINT32 clientIndex_, const HEARTBEAT_PONG_PACKET& packet_)
 {
-	printf("ProcessLoginDBResult. UserIndex: %d\n", clientIndex_);
-
-	auto pBody = (RedisLoginRes*)pPacket_;
+	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
 
-	if (pBody->Result == (UINT16)ERROR_CODE::NONE)
+	auto rttMs = ReportPongFunc(pUser->GetSessionId(), packet_.PingTimeMs);
+	if (rttMs < 0)
 	{
-		//α Ϸ Ѵ
-		auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
-		pUser->SetLogin(pBody->UserID);
+		return;
 	}
 
-	LOGIN_RESPONSE_PACKET loginResPacket;
-	//loginResPacket.Result = pBody->Result;
-	// Unity3D 
-	loginResPacket.Result = clientIndex_;
-	SendPacketFunc(clientIndex_, sizeof(LOGIN_RESPONSE_PACKET), (char*)&loginResPacket);
+	pUser->SetRttMs((UINT32)rttMs);
+	ALOG_TRACE("[ProcessHeartbeatPong] client=%u rtt=%dms\n", clientIndex_, rttMs);
 }
 
-void PacketManager::ProcessNoticeDBResult(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessNoticeDBResult(UINT32 clientIndex_, const RedisNoticeRes& body_)
 {
-	printf("ProcessNoticeDBResult. UserIndex: %d\n", clientIndex_);
-
-	auto pBody = (RedisNoticeRes*)pPacket_;
+	ALOG_DEBUG("ProcessNoticeDBResult. UserIndex: %d\n", clientIndex_);
 
 	ROOM_CHAT_NOTIFY_PACKET roomChatNtfyPkt;
 	StringCbCopyA(roomChatNtfyPkt.userID, sizeof(roomChatNtfyPkt.userID), "[GM]");
-	StringCbCopyA(roomChatNtfyPkt.Msg, sizeof(roomChatNtfyPkt.Msg), pBody->Message);
+	StringCbCopyA(roomChatNtfyPkt.Msg, sizeof(roomChatNtfyPkt.Msg), body_.Message);
 
-	mRoomManager->SendToAllUser(roomChatNtfyPkt.PacketLength, (char*)&roomChatNtfyPkt, clientIndex_, false);
+	mRoomManager->SendToAllUser(roomChatNtfyPkt.PacketLength, (char*)&roomChatNtfyPkt, clientIndex_);
 }
 
 
 
-void PacketManager::ProcessEnterRoom(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessEnterRoom(UINT32 clientIndex_, const ROOM_ENTER_REQUEST_PACKET& packet_)
 {
-	UNREFERENCED_PARAMETER(packetSize_);
-
-	auto pRoomEnterReqPacket = reinterpret_cast<ROOM_ENTER_REQUEST_PACKET*>(pPacket_);
 	auto pReqUser = mUserManager->GetUserByConnIdx(clientIndex_);
 
 	if (!pReqUser || pReqUser == nullptr) 
@@ -347,175 +821,175 @@ void PacketManager::ProcessEnterRoom(UINT32 clientIndex_, UINT16 packetSize_, ch
 		return;
 	}
 
-	auto roomNumber = pRoomEnterReqPacket->RoomNumber;
+	auto roomNumber = packet_.RoomNumber;
 	
 			
-	// Room::EnterUser() ϴ    Ʈ Ѵ
-	auto enterResult = mRoomManager->EnterUser(roomNumber, pReqUser);
-
+	// ϸ  Ŀ   Ʈ   (ProcessRoomEnter)
+	auto enterResult = mRoomManager->EnterUser(roomNumber, pReqUser, true);
+	if (enterResult != (UINT16)ERROR_CODE::NONE)
 	{
 		ROOM_ENTER_RESPONSE_PACKET roomEnterResPacket;
 		roomEnterResPacket.Result = enterResult;
-		SendPacketFunc(clientIndex_, sizeof(ROOM_ENTER_RESPONSE_PACKET), (char*)&roomEnterResPacket);
+		SendPacket(clientIndex_, sizeof(ROOM_ENTER_RESPONSE_PACKET), (char*)&roomEnterResPacket);
 	}
-	printf("Response Packet Sended");
+}
 
+void PacketManager::ProcessEnterRoomByPlayerJoined(UINT32 clientIndex_, const ROOM_NEW_USER_NTF_PACKET& packet_)
+{
+	auto pReqUser = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
+	if (!pReqUser) return;
+
+	// Ŭ   Ŷ pos/rot   ¿ ݿ (̰  ⺻ 0,0,0 ״ ۵)
+	pReqUser->SetPosition(packet_.position);
+	pReqUser->SetRotation(packet_.rotation);
+
+	const INT32 roomNumber = 0;
+
+	//  Ŀ 濡 ִ 鿡 "  (208)" ˸
+	auto enterResult = mRoomManager->EnterUser(roomNumber, pReqUser, false);
 	if (enterResult != (UINT16)ERROR_CODE::NONE)
 	{
+		ALOG_WARN("[EnterBy208] enter failed. client=%u result=%d\n", clientIndex_, (int)enterResult);
 		return;
 	}
 
-	auto pRoom = mRoomManager->GetRoomByNumber(roomNumber);
-
-	//  鿡 ϴ   ġ ȸ 
-	pRoom->NotifyUserEnter(clientIndex_, pReqUser->GetUserId(), pReqUser->GetPosition(), pReqUser->GetRotation());
+	ALOG_INFO("[EnterBy208] client=%u entered room=%d\n", clientIndex_, roomNumber);
 }
 
-void PacketManager::ProcessEnterRoomByPlayerJoined(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+
+
+void PacketManager::ProcessLeaveRoom(UINT32 clientIndex_, const ROOM_LEAVE_REQUEST_PACKET& packet_)
 {
-	auto pReqUser = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
-	if (!pReqUser) return;
+	UNREFERENCED_PARAMETER(packet_);
 
-	// ּ ũ üũ
-	if (packetSize_ < sizeof(ROOM_NEW_USER_NTF_PACKET))
+	ROOM_LEAVE_RESPONSE_PACKET roomLeaveResPacket;
+
+	auto reqUser = mUserManager->GetUserByConnIdx(clientIndex_);
+	auto roomNum = reqUser->GetCurrentRoom();
+				
+	//TODO Room UserListü  Ȯϱ
+	roomLeaveResPacket.Result = mRoomManager->LeaveUser(roomNum, reqUser);
+	SendPacket(clientIndex_, sizeof(ROOM_LEAVE_RESPONSE_PACKET), (char*)&roomLeaveResPacket);
+}
+
+// Ŀ  óϰ  ġ User ݿѴ.   翬Ǿų ٽ  .
+void PacketManager::ProcessRoomLeft(UINT32 sessionId_, const stRoomLeftInfo& leftInfo_)
+{
+	auto pUser = mUserManager->GetUserByConnIdx(GetSessionIndex(sessionId_));
+	if (pUser->GetSessionId() != sessionId_ || pUser->GetDomainState() != User::DOMAIN_STATE::LOGIN)
 	{
-		printf("[EnterBy208] invalid packet size. client=%u size=%u\n", clientIndex_, packetSize_);
 		return;
 	}
 
-	// Ŭ   Ŷ pos/rot б
-	auto joinPkt = reinterpret_cast<ROOM_NEW_USER_NTF_PACKET*>(pPacket_);
+	pUser->SetPosition(leftInfo_.Position);
+	pUser->SetRotation(leftInfo_.Rotation);
+}
 
-	//   ¿ ݿ (̰  ⺻ 0,0,0 ״ ۵)
-	pReqUser->SetPosition(joinPkt->position);
-	pReqUser->SetRotation(joinPkt->rotation);
+// =================  Ŀ =========================
+void PacketManager::ProcessRoomEnter(Room& room_, UINT32 clientIndex_, const stRoomEnterInfo& enterInfo_)
+{
+	// Room::EnterUser() ϴ    Ʈ Ѵ
+	auto enterResult = room_.EnterUser(clientIndex_, enterInfo_);
 
-	const INT32 roomNumber = 0;
+	if (enterInfo_.IsSendResponse)
+	{
+		ROOM_ENTER_RESPONSE_PACKET roomEnterResPacket;
+		roomEnterResPacket.Result = enterResult;
+		SendPacketToSession(enterInfo_.SessionId, sizeof(ROOM_ENTER_RESPONSE_PACKET), (char*)&roomEnterResPacket);
+		ALOG_DEBUG("Response Packet Sended");
+	}
 
-	auto enterResult = mRoomManager->EnterUser(roomNumber, pReqUser);
 	if (enterResult != (UINT16)ERROR_CODE::NONE)
 	{
-		printf("[EnterBy208] enter failed. client=%u result=%d\n", clientIndex_, (int)enterResult);
 		return;
 	}
 
-	auto pRoom = mRoomManager->GetRoomByNumber(roomNumber);
-	if (!pRoom) return;
-
-	// 濡 ִ 鿡 "  (208)" ˸
-	pRoom->NotifyUserEnter(clientIndex_, pReqUser->GetUserId(),
-		pReqUser->GetPosition(), pReqUser->GetRotation());
-
-	printf("[EnterBy208] client=%u entered room=%d\n", clientIndex_, roomNumber);
+	//  鿡 ϴ   ġ ȸ 
+	room_.NotifyUserEnter(clientIndex_, enterInfo_.UserID, enterInfo_.Position, enterInfo_.Rotation);
 }
 
-
-void PacketManager::ProcessHitReport(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+// ȿ  ġ   ý ť ش. ť     带 ٸ ʰ .
+void PacketManager::ProcessRoomLeave(Room& room_, UINT32 clientIndex_)
 {
-	if (packetSize_ < sizeof(HIT_REPORT_PACKET))
+	auto pRoomUser = room_.FindUserByConnIdx(clientIndex_);
+	if (pRoomUser == nullptr)
 	{
-		printf("[HitReport] size mismatch. got=%u expected=%zu\n", packetSize_, sizeof(HIT_REPORT_PACKET));
 		return;
 	}
 
-	auto* req = reinterpret_cast<HIT_REPORT_PACKET*>(pPacket_);
+	auto sessionId = pRoomUser->GetSessionId();
+	stRoomLeftInfo leftInfo;
+	room_.LeaveUser(clientIndex_, &leftInfo);
 
-	auto* user = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
-	if (!user) return;
-
-	if (user->GetDomainState() != User::DOMAIN_STATE::ROOM)
+	PacketInfo packet{ sessionId, (UINT16)PACKET_ID::SYS_ROOM_LEFT, sizeof(stRoomLeftInfo), new char[sizeof(stRoomLeftInfo)], PacketLatencyMonitor::Instance().Stamp() };
+	CopyMemory(packet.pDataPtr, &leftInfo, sizeof(stRoomLeftInfo));
+	if (mSystemPacketQueue.TryPush(packet) == false)
 	{
-		printf("[HitReport] user not in room. client=%u\n", clientIndex_);
+		delete[] packet.pDataPtr;
 		return;
 	}
-
-	INT32 roomNum = user->GetCurrentRoom();
-	Room* room = mRoomManager->GetRoomByNumber(roomNum);
-	if (!room) return;
-
-	printf("[HitReport] client=%u enemy=%lld dmg=%d\n", clientIndex_, req->enemyID, req->damage);
-
-	room->ProcessHitReport((INT64)clientIndex_, req->enemyID, req->damage);
+	mLogicWakeup.Notify();
 }
 
-void PacketManager::ProcessLeaveRoom(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessRoomNotice(Room& room_, UINT32 clientIndex_, UINT16 packetSize_, const PACKET_HEADER& packet_)
 {
-	UNREFERENCED_PARAMETER(packetSize_);
-	UNREFERENCED_PARAMETER(pPacket_);
-
-	ROOM_LEAVE_RESPONSE_PACKET roomLeaveResPacket;
-
-	auto reqUser = mUserManager->GetUserByConnIdx(clientIndex_);
-	auto roomNum = reqUser->GetCurrentRoom();
-				
-	//TODO Room UserListü  Ȯϱ
-	roomLeaveResPacket.Result = mRoomManager->LeaveUser(roomNum, reqUser);
-	SendPacketFunc(clientIndex_, sizeof(ROOM_LEAVE_RESPONSE_PACKET), (char*)&roomLeaveResPacket);
+	room_.SendToAllUser(packetSize_, (char*)&packet_, (INT32)clientIndex_, false);
 }
 
-void PacketManager::ProcessPlayerMovement(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessHitReport(Room& room_, UINT32 clientIndex_, const HIT_REPORT_PACKET& packet_)
 {
-	UNREFERENCED_PARAMETER(packetSize_);
-	UNREFERENCED_PARAMETER(pPacket_);
+	ALOG_DEBUG("[HitReport] client=%u enemy=%lld dmg=%d\n", clientIndex_, packet_.enemyID, packet_.damage);
 
-	auto playerMovement = reinterpret_cast<PLAYER_MOVEMENT_PACKET*>(pPacket_);
+	room_.ProcessHitReport((INT64)clientIndex_, packet_.enemyID, packet_.damage);
+}
 
-	if (playerMovement->userUUID != clientIndex_)
+void PacketManager::ProcessPlayerMovement(Room& room_, UINT32 clientIndex_, const PLAYER_MOVEMENT_PACKET& packet_)
+{
+	if (packet_.userUUID != clientIndex_)
 	{
-		printf("[ProcessPlayerMovement] userUUID(%lld) != clientIndex_(%ld)\n", playerMovement->userUUID, clientIndex_);
+		ALOG_WARN("[ProcessPlayerMovement] userUUID(%lld) != clientIndex_(%u)\n", packet_.userUUID, clientIndex_);
 		return;
 	}
 
 
-	printf("[ProcessPlayerMovement] userUUID(%lld) dx=%f, dy=%f, rx:%f, ry:%f, rz:%f \n", playerMovement->userUUID, 
-		playerMovement->dx, playerMovement->dy, playerMovement->rotation.x, playerMovement->rotation.y, playerMovement->rotation.z);
+	ALOG_TRACE("[ProcessPlayerMovement] userUUID(%lld) dx=%f, dy=%f, rx:%f, ry:%f, rz:%f \n", packet_.userUUID, 
+		packet_.dx, packet_.dy, packet_.rotation.x, packet_.rotation.y, packet_.rotation.z);
 
-	auto reqUser = mUserManager->GetUserByConnIdx(clientIndex_);
-	auto roomNum = reqUser->GetCurrentRoom();
-
-	auto pRoom = mRoomManager->GetRoomByNumber(roomNum);
-	if (pRoom == nullptr)
+	auto reqUser = room_.FindUserByConnIdx(clientIndex_);
+	if (reqUser == nullptr)
 	{
-		printf("[ProcessPlayerMovement] pRoom == nullptr userUUID(%lld), roomNum(%d)\n", playerMovement->userUUID, roomNum);
+		ALOG_WARN("[ProcessPlayerMovement] user not in room. userUUID(%lld), roomNum(%d)\n", packet_.userUUID, room_.GetRoomNumber());
 		return;
 	}
 
 	UPDATE_PLAYER_MOVEMENT_PACKET updateMovement;
-	updateMovement.player_id = playerMovement->userUUID;
-	updateMovement.rotation = playerMovement->rotation;
+	updateMovement.player_id = packet_.userUUID;
+	updateMovement.rotation = packet_.rotation;
 	// Movement ó
-	updateMovement.motion = reqUser->UpdateMovement(playerMovement->dx, playerMovement->dy, playerMovement->rotation);
+	updateMovement.motion = reqUser->UpdateMovement(packet_.dx, packet_.dy, packet_.rotation);
 	
-	pRoom->SendToAllUser(updateMovement.PacketLength, (char*)&updateMovement, clientIndex_, false);
+	room_.SendToAllUser(updateMovement.PacketLength, (char*)&updateMovement, clientIndex_, false);
 }
 
 
-void PacketManager::ProcessRoomChatMessage(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessRoomChatMessage(Room& room_, UINT32 clientIndex_, const ROOM_CHAT_REQUEST_VIEW& packet_)
 {
-	UNREFERENCED_PARAMETER(packetSize_);
-
-	auto pRoomChatReqPacketet = reinterpret_cast<ROOM_CHAT_REQUEST_PACKET*>(pPacket_);
-		
 	ROOM_CHAT_RESPONSE_PACKET roomChatResPacket;
 	roomChatResPacket.Result = (INT16)ERROR_CODE::NONE;
 
-	auto reqUser = mUserManager->GetUserByConnIdx(clientIndex_);
-	auto roomNum = reqUser->GetCurrentRoom();
-
-	auto pRoom = mRoomManager->GetRoomByNumber(roomNum);
-	if (pRoom == nullptr)
+	auto reqUser = room_.FindUserByConnIdx(clientIndex_);
+	if (reqUser == nullptr)
 	{
-		roomChatResPacket.Result = (INT16)ERROR_CODE::CHAT_ROOM_INVALID_ROOM_NUMBER;
-		SendPacketFunc(clientIndex_, sizeof(ROOM_CHAT_RESPONSE_PACKET), (char*)&roomChatResPacket);
 		return;
 	}
 
+	const std::string cmdMessage(packet_.Message());
+
 	// Ư  "/c"
-	const std::string cmdMessage = pRoomChatReqPacketet->Message;
 	if (cmdMessage.find("/c", 0) == 0)
 	{
 		// Npc Ѵ
-		pRoom->EnterNpc();
+		room_.EnterNpc();
 		return;
 	}
 
@@ -534,18 +1008,20 @@ void PacketManager::ProcessRoomChatMessage(UINT32 clientIndex_, UINT16 packetSiz
 	{
 		// տ "/p" ϴ κ ߶󳽴
 		const std::string endPosStr = cmdMessage.substr(2);
-		TempFindPath(endPosStr, *reqUser, *pRoom);
+		TempFindPath(endPosStr, *reqUser, room_);
 		return;
 	}
 		
-	SendPacketFunc(clientIndex_, sizeof(ROOM_CHAT_RESPONSE_PACKET), (char*)&roomChatResPacket);
+	room_.SendToUser(clientIndex_, sizeof(ROOM_CHAT_RESPONSE_PACKET), (char*)&roomChatResPacket);
 
-	pRoom->NotifyChat(clientIndex_, reqUser->GetUserId().c_str(), pRoomChatReqPacketet->Message);		
+	room_.NotifyChat(clientIndex_, reqUser->GetUserId().c_str(), cmdMessage.c_str());		
 }
 
 // ================= κ丮 =========================
-void PacketManager::ProcessInventoryInfoRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessInventoryInfoRequest(UINT32 clientIndex_, const INVENTORY_INFO_REQUEST_PACKET& packet_)
 {
+	UNREFERENCED_PARAMETER(packet_);
+
 	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
 	if (!pUser) return;
 
@@ -563,12 +1039,11 @@ void PacketManager::ProcessInventoryInfoRequest(UINT32 clientIndex_, UINT16 pack
 		}
 	}
 
-	SendPacketFunc(clientIndex_, sizeof(INVENTORY_INFO_RESPONSE_PACKET), (char*)&response);
+	SendPacket(clientIndex_, sizeof(INVENTORY_INFO_RESPONSE_PACKET), (char*)&response);
 }
 
-void PacketManager::ProcessItemAddRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessItemAddRequest(UINT32 clientIndex_, const ITEM_ADD_REQUEST_PACKET& packet_)
 {
-	auto pRequest = reinterpret_cast<ITEM_ADD_REQUEST_PACKET*>(pPacket_);
 	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
 	if (!pUser) return;
 
@@ -578,9 +1053,9 @@ void PacketManager::ProcessItemAddRequest(UINT32 clientIndex_, UINT16 packetSize
 	// ⼭ ÷ ϵڵ
 	UINT16 slotIndex = 0;
 	bool success = pUser->GetInventory().AddItem(
-		pRequest->itemID,
+		packet_.itemID,
 		ITEM_TYPE::POTION,
-		pRequest->quantity,
+		packet_.quantity,
 		"Health Potion",
 		slotIndex
 	);
@@ -596,24 +1071,23 @@ void PacketManager::ProcessItemAddRequest(UINT32 clientIndex_, UINT16 packetSize
 		response.Result = (UINT16)ERROR_CODE::INVENTORY_FULL;
 	}
 
-	SendPacketFunc(clientIndex_, sizeof(ITEM_ADD_RESPONSE_PACKET), (char*)&response);
+	SendPacket(clientIndex_, sizeof(ITEM_ADD_RESPONSE_PACKET), (char*)&response);
 }
 
-void PacketManager::ProcessItemUseRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessItemUseRequest(UINT32 clientIndex_, const ITEM_USE_REQUEST_PACKET& packet_)
 {
-	auto pRequest = reinterpret_cast<ITEM_USE_REQUEST_PACKET*>(pPacket_);
 	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
 	if (!pUser) return;
 
 	ITEM_USE_RESPONSE_PACKET response;
 	UINT16 remainingQuantity = 0;
 
-	bool success = pUser->GetInventory().UseItem(pRequest->slotIndex, remainingQuantity);
+	bool success = pUser->GetInventory().UseItem(packet_.slotIndex, remainingQuantity);
 
 	if (success)
 	{
 		response.Result = (UINT16)ERROR_CODE::NONE;
-		response.slotIndex = pRequest->slotIndex;
+		response.slotIndex = packet_.slotIndex;
 		response.remainingQuantity = remainingQuantity;
 
 		// TODO:  ȿ  (ü ȸ )
@@ -623,23 +1097,21 @@ void PacketManager::ProcessItemUseRequest(UINT32 clientIndex_, UINT16 packetSize
 		response.Result = (UINT16)ERROR_CODE::ITEM_USE_FAILED;
 	}
 
-	SendPacketFunc(clientIndex_, sizeof(ITEM_USE_RESPONSE_PACKET), (char*)&response);
+	SendPacket(clientIndex_, sizeof(ITEM_USE_RESPONSE_PACKET), (char*)&response);
 }
 // =================================================
 
 // ====================== Quest =====================
-void PacketManager::ProcessQuestTalk(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessQuestTalk(UINT32 clientIndex_, const QUEST_TALK_REQUEST_PACKET& packet_)
 {
-	printf("[QuestTalk] recv from client=%u\n", clientIndex_);
+	ALOG_DEBUG("[QuestTalk] recv from client=%u\n", clientIndex_);
 	User* pUser = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
 	if (!pUser) return;
 
-	auto* pReq = reinterpret_cast<QUEST_TALK_REQUEST_PACKET*>(pPacket_);
-
 	QUEST_TALK_RESPONSE_PACKET res;
-	res.npc_id = pReq->npc_id;
+	res.npc_id = packet_.npc_id;
 	res.quest_id = 1;
-	res.state = (UINT8)pUser->GetQuestState();   // 0/1/2 Unity ؾ 
+	res.state = pUser->GetQuestState();
 	res.current = 0;
 	res.required = 1;
 
@@ -649,27 +1121,25 @@ void PacketManager::ProcessQuestTalk(UINT32 clientIndex_, UINT16 packetSize_, ch
 	res.rewardItemID = 1001; // :   ID
 	res.rewardQty = 1;
 
-	SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+	SendPacket(clientIndex_, sizeof(res), (char*)&res);
 }
 
-void PacketManager::ProcessQuestAccept(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessQuestAccept(UINT32 clientIndex_, const QUEST_ACCEPT_REQUEST_PACKET& packet_)
 {
 	User* pUser = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
 	if (!pUser) return;
 
-	auto* pReq = reinterpret_cast<QUEST_ACCEPT_REQUEST_PACKET*>(pPacket_);
-
 	QUEST_ACCEPT_RESPONSE_PACKET res;
-	res.quest_id = pReq->quest_id;
+	res.quest_id = packet_.quest_id;
 
 	// ̹ / ̸ 
 	if (pUser->GetQuestState() != QUEST_STATE::NOT_ACCEPTED)
 	{
 		res.result = 0;
-		res.state = (UINT8)pUser->GetQuestState();
+		res.state = pUser->GetQuestState();
 		res.current = 0;
 		res.required = 1;
-		SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+		SendPacket(clientIndex_, sizeof(res), (char*)&res);
 		return;
 	}
 
@@ -678,106 +1148,78 @@ void PacketManager::ProcessQuestAccept(UINT32 clientIndex_, UINT16 packetSize_,
 
 	//  
 	res.result = 1; // Unity 1̸  ó
-	res.state = (UINT8)pUser->GetQuestState();
+	res.state = pUser->GetQuestState();
 	res.current = 0;
 	res.required = 1;
 
-	// Room Ʈ   /
-	{
-		INT32 roomNum = pUser->GetCurrentRoom();
-		Room* room = mRoomManager->GetRoomByNumber(roomNum);
-		if (room)
-		{
-			// Room.h ߰ Լ
-			room->SetQuestAccepted((INT64)clientIndex_, (INT32)pReq->quest_id, (UINT16)res.required);
-		}
-		else
-		{
-			printf("[QuestAccept] room not found. client=%u room=%d\n", clientIndex_, roomNum);
-		}
-	}
+	// Room Ʈ   / (ProcessRoomQuestAccept)
+	PostToRoom(clientIndex_, (UINT16)PACKET_ID::QUEST_ACCEPT_REQUEST, sizeof(packet_), (char*)&packet_);
 
 	//  
-	SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+	SendPacket(clientIndex_, sizeof(res), (char*)&res);
 }
 
-void PacketManager::ProcessQuestComplete(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessRoomQuestAccept(Room& room_, UINT32 clientIndex_, const QUEST_ACCEPT_REQUEST_PACKET& packet_)
 {
-	UNREFERENCED_PARAMETER(packetSize_);
+	// ʿ  ProcessQuestAccept()  
+	room_.SetQuestAccepted((INT64)clientIndex_, (INT32)packet_.quest_id, 1);
+}
 
+void PacketManager::ProcessQuestComplete(UINT32 clientIndex_, const QUEST_COMPLETE_REQUEST_PACKET& packet_)
+{
 	User* pUser = mUserManager->GetUserByConnIdx((INT32)clientIndex_);
 	if (!pUser) return;
 
-	auto pReq = reinterpret_cast<QUEST_COMPLETE_REQUEST_PACKET*>(pPacket_);
-
 	QUEST_COMPLETE_RESPONSE_PACKET res;
-	res.QuestId = pReq->QuestId;
+	res.QuestId = packet_.QuestId;
 
 	if (pUser->GetQuestState() == QUEST_STATE::NOT_ACCEPTED)
 	{
 		res.Result = (UINT16)ERROR_CODE::QUEST_NOT_ACCEPTED;
-		res.State = (UINT8)pUser->GetQuestState();
-		SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+		res.State = pUser->GetQuestState();
+		SendPacket(clientIndex_, sizeof(res), (char*)&res);
 		return;
 	}
 
 	if (pUser->GetQuestState() == QUEST_STATE::COMPLETED)
 	{
 		res.Result = (UINT16)ERROR_CODE::QUEST_ALREADY_COMPLETED;
-		res.State = (UINT8)pUser->GetQuestState();
-		SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+		res.State = pUser->GetQuestState();
+		SendPacket(clientIndex_, sizeof(res), (char*)&res);
 		return;
 	}
 
 	pUser->SetQuestState(QUEST_STATE::COMPLETED);
 
 	res.Result = (UINT16)ERROR_CODE::NONE;
-	res.State = (UINT8)pUser->GetQuestState();
-	SendPacketFunc(clientIndex_, sizeof(res), (char*)&res);
+	res.State = pUser->GetQuestState();
+	SendPacket(clientIndex_, sizeof(res), (char*)&res);
 }
 // =================================================
 
 // ====================== Attack =====================
-void PacketManager::ProcessPlayerAttack(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_)
+void PacketManager::ProcessPlayerAttack(Room& room_, UINT32 clientIndex_, const PLAYER_ATTACK_REQUEST_PACKET& packet_)
 {
-	auto pAttackPacket = reinterpret_cast<PLAYER_ATTACK_REQUEST_PACKET*>(pPacket_);
-	auto pUser = mUserManager->GetUserByConnIdx(clientIndex_);
-
-	if (!pUser)
-	{
-		printf("[ProcessPlayerAttack] User not found: %d\n", clientIndex_);
-		return;
-	}
-
-	auto roomNum = pUser->GetCurrentRoom();
-	auto pRoom = mRoomManager->GetRoomByNumber(roomNum);
-
-	if (!pRoom)
-	{
-		printf("[ProcessPlayerAttack] Room not found: %d\n", roomNum);
-		return;
-	}
-
-	printf("[Attack] Player %lld attacking at (%.1f, %.1f, %.1f) dir(%.2f, %.2f, %.2f)\n",
+	ALOG_DEBUG("[Attack] Player %lld attacking at (%.1f, %.1f, %.1f) dir(%.2f, %.2f, %.2f)\n",
 		(INT64)clientIndex_,
-		pAttackPacket->attackPosition.x,
-		pAttackPacket->attackPosition.y,
-		pAttackPacket->attackPosition.z,
-		pAttackPacket->attackDirection.x,
-		pAttackPacket->attackDirection.y,
-		pAttackPacket->attackDirection.z);
+		packet_.attackPosition.x,
+		packet_.attackPosition.y,
+		packet_.attackPosition.z,
+		packet_.attackDirection.x,
+		packet_.attackDirection.y,
+		packet_.attackDirection.z);
 
 	// 濡  ó
-	pRoom->ProcessPlayerAttack((INT64)clientIndex_,
-		pAttackPacket->attackPosition,
-		pAttackPacket->attackDirection);
+	room_.ProcessPlayerAttack((INT64)clientIndex_,
+		packet_.attackPosition,
+		packet_.attackDirection);
 }
 // =================================================
 
-void PacketManager::TempFindPath(const std::string& endPosStr, User& user, Room& room)
+void PacketManager::TempFindPath(const std::string& endPosStr, Actor& user, Room& room)
 {
 
-	printf("[TempFindPath] userUUID(%lld) pos(%f,%f,%f), endPos(%s)\n", user.GetNetConnIdx(),
+	ALOG_DEBUG("[TempFindPath] userUUID(%lld) pos(%f,%f,%f), endPos(%s)\n", user.GetNetConnIdx(),
 		user.GetPosition().x, user.GetPosition().y, user.GetPosition().z, endPosStr.c_str());
 
 	Vector3 end = stringToVector3(endPosStr);
@@ -790,7 +1232,7 @@ void PacketManager::TempFindPath(const std::string& endPosStr, User& user, Room&
 	for (int i = 0; i < path.size() && i < 10; ++i)
 	{
 		movePathResponse.path[i] = path[i];
-		printf("[TempFindPath] path[%i](%f,%f,%f)\n", i, path[i].x, path[i].y, path[i].z);
+		ALOG_DEBUG("[TempFindPath] path[%i](%f,%f,%f)\n", i, path[i].x, path[i].y, path[i].z);
 	}
 
 	// Send
@@ -1,20 +1,46 @@
 #pragma once
 
 #include "Packet.h"
+#include "ServerConfig.h"
+#include "PacketRateLimiter.h"
+#include "PacketDispatcher.h"
+#include "LogicTask.h"
+#include "ServerNetwork/MpscQueue.h"
+#include "ServerNetwork/ThreadWakeup.h"
 
-#include <unordered_map>
 #include <deque>
 #include <functional>
 #include <thread>
-#include <mutex>
 #include <string>
 
 
+class Actor;
 class User;
 class Room;
 class UserManager;
 class RoomManager;
 class RedisManager;
+class stBroadcastBuffer;
+struct stThreadStat;
+struct stRoomTask;
+struct stRoomEnterInfo;
+struct stRoomLeftInfo;
+struct RedisNoticeRes;
+class RecvRingBuffer;
+
+//I/O 尡  忡 ѱ  뺸.    Ϳ ϼ Ŷ 뺸 ϳ ´.
+struct stInComingPacket
+{
+	UINT32 SessionId = 0;
+	UINT32 PacketCount = 0;		//  ̾  Ŷ 
+	UINT64 RecvTimeNs = 0;
+};
+
+const UINT32 INCOMING_PACKET_QUEUE_SIZE = 65536;	// 뺸 ť.   I/O 尡  带 ٸ.
+const UINT32 SYSTEM_PACKET_QUEUE_SIZE = 16384;
+const UINT32 UDP_PACKET_QUEUE_SIZE = 16384;
+const UINT32 LOGIC_BATCH_SIZE = 256;			// 尡 ť ϳ    ִ 
+const UINT32 LOGIC_WAIT_TIMEOUT_MS = 100;		//    ִ ð.  Ȯο
 
 Vector3 stringToVector3(const std::string& s);
 
@@ -23,76 +49,118 @@ public:
 	PacketManager() = default;
 	~PacketManager() = default;
 
-	void Init(const UINT32 maxClient_);
+	void Init(const ServerConfig& config_);
 
 	bool Run();
 
 	void End();
 
-	void ReceivePacketData(const UINT32 clientIndex_, const UINT32 size_, char* pData_);
+	void ReceivePacketData(const UINT32 sessionId_);
 
 	void PushSystemPacket(PacketInfo packet_);
+
+	void ReceiveUdpPacket(const UINT32 sessionId_, const UINT32 packetSize_, char* pPacket_, const bool isReliableUdp_);
 		
+	//Ʈũ  Լ  ID ޴´.     ȣ  SendPacket() ٲ۴.
 	std::function<void(UINT32, UINT32, char*)> SendPacketFunc;
+	std::function<void(UINT32, stBroadcastBuffer*)> SendBroadcastFunc;
+	std::function<RecvRingBuffer*(UINT32)> GetRecvRingFunc;
+	std::function<INT32(UINT32, UINT64)> ReportPongFunc;	//( ID,  ð) -> RTT(ms).   ƴϸ -1
+	std::function<bool(UINT32)> DisconnectFunc;
+	std::function<UINT64(UINT32)> IssueUdpTokenFunc;	//( ID) -> UDP ū. UDP   0
+	std::function<bool(UINT32, UINT32, char*)> SendUdpFunc;	//( ID, ũ, ) -> UDP    ̳ Ŷ̸ false
 
 private:
-	void CreateCompent(const UINT32 maxClient_);
+	void CreateCompent(const ServerConfig& config_);
 
 	void ClearConnectionInfo(INT32 clientIndex_);
 
-	void EnqueuePacketData(const UINT32 clientIndex_);
-	PacketInfo DequePacketData();
+	RecvRingBuffer* BindSession(const UINT32 sessionId_);
+
+	void SendPacket(const UINT32 userIndex_, const UINT32 packetSize_, char* pPacket_);
+	void SendPacketToSession(const UINT32 sessionId_, const UINT32 packetSize_, char* pPacket_);
+	void SendUdpToken(const UINT32 userIndex_);
 
-	PacketInfo DequeSystemPacketData();
+	void EnqueuePacketData(const UINT32 sessionId_, const UINT32 packetCount_, const UINT64 recvTimeNs_);
+	PacketInfo GetInComingPacket(const stInComingPacket& inComingPacket_);
+	void ReleasePacketData(const PacketInfo& packet_);
 
-	void RedisReqNotice(User& user, const std::string noticeMsg);
+	bool DequeSystemPacketData(PacketInfo* pPacket_);
+	bool DequeUdpPacketData(PacketInfo* pPacket_);
+	bool IsInboundEmpty();
+
+	void RedisReqNotice(Actor& user, const std::string noticeMsg);
 
 
 	void ProcessPacket();
+	UINT32 ProcessInComingPackets(stThreadStat* pStat_);
+	UINT32 ProcessSystemPackets(stThreadStat* pStat_);
+	UINT32 ProcessUdpPackets(stThreadStat* pStat_);
+	UINT32 ProcessRedisResponses(stThreadStat* pStat_);
+
+	void ProcessClientPacket(const PacketInfo& packet_);
 
+	void ProcessSystemPacket(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_);
 	void ProcessRecvPacket(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_);
 
-	void ProcessUserConnect(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessUserDisConnect(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	bool PostToRoom(const UINT32 clientIndex_, const UINT16 packetId_, const UINT16 packetSize_, char* pPacket_);
+	void ProcessRoomTask(Room* pRoom_, const stRoomTask& task_);
+
+	void ProcessUserConnect(UINT32 sessionId_);
+	void ProcessUserDisConnect(UINT32 sessionId_);
 	
-	void ProcessLogin(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessLoginDBResult(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessNoticeDBResult(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	LogicTask ProcessLogin(UINT32 clientIndex_, const LOGIN_REQUEST_PACKET& packet_);
+	void ProcessHeartbeatPong(UINT32 clientIndex_, const HEARTBEAT_PONG_PACKET& packet_);
+	void ProcessNoticeDBResult(UINT32 clientIndex_, const RedisNoticeRes& body_);
 	
-	void ProcessEnterRoom(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessEnterRoomByPlayerJoined(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessHitReport(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessLeaveRoom(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessPlayerMovement(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessRoomChatMessage(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessEnterRoom(UINT32 clientIndex_, const ROOM_ENTER_REQUEST_PACKET& packet_);
+	void ProcessEnterRoomByPlayerJoined(UINT32 clientIndex_, const ROOM_NEW_USER_NTF_PACKET& packet_);
+	void ProcessLeaveRoom(UINT32 clientIndex_, const ROOM_LEAVE_REQUEST_PACKET& packet_);
+	void ProcessRoomLeft(UINT32 sessionId_, const stRoomLeftInfo& leftInfo_);
+
+	// ====================== Room =====================
+	//   Ŀ 忡 ȣȴ.  ¿  (RoomUser)  UserManager User  ʴ´.
+	void ProcessRoomEnter(Room& room_, UINT32 clientIndex_, const stRoomEnterInfo& enterInfo_);
+	void ProcessRoomLeave(Room& room_, UINT32 clientIndex_);
+	void ProcessRoomNotice(Room& room_, UINT32 clientIndex_, UINT16 packetSize_, const PACKET_HEADER& packet_);
+	void ProcessHitReport(Room& room_, UINT32 clientIndex_, const HIT_REPORT_PACKET& packet_);
+	void ProcessPlayerMovement(Room& room_, UINT32 clientIndex_, const PLAYER_MOVEMENT_PACKET& packet_);
+	void ProcessRoomChatMessage(Room& room_, UINT32 clientIndex_, const ROOM_CHAT_REQUEST_VIEW& packet_);
+	void ProcessRoomQuestAccept(Room& room_, UINT32 clientIndex_, const QUEST_ACCEPT_REQUEST_PACKET& packet_);
+	// =================================================
 
 	// ====================== Inventory =====================
 	// κ丮  û ó
-	void ProcessInventoryInfoRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessInventoryInfoRequest(UINT32 clientIndex_, const INVENTORY_INFO_REQUEST_PACKET& packet_);
 
 	//  ߰ û ó
-	void ProcessItemAddRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessItemAddRequest(UINT32 clientIndex_, const ITEM_ADD_REQUEST_PACKET& packet_);
 
 	//   û ó
-	void ProcessItemUseRequest(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessItemUseRequest(UINT32 clientIndex_, const ITEM_USE_REQUEST_PACKET& packet_);
 	// =================================================
 
 	// ====================== Quest =====================
 	// NPC  ó : ȣ ̰ 
-	void ProcessQuestTalk(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessQuestAccept(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
-	void ProcessQuestComplete(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessQuestTalk(UINT32 clientIndex_, const QUEST_TALK_REQUEST_PACKET& packet_);
+	void ProcessQuestAccept(UINT32 clientIndex_, const QUEST_ACCEPT_REQUEST_PACKET& packet_);
+	void ProcessQuestComplete(UINT32 clientIndex_, const QUEST_COMPLETE_REQUEST_PACKET& packet_);
 	// =================================================
 
 	// ====================== Attack =====================
 	// ÷̾  ó Լ ߰
-	void ProcessPlayerAttack(UINT32 clientIndex_, UINT16 packetSize_, char* pPacket_);
+	void ProcessPlayerAttack(Room& room_, UINT32 clientIndex_, const PLAYER_ATTACK_REQUEST_PACKET& packet_);
 	// =================================================
 
-	void TempFindPath(const std::string& endPosStr, User& user, Room& room);
+	void TempFindPath(const std::string& endPosStr, Actor& user, Room& room);
+
+	//Ŷ ID ٷ ã ڵ鷯 ǥ. ϵ ü  Ŷ ڵ鷯 θ ʰ .
+	//Ŭ̾Ʈ Ŷ(mRecvDispatcher)  ȿ  Ŷ(mSystemDispatcher)  Ŭ̾Ʈ  ID 䳻    Ѵ.
+	PacketDispatcher<PacketManager> mRecvDispatcher;
+	PacketDispatcher<PacketManager> mSystemDispatcher;
 
-	typedef void(PacketManager::* PROCESS_RECV_PACKET_FUNCTION)(UINT32, UINT16, char*);
-	std::unordered_map<int, PROCESS_RECV_PACKET_FUNCTION> mRecvFuntionDictionary;
+	//mRecvDispatcher  Ŷ   ִ  Ŀ Ѱܼ ⼭ ã´. Init() ڿ б⸸ Ѵ.
+	PacketDispatcher<PacketManager, Room&> mRoomDispatcher;
 
 	UserManager* mUserManager;
 	RoomManager* mRoomManager;	
@@ -102,13 +170,23 @@ private:
 
 
 	bool mIsRunProcessThread = false;
+	std::vector<UINT32> mLogicCpus;
+
+	PacketRateLimiter mRateLimiter;
+	PacketRateLimiter mUdpRateLimiter;	// UDP   
+	UINT16 mUdpPort = 0;
 	
 	std::thread mProcessThread;
 	
-	std::mutex mLock;
-	
-	std::deque<UINT32> mInComingPacketUserIndex;
+	//I/O, ƮƮ, UDP 尡 ְ  常 .   mLogicWakeup   带 .
+	MpscQueue<stInComingPacket> mInComingPacketUserIndex;
+
+	MpscQueue<PacketInfo> mSystemPacketQueue;
+
+	MpscQueue<PacketInfo> mUdpPacketQueue;	// ClientIndex  ID. ʹ   ̶ ó  Ѵ.
+
+	ThreadWakeup mLogicWakeup;
 
-	std::deque<PacketInfo> mSystemPacketQueue;
+	char* mDecompressBuffer = nullptr;	//  尡 TCP   Ŷ Ǫ 
 };
 
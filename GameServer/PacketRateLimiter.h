@@ -0,0 +1,174 @@
+#pragma once
+
+#include "Packet.h"
+#include "ServerNetwork/TokenBucket.h"
+
+#include <stdio.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+
+//ӵ   δ Ŷ 
+enum class RATE_LIMIT_CLASS : UINT8
+{
+	MOVEMENT,
+	CHAT,
+	COMBAT,
+	DEFAULT,
+	COUNT
+};
+
+struct stRateLimitRule
+{
+	UINT32 RatePerSec;
+	UINT32 Burst;
+	bool IsViolation;	//ģ Ŷ  .  ̸ ´.
+};
+
+//Ŭ̾Ʈ ̴    ̵ Ŷ Ƿ ̵ ˳ϰ ΰ, ĵ ֽ ġ ǹ̰ ־ ⸸ Ѵ.
+const stRateLimitRule RATE_LIMIT_RULES[(int)RATE_LIMIT_CLASS::COUNT] =
+{
+	{ 150, 300, false },	//MOVEMENT
+	{ 5, 10, true },		//CHAT
+	{ 30, 60, true },		//COMBAT
+	{ 50, 100, true },		//DEFAULT
+};
+const stRateLimitRule RATE_LIMIT_SESSION_RULE = { 400, 800, true };	//   Ŷ
+
+// ʴ RATE_LIMIT_VIOLATION_PER_SEC  ְ, ׺ RATE_LIMIT_VIOLATION_BURST  Ѱ ̸ ´.
+const UINT32 RATE_LIMIT_VIOLATION_PER_SEC = 10;
+const UINT32 RATE_LIMIT_VIOLATION_BURST = 100;
+
+enum class RATE_LIMIT_RESULT : UINT8
+{
+	PASS,
+	DROP,		//  ѱ ʰ .
+	DISCONNECT,	//  ´.    Ŷ  DROP
+};
+
+inline RATE_LIMIT_CLASS GetRateLimitClass(const UINT16 packetId_)
+{
+	switch ((PACKET_ID)packetId_)
+	{
+	case PACKET_ID::PLAYER_MOVEMENT:
+		return RATE_LIMIT_CLASS::MOVEMENT;
+
+	case PACKET_ID::ROOM_CHAT_REQUEST:
+		return RATE_LIMIT_CLASS::CHAT;
+
+	case PACKET_ID::PLAYER_ATTACK_REQUEST:
+	case PACKET_ID::HIT_REPORT:
+		return RATE_LIMIT_CLASS::COMBAT;
+
+	default:
+		return RATE_LIMIT_CLASS::DEFAULT;
+	}
+}
+
+
+//Ǻ, Ŷ  ū Ŷ  Ŷ  忡 ѱ  ɷ.
+//  óϴ I/O 忡 ȣϹǷ  ¿  .
+class PacketRateLimiter
+{
+public:
+	void Init(const UINT32 maxSessionCount_, const bool isEnabled_)
+	{
+		mIsEnabled = isEnabled_;
+		mSessions = std::make_unique<stSessionLimit[]>(maxSessionCount_);
+	}
+
+	bool IsEnabled() { return mIsEnabled; }
+
+	RATE_LIMIT_RESULT Check(const UINT32 sessionId_, const UINT16 packetId_, const UINT64 nowMs_)
+	{
+		if (mIsEnabled == false)
+		{
+			return RATE_LIMIT_RESULT::PASS;
+		}
+
+		auto& session = mSessions[GetSessionIndex(sessionId_)];
+		if (session.SessionId != sessionId_)
+		{
+			session.Reset(sessionId_, nowMs_);
+		}
+
+		auto rateClass = (int)GetRateLimitClass(packetId_);
+
+		if (session.IsDisconnecting)
+		{
+			mDroppedCount[rateClass].fetch_add(1, std::memory_order_relaxed);
+			return RATE_LIMIT_RESULT::DROP;
+		}
+
+		// Ŷ ġ  Ŷ  ʴ´.
+		bool isViolation = false;
+		if (session.ClassBuckets[rateClass].TryConsume(nowMs_))
+		{
+			if (session.SessionBucket.TryConsume(nowMs_))
+			{
+				return RATE_LIMIT_RESULT::PASS;
+			}
+
+			isViolation = RATE_LIMIT_SESSION_RULE.IsViolation;
+		}
+		else
+		{
+			isViolation = RATE_LIMIT_RULES[rateClass].IsViolation;
+		}
+
+		mDroppedCount[rateClass].fetch_add(1, std::memory_order_relaxed);
+
+		if (isViolation && session.ViolationBucket.TryConsume(nowMs_) == false)
+		{
+			session.IsDisconnecting = true;
+			mDisconnectCount.fetch_add(1, std::memory_order_relaxed);
+			return RATE_LIMIT_RESULT::DISCONNECT;
+		}
+
+		return RATE_LIMIT_RESULT::DROP;
+	}
+
+	void Print(const char* pName_)
+	{
+		printf("[ӵ ] %s dropped move(%llu) chat(%llu) combat(%llu) other(%llu) disconnected(%llu)\n", pName_,
+			(UINT64)mDroppedCount[(int)RATE_LIMIT_CLASS::MOVEMENT], (UINT64)mDroppedCount[(int)RATE_LIMIT_CLASS::CHAT],
+			(UINT64)mDroppedCount[(int)RATE_LIMIT_CLASS::COMBAT], (UINT64)mDroppedCount[(int)RATE_LIMIT_CLASS::DEFAULT],
+			(UINT64)mDisconnectCount);
+	}
+
+	static UINT64 GetNowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+private:
+	struct stSessionLimit
+	{
+		//   Ŷ  ä Ѵ.
+		void Reset(const UINT32 sessionId_, const UINT64 nowMs_)
+		{
+			SessionId = sessionId_;
+			IsDisconnecting = false;
+
+			for (int i = 0; i < (int)RATE_LIMIT_CLASS::COUNT; ++i)
+			{
+				ClassBuckets[i].Init(RATE_LIMIT_RULES[i].RatePerSec, RATE_LIMIT_RULES[i].Burst, nowMs_);
+			}
+			SessionBucket.Init(RATE_LIMIT_SESSION_RULE.RatePerSec, RATE_LIMIT_SESSION_RULE.Burst, nowMs_);
+			ViolationBucket.Init(RATE_LIMIT_VIOLATION_PER_SEC, RATE_LIMIT_VIOLATION_BURST, nowMs_);
+		}
+
+		UINT32 SessionId = 0;
+		bool IsDisconnecting = false;
+		stTokenBucket ClassBuckets[(int)RATE_LIMIT_CLASS::COUNT];
+		stTokenBucket SessionBucket;
+		stTokenBucket ViolationBucket;
+	};
+
+	bool mIsEnabled = true;
+	std::unique_ptr<stSessionLimit[]> mSessions;
+
+	std::atomic<UINT64> mDroppedCount[(int)RATE_LIMIT_CLASS::COUNT] = {};
+	std::atomic<UINT64> mDisconnectCount{ 0 };
+};
\ No newline at end of file
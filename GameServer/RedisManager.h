@@ -5,17 +5,29 @@
 
 //#include "../thirdparty/CRedisConn.h"
 #include "CRedisConnEx.h"
+#include "ServerNetwork/MpscQueue.h"
 #include <vector>
 #include <deque>
 #include <thread>
 #include <mutex>
+#include <atomic>
+#include <functional>
+
+const UINT32 REDIS_RESPONSE_QUEUE_SIZE = 4096;
 
 class RedisManager
 {
 public:
-	RedisManager() = default;
+	RedisManager()
+	{
+		mResponseTask.Init(REDIS_RESPONSE_QUEUE_SIZE);
+		mResumeQueue.Init(REDIS_RESPONSE_QUEUE_SIZE);
+	}
 	~RedisManager() = default;
 
+	//Redis 尡    ȣѴ.   带 .
+	std::function<void()> ResponseNotifyFunc;
+
 	bool Run(std::string ip_, UINT16 port_, const UINT32 threadCount_)
 	{
 		if (Connect(ip_, port_) == false)
@@ -40,9 +52,13 @@ public:
 
 	void End()
 	{
-		mIsTaskRun = false;
+		{
+			std::lock_guard<std::mutex> guard(mReqLock);
+			mIsTaskRun = false;
+		}
 
-		mConnSub.disConnect();
+		//  Redis ٸ  Ƿ  ݾ .  ü 尡   Ѵ.
+		mConnSub.shutdownSocket();
 
 		for (auto& thread : mTaskThreads)
 		{
@@ -51,29 +67,114 @@ public:
 				thread.join();
 			}
 		}
+
+		mConnSub.disConnect();
 	}
 
-	void PushTask(RedisTask task_)
+	//End()      ȣѴ.  ٸ ڷƾ ̾  ʰ Ӹ Ѵ.
+	void DestroyWaiters()
 	{
 		std::lock_guard<std::mutex> guard(mReqLock);
-		mRequestTask.push_back(task_);
+		for (auto& command : mRequestCommand)
+		{
+			if (command.Waiter)
+			{
+				command.Waiter.destroy();
+			}
+		}
+		mRequestCommand.clear();
+
+		while (auto waiter = TakeResume())
+		{
+			waiter.destroy();
+		}
 	}
 
-	RedisTask TakeResponseTask()
+	//co_awaitϸ Redis  ϳ     ڷƾ .   LogicTask ȿ .
+	// Redis 尡 ڷƾ    ü ٷ ä,  尡 TakeResume()  ̾ Ѵ.
+	class Awaiter
 	{
-		std::lock_guard<std::mutex> guard(mResLock);
+	public:
+		Awaiter(RedisManager& redisMgr_, stRedisCommand command_) : mRedisMgr(redisMgr_), mCommand(std::move(command_)) {}
+
+		bool await_ready() const { return false; }
 
-		if (mResponseTask.empty())
+		//Redis    ʰ FAILED ̾.
+		bool await_suspend(std::coroutine_handle<> waiter_)
 		{
-			return RedisTask();
+			mCommand.pReply = &mReply;
+			mCommand.Waiter = waiter_;
+			return mRedisMgr.PushCommand(std::move(mCommand));
 		}
 
-		auto task = mResponseTask.front();
-		mResponseTask.pop_front();
+		stRedisReply await_resume() { return std::move(mReply); }
+
+	private:
+		RedisManager& mRedisMgr;
+		stRedisCommand mCommand;
+		stRedisReply mReply;
+	};
+
+	Awaiter Get(std::string key_)
+	{
+		stRedisCommand command;
+		command.Command = REDIS_COMMAND::GET;
+		command.Key = std::move(key_);
+		return Awaiter(*this, std::move(command));
+	}
+
+	// ٸ ʴ´.  Ŀ ҷ ȴ.
+	void Publish(std::string channel_, std::string message_)
+	{
+		stRedisCommand command;
+		command.Command = REDIS_COMMAND::PUBLISH;
+		command.Key = std::move(channel_);
+		command.Value = std::move(message_);
+		PushCommand(std::move(command));
+	}
+
+	//ȯ : Redis 尡   ʾ   false
+	bool PushCommand(stRedisCommand command_)
+	{
+		std::lock_guard<std::mutex> guard(mReqLock);
+		if (mIsTaskRun == false)
+		{
+			return false;
+		}
+
+		mRequestCommand.push_back(std::move(command_));
+		return true;
+	}
+
+	//  ڷƾ.   ڵ.  常 ȣѴ.
+	std::coroutine_handle<> TakeResume()
+	{
+		std::coroutine_handle<> waiter;
+		if (mResumeQueue.TryPop(&waiter) == false)
+		{
+			return nullptr;
+		}
+
+		return waiter;
+	}
+
+	// 常 ȣѴ.
+	RedisTask TakeResponseTask()
+	{
+		RedisTask task;
+		if (mResponseTask.TryPop(&task) == false)
+		{
+			return RedisTask();
+		}
 
 		return task;
 	}
 
+	bool IsResponseEmpty() const
+	{
+		return mResponseTask.IsEmpty() && mResumeQueue.IsEmpty();
+	}
+
 
 private:
 	bool Connect(std::string ip_, UINT16 port_)
@@ -109,47 +210,11 @@ private:
 		{
 			bool isIdle = true;
 
-			if (auto task = TakeRequestTask(); task.TaskID != RedisTaskID::INVALID)
+			stRedisCommand command;
+			if (TakeRequestCommand(&command))
 			{
 				isIdle = false;
-
-				if (task.TaskID == RedisTaskID::REQUEST_LOGIN)
-				{
-					auto pRequest = (RedisLoginReq*)task.pData;
-					
-					RedisLoginRes bodyData;
-					bodyData.Result = (UINT16)ERROR_CODE::LOGIN_USER_INVALID_PW;
-
-					std::string value;
-					if (mConn.get(pRequest->UserID, value))
-					{
-						bodyData.Result = (UINT16)ERROR_CODE::NONE;
-
-						if (value.compare(pRequest->UserPW) == 0)
-						{
-							bodyData.Result = (UINT16)ERROR_CODE::NONE;
-							CopyUserID(bodyData.UserID, pRequest->UserID);
-						}
-					}
-					
-					RedisTask resTask;
-					resTask.UserIndex = task.UserIndex;
-					resTask.TaskID = RedisTaskID::RESPONSE_LOGIN;
-					resTask.DataSize = sizeof(RedisLoginRes);
-					resTask.pData = new char[resTask.DataSize];
-					CopyMemory(resTask.pData, (char*)&bodyData, resTask.DataSize);
-
-					PushResponse(resTask);
-				}
-				else if (task.TaskID == RedisTaskID::REQUEST_NOTICE)
-				{
-					auto pRequest = (RedisNoticeReq*)task.pData;
-
-					mConn.publish("ch_notice", pRequest->Message);
-					
-				}
-
-				task.Release();
+				ExecuteCommand(command);
 			}
 
 	
@@ -166,12 +231,20 @@ private:
 	{
 		printf("RedisManager::SubscribeThread() Redis(Sub)  ...\n");
 
-		auto result = mConnSub.initSubscribe("ch_notice");
+		//   subscribe()     .
+		if (mConnSub.initSubscribe(REDIS_NOTICE_CHANNEL) == false)
+		{
+			printf("RedisManager::SubscribeThread() Redis(Sub)  \n");
+			return;
+		}
 
 		while (mIsTaskRun)
 		{
 			std::string message; /* output */
-			mConnSub.subscribe(message);
+			if (mConnSub.subscribe(message) == false)
+			{
+				break;
+			}
 
 			RedisNoticeRes bodyData;
 			CopyUserID(bodyData.UserID, "[GM]");
@@ -188,25 +261,61 @@ private:
 		}
 	}
 
-	RedisTask TakeRequestTask()
+	void ExecuteCommand(stRedisCommand& command_)
+	{
+		stRedisReply reply;
+
+		switch (command_.Command)
+		{
+		case REDIS_COMMAND::GET:
+			if (mConn.get(command_.Key, reply.Value))
+			{
+				reply.Result = REDIS_REPLY_RESULT::OK;
+			}
+			else if (mConn.isConneced())
+			{
+				reply.Result = REDIS_REPLY_RESULT::NOT_FOUND;
+			}
+			break;
+		case REDIS_COMMAND::PUBLISH:
+			mConn.publish(command_.Key, command_.Value);
+			reply.Result = REDIS_REPLY_RESULT::OK;
+			break;
+		}
+
+		if (command_.Waiter)
+		{
+			*command_.pReply = std::move(reply);
+			mResumeQueue.Push(command_.Waiter);
+			if (ResponseNotifyFunc)
+			{
+				ResponseNotifyFunc();
+			}
+		}
+	}
+
+	bool TakeRequestCommand(stRedisCommand* pCommand_)
 	{
 		std::lock_guard<std::mutex> guard(mReqLock);
 
-		if (mRequestTask.empty())
+		if (mRequestCommand.empty())
 		{
-			return RedisTask();
+			return false;
 		}
 
-		auto task = mRequestTask.front();
-		mRequestTask.pop_front();
+		*pCommand_ = std::move(mRequestCommand.front());
+		mRequestCommand.pop_front();
 
-		return task;
+		return true;
 	}
 
 	void PushResponse(RedisTask task_)
 	{
-		std::lock_guard<std::mutex> guard(mResLock);
-		mResponseTask.push_back(task_);
+		mResponseTask.Push(task_);
+		if (ResponseNotifyFunc)
+		{
+			ResponseNotifyFunc();
+		}
 	}
 
 
@@ -217,12 +326,12 @@ private:
 	RedisCpp::CRedisConnEx mConn;
 	RedisCpp::CRedisConnEx mConnSub; // Redis Subscribe
 
-	bool		mIsTaskRun = false;
+	std::atomic<bool> mIsTaskRun = false;	//ٲ  mReqLock ´. PushCommand() End()  ʰ Ѵ.
 	std::vector<std::thread> mTaskThreads;
 
 	std::mutex mReqLock;
-	std::deque<RedisTask> mRequestTask;
+	std::deque<stRedisCommand> mRequestCommand;
 
-	std::mutex mResLock;
-	std::deque<RedisTask> mResponseTask;
+	MpscQueue<RedisTask> mResponseTask;	//Redis  ְ  尡 .
+	MpscQueue<std::coroutine_handle<>> mResumeQueue;	// ͼ ̾  ڷƾ
 };
\ No newline at end of file
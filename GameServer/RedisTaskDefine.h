@@ -1,17 +1,22 @@
 #pragma once
 
+#ifdef _WIN32
 #define WIN32_LEAN_AND_MEAN
 #include <windows.h>
+#else
+#include "ServerNetwork/LinuxDefine.h"
+#endif
 
 #include "ErrorCode.h"
 
+#include <coroutine>
+#include <string>
+
+//û  Redis  ˸( ޽). Ŷó   ڵ鷯 ǥ óѴ.
 enum class RedisTaskID : UINT16
 {
 	INVALID = 0,
 
-	REQUEST_LOGIN = 1001,
-	RESPONSE_LOGIN = 1002,
-	REQUEST_NOTICE = 1003,
 	RESPONSE_NOTICE = 1004,
 };
 
@@ -34,28 +39,44 @@ struct RedisTask
 };
 
 
+const char REDIS_NOTICE_CHANNEL[] = "ch_notice";
 
+enum class REDIS_COMMAND : UINT8
+{
+	GET,
+	PUBLISH,	//Key ä, Value ޽
+};
 
-#pragma pack(push,1)
-
-struct RedisLoginReq
+enum class REDIS_REPLY_RESULT : UINT8
 {
-	char UserID[MAX_USER_ID_LEN + 1];
-	char UserPW[MAX_USER_PW_LEN + 1];
+	FAILED,		//Redis  ߰ų  ߴ
+	OK,
+	NOT_FOUND,	//Ű 
 };
 
-struct RedisLoginRes
+struct stRedisReply
 {
-	char UserID[MAX_USER_ID_LEN + 1];
-	UINT16 Result = (UINT16)ERROR_CODE::NONE;
+	REDIS_REPLY_RESULT Result = REDIS_REPLY_RESULT::FAILED;
+	std::string Value;
 };
 
-struct RedisNoticeReq
+//Redis 尡   ϳ
+struct stRedisCommand
 {
-	char UserID[MAX_USER_ID_LEN + 1];
-	char Message[MAX_CHAT_MSG_SIZE + 1];
+	REDIS_COMMAND Command = REDIS_COMMAND::GET;
+	std::string Key;
+	std::string Value;
+
+	// ٸ ڷƾ  ä . ڷƾ  ȿ ִ.   .
+	stRedisReply* pReply = nullptr;
+	std::coroutine_handle<> Waiter;
 };
 
+
+
+
+#pragma pack(push,1)
+
 struct RedisNoticeRes
 {
 	char UserID[MAX_USER_ID_LEN + 1];
@@ -3,30 +3,68 @@
 #include "Npc.h"
 #include "UserManager.h"
 #include "Packet.h"
+#include "PacketCompressor.h"
 #include "NavMeshManager.h"
 #include "Enemy.h"
 #include "EnemySpawner.h"
+#include "ServerNetwork/BroadcastBuffer.h"
+#include "ServerNetwork/AsyncLogger.h"
 
 #include <functional>
 #include <unordered_map>
-#include <thread>
+#include <list>
+#include <algorithm>
+#include <cmath>
 
 void CopyUserID(char* userID, const Actor& user);
 void CopyUserID(char* userID, const std::string& userID_);
 void CopyUserID(char* userID, const char* userID_);
 
+//SYS_ROOM_ENTER .  尡     ؼ  Ŀ ѱ.
+struct stRoomEnterInfo
+{
+	UINT32 SessionId = 0;
+	char UserID[MAX_USER_ID_LEN + 1] = { 0, };
+	Vector3 Position;
+	Quaternion Rotation;
+	bool IsSendResponse = false;	//    ROOM_ENTER_RESPONSE .
+};
+
+//SYS_ROOM_LEFT .  ȿ  ġ   User ش.
+struct stRoomLeftInfo
+{
+	Vector3 Position;
+	Quaternion Rotation;
+};
+
+//  .   Ŀ    Userʹ  ġ ȸ ´.
+//     ID Ƿ  뺸  翬  ߸  ʴ´.
+class RoomUser : public Actor
+{
+public:
+	void Init(const INT32 userIndex_, const INT32 roomNumber_, const stRoomEnterInfo& info_)
+	{
+		mIndex = userIndex_;
+		mUserID = info_.UserID;
+		mSessionId = info_.SessionId;
+		position = info_.Position;
+		rotation = info_.Rotation;
+		EnterRoom(roomNumber_);
+	}
+
+	UINT32 GetSessionId() const { return mSessionId; }
+
+private:
+	UINT32 mSessionId = 0;
+};
+
+// ´   RoomShard Ŀ 常 . ٸ  RoomShard::Post()   ѱ.
 class Room 
 {
 public:
 	Room() = default;
 	~Room()
 	{
-		mIsRunning = false;
-		if (mUpdateThread.joinable())
-		{
-			mUpdateThread.join();
-		}
-
 		//  
 		for (auto& pair : mEnemies)
 		{
@@ -60,10 +98,6 @@ public:
 
 		// ʱ  
 		SpawnInitialEnemies();
-
-		// Ʈ  
-		mIsRunning = true;
-		mUpdateThread = std::thread([this]() { UpdateLoop(); });
 	}
 
 	void InitNavMesh(const std::string& navMeshFileName)
@@ -121,7 +155,7 @@ public:
 
             mSpawners.push_back(spawner);
 
-            printf("[Room %d] Spawner created: ID=%lld, Type=%d, Pos=(%.1f, %.1f, %.1f)\n",
+            ALOG_DEBUG("[Room %d] Spawner created: ID=%lld, Type=%d, Pos=(%.1f, %.1f, %.1f)\n",
                 mRoomNum, spawnerID, (int)spawnerTypes[i],
                 spawnerPositions[i].x, spawnerPositions[i].y, spawnerPositions[i].z);
         }
@@ -141,43 +175,31 @@ public:
             }
         }
 
-        printf("[Room %d] Initial enemies spawned: %d enemies\n", mRoomNum, (int)mEnemies.size());
+        ALOG_INFO("[Room %d] Initial enemies spawned: %d enemies\n", mRoomNum, (int)mEnemies.size());
     }
 
-    // Ʈ 
-    void UpdateLoop()
+    //  Ʈ.   Ŀ ROOM_TICK_MS θ.
+    void Update(float deltaTime)
     {
-        auto lastUpdate = std::chrono::steady_clock::now();
-
-        while (mIsRunning)
+        //  Ʈ
+        for (auto& pair : mEnemies)
         {
-            auto now = std::chrono::steady_clock::now();
-            float deltaTime = std::chrono::duration<float>(now - lastUpdate).count();
-            lastUpdate = now;
-
-            //  Ʈ
-            for (auto& pair : mEnemies)
+            Enemy* enemy = pair.second;
+            if (!enemy->IsDead())
             {
-                Enemy* enemy = pair.second;
-                if (!enemy->IsDead())
-                {
-                    enemy->Update(deltaTime);
-                }
+                enemy->Update(deltaTime);
             }
+        }
 
-            //  Ʈ ()
-            UpdateSpawners(deltaTime);
-
-            // 0.1ʸ ġ ȭ (10 FPS)
-            static float syncTimer = 0.0f;
-            syncTimer += deltaTime;
-            if (syncTimer >= 0.1f)
-            {
-                SyncEnemyPositions();
-                syncTimer = 0.0f;
-            }
+        //  Ʈ ()
+        UpdateSpawners(deltaTime);
 
-            std::this_thread::sleep_for(std::chrono::milliseconds(33)); // ~30 FPS
+        // 0.1ʸ ġ ȭ (10 FPS)
+        mSyncTimer += deltaTime;
+        if (mSyncTimer >= 0.1f)
+        {
+            SyncEnemyPositions();
+            mSyncTimer = 0.0f;
         }
     }
 
@@ -210,7 +232,7 @@ public:
 
                     SendToAllUser(spawnPacket.PacketLength, (char*)&spawnPacket, -1, false);
 
-                    printf("[Room %d] Enemy respawned: ID=%lld, Type=%d\n",
+                    ALOG_DEBUG("[Room %d] Enemy respawned: ID=%lld, Type=%d\n",
                         mRoomNum, enemyID, (int)newEnemy->GetEnemyType());
                 }
             }
@@ -232,7 +254,9 @@ public:
             packet.rotation = enemy->GetRotation();
             packet.velocity = Vector3{ 0, 0, 0 };
 
-            SendToAllUser(packet.PacketLength, (char*)&packet, -1, false);
+            //и ǿ    ġ  ġ ٲ㼭 .
+            SendToAllUser(packet.PacketLength, (char*)&packet, -1, false,
+                SEND_CLASS::REPLACEABLE, MakeReplaceKey((UINT16)PACKET_ID::ENEMY_PATROL_UPDATE, packet.enemyID));
         }
     }
 
@@ -290,7 +314,7 @@ public:
             damagePacket.remainingHealth = hitEnemy->GetCurrentHealth();
             SendToAllUser(damagePacket.PacketLength, (char*)&damagePacket, -1, false);
 
-            printf("[Room %d] Enemy %lld took %d damage from player %lld. HP: %d/%d\n",
+            ALOG_DEBUG("[Room %d] Enemy %lld took %d damage from player %lld. HP: %d/%d\n",
                 mRoomNum, hitEnemyID, damage, attackerID,
                 hitEnemy->GetCurrentHealth(), hitEnemy->GetMaxHealth());
 
@@ -302,7 +326,7 @@ public:
                 deathPacket.killerID = attackerID;
                 SendToAllUser(deathPacket.PacketLength, (char*)&deathPacket, -1, false);
 
-                printf("[Room %d] Enemy %lld killed by player %lld\n", mRoomNum, hitEnemyID, attackerID);
+                ALOG_DEBUG("[Room %d] Enemy %lld killed by player %lld\n", mRoomNum, hitEnemyID, attackerID);
 
                 // ʿ  ˸
                 NotifySpawnerEnemyDeath(hitEnemy);
@@ -310,7 +334,7 @@ public:
         }
         else
         {
-            printf("[Room %d] Player %lld attack missed!\n", mRoomNum, attackerID);
+            ALOG_DEBUG("[Room %d] Player %lld attack missed!\n", mRoomNum, attackerID);
         }
     }
 
@@ -361,31 +385,31 @@ public:
             fabs(localZ) <= halfD);
     }
 
-	UINT16 EnterUser(User* user_)
+	UINT16 EnterUser(const INT32 userIndex_, const stRoomEnterInfo& info_)
 	{
 		if (mCurrentUserCount >= mMaxUserCount)
 		{
 			return (UINT16)ERROR_CODE::ENTER_ROOM_FULL_USER;
 		}
 
-		mUserList.push_back(user_);
+		mUserList.emplace_back();
+		auto pEnterUser = &mUserList.back();
+		pEnterUser->Init(userIndex_, mRoomNum, info_);
 		++mCurrentUserCount;
 
-		user_->EnterRoom(mRoomNum);
-
 		// ϴ , Zone    ŭ  ۽
-		for (auto pRoomUser : mUserList)
+		for (auto& roomUser : mUserList)
 		{
-			if (pRoomUser == nullptr || pRoomUser == user_) {
+			if (&roomUser == pEnterUser) {
 				continue;
 			}
 
 			ROOM_USER_INFO_NTF_PACKET roomUserInfoNtf;
-			roomUserInfoNtf.userUUID = pRoomUser->GetNetConnIdx();
-			CopyUserID(roomUserInfoNtf.userID, *pRoomUser);
-			roomUserInfoNtf.position = pRoomUser->GetPosition();
-			roomUserInfoNtf.rotation = pRoomUser->GetRotation();
-			SendPacketFunc(user_->GetNetConnIdx(), roomUserInfoNtf.PacketLength, (char*)&roomUserInfoNtf);
+			roomUserInfoNtf.userUUID = roomUser.GetNetConnIdx();
+			CopyUserID(roomUserInfoNtf.userID, roomUser);
+			roomUserInfoNtf.position = roomUser.GetPosition();
+			roomUserInfoNtf.rotation = roomUser.GetRotation();
+			SendPacketFunc(pEnterUser->GetSessionId(), roomUserInfoNtf.PacketLength, (char*)&roomUserInfoNtf);
 		}
 
 		// ϴ , Zone  Npc  ŭ  ۽
@@ -400,7 +424,7 @@ public:
 			CopyUserID(roomUserInfoNtf.userID, *pRoomNpc);
 			roomUserInfoNtf.position = pRoomNpc->GetPosition();
 			roomUserInfoNtf.rotation = pRoomNpc->GetRotation();
-			SendPacketFunc(user_->GetNetConnIdx(), roomUserInfoNtf.PacketLength, (char*)&roomUserInfoNtf);
+			SendPacketFunc(pEnterUser->GetSessionId(), roomUserInfoNtf.PacketLength, (char*)&roomUserInfoNtf);
 		}
 
         int sent = 0;
@@ -417,10 +441,10 @@ public:
             spawnPacket.maxHealth = enemy->GetMaxHealth();
             spawnPacket.currentHealth = enemy->GetCurrentHealth();
 
-            SendPacketFunc(user_->GetNetConnIdx(), spawnPacket.PacketLength, (char*)&spawnPacket);
+            SendPacketFunc(pEnterUser->GetSessionId(), spawnPacket.PacketLength, (char*)&spawnPacket);
             sent++;
         }
-        printf("[Room %d] Sent initial enemies to user(%d): %d\n", mRoomNum, user_->GetNetConnIdx(), sent);
+        ALOG_DEBUG("[Room %d] Sent initial enemies to user(%d): %d\n", mRoomNum, pEnterUser->GetNetConnIdx(), sent);
 
 		return (UINT16)ERROR_CODE::NONE;
 	}
@@ -447,25 +471,35 @@ public:
 	}
 
 		
-	void LeaveUser(User* leaveUser_)
+	//ȯ : 濡   false
+	bool LeaveUser(const INT32 userIndex_, stRoomLeftInfo* pLeftInfo_)
 	{
-		mUserList.remove_if([leaveUserId = leaveUser_->GetUserId()](User* pUser) {
-			return leaveUserId == pUser->GetUserId();
+		auto iter = std::find_if(mUserList.begin(), mUserList.end(), [userIndex_](RoomUser& roomUser) {
+			return roomUser.GetNetConnIdx() == userIndex_;
 		});
+		if (iter == mUserList.end())
+		{
+			return false;
+		}
+
+		ROOM_LEAVE_USER_NTF_PACKET notifyPkt;
+		notifyPkt.userUUID = userIndex_;
+		CopyUserID(notifyPkt.userID, *iter);
+		pLeftInfo_->Position = iter->GetPosition();
+		pLeftInfo_->Rotation = iter->GetRotation();
 
+		mUserList.erase(iter);
 		--mCurrentUserCount;
 
-		ROOM_LEAVE_USER_NTF_PACKET notifyPkt;
-		notifyPkt.userUUID = leaveUser_->GetNetConnIdx();
-		CopyUserID(notifyPkt.userID, *leaveUser_);
 		bool EXCEPT_ME = true; // ϴ   
 		SendToAllUser(notifyPkt.PacketLength, (char*)&notifyPkt, notifyPkt.userUUID, EXCEPT_ME);
+		return true;
 	}
 						
 	void NotifyChat(INT32 clientIndex_, const char* userID_, const char* msg_)
 	{
 		ROOM_CHAT_NOTIFY_PACKET roomChatNtfyPkt;
-		CopyMemory(roomChatNtfyPkt.Msg, msg_, sizeof(roomChatNtfyPkt.Msg));
+		StringCbCopyA(roomChatNtfyPkt.Msg, sizeof(roomChatNtfyPkt.Msg), msg_);
 		CopyUserID(roomChatNtfyPkt.userID, userID_);
 		SendToAllUser(sizeof(roomChatNtfyPkt), (char*)&roomChatNtfyPkt, clientIndex_, false);
 	}
@@ -481,14 +515,27 @@ public:
     }
 
 		
+	//   ID .
 	std::function<void(UINT32, UINT32, char*)> SendPacketFunc;
+	std::function<void(UINT32, stBroadcastBuffer*)> SendBroadcastFunc;
+
+	void SendToUser(const INT64 userIndex_, const UINT32 dataSize_, char* data_)
+	{
+		auto pRoomUser = FindUserByConnIdx(userIndex_);
+		if (pRoomUser == nullptr)
+		{
+			return;
+		}
+
+		SendPacketFunc(pRoomUser->GetSessionId(), dataSize_, data_);
+	}
 
     void ProcessHitReport(INT64 attackerID, INT64 enemyID, INT32 damage)
     {
         auto it = mEnemies.find(enemyID);
         if (it == mEnemies.end() || it->second == nullptr)
         {
-            printf("[Room %d] HitReport enemy not found. enemy=%lld\n", mRoomNum, enemyID);
+            ALOG_WARN("[Room %d] HitReport enemy not found. enemy=%lld\n", mRoomNum, enemyID);
             return;
         }
 
@@ -506,7 +553,7 @@ public:
         damagePacket.remainingHealth = enemy->GetCurrentHealth();
         SendToAllUser(damagePacket.PacketLength, (char*)&damagePacket, -1, false);
 
-        printf("[Room %d] Sent 424 damage. enemy=%lld hp=%d\n", mRoomNum, enemyID, enemy->GetCurrentHealth());
+        ALOG_DEBUG("[Room %d] Sent 424 damage. enemy=%lld hp=%d\n", mRoomNum, enemyID, enemy->GetCurrentHealth());
 
         if (isDead)
         {
@@ -522,19 +569,35 @@ public:
         }
     }
 
-	void SendToAllUser(const UINT16 dataSize_, char* data_, const INT32 passUserIndex_, bool exceptMe)
+	//Ŷ ѹ ϰ   ۽ ť  ۸ Ѵ.
+	//sendClass_ : ۽ ť з  ų(DROPPABLE)  replaceKey_  Ŷ ٲ㵵(REPLACEABLE) Ǵ Ŷ
+	void SendToAllUser(const UINT16 dataSize_, char* data_, const INT32 passUserIndex_, bool exceptMe,
+		const SEND_CLASS sendClass_ = SEND_CLASS::RELIABLE, const UINT64 replaceKey_ = 0)
 	{
-		for (auto pUser : mUserList)
+		if (mUserList.empty())
 		{
-			if (pUser == nullptr) {
-				continue;
-			}
+			return;
+		}
+
+		//ο  ۸ Ƿ ൵ ѹ Ѵ.
+		char compressedPacket[PACKET_COMPRESS_BUFFER_SIZE];
+		auto compressedSize = PacketCompressor::Instance().Compress(data_, dataSize_, compressedPacket);
+		auto pBuffer = (compressedSize > 0) ?
+			stBroadcastBuffer::Create(compressedSize, compressedPacket, sendClass_, replaceKey_) :
+			stBroadcastBuffer::Create(dataSize_, data_, sendClass_, replaceKey_);
+		SendToAllUser(pBuffer, passUserIndex_, exceptMe);
+		pBuffer->Release();
+	}
 
-			if (exceptMe && pUser->GetNetConnIdx() == passUserIndex_) {
+	void SendToAllUser(stBroadcastBuffer* pBuffer_, const INT32 passUserIndex_, bool exceptMe)
+	{
+		for (auto& roomUser : mUserList)
+		{
+			if (exceptMe && roomUser.GetNetConnIdx() == passUserIndex_) {
 				continue;
 			}
 
-			SendPacketFunc((UINT32)pUser->GetNetConnIdx(), (UINT32)dataSize_, data_);
+			SendBroadcastFunc(roomUser.GetSessionId(), pBuffer_);
 		}
 	}
 
@@ -550,12 +613,12 @@ public:
         return count;
     }
 
-    User* FindUserByConnIdx(INT64 connIdx)
+    RoomUser* FindUserByConnIdx(INT64 connIdx)
     {
-        for (auto* u : mUserList)
+        for (auto& u : mUserList)
         {
-            if (u && u->GetNetConnIdx() == connIdx)
-                return u;
+            if (u.GetNetConnIdx() == connIdx)
+                return &u;
         }
         return nullptr;
     }
@@ -575,7 +638,7 @@ public:
         qp.current = 0;
         qp.required = (required == 0 ? 1 : required);
 
-        printf("[Room %d] Quest accepted. user=%lld quest=%d req=%d\n",
+        ALOG_DEBUG("[Room %d] Quest accepted. user=%lld quest=%d req=%d\n",
             mRoomNum, userConnIdx, questId, (int)qp.required);
     }
 
@@ -600,26 +663,25 @@ public:
         ntf.quest_id = qp.questId;
         ntf.current = qp.current;
         ntf.required = qp.required;
-        ntf.state = (UINT8)qp.state;
+        ntf.state = qp.state;
 
-        SendPacketFunc((UINT32)killerConnIdx, (UINT32)ntf.PacketLength, (char*)&ntf);
+        SendToUser(killerConnIdx, (UINT32)ntf.PacketLength, (char*)&ntf);
 
-        printf("[Room %d] Quest progress notify(505). user=%lld quest=%d %d/%d state=%d\n",
+        ALOG_DEBUG("[Room %d] Quest progress notify(505). user=%lld quest=%d %d/%d state=%d\n",
             mRoomNum, killerConnIdx, qp.questId, qp.current, qp.required, (int)qp.state);
     }
 
 private:
     INT64 GenerateEnemyID()
     {
-        static INT64 nextID = 1;
-        return (INT64)mRoomNum * 10000 + (nextID++);
+        return (INT64)mRoomNum * 10000 + (mNextEnemyID++);
     }
 
     NavMeshManager navMeshManager;
 
     INT32 mRoomNum = -1;
 
-    std::list<User*> mUserList;
+    std::list<RoomUser> mUserList;
     std::list<Npc*> mNpcList;
 
     //   (map )
@@ -631,9 +693,8 @@ private:
     INT32 mMaxUserCount = 0;
     UINT16 mCurrentUserCount = 0;
 
-    // Ʈ 
-    bool mIsRunning = false;
-    std::thread mUpdateThread;
+    float mSyncTimer = 0.0f;
+    INT64 mNextEnemyID = 1;
 
     struct QuestProgress
     {
@@ -654,10 +715,10 @@ void CopyUserID(char* userID, const Actor& user)
 
 void CopyUserID(char* userID, const std::string& userID_)
 {
-	CopyMemory(userID, userID_.c_str(), sizeof(userID));
+	StringCbCopyA(userID, (MAX_USER_ID_LEN + 1), userID_.c_str());
 }
 
 void CopyUserID(char* userID, const char* userID_)
 {
-	CopyMemory(userID, userID_, (MAX_USER_ID_LEN + 1));
+	StringCbCopyA(userID, (MAX_USER_ID_LEN + 1), userID_);
 }
\ No newline at end of file
@@ -1,19 +1,32 @@
 #pragma once
 #include "Room.h"
+#include "RoomShard.h"
 
+//  (ο ,  )  尡 ϰ   ó   RoomShard Ŀ ѱ.
+//Ʒ Լ  忡 ȣѴ.
 class RoomManager
 {
 public:
 	RoomManager() = default;
 	~RoomManager() = default;
 
-	void Init(const INT32 beginRoomNumber_, const INT32 maxRoomCount_, const INT32 maxRoomUserCount_)
+	// i Ŀ i % shardCount_ ô´. Ŀ j roomCpus_[j % ] Ѵ.   ʴ´.
+	void Init(const INT32 beginRoomNumber_, const INT32 maxRoomCount_, const INT32 maxRoomUserCount_, const UINT32 shardCount_, const std::vector<UINT32>& roomCpus_)
 	{
 		mBeginRoomNumber = beginRoomNumber_;
 		mMaxRoomCount = maxRoomCount_;
 		mEndRoomNumber = beginRoomNumber_ + maxRoomCount_;
 
 		mRoomList = std::vector<Room*>(maxRoomCount_);
+		mRoomUserCounts = std::vector<INT32>(maxRoomCount_, 0);
+
+		mShardList = std::vector<RoomShard*>(shardCount_);
+		for (UINT32 i = 0; i < shardCount_; i++)
+		{
+			mShardList[i] = new RoomShard();
+			mShardList[i]->ProcessTaskFunc = ProcessTaskFunc;
+			mShardList[i]->Init(i);
+		}
 
 		// temp
 		const std::string navMeshFileName("all_tiles_navmesh.bin");
@@ -22,13 +35,30 @@ public:
 		{
 			mRoomList[i] = new Room();
 			mRoomList[i]->SendPacketFunc = SendPacketFunc;
+			mRoomList[i]->SendBroadcastFunc = SendBroadcastFunc;
 			mRoomList[i]->Init((i+ beginRoomNumber_), maxRoomUserCount_, navMeshFileName);
+			GetShard(i)->AddRoom(mRoomList[i]);
+		}
+
+		for (auto pShard : mShardList)
+		{
+			pShard->Run(roomCpus_);
+		}
+	}
+
+	void End()
+	{
+		for (auto pShard : mShardList)
+		{
+			pShard->End();
 		}
 	}
 
 	UINT GetMaxRoomCount() { return mMaxRoomCount; }
 		
-	UINT16 EnterUser(INT32 roomNumber_, User* user_)
+	//  ó(  ۽,  ˸)  Ŀ SYS_ROOM_ENTER ޾Ƽ Ѵ.
+	//isSendResponse_ :  Ŀ     ROOM_ENTER_RESPONSE .
+	UINT16 EnterUser(INT32 roomNumber_, User* user_, const bool isSendResponse_)
 	{
 		auto pRoom = GetRoomByNumber(roomNumber_);
 		if (pRoom == nullptr)
@@ -36,8 +66,31 @@ public:
 			return (UINT16)ERROR_CODE::ROOM_INVALID_INDEX;
 		}
 
+		//̹ 濡   .
+		if (user_->GetDomainState() == User::DOMAIN_STATE::ROOM)
+		{
+			LeaveUser(user_->GetCurrentRoom(), user_);
+		}
+
+		auto index = (roomNumber_ - mBeginRoomNumber);
+		if (mRoomUserCounts[index] >= pRoom->GetMaxUserCount())
+		{
+			return (UINT16)ERROR_CODE::ENTER_ROOM_FULL_USER;
+		}
+
+		++mRoomUserCounts[index];
+		user_->EnterRoom(roomNumber_);
 
-		return pRoom->EnterUser(user_);
+		stRoomEnterInfo enterInfo;
+		auto userId = user_->GetUserId();
+		CopyMemory(enterInfo.UserID, userId.c_str(), (std::min)(userId.size(), (size_t)MAX_USER_ID_LEN));
+		enterInfo.SessionId = user_->GetSessionId();
+		enterInfo.Position = user_->GetPosition();
+		enterInfo.Rotation = user_->GetRotation();
+		enterInfo.IsSendResponse = isSendResponse_;
+		PostToRoom(roomNumber_, user_->GetNetConnIdx(), (UINT16)PACKET_ID::SYS_ROOM_ENTER, sizeof(enterInfo), (char*)&enterInfo);
+
+		return (UINT16)ERROR_CODE::NONE;
 	}
 		
 	INT16 LeaveUser(INT32 roomNumber_, User* user_)
@@ -47,12 +100,33 @@ public:
 		{
 			return (INT16)ERROR_CODE::ROOM_INVALID_INDEX;
 		}
+
+		// 濡    ̸ ο  ǵ帮 ʴ´.
+		if (user_->GetDomainState() != User::DOMAIN_STATE::ROOM || user_->GetCurrentRoom() != roomNumber_)
+		{
+			return (INT16)ERROR_CODE::LEAVE_ROOM_INVALID_ROOM_INDEX;
+		}
 			
+		--mRoomUserCounts[roomNumber_ - mBeginRoomNumber];
 		user_->SetDomainState(User::DOMAIN_STATE::LOGIN);
-		pRoom->LeaveUser(user_);
+		PostToRoom(roomNumber_, user_->GetNetConnIdx(), (UINT16)PACKET_ID::SYS_ROOM_LEAVE, 0, nullptr);
 		return (INT16)ERROR_CODE::NONE;
 	}
 
+	//  Ŀ ѱ.   ѱ  ѱ  óȴ.
+	//ȯ :  ̸ false
+	bool PostToRoom(INT32 roomNumber_, const UINT32 userIndex_, const UINT16 packetId_, const UINT16 dataSize_, const char* pData_)
+	{
+		auto pRoom = GetRoomByNumber(roomNumber_);
+		if (pRoom == nullptr)
+		{
+			return false;
+		}
+
+		GetShard(roomNumber_ - mBeginRoomNumber)->Post(pRoom, userIndex_, packetId_, dataSize_, pData_);
+		return true;
+	}
+
 	Room* GetRoomByNumber(INT32 number_) 
 	{ 
 		if (number_ < mBeginRoomNumber || number_ >= mEndRoomNumber)
@@ -64,22 +138,29 @@ public:
 		return mRoomList[index]; 
 	} 
 
-	void SendToAllUser(const UINT16 dataSize_, char* data_, const INT32 passUserIndex_, bool exceptMe)
+	//渶 SYS_ROOM_NOTICE ѱ   Ŀ ڱ   .
+	void SendToAllUser(const UINT16 dataSize_, char* data_, const INT32 passUserIndex_)
 	{
-		for (auto& room : mRoomList)
+		for (auto number = mBeginRoomNumber; number < mEndRoomNumber; ++number)
 		{
-			room->SendToAllUser(dataSize_, data_, passUserIndex_, exceptMe);
+			PostToRoom(number, (UINT32)passUserIndex_, (UINT16)PACKET_ID::SYS_ROOM_NOTICE, dataSize_, data_);
 		}
 	}
 
 
 		
-	std::function<void(UINT32, UINT16, char*)> SendPacketFunc;
+	std::function<void(UINT32, UINT16, char*)> SendPacketFunc;	//( ID, ũ, )
+	std::function<void(UINT32, stBroadcastBuffer*)> SendBroadcastFunc;
+	std::function<void(Room*, const stRoomTask&)> ProcessTaskFunc;	// Ŀ 忡 ȣȴ.
 		
 
 private:
+	RoomShard* GetShard(const INT32 roomIndex_) { return mShardList[roomIndex_ % mShardList.size()]; }
+
 	std::vector<Room*> mRoomList;
+	std::vector<INT32> mRoomUserCounts;	// 尡      ο.  Ŀ ο  ٲ.
+	std::vector<RoomShard*> mShardList;
 	INT32 mBeginRoomNumber = 0;
 	INT32 mEndRoomNumber = 0;
 	INT32 mMaxRoomCount = 0;
-};
+};
\ No newline at end of file
@@ -0,0 +1,179 @@
+#pragma once
+
+#include "Room.h"
+#include "ServerNetwork/MpscQueue.h"
+#include "ServerNetwork/ThreadWakeup.h"
+#include "ServerNetwork/ThreadAffinity.h"
+#include "ServerNetwork/ThreadStat.h"
+
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
+
+const UINT32 ROOM_TASK_QUEUE_SIZE = 16384;	//  ѱ  尡 Ŀ ٸ.
+const UINT32 ROOM_TASK_BATCH_SIZE = 256;	//  óϴ ִ .  ̿  Ʈ ð ȮѴ.
+const UINT32 ROOM_TICK_MS = 33;				// Ʈ ֱ (~30 FPS)
+
+// Ŀ ó  ϳ. Ŭ̾Ʈ Ŷ̰ų SYS_ROOM_... ޽.
+struct stRoomTask
+{
+	Room* pRoom = nullptr;
+	UINT32 UserIndex = 0;
+	UINT16 PacketId = 0;
+	UINT16 DataSize = 0;
+	char* pData = nullptr;	//Post()  . ó  Ŀ Ѵ.
+};
+
+//   þƼ   Ŷ Ʈ  ϳ óѴ.
+// ϳ ׻  Ŀ Ƿ  ´  ʴ´. Ŀ ƹ͵   ʴ´.
+class RoomShard
+{
+public:
+	~RoomShard()
+	{
+		End();
+	}
+
+	void Init(const UINT32 shardIndex_)
+	{
+		mShardIndex = shardIndex_;
+		mTaskQueue.Init(ROOM_TASK_QUEUE_SIZE);
+		mWakeup.Init();
+	}
+
+	//Run()  ȣѴ.
+	void AddRoom(Room* pRoom_)
+	{
+		mRoomList.push_back(pRoom_);
+	}
+
+	void Run(const std::vector<UINT32>& cpus_)
+	{
+		mIsRunning = true;
+		mWorkThread = std::thread([this, cpus_]() {
+			PinCurrentThread(cpus_, mShardIndex, "room");
+			WorkLoop();
+		});
+	}
+
+	void End()
+	{
+		if (mWorkThread.joinable() == false)
+		{
+			return;
+		}
+
+		mIsRunning = false;
+		mWakeup.Notify();
+		mWorkThread.join();
+
+		//ó   纻 Ѵ.
+		stRoomTask task;
+		while (mTaskQueue.TryPop(&task))
+		{
+			delete[] task.pData;
+		}
+
+		printf("[ Ŀ %u] rooms(%u) tasks(%llu) full(%llu)\n", mShardIndex, (UINT32)mRoomList.size(),
+			(unsigned long long)mTaskCount, (unsigned long long)mTaskQueue.GetFullCount());
+	}
+
+	//ٸ 忡 ȣѴ. pData_ ؼ ѱ.
+	void Post(Room* pRoom_, const UINT32 userIndex_, const UINT16 packetId_, const UINT16 dataSize_, const char* pData_)
+	{
+		stRoomTask task{ pRoom_, userIndex_, packetId_, dataSize_, nullptr };
+		if (dataSize_ > 0)
+		{
+			task.pData = new char[dataSize_];
+			CopyMemory(task.pData, pData_, dataSize_);
+		}
+
+		mTaskQueue.Push(task);
+		mWakeup.Notify();
+	}
+
+	std::function<void(Room*, const stRoomTask&)> ProcessTaskFunc;
+
+private:
+	void WorkLoop()
+	{
+		auto pStat = ThreadStatMonitor::Instance().Register("room", mShardIndex);
+		auto lastUpdate = std::chrono::steady_clock::now();
+		auto nextUpdate = lastUpdate + std::chrono::milliseconds(ROOM_TICK_MS);
+
+		while (mIsRunning)
+		{
+			auto dequeCount = ProcessTasks(pStat);
+
+			auto now = std::chrono::steady_clock::now();
+			if (now >= nextUpdate)
+			{
+				float deltaTime = std::chrono::duration<float>(now - lastUpdate).count();
+				lastUpdate = now;
+
+				//з  ʰ ݺ ٽ .
+				nextUpdate += std::chrono::milliseconds(ROOM_TICK_MS);
+				if (nextUpdate <= now)
+				{
+					nextUpdate = now + std::chrono::milliseconds(ROOM_TICK_MS);
+				}
+
+				for (auto pRoom : mRoomList)
+				{
+					pRoom->Update(deltaTime);
+					pStat->AddCompletion();
+				}
+			}
+
+			if (dequeCount > 0)
+			{
+				continue;
+			}
+
+			mWakeup.PrepareWait();
+			if (mTaskQueue.IsEmpty() == false || mIsRunning == false)
+			{
+				mWakeup.CancelWait();
+				continue;
+			}
+
+			// Ʈ ܴ. 1ms Ʒ ÷ ٻڰ  ʰ Ѵ.
+			auto waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(nextUpdate - std::chrono::steady_clock::now()).count() + 1;
+			auto idleBeginNs = pStat->BeginIdle();
+			mWakeup.Wait((waitMs > 0) ? (UINT32)waitMs : 1);
+			pStat->EndIdle(idleBeginNs);
+		}
+
+		ThreadStatMonitor::Instance().Unregister(pStat);
+	}
+
+	//ȯ : ť  
+	UINT32 ProcessTasks(stThreadStat* pStat_)
+	{
+		UINT32 dequeCount = 0;
+		stRoomTask task;
+		while (dequeCount < ROOM_TASK_BATCH_SIZE && mTaskQueue.TryPop(&task))
+		{
+			++dequeCount;
+			pStat_->AddCompletion();
+			ProcessTaskFunc(task.pRoom, task);
+			delete[] task.pData;
+		}
+
+		mTaskCount += dequeCount;
+		return dequeCount;
+	}
+
+	UINT32 mShardIndex = 0;
+	std::vector<Room*> mRoomList;
+
+	std::atomic<bool> mIsRunning{ false };
+	std::thread mWorkThread;
+
+	// 尡 ְ  Ŀ .
+	MpscQueue<stRoomTask> mTaskQueue;
+	ThreadWakeup mWakeup;
+
+	UINT64 mTaskCount = 0;
+};
\ No newline at end of file
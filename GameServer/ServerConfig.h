@@ -0,0 +1,310 @@
+#pragma once
+
+#include "ServerNetwork/Define.h"
+#include "ServerNetwork/ThreadAffinity.h"
+#include "ServerNetwork/AsyncLogger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <fstream>
+#include <thread>
+
+//  .  (--config=)  а  (--̸=) .
+//   ٿ "̸=" ϳ̰ # ϴ  ̴ּ.   ̸ ѱ(true).
+//
+//	port=11021
+//	max_client=3
+//	io_threads=0			I/O Ŀ  . 0̸ ھ 
+//	room_count=10
+//	room_user_count=4
+//	logic_threads=0			  ô  Ŀ  . 0̸ ھ (    ʴ´)
+//	io_cpus=0-3				带  CPU .   ʴ´.
+//	logic_cpus=4
+//	room_cpus=5-7
+//	cpu_layout=auto			ִ CPU  ھ   I/O, ,    ä.
+//	thread_stat_interval=5	   ֱ(). 0̸  ʴ´.
+//	accept_data
+//	io_uring
+//	heartbeat_ping=10
+//	heartbeat_timeout=30
+//	rate_limit=1			Ǻ Ŷ ӵ . 0̸ .
+//	udp_port=5025			̵/ġ Ŷ ְ UDP Ʈ. 0̸ UDP  ʰ  TCP .
+//	udp_reliable=1			Ŭ̾Ʈ ûϸ ŷڼ UDP  Ŷ ְ޴´.
+//	udp_drop=0				׽Ʈ UDP ս (%).  Ŷ  Ŷ  Ȯ .
+//	udp_delay=0				׽Ʈ UDP (ms).  Ŷ  Ŷ ̸ŭ ʰ óѴ.
+//	udp_jitter=0			׽Ʈ UDP  鸲(ms). 0 ~  ŭ  .  ٲ  ִ.
+//	compress_threshold=128	 ũ(Ʈ) ̻ Ŷ ؼ . 0̸  ʴ´.
+//	send_pool=1				۽  Ǯ . 0̸ ۽Ÿ new/delete Ѵ(Ǯ 񱳿).
+//	packet_latency=1		Ŷ ID ť , ó, ۽   . ֿܼ latency Ѵ.
+//	latency_interval=0		  latency_file ̴ ֱ(). 0̸  ʴ´.
+//	latency_file=packet_latency.log
+//	log_level=info			trace, debug, info, warn, error, off. ֿܼ log ܰ ٲ  ִ.
+//	log_file=				α׸ ְܼ Բ  Ͽ δ.  ֿܼ .
+struct ServerConfig
+{
+	UINT16 Port = 11021;
+	UINT32 MaxClient = 3;		// Ҽ ִ Ŭ̾Ʈ 
+	UINT32 IOThreadCount = 0;
+	UINT32 RoomCount = 10;
+	UINT32 RoomUserCount = 4;
+	UINT32 LogicThreadCount = 0;
+
+	std::vector<UINT32> IOCpus;
+	std::vector<UINT32> LogicCpus;
+	std::vector<UINT32> RoomCpus;
+	bool IsAutoCpuLayout = false;
+
+	UINT32 ThreadStatIntervalSec = 0;
+
+	bool IsAcceptData = false;
+	bool IsIoUring = false;
+	UINT32 HeartbeatPingSec = DEFAULT_HEARTBEAT_PING_INTERVAL_SEC;
+	UINT32 HeartbeatTimeoutSec = DEFAULT_HEARTBEAT_TIMEOUT_SEC;
+	bool IsRateLimit = true;
+	UINT16 UdpPort = 5025;
+	bool IsUdpReliable = true;
+	UINT32 UdpDropPercent = 0;
+	UINT32 UdpDelayMs = 0;
+	UINT32 UdpJitterMs = 0;
+	UINT32 CompressThreshold = 128;
+	bool IsSendPool = true;
+	bool IsPacketLatency = true;
+	UINT32 LatencyIntervalSec = 0;
+	std::string LatencyFile = "packet_latency.log";
+	LOG_LEVEL LogLevel = LOG_LEVEL::INFO;
+	std::string LogFile;
+
+	//ȯ : ߸   false
+	bool Load(int argc, char* argv[])
+	{
+		// ڰ       д´.
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			if (arg.rfind("--config=", 0) == 0 && LoadFile(arg.substr(arg.find('=') + 1)) == false)
+			{
+				return false;
+			}
+		}
+
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string arg = argv[i];
+			if (arg.rfind("--", 0) != 0)
+			{
+				printf("[]     : %s\n", argv[i]);
+				return false;
+			}
+
+			auto pos = arg.find('=');
+			auto name = arg.substr(2, (pos == std::string::npos) ? std::string::npos : pos - 2);
+			auto value = (pos == std::string::npos) ? std::string() : arg.substr(pos + 1);
+
+			if (name != "config" && Set(name, value) == false)
+			{
+				return false;
+			}
+		}
+
+		ResolveThreadLayout();
+		return true;
+	}
+
+	void Print()
+	{
+		printf("[] port(%u) max_client(%u) io_threads(%u) rooms(%u x %u) logic_threads(%u) thread_stat_interval(%u)\n",
+			Port, MaxClient, IOThreadCount, RoomCount, RoomUserCount, LogicThreadCount, ThreadStatIntervalSec);
+		printf("[] cpu : io(%s) logic(%s) room(%s)\n",
+			CpuListToString(IOCpus).c_str(), CpuListToString(LogicCpus).c_str(), CpuListToString(RoomCpus).c_str());
+		printf("[] udp_port(%u) udp_reliable(%d) udp_drop(%u%%) udp_delay(%ums) udp_jitter(%ums)\n",
+			UdpPort, IsUdpReliable, UdpDropPercent, UdpDelayMs, UdpJitterMs);
+		printf("[] compress_threshold(%u) send_pool(%d)\n", CompressThreshold, IsSendPool);
+		printf("[] packet_latency(%d) latency_interval(%u) latency_file(%s)\n", IsPacketLatency, LatencyIntervalSec, LatencyFile.c_str());
+		printf("[] log_level(%s) log_file(%s)\n", LOG_LEVEL_NAMES[(UINT8)LogLevel], LogFile.c_str());
+	}
+
+private:
+	bool LoadFile(const std::string& path_)
+	{
+		std::ifstream file(path_);
+		if (!file)
+		{
+			printf("[]      : %s\n", path_.c_str());
+			return false;
+		}
+
+		std::string line;
+		UINT32 lineNumber = 0;
+		while (std::getline(file, line))
+		{
+			++lineNumber;
+
+			line = Trim(line);
+			if (line.empty() || line[0] == '#')
+			{
+				continue;
+			}
+
+			auto pos = line.find('=');
+			auto name = Trim(line.substr(0, pos));
+			auto value = (pos == std::string::npos) ? std::string() : Trim(line.substr(pos + 1));
+
+			if (Set(name, value) == false)
+			{
+				printf("[]   %s:%u\n", path_.c_str(), lineNumber);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool Set(const std::string& name_, const std::string& value_)
+	{
+		bool isValid = false;
+		UINT32 number = 0;
+
+		if (name_ == "port") { isValid = ParseNumber(value_, 1, 65535, &number); Port = (UINT16)number; }
+		else if (name_ == "max_client") { isValid = ParseNumber(value_, 1, SESSION_INDEX_MASK + 1, &MaxClient); }
+		else if (name_ == "io_threads") { isValid = ParseNumber(value_, 0, 1024, &IOThreadCount); }
+		else if (name_ == "room_count") { isValid = ParseNumber(value_, 1, 100000, &RoomCount); }
+		else if (name_ == "room_user_count") { isValid = ParseNumber(value_, 1, 1024, &RoomUserCount); }
+		else if (name_ == "logic_threads") { isValid = ParseNumber(value_, 0, 1024, &LogicThreadCount); }
+		else if (name_ == "io_cpus") { isValid = ParseCpuList(value_, &IOCpus); }
+		else if (name_ == "logic_cpus") { isValid = ParseCpuList(value_, &LogicCpus); }
+		else if (name_ == "room_cpus") { isValid = ParseCpuList(value_, &RoomCpus); }
+		else if (name_ == "cpu_layout") { isValid = (value_ == "auto" || value_ == "none"); IsAutoCpuLayout = (value_ == "auto"); }
+		else if (name_ == "thread_stat_interval") { isValid = ParseNumber(value_, 0, 3600, &ThreadStatIntervalSec); }
+		else if (name_ == "accept_data") { isValid = ParseBool(value_, &IsAcceptData); }
+		else if (name_ == "io_uring") { isValid = ParseBool(value_, &IsIoUring); }
+		else if (name_ == "heartbeat_ping") { isValid = ParseNumber(value_, 0, 3600, &HeartbeatPingSec); }
+		else if (name_ == "heartbeat_timeout") { isValid = ParseNumber(value_, 0, 3600, &HeartbeatTimeoutSec); }
+		else if (name_ == "rate_limit") { isValid = ParseBool(value_, &IsRateLimit); }
+		else if (name_ == "udp_port") { isValid = ParseNumber(value_, 0, 65535, &number); UdpPort = (UINT16)number; }
+		else if (name_ == "udp_reliable") { isValid = ParseBool(value_, &IsUdpReliable); }
+		else if (name_ == "udp_drop") { isValid = ParseNumber(value_, 0, 100, &UdpDropPercent); }
+		else if (name_ == "udp_delay") { isValid = ParseNumber(value_, 0, 10000, &UdpDelayMs); }
+		else if (name_ == "udp_jitter") { isValid = ParseNumber(value_, 0, 10000, &UdpJitterMs); }
+		else if (name_ == "compress_threshold") { isValid = ParseNumber(value_, 0, 65535, &CompressThreshold); }
+		else if (name_ == "send_pool") { isValid = ParseBool(value_, &IsSendPool); }
+		else if (name_ == "packet_latency") { isValid = ParseBool(value_, &IsPacketLatency); }
+		else if (name_ == "latency_interval") { isValid = ParseNumber(value_, 0, 3600, &LatencyIntervalSec); }
+		else if (name_ == "latency_file") { isValid = (value_.empty() == false); LatencyFile = value_; }
+		else if (name_ == "log_level") { isValid = AsyncLogger::ParseLevel(value_, &LogLevel); }
+		else if (name_ == "log_file") { isValid = true; LogFile = value_; }
+		else
+		{
+			printf("[]     : %s\n", name_.c_str());
+			return false;
+		}
+
+		if (isValid == false)
+		{
+			printf("[] ߸   : %s=%s\n", name_.c_str(), value_.c_str());
+		}
+		return isValid;
+	}
+
+	//io_threads, logic_threads 0 ̸ ھ ŭ . cpu_layout=auto ̸ ִ ϸ ä.
+	//I/O Ŀ  ھ ϳ ,  尡   ھ,  Ŀ  ھ  ´.  ھ   Ŀ  ʴ´.
+	void ResolveThreadLayout()
+	{
+		UINT32 coreCount = std::thread::hardware_concurrency();
+		if (coreCount == 0)
+		{
+			coreCount = 1;
+		}
+
+		if (IOThreadCount == 0)
+		{
+			IOThreadCount = coreCount;
+		}
+
+		if (LogicThreadCount == 0)
+		{
+			LogicThreadCount = coreCount;
+		}
+
+		//溸  Ŀ   .
+		if (LogicThreadCount > RoomCount)
+		{
+			LogicThreadCount = RoomCount;
+		}
+
+		if (IsAutoCpuLayout == false)
+		{
+			return;
+		}
+
+		if (IOCpus.empty())
+		{
+			for (UINT32 i = 0; i < IOThreadCount; ++i)
+			{
+				IOCpus.push_back(i % coreCount);
+			}
+		}
+
+		if (LogicCpus.empty())
+		{
+			LogicCpus.push_back(IOThreadCount % coreCount);
+		}
+
+		if (RoomCpus.empty())
+		{
+			for (UINT32 cpu = IOThreadCount + 1; cpu < coreCount; ++cpu)
+			{
+				RoomCpus.push_back(cpu);
+			}
+		}
+	}
+
+	static std::string Trim(const std::string& text_)
+	{
+		auto begin = text_.find_first_not_of(" \t\r\n");
+		if (begin == std::string::npos)
+		{
+			return std::string();
+		}
+
+		auto end = text_.find_last_not_of(" \t\r\n");
+		return text_.substr(begin, end - begin + 1);
+	}
+
+	static bool ParseNumber(const std::string& value_, const UINT32 min_, const UINT32 max_, UINT32* pValue_)
+	{
+		if (value_.empty() || value_[0] < '0' || value_[0] > '9')
+		{
+			return false;
+		}
+
+		char* pEnd = nullptr;
+		auto number = strtoul(value_.c_str(), &pEnd, 10);
+		if (*pEnd != '\0' || number < min_ || number > max_)
+		{
+			return false;
+		}
+
+		*pValue_ = (UINT32)number;
+		return true;
+	}
+
+	//  ѱ.
+	static bool ParseBool(const std::string& value_, bool* pValue_)
+	{
+		if (value_.empty() || value_ == "1" || value_ == "true" || value_ == "yes")
+		{
+			*pValue_ = true;
+			return true;
+		}
+
+		if (value_ == "0" || value_ == "false" || value_ == "no")
+		{
+			*pValue_ = false;
+			return true;
+		}
+
+		return false;
+	}
+};
\ No newline at end of file
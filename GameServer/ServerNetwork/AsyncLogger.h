@@ -0,0 +1,506 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+enum class LOG_LEVEL : UINT8
+{
+	TRACE = 0,	//Ŷ ϳϳ(, ۽ Ϸ, ̵)
+	DEBUG,		// ̺Ʈ(, ǰ, Ʈ)
+	INFO,		//, α,  
+	WARN,
+	ERR,
+	OFF,
+};
+
+const char* const LOG_LEVEL_NAMES[] = { "trace", "debug", "info", "warn", "error", "off" };
+
+//   ܰ α״ ϵ ʴ´. ) /D ASYNC_LOG_MIN_LEVEL=2 ̸ trace, debug .
+#ifndef ASYNC_LOG_MIN_LEVEL
+#define ASYNC_LOG_MIN_LEVEL 0
+#endif
+
+//printf   .  ڿ ڿ  Ѵ(͸ ϰ  忡  ).
+//ܰ谡   ڸ  ʴ´.
+//ASYNC_LOG_MIN_LEVEL 0̸   񱳰 Ǿ -Wtype-limits  Ƿ 񱳸  ʴ´.
+#if ASYNC_LOG_MIN_LEVEL > 0
+#define ASYNC_LOG(level_, ...) \
+	do { \
+		if ((int)(level_) >= ASYNC_LOG_MIN_LEVEL && AsyncLogger::IsEnabled(level_)) \
+		{ \
+			AsyncLogger::Instance().Write(level_, __VA_ARGS__); \
+		} \
+	} while (0)
+#else
+#define ASYNC_LOG(level_, ...) \
+	do { \
+		if (AsyncLogger::IsEnabled(level_)) \
+		{ \
+			AsyncLogger::Instance().Write(level_, __VA_ARGS__); \
+		} \
+	} while (0)
+#endif
+
+#define ALOG_TRACE(...) ASYNC_LOG(LOG_LEVEL::TRACE, __VA_ARGS__)
+#define ALOG_DEBUG(...) ASYNC_LOG(LOG_LEVEL::DEBUG, __VA_ARGS__)
+#define ALOG_INFO(...) ASYNC_LOG(LOG_LEVEL::INFO, __VA_ARGS__)
+#define ALOG_WARN(...) ASYNC_LOG(LOG_LEVEL::WARN, __VA_ARGS__)
+#define ALOG_ERROR(...) ASYNC_LOG(LOG_LEVEL::ERR, __VA_ARGS__)
+
+const UINT32 LOG_ARGS_SIZE = 224;
+const UINT32 LOG_TEXT_SIZE = 64;			//ڿ ڴ  ̱ Ѵ.
+const UINT32 LOG_RING_CAPACITY = 4096;		// ϳ    . 2 ŵ
+const UINT32 MAX_LOG_RING_COUNT = 256;		//α׸   
+const UINT32 MAX_LOG_LINE_LENGTH = 1024;
+
+//ڿ ڴ ȣ    Ƿ   д.
+struct stLogText
+{
+	char Text[LOG_TEXT_SIZE];
+};
+
+template<typename T>
+struct LogArg
+{
+	static_assert(std::is_trivially_copyable<T>::value, "α ڴ 縸 ű  ־ Ѵ. std::string c_str() ѱ.");
+
+	using Type = T;
+	static Type Pack(const T value_) { return value_; }
+};
+
+template<>
+struct LogArg<const char*>
+{
+	using Type = stLogText;
+
+	static Type Pack(const char* pText_)
+	{
+		Type text;
+		snprintf(text.Text, sizeof(text.Text), "%s", (pText_ != nullptr) ? pText_ : "(null)");
+		return text;
+	}
+};
+
+template<>
+struct LogArg<char*> : LogArg<const char*> {};
+
+//    ڸ printf ѱ  ǵ.
+template<typename T>
+inline T UnpackLogArg(const T& value_) { return value_; }
+
+inline const char* UnpackLogArg(const stLogText& text_) { return text_.Text; }
+
+// ߱  α  . ڴ ArgData std::tuple ְ FormatFunc  ¸ ȴ.
+struct stLogRecord
+{
+	UINT64 TimeUs = 0;
+	int (*FormatFunc)(const char* pFormat_, const char* pArgs_, char* pBuffer_, size_t size_) = nullptr;
+	const char* pFormat = nullptr;
+	LOG_LEVEL Level = LOG_LEVEL::INFO;
+	alignas(8) char ArgData[LOG_ARGS_SIZE];
+};
+
+// ϳ    ϳ д  
+struct stLogRing
+{
+	stLogRing() : Records(new stLogRecord[LOG_RING_CAPACITY]) {}
+
+	//ȯ : ä ڸ.  á nullptr
+	stLogRecord* BeginPush()
+	{
+		auto tail = Tail.load(std::memory_order_relaxed);
+		if (tail - Head.load(std::memory_order_acquire) >= LOG_RING_CAPACITY)
+		{
+			return nullptr;
+		}
+		return &Records[tail & (LOG_RING_CAPACITY - 1)];
+	}
+
+	void EndPush()
+	{
+		Tail.store(Tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	std::unique_ptr<stLogRecord[]> Records;
+	alignas(64) std::atomic<UINT64> Tail{ 0 };	// 常 ٲ۴.
+	alignas(64) std::atomic<UINT64> Head{ 0 };	// 常 ٲ۴.
+	std::atomic<UINT64> DropCount{ 0 };
+	std::atomic<bool> IsOwned{ false };		//尡  false ǰ   尡 ٽ .
+	UINT32 Index = 0;
+};
+
+//I/O, ,   α׸ 庰  ۿ ° ־ ΰ,  尡 Ƽ   ְܼ Ͽ .
+//α׸   ܼ  ٸ ʴ´. Start()  Stop() Ŀ  ڸ ٷ .
+//    尡    ð   ٸ  ִ. ٸ ð δ.
+class AsyncLogger
+{
+public:
+	//α׷    尡 α׸   Ƿ Ϻη ı ʴ´.
+	static AsyncLogger& Instance()
+	{
+		static AsyncLogger* pInstance = new AsyncLogger;
+		return *pInstance;
+	}
+
+	static bool IsEnabled(const LOG_LEVEL level_)
+	{
+		return (UINT8)level_ >= sLevel.load(std::memory_order_relaxed);
+	}
+
+	static void SetLevel(const LOG_LEVEL level_)
+	{
+		sLevel.store((UINT8)level_, std::memory_order_relaxed);
+	}
+
+	static LOG_LEVEL GetLevel()
+	{
+		return (LOG_LEVEL)sLevel.load(std::memory_order_relaxed);
+	}
+
+	//ȯ : 𸣴 ̸̸ false
+	static bool ParseLevel(const std::string& name_, LOG_LEVEL* pLevel_)
+	{
+		for (UINT8 i = 0; i <= (UINT8)LOG_LEVEL::OFF; ++i)
+		{
+			if (name_ == LOG_LEVEL_NAMES[i])
+			{
+				*pLevel_ = (LOG_LEVEL)i;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	//filePath_  ֿܼ .
+	bool Start(const std::string& filePath_)
+	{
+		std::lock_guard<std::mutex> guard(mLock);
+		if (mIsRun)
+		{
+			return true;
+		}
+
+		if (filePath_.empty() == false && (fopen_s(&mpFile, filePath_.c_str(), "a") != 0 || mpFile == nullptr))
+		{
+			mpFile = nullptr;
+			printf("[] α     : %s\n", filePath_.c_str());
+			return false;
+		}
+
+		mIsRun = true;
+		mIsWriterRun.store(true, std::memory_order_release);
+		mWriterThread = std::thread([this]() { WriterThread(); });
+		return true;
+	}
+
+	// α׸   .
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			if (mIsRun == false)
+			{
+				return;
+			}
+			mIsRun = false;
+		}
+
+		mIsWriterRun.store(false, std::memory_order_release);
+		if (mWriterThread.joinable())
+		{
+			mWriterThread.join();
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+		if (mpFile != nullptr)
+		{
+			fclose(mpFile);
+			mpFile = nullptr;
+		}
+	}
+
+	template<typename... Args>
+	void Write(const LOG_LEVEL level_, const char* pFormat_, Args... args_)
+	{
+		using Packed = std::tuple<typename LogArg<Args>::Type...>;
+		static_assert(sizeof(Packed) <= LOG_ARGS_SIZE, "α ڰ ʹ ũ.");
+		static_assert(alignof(Packed) <= 8, "α   ʹ ũ.");
+		static_assert(std::is_trivially_destructible<Packed>::value, "α ڴ ı   Ѵ.");
+
+		auto pRing = GetThreadRing();
+		if (pRing == nullptr || mIsWriterRun.load(std::memory_order_acquire) == false)
+		{
+			WriteNow(level_, pFormat_, args_...);
+			return;
+		}
+
+		//   trace, debug ٸ ʰ  info ̻  ڸ ٷ .
+		auto pRecord = pRing->BeginPush();
+		if (pRecord == nullptr)
+		{
+			if (level_ >= LOG_LEVEL::INFO)
+			{
+				WriteNow(level_, pFormat_, args_...);
+			}
+			else
+			{
+				pRing->DropCount.fetch_add(1, std::memory_order_relaxed);
+			}
+			return;
+		}
+
+		pRecord->TimeUs = GetNowUs();
+		pRecord->FormatFunc = &FormatRecord<typename LogArg<Args>::Type...>;
+		pRecord->pFormat = pFormat_;
+		pRecord->Level = level_;
+		new (pRecord->ArgData) Packed(LogArg<Args>::Pack(args_)...);
+		pRing->EndPush();
+	}
+
+	UINT64 GetDropCount()
+	{
+		UINT64 dropCount = 0;
+		auto ringCount = mRingCount.load(std::memory_order_acquire);
+		for (UINT32 i = 0; i < ringCount; ++i)
+		{
+			dropCount += mRings[i]->DropCount.load(std::memory_order_relaxed);
+		}
+		return dropCount;
+	}
+
+private:
+	AsyncLogger() = default;
+
+	static UINT64 GetNowUs()
+	{
+		return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+	}
+
+	static int FormatText(char* pBuffer_, size_t size_, const char* pFormat_, ...)
+	{
+		va_list args;
+		va_start(args, pFormat_);
+		auto length = vsnprintf(pBuffer_, size_, pFormat_, args);
+		va_end(args);
+		return length;
+	}
+
+	template<typename... Packed>
+	static int FormatRecord(const char* pFormat_, const char* pArgs_, char* pBuffer_, size_t size_)
+	{
+		auto& args = *reinterpret_cast<const std::tuple<Packed...>*>(pArgs_);
+		return std::apply([&](const Packed&... values_) {
+			return FormatText(pBuffer_, size_, pFormat_, UnpackLogArg(values_)...);
+		}, args);
+	}
+
+	//尡 ó α׸    ϳ ް, 尡  ش.
+	struct stRingOwner
+	{
+		~stRingOwner()
+		{
+			if (pRing != nullptr)
+			{
+				pRing->IsOwned.store(false, std::memory_order_release);
+			}
+		}
+
+		stLogRing* pRing = nullptr;
+	};
+
+	stLogRing* GetThreadRing()
+	{
+		static thread_local stRingOwner owner;
+		if (owner.pRing == nullptr)
+		{
+			owner.pRing = AcquireRing();
+		}
+		return owner.pRing;
+	}
+
+	//ȯ :      nullptr.   ٷ .
+	stLogRing* AcquireRing()
+	{
+		std::lock_guard<std::mutex> guard(mRingLock);
+
+		auto ringCount = mRingCount.load(std::memory_order_relaxed);
+		for (UINT32 i = 0; i < ringCount; ++i)
+		{
+			bool isOwned = false;
+			if (mRings[i]->IsOwned.compare_exchange_strong(isOwned, true, std::memory_order_acq_rel))
+			{
+				return mRings[i];
+			}
+		}
+
+		if (ringCount >= MAX_LOG_RING_COUNT)
+		{
+			return nullptr;
+		}
+
+		auto pRing = new stLogRing;
+		pRing->Index = ringCount;
+		pRing->IsOwned.store(true, std::memory_order_relaxed);
+		mRings[ringCount] = pRing;
+		mRingCount.store(ringCount + 1, std::memory_order_release);
+		return pRing;
+	}
+
+	template<typename... Args>
+	void WriteNow(const LOG_LEVEL level_, const char* pFormat_, Args... args_)
+	{
+		char text[MAX_LOG_LINE_LENGTH];
+		FormatText(text, sizeof(text), pFormat_, args_...);
+
+		std::lock_guard<std::mutex> guard(mLock);
+		AppendLine(level_, GetNowUs(), MAX_LOG_RING_COUNT, text);
+		Flush();
+	}
+
+	void WriterThread()
+	{
+		UINT64 reportedDropCount = 0;
+
+		while (true)
+		{
+			//߶ ȣ  а        α׸ ġ ʴ´.
+			auto isRun = mIsWriterRun.load(std::memory_order_acquire);
+
+			UINT32 writeCount = 0;
+			{
+				std::lock_guard<std::mutex> guard(mLock);
+
+				auto ringCount = mRingCount.load(std::memory_order_acquire);
+				for (UINT32 i = 0; i < ringCount; ++i)
+				{
+					writeCount += DrainRing(mRings[i]);
+				}
+
+				auto dropCount = GetDropCount();
+				if (dropCount != reportedDropCount)
+				{
+					char text[128];
+					snprintf(text, sizeof(text), "[α]  ۰   %llu \n", (unsigned long long)(dropCount - reportedDropCount));
+					AppendLine(LOG_LEVEL::WARN, GetNowUs(), MAX_LOG_RING_COUNT, text);
+					reportedDropCount = dropCount;
+				}
+
+				if (writeCount > 0)
+				{
+					Flush();
+				}
+			}
+
+			if (isRun == false)
+			{
+				return;
+			}
+
+			if (writeCount == 0)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+		}
+	}
+
+	UINT32 DrainRing(stLogRing* pRing_)
+	{
+		auto head = pRing_->Head.load(std::memory_order_relaxed);
+		auto tail = pRing_->Tail.load(std::memory_order_acquire);
+
+		char text[MAX_LOG_LINE_LENGTH];
+		for (auto i = head; i != tail; ++i)
+		{
+			auto& record = pRing_->Records[i & (LOG_RING_CAPACITY - 1)];
+			record.FormatFunc(record.pFormat, record.ArgData, text, sizeof(text));
+			AppendLine(record.Level, record.TimeUs, pRing_->Index, text);
+		}
+
+		pRing_->Head.store(tail, std::memory_order_release);
+		return (UINT32)(tail - head);
+	}
+
+	//"::.и ܰ T "    д.  ٹٲ   δ.
+	void AppendLine(const LOG_LEVEL level_, const UINT64 timeUs_, const UINT32 ringIndex_, const char* pText_)
+	{
+		auto sec = (time_t)(timeUs_ / 1000000);
+		if (sec != mTimeTextSec)
+		{
+			tm localTime;
+#ifdef _WIN32
+			localtime_s(&localTime, &sec);
+#else
+			localtime_r(&sec, &localTime);
+#endif
+			strftime(mTimeText, sizeof(mTimeText), "%H:%M:%S", &localTime);
+			mTimeTextSec = sec;
+		}
+
+		char threadText[8] = "T--";
+		if (ringIndex_ < MAX_LOG_RING_COUNT)
+		{
+			snprintf(threadText, sizeof(threadText), "T%02u", ringIndex_);
+		}
+
+		auto textLength = strlen(pText_);
+		auto isNewLine = (textLength > 0 && pText_[textLength - 1] == '\n');
+
+		if (mLineLength + textLength + 64 > sizeof(mLineBuffer))
+		{
+			Flush();
+		}
+
+		mLineLength += snprintf(mLineBuffer + mLineLength, sizeof(mLineBuffer) - mLineLength, "%s.%03u %-5s %s %s%s",
+			mTimeText, (UINT32)(timeUs_ / 1000 % 1000), LOG_LEVEL_NAMES[(UINT8)level_], threadText, pText_, isNewLine ? "" : "\n");
+		if (mLineLength >= sizeof(mLineBuffer))
+		{
+			mLineLength = sizeof(mLineBuffer) - 1;
+		}
+	}
+
+	void Flush()
+	{
+		if (mLineLength == 0)
+		{
+			return;
+		}
+
+		fwrite(mLineBuffer, 1, mLineLength, stdout);
+		fflush(stdout);
+		if (mpFile != nullptr)
+		{
+			fwrite(mLineBuffer, 1, mLineLength, mpFile);
+			fflush(mpFile);
+		}
+		mLineLength = 0;
+	}
+
+	inline static std::atomic<UINT8> sLevel{ (UINT8)LOG_LEVEL::INFO };
+
+	std::mutex mRingLock;
+	stLogRing* mRings[MAX_LOG_RING_COUNT] = {};
+	std::atomic<UINT32> mRingCount{ 0 };
+
+	std::atomic<bool> mIsWriterRun{ false };
+
+	//Ʒ mLock Ų.
+	std::mutex mLock;
+	bool mIsRun = false;
+	FILE* mpFile = nullptr;
+	std::thread mWriterThread;
+	char mLineBuffer[64 * 1024];
+	size_t mLineLength = 0;
+	time_t mTimeTextSec = 0;
+	char mTimeText[16] = { 0, };
+};
\ No newline at end of file
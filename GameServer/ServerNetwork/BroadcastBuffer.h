@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Define.h"
+#include <atomic>
+#include <new>
+
+
+// ǿ  Ŷ    б  ۽ 
+//ѹ  ΰ   ۽ ť  ۸  Ѵ.   ۽ ϷǸ ȴ.
+class stBroadcastBuffer
+{
+public:
+	//  1( ) Ѵ. ǵ鿡    ʵ Release() ȣؾ Ѵ.
+	//sendClass_, replaceKey_ : ޴  ۽ ť з   Ŷ ٷ 
+	static stBroadcastBuffer* Create(const UINT32 dataSize_, const char* pData_,
+		const SEND_CLASS sendClass_ = SEND_CLASS::RELIABLE, const UINT64 replaceKey_ = 0)
+	{
+		auto pBlock = new char[sizeof(stBroadcastBuffer) + dataSize_];
+		auto pBuffer = new (pBlock) stBroadcastBuffer(dataSize_);
+		pBuffer->mSendClass = sendClass_;
+		pBuffer->mReplaceKey = replaceKey_;
+		CopyMemory(pBuffer->GetData(), pData_, dataSize_);
+		return pBuffer;
+	}
+
+	void AddRef()
+	{
+		mRefCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	void Release()
+	{
+		if (mRefCount.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		this->~stBroadcastBuffer();
+		delete[] (char*)this;
+	}
+
+	char* GetData() { return (char*)(this + 1); }
+
+	UINT32 GetDataSize() { return mDataSize; }
+
+	SEND_CLASS GetSendClass() { return mSendClass; }
+
+	UINT64 GetReplaceKey() { return mReplaceKey; }
+
+
+private:
+	explicit stBroadcastBuffer(const UINT32 dataSize_) : mDataSize(dataSize_) {}
+	~stBroadcastBuffer() = default;
+
+	std::atomic<INT32> mRefCount{ 1 };
+	UINT32 mDataSize = 0;
+	SEND_CLASS mSendClass = SEND_CLASS::RELIABLE;
+	UINT64 mReplaceKey = 0;
+};
\ No newline at end of file
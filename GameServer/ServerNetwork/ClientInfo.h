@@ -1,9 +1,15 @@
 #pragma once
 
 #include "Define.h"
+#include "SendBufferPool.h"
+#include "RecvRingBuffer.h"
+#include "SendBackpressure.h"
+#include "PacketLatency.h"
+#include "AsyncLogger.h"
 #include <stdio.h>
 #include <mutex>
-#include <queue>
+#include <deque>
+#include <atomic>
 
 
 //Ŭ̾Ʈ   ü
@@ -13,13 +19,18 @@ public:
 	stClientInfo()
 	{
 		ZeroMemory(&mRecvOverlappedEx, sizeof(stOverlappedEx));
+		ZeroMemory(&mSendOverlappedEx, sizeof(stOverlappedEx));
 		mSocket = INVALID_SOCKET;
 	}
 
-	void Init(const UINT32 index, HANDLE iocpHandle_)
+	void Init(const UINT32 index, HANDLE iocpHandle_, stIOStat* pIOStat_, stSendPoolStat* pSendPoolStat_, const bool isSendPoolEnabled_)
 	{
 		mIndex = index;
+		mSessionId = MakeSessionId(index, 0);
 		mIOCPHandle = iocpHandle_;
+		mpIOStat = pIOStat_;
+		mSendPool.Init(pSendPoolStat_, isSendPoolEnabled_);
+		mSendLimit.Init(pIOStat_);
 	}
 
 	UINT32 GetIndex() { return mIndex; }
@@ -28,18 +39,31 @@ public:
 	
 	SOCKET GetSock() { return mSocket; }
 
-	UINT64 GetLatestClosedTimeSec() { return mLatestClosedTimeSec; }
+	UINT32 GetSessionId() { return mSessionId.load(std::memory_order_acquire); }
 
-	char* RecvBuffer() { return mRecvBuf; }
+	RecvRingBuffer* GetRecvRing() { return &mRecvRing; }
 
 
-	bool OnConnect(HANDLE iocpHandle_, SOCKET socket_)
+	//pFirstData_ : Ӱ Բ  . ù WSARecv    ִ´.
+	bool OnConnect(HANDLE iocpHandle_, SOCKET socket_, const char* pFirstData_ = nullptr, const UINT32 firstDataSize_ = 0)
 	{
 		mSocket = socket_;
-		mIsConnect = 1;
 		
 		Clear();
 
+		//  ť Close()  .
+		mSendLimit.Reset();
+
+		if (firstDataSize_ > 0)
+		{
+			mRecvRing.Write(pFirstData_, firstDataSize_);
+		}
+
+		// ü  1 . Close() ´.
+		mIORefCount.store(1, std::memory_order_relaxed);
+		mSessionId.store(GetNextSessionId(mSessionId.load(std::memory_order_relaxed)), std::memory_order_release);
+		mIsConnect = 1;
+
 		//I/O Completion Portü  Ų.
 		if (BindIOCompletionPort(iocpHandle_) == false)
 		{
@@ -49,7 +73,8 @@ public:
 		return BindRecv();
 	}
 
-	void Close(bool bIsForce = false)
+	//ȯ : ɷִ I/O  ٷ  ൵ Ǹ true
+	bool Close(bool bIsForce = false)
 	{
 		struct linger stLinger = { 0, 0 };	// SO_DONTLINGER 
 
@@ -59,28 +84,50 @@ public:
 			stLinger.l_onoff = 1;
 		}
 
+		//SendIO() Disconnect() mSendLock ȿ  Ƿ  ݴ ͵ mSendLock ȿ Ѵ.
+		//  ڵ ٸ  AcceptEx  ٽ   ִ.
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		// Ŀ ÿ  ѹ ݴ´.
+		if (mIsConnect.exchange(0) != 1)
+		{
+			return false;
+		}
+
 		//socketClose  ۼ  ߴ Ų.
 		shutdown(mSocket, SD_BOTH);
 
 		// ɼ Ѵ.
 		setsockopt(mSocket, SOL_SOCKET, SO_LINGER, (char*)&stLinger, sizeof(stLinger));
 				
-		mIsConnect = 0;
-		mLatestClosedTimeSec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
 		//   Ų.
 		closesocket(mSocket);		
 		mSocket = INVALID_SOCKET;
+
+		//  ʹ . ɷִ WSASend closesocket ҵ  Ϸ 뺸  
+		//۸   Ƿ    mSendingCount SendCompleted() .
+		ReleaseWaitingSendData();
+
+		//۽ ߿    ʵ mSendLock ȿ ´.
+		return ReleaseIORef();
 	}
 
 	void Clear()
 	{		
+		mRecvRing.MarkSessionStart();
 	}
 
-	bool PostAccept(SOCKET listenSock_, const UINT64 curTimeSec_)
+	//I/O Ϸ ϳ ó  ȣѴ.
+	//ȯ :    I/O true. ̶    Ͽ ش.
+	bool ReleaseIORef()
 	{
-		printf_s("PostAccept. client Index: %d\n", GetIndex());
+		return mIORefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+	}
 
-		mLatestClosedTimeSec = UINT32_MAX;
+	//acceptDataSize_ : 0 ũ Ŭ̾Ʈ ù ͸   ٷȴٰ  Ϳ Բ  ϷѴ.
+	bool PostAccept(SOCKET listenSock_, const UINT32 acceptDataSize_)
+	{
+		ALOG_DEBUG("PostAccept. client Index: %d\n", GetIndex());
 
 		mSocket = WSASocket(AF_INET, SOCK_STREAM, IPPROTO_IP,
 			NULL, 0, WSA_FLAG_OVERLAPPED);
@@ -99,12 +146,17 @@ public:
 		mAcceptContext.m_eOperation = IOOperation::ACCEPT;
 		mAcceptContext.SessionIndex = mIndex;
 
-		if (FALSE == AcceptEx(listenSock_, mSocket, mAcceptBuf, 0,
+		mIsAccepting = true;
+
+		//  ڿ / ּҰ ٴ´.
+		if (FALSE == AcceptEx(listenSock_, mSocket, mAcceptBuf, acceptDataSize_,
 			sizeof(SOCKADDR_IN) + 16, sizeof(SOCKADDR_IN) + 16, &bytes, (LPWSAOVERLAPPED) & (mAcceptContext)))
 		{
 			if (WSAGetLastError() != WSA_IO_PENDING)
 			{
 				printf_s("AcceptEx Error : %d\n", GetLastError());
+				mIsAccepting = false;
+				CloseAcceptSocket();
 				return false;
 			}
 		}
@@ -112,11 +164,54 @@ public:
 		return true;
 	}
 
-	bool AcceptCompletion()
+	bool IsAccepting() { return mIsAccepting; }
+
+	// Ǿµ ù ͸ timeoutSec_ Ѱ  ʰ  true
+	//AcceptEx  Ƿ PostAccept() Ϸ ó(AcceptCompletion(), CloseAcceptSocket()) ġ ʰ  ش.
+	bool IsAcceptDataTimedOut(const UINT32 timeoutSec_)
+	{
+		if (mIsAccepting == false)
+		{
+			return false;
+		}
+
+		//    0xFFFFFFFF
+		DWORD connectTimeSec = 0;
+		int optLen = sizeof(connectTimeSec);
+		if (SOCKET_ERROR == getsockopt(mSocket, SOL_SOCKET, SO_CONNECT_TIME, (char*)&connectTimeSec, &optLen))
+		{
+			return false;
+		}
+
+		return connectTimeSec != 0xFFFFFFFF && connectTimeSec >= timeoutSec_;
+	}
+
+	//ɷִ AcceptEx Ѵ.  Ϸ 뺸  AcceptFailed()  ش.
+	void CancelAccept(SOCKET listenSock_)
+	{
+		CancelIoEx((HANDLE)listenSock_, (LPOVERLAPPED)&mAcceptContext);
+	}
+
+	//AcceptEx   ̸    ݴ´.
+	void CloseAcceptSocket()
+	{
+		mIsAccepting = false;
+
+		if (INVALID_SOCKET != mSocket)
+		{
+			closesocket(mSocket);
+			mSocket = INVALID_SOCKET;
+		}
+	}
+
+	//acceptDataSize_ : AcceptEx Ӱ Բ  Ʈ 
+	bool AcceptCompletion(const UINT32 acceptDataSize_)
 	{
-		printf_s("AcceptCompletion : SessionIndex(%d)\n", mIndex);
+		ALOG_DEBUG("AcceptCompletion : SessionIndex(%d)\n", mIndex);
 
-		if (OnConnect(mIOCPHandle, mSocket) == false)
+		mIsAccepting = false;
+
+		if (OnConnect(mIOCPHandle, mSocket, mAcceptBuf, acceptDataSize_) == false)
 		{
 			return false;
 		}
@@ -125,7 +220,7 @@ public:
 		int nAddrLen = sizeof(SOCKADDR_IN);
 		char clientIP[32] = { 0, };
 		inet_ntop(AF_INET, &(stClientAddr.sin_addr), clientIP, 32 - 1);
-		printf("Ŭ̾Ʈ  : IP(%s) SOCKET(%d)\n", clientIP, (int)mSocket);
+		ALOG_INFO("Ŭ̾Ʈ  : IP(%s) SOCKET(%d)\n", clientIP, (int)mSocket);
 		
 		return true;
 	}
@@ -151,14 +246,31 @@ public:
 		DWORD dwFlag = 0;
 		DWORD dwRecvNumBytes = 0;
 
+		//    ٷ ޴´.   ġ WSABUF 2  ޴´.
+		char* pSpans[2];
+		UINT32 spanSizes[2];
+		auto spanCount = mRecvRing.GetWriteSpans(pSpans, spanSizes);
+		if (spanCount == 0)
+		{
+			printf("[]   ۰   : Index(%d)\n", mIndex);
+			return false;
+		}
+
+		for (UINT32 i = 0; i < spanCount; ++i)
+		{
+			mRecvWsaBufs[i].buf = pSpans[i];
+			mRecvWsaBufs[i].len = spanSizes[i];
+		}
+
 		//Overlapped I/O     ش.
-		mRecvOverlappedEx.m_wsaBuf.len = MAX_SOCK_RECVBUF;
-		mRecvOverlappedEx.m_wsaBuf.buf = mRecvBuf;
+		mRecvOverlappedEx.m_wsaBuf = mRecvWsaBufs[0];
 		mRecvOverlappedEx.m_eOperation = IOOperation::RECV;
 
+		++mpIOStat->SyscallCount;
+		mIORefCount.fetch_add(1, std::memory_order_relaxed);
 		int nRet = WSARecv(mSocket,
-			&(mRecvOverlappedEx.m_wsaBuf),
-			1,
+			mRecvWsaBufs,
+			spanCount,
 			&dwRecvNumBytes,
 			&dwFlag,
 			(LPWSAOVERLAPPED) & (mRecvOverlappedEx),
@@ -168,44 +280,116 @@ public:
 		if (nRet == SOCKET_ERROR && (WSAGetLastError() != ERROR_IO_PENDING))
 		{
 			printf("[] WSARecv()Լ  : %d\n", WSAGetLastError());
+			//  ȣ Ϸ  Ƿ 0  ʴ´.
+			mIORefCount.fetch_sub(1, std::memory_order_relaxed);
 			return false;
 		}
 
 		return true;
 	}
 
+	// ŭ    ġ ű.
+	void RecvCompleted(const UINT32 dataSize_)
+	{
+		mRecvRing.CommitWrite(dataSize_);
+	}
+
 	// 1 忡 ȣؾ Ѵ!
-	bool SendMsg(const UINT32 dataSize_, char* pMsg_)
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pMsg_)
 	{	
-		auto sendOverlappedEx = new stOverlappedEx;
-		ZeroMemory(sendOverlappedEx, sizeof(stOverlappedEx));
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		//۽ ؽƮ  ۴  Ǯ ѹ ޴´.
+		char* pSendBuf = nullptr;
+		auto sendOverlappedEx = mSendPool.Alloc(dataSize_, &pSendBuf);
 		sendOverlappedEx->m_wsaBuf.len = dataSize_;
-		sendOverlappedEx->m_wsaBuf.buf = new char[dataSize_];
-		CopyMemory(sendOverlappedEx->m_wsaBuf.buf, pMsg_, dataSize_);
+		sendOverlappedEx->m_wsaBuf.buf = pSendBuf;
+		CopyMemory(pSendBuf, pMsg_, dataSize_);
 		sendOverlappedEx->m_eOperation = IOOperation::SEND;
-		
+
+		return EnqueueSendData(sendOverlappedEx);
+	}	
+
+	// ۴  ʰ  ť ִ´.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
 		std::lock_guard<std::mutex> guard(mSendLock);
 
-		mSendDataqueue.push(sendOverlappedEx);
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		auto sendOverlappedEx = mSendPool.AllocBroadcast(pBuffer_);
+		sendOverlappedEx->m_wsaBuf.len = pBuffer_->GetDataSize();
+		sendOverlappedEx->m_wsaBuf.buf = pBuffer_->GetData();
+		sendOverlappedEx->m_eOperation = IOOperation::SEND;
 
-		if (mSendDataqueue.size() == 1)
+		return EnqueueSendData(sendOverlappedEx);
+	}
+
+	//ٸ 忡  ´. ɷִ WSARecv/WSASend ϸ Ŀ  ϷḦ ޾Ƽ ó Close() ȣѴ.
+	bool Disconnect(const UINT32 sessionId_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsConnectd() == false || sessionId_ != mSessionId.load(std::memory_order_relaxed))
 		{
-			SendIO();
+			return false;
 		}
-		
+
+		//밡   shutdownδ ɷִ   ʴ´.
+		shutdown(mSocket, SD_BOTH);
+		CancelIoEx((HANDLE)mSocket, nullptr);
 		return true;
-	}	
+	}
 
 	void SendCompleted(const UINT32 dataSize_)
 	{		
-		printf("[۽ Ϸ] bytes : %d\n", dataSize_);
+		ALOG_TRACE("[۽ Ϸ] bytes : %d\n", dataSize_);
 
 		std::lock_guard<std::mutex> guard(mSendLock);
 
-		delete[] mSendDataqueue.front()->m_wsaBuf.buf;
-		delete mSendDataqueue.front();
+		//  Ϸ( Ϸ ) Close() ܵ  ͸ ⸸ Ѵ.
+		if (IsConnectd() == false)
+		{
+			for (; mSendingCount > 0 && mSendDataqueue.empty() == false; --mSendingCount)
+			{
+				ReleaseFrontSendData();
+			}
+
+			mSendingCount = 0;
+			mFrontSentSize = 0;
+			return;
+		}
+
+		// Ʈŭ տ Ϸ óѴ. Ϻθ  Ŷ  WSASend ̾ .
+		auto remainBytes = dataSize_;
+		while (remainBytes > 0 && mSendDataqueue.empty() == false)
+		{
+			auto frontRemainSize = mSendDataqueue.front()->m_wsaBuf.len - mFrontSentSize;
+			if (remainBytes < frontRemainSize)
+			{
+				mFrontSentSize += remainBytes;
+				break;
+			}
+
+			remainBytes -= frontRemainSize;
+			mFrontSentSize = 0;
 
-		mSendDataqueue.pop();
+			auto sendOverlappedEx = mSendDataqueue.front();
+			PacketLatencyMonitor::Instance().AddSend(sendOverlappedEx->m_wsaBuf.buf, sendOverlappedEx->m_wsaBuf.len, sendOverlappedEx->EnqueueNs);
+
+			++mpIOStat->SendCount;
+			ReleaseFrontSendData();
+		}
+
+		mSendingCount = 0;
 
 		if (mSendDataqueue.empty() == false)
 		{
@@ -215,29 +399,160 @@ public:
 
 
 private:
+	//mSendLock  ¿ ȣѴ. ų    ۽ .
+	bool IsSendable(const UINT32 sessionId_)
+	{
+		if (IsConnectd() == false)
+		{
+			return false;
+		}
+
+		if (sessionId_ != mSessionId.load(std::memory_order_relaxed))
+		{
+			++mpIOStat->StaleSendCount;
+			return false;
+		}
+
+		return true;
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	bool EnqueueSendData(stOverlappedEx* sendOverlappedEx_)
+	{
+		auto dataSize = sendOverlappedEx_->m_wsaBuf.len;
+		sendOverlappedEx_->EnqueueNs = PacketLatencyMonitor::Instance().Stamp();
+
+		if (sendOverlappedEx_->SendClass == SEND_CLASS::REPLACEABLE && ReplaceQueuedSendData(sendOverlappedEx_))
+		{
+			return true;
+		}
+
+		switch (mSendLimit.Admit(sendOverlappedEx_->SendClass, dataSize))
+		{
+		case SendBackpressure::RESULT::DROP:
+			mSendPool.Free(sendOverlappedEx_, dataSize);
+			return true;
+
+		//۽ ť Ǯ ʴ´. ޱ⸦  Ŀ ó  ϰ Ѵ.
+		case SendBackpressure::RESULT::CLOSE:
+			printf("[] ۽ ť Ǯ ʾƼ   : Index(%d)\n", mIndex);
+			mSendPool.Free(sendOverlappedEx_, dataSize);
+			shutdown(mSocket, SD_BOTH);
+			return false;
+
+		default:
+			break;
+		}
+
+		mSendDataqueue.push_back(sendOverlappedEx_);
+
+		//  Ͱ  ۽ Ϸ    Ƽ .
+		if (mSendingCount == 0)
+		{
+			SendIO();
+		}
+
+		return true;
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	// Ŷ MAX_SEND_GATHER_COUNT WSABUF 迭 Ƽ WSASend ѹ .
 	bool SendIO()
 	{
-		auto sendOverlappedEx = mSendDataqueue.front();
+		mSendingCount = 0;
+		for (auto sendOverlappedEx : mSendDataqueue)
+		{
+			if (mSendingCount == MAX_SEND_GATHER_COUNT)
+			{
+				break;
+			}
+
+			auto& wsaBuf = mSendWsaBufs[mSendingCount];
+			wsaBuf = sendOverlappedEx->m_wsaBuf;
+
+			//տ Ϻθ  Ŷ  κк .
+			if (mSendingCount == 0)
+			{
+				wsaBuf.buf += mFrontSentSize;
+				wsaBuf.len -= mFrontSentSize;
+			}
+
+			++mSendingCount;
+		}
+
+		ZeroMemory(&mSendOverlappedEx, sizeof(stOverlappedEx));
+		mSendOverlappedEx.m_eOperation = IOOperation::SEND;
+		mSendOverlappedEx.SessionIndex = mIndex;
+
+		++mpIOStat->SyscallCount;
+		++mpIOStat->SendCallCount;
+		mIORefCount.fetch_add(1, std::memory_order_relaxed);
 
 		DWORD dwRecvNumBytes = 0;
 		int nRet = WSASend(mSocket,
-			&(sendOverlappedEx->m_wsaBuf),
-			1,
+			mSendWsaBufs,
+			mSendingCount,
 			&dwRecvNumBytes,
 			0,
-			(LPWSAOVERLAPPED)sendOverlappedEx,
+			(LPWSAOVERLAPPED)&mSendOverlappedEx,
 			NULL);
 
 		//socket_error̸ client socket ɷ óѴ.
 		if (nRet == SOCKET_ERROR && (WSAGetLastError() != ERROR_IO_PENDING))
 		{
 			printf("[] WSASend()Լ  : %d\n", WSAGetLastError());
+			mIORefCount.fetch_sub(1, std::memory_order_relaxed);
+			mSendingCount = 0;
 			return false;
 		}
 
 		return true;
 	}
 
+	//mSendLock  ¿ ȣѴ. WSASend ѱ  mSendingCount ǵ帮 ʴ´.
+	//ȯ :  Ű Ŷ ãƼ ٲ true
+	bool ReplaceQueuedSendData(stOverlappedEx* sendOverlappedEx_)
+	{
+		for (size_t i = mSendingCount; i < mSendDataqueue.size(); ++i)
+		{
+			auto queuedOverlappedEx = mSendDataqueue[i];
+			if (queuedOverlappedEx->SendClass != SEND_CLASS::REPLACEABLE || queuedOverlappedEx->ReplaceKey != sendOverlappedEx_->ReplaceKey)
+			{
+				continue;
+			}
+
+			mSendLimit.OnReplaced(queuedOverlappedEx->m_wsaBuf.len, sendOverlappedEx_->m_wsaBuf.len);
+			mSendPool.Free(queuedOverlappedEx, queuedOverlappedEx->m_wsaBuf.len);
+			mSendDataqueue[i] = sendOverlappedEx_;
+			return true;
+		}
+
+		return false;
+	}
+
+	void ReleaseFrontSendData()
+	{
+		auto sendOverlappedEx = mSendDataqueue.front();
+		mSendLimit.OnRemoved(sendOverlappedEx->m_wsaBuf.len);
+		mSendPool.Free(sendOverlappedEx, sendOverlappedEx->m_wsaBuf.len);
+
+		mSendDataqueue.pop_front();
+	}
+
+	// ͸ . WSASend ѱ  mSendingCount .
+	void ReleaseWaitingSendData()
+	{
+		std::deque<stOverlappedEx*> remainQueue(mSendDataqueue.begin(), mSendDataqueue.begin() + mSendingCount);
+		mSendDataqueue.erase(mSendDataqueue.begin(), mSendDataqueue.begin() + mSendingCount);
+
+		while (mSendDataqueue.empty() == false)
+		{
+			ReleaseFrontSendData();
+		}
+
+		mSendDataqueue.swap(remainQueue);
+	}
+
 	bool SetSocketOption()
 	{
 		/*if (SOCKET_ERROR == setsockopt(mSock, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT, (char*)GIocpManager->GetListenSocket(), sizeof(SOCKET)))
@@ -267,19 +582,31 @@ private:
 	INT32 mIndex = 0;
 	HANDLE mIOCPHandle = INVALID_HANDLE_VALUE;
 
-	INT64 mIsConnect = 0;
-	UINT64 mLatestClosedTimeSec = 0;
+	stIOStat* mpIOStat = nullptr;
+
+	std::atomic<INT64> mIsConnect{ 0 };
+	std::atomic<UINT32> mSessionId{ 0 };	// +  ȣ.   밡 ٲ.
+	std::atomic<INT32> mIORefCount{ 0 };	// 1 + ɷִ WSARecv/WSASend . 0 Ǹ    ִ.
 
 	SOCKET			mSocket;			//Cliet Ǵ 
 
 	stOverlappedEx	mAcceptContext;
-	char mAcceptBuf[64];
+	char mAcceptBuf[ACCEPT_DATA_SIZE + (sizeof(SOCKADDR_IN) + 16) * 2];
+	std::atomic<bool> mIsAccepting{ false };	//AcceptEx ɷִ 
 
 	stOverlappedEx	mRecvOverlappedEx;	//RECV Overlapped I/O۾  	
-	char			mRecvBuf[MAX_SOCK_RECVBUF]; // 
+	WSABUF			mRecvWsaBufs[2];
+	RecvRingBuffer	mRecvRing;			//  .  尡 ⼭ ٷ Ŷ д´.
 
 	std::mutex mSendLock;
-	std::queue<stOverlappedEx*> mSendDataqueue;
+	std::deque<stOverlappedEx*> mSendDataqueue;
+	SendBufferPool<stOverlappedEx> mSendPool;
+	SendBackpressure mSendLimit;			//۽ ť  з  ó
+
+	stOverlappedEx	mSendOverlappedEx;	//Ƽ  SEND Overlapped I/O۾  
+	WSABUF			mSendWsaBufs[MAX_SEND_GATHER_COUNT];
+	UINT32			mSendingCount = 0;	//  Ŷ . 0̸   ƴϴ.
+	UINT32			mFrontSentSize = 0;	//  Ŷ ̹  Ʈ
 
 	
 };
\ No newline at end of file
@@ -1,12 +1,68 @@
 #pragma once
 
+#ifdef _WIN32
 #include <winsock2.h>
 #include <Ws2tcpip.h>
 #include <mswsock.h>
+#else
+#include "LinuxDefine.h"
+#include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#endif
+#include <stdio.h>
+#include <atomic>
 
 const UINT32 MAX_SOCK_RECVBUF = 256;	//   ũ
 const UINT32 MAX_SOCK_SENDBUF = 4096;	//   ũ
-const UINT64 RE_USE_SESSION_WAIT_TIMESEC = 3;
+const UINT32 MAX_POSTED_ACCEPT_COUNT = 16;	// ̸ ɾδ AcceptEx 
+const UINT32 ACCEPT_DATA_SIZE = MAX_SOCK_RECVBUF;	// ù Ϳ Բ    Ӱ  ޴ ִ ũ
+const UINT32 DEFAULT_ACCEPT_DATA_TIMEOUT_SEC = 3;	// ϰ ù ͸  ʴ    ð
+const UINT32 MAX_SEND_GATHER_COUNT = 32;	// ۽ ѹ Ƽ  ִ Ŷ 
+const UINT32 RECV_RING_BUFFER_SIZE = 8192;	// Ǻ    ũ (2 ŵ). Ŷ ϳ ̺ ۾ƾ Ѵ.
+
+// ۽ ť .    и ° ǰ   Ʒ  Ǯ.
+const UINT32 SEND_QUEUE_HIGH_WATERMARK_BYTES = 256 * 1024;
+const UINT32 SEND_QUEUE_LOW_WATERMARK_BYTES = 64 * 1024;
+const UINT32 SEND_QUEUE_HIGH_WATERMARK_COUNT = 4096;
+const UINT32 SEND_QUEUE_LOW_WATERMARK_COUNT = 1024;
+const UINT32 SEND_QUEUE_MAX_BYTES = 1024 * 1024;		// ̺ ̸ ٷ ´.
+const UINT32 SEND_QUEUE_CONGESTION_TIMEOUT_MS = 5000;	// и ° ̺  ̾ ´.
+
+const UINT32 HEARTBEAT_TICK_MS = 100;	// ƮƮ Ÿ̸   ĭ ð
+const UINT32 DEFAULT_HEARTBEAT_PING_INTERVAL_SEC = 10;	//  ð      .
+const UINT32 DEFAULT_HEARTBEAT_TIMEOUT_SEC = 30;	//  ð     ´.
+
+// ID = ( 15Ʈ) +  ȣ( 16Ʈ). INT32 ٷﵵ   ʴ´.
+//   밡 ٲǷ    Ŷ ۽ ID  ʾ .
+const UINT32 SESSION_INDEX_BITS = 16;
+const UINT32 SESSION_INDEX_MASK = (1u << SESSION_INDEX_BITS) - 1;
+const UINT32 SESSION_GENERATION_MASK = 0x7FFF;
+
+inline UINT32 MakeSessionId(const UINT32 index_, const UINT32 generation_)
+{
+	return ((generation_ & SESSION_GENERATION_MASK) << SESSION_INDEX_BITS) | index_;
+}
+
+inline UINT32 GetSessionIndex(const UINT32 sessionId_)
+{
+	return sessionId_ & SESSION_INDEX_MASK;
+}
+
+//  ȣ   ID.  0 ѹ   ǿ .
+inline UINT32 GetNextSessionId(const UINT32 sessionId_)
+{
+	auto generation = ((sessionId_ >> SESSION_INDEX_BITS) + 1) & SESSION_GENERATION_MASK;
+	if (generation == 0)
+	{
+		generation = 1;
+	}
+
+	return MakeSessionId(GetSessionIndex(sessionId_), generation);
+}
 
 
 enum class IOOperation
@@ -16,6 +72,55 @@ enum class IOOperation
 	SEND
 };
 
+//۽ ť з  Ŷ ٷ 
+enum class SEND_CLASS : UINT8
+{
+	RELIABLE,		//׻ .
+	DROPPABLE,		//и ¿ .
+	REPLACEABLE,	//    ReplaceKey Ŷ ť   ڸ  Ŷ ٲ۴. и ¿ ٲ Ŷ  .
+};
+
+//REPLACEABLE Ŷ Ű.  Ŷ ,  (,  )̸  Ű ȴ.
+inline UINT64 MakeReplaceKey(const UINT16 packetId_, const INT64 objectId_)
+{
+	return ((UINT64)packetId_ << 48) | ((UINT64)objectId_ & 0xFFFFFFFFFFFFull);
+}
+
+class stBroadcastBuffer;
+
+//鿣 񱳿 I/O . ޼ ϳ ý   .
+struct stIOStat
+{
+	std::atomic<UINT64> SyscallCount{ 0 };
+	std::atomic<UINT64> RecvCount{ 0 };		//͸   Ϸ 
+	std::atomic<UINT64> SendCount{ 0 };		//۽ Ϸ ޼ 
+	std::atomic<UINT64> SendCallCount{ 0 };	//۽ û(send/WSASend/sqe) .  ޼ Ƽ ѹ .
+	std::atomic<UINT64> StaleSendCount{ 0 };	//̹    ID   
+
+	std::atomic<UINT64> DroppedSendCount{ 0 };		//۽ ť з  Ŷ 
+	std::atomic<UINT64> DroppedSendBytes{ 0 };
+	std::atomic<UINT64> SupersededSendCount{ 0 };	// ο Ŷ ٲ   Ŷ 
+	std::atomic<UINT64> SupersededSendBytes{ 0 };
+	std::atomic<UINT64> BackpressureCloseCount{ 0 };	//۽ ť Ǯ ʾƼ   
+
+	void Print(const char* pBackendName_)
+	{
+		UINT64 syscallCount = SyscallCount;
+		UINT64 msgCount = RecvCount + SendCount;
+		UINT64 sendCallCount = SendCallCount;
+		printf("[IO ] %s : syscall(%llu) recv(%llu) send(%llu) syscall/msg(%.2f) packets/send(%.2f) stale send(%llu)\n", pBackendName_,
+			syscallCount, (UINT64)RecvCount, (UINT64)SendCount,
+			(msgCount > 0) ? (double)syscallCount / (double)msgCount : 0.0,
+			(sendCallCount > 0) ? (double)SendCount / (double)sendCallCount : 0.0,
+			(UINT64)StaleSendCount);
+		printf("[۽ ] %s : dropped(%llu, %llu bytes) superseded(%llu, %llu bytes) closed(%llu)\n", pBackendName_,
+			(UINT64)DroppedSendCount, (UINT64)DroppedSendBytes,
+			(UINT64)SupersededSendCount, (UINT64)SupersededSendBytes,
+			(UINT64)BackpressureCloseCount);
+	}
+};
+
+#ifdef _WIN32
 //WSAOVERLAPPEDü Ȯ Ѽ ʿ   ־.
 struct stOverlappedEx
 {
@@ -23,5 +128,38 @@ struct stOverlappedEx
 	WSABUF		m_wsaBuf;				//Overlapped I/O۾ 
 	IOOperation m_eOperation;			//۾  
 	UINT32 SessionIndex = 0;
+	stBroadcastBuffer* pBroadcast = nullptr;	// ۸   m_wsaBuf  ۸ Ų.
+	SEND_CLASS SendClass = SEND_CLASS::RELIABLE;
+	UINT64 ReplaceKey = 0;
+	UINT64 EnqueueNs = 0;	//۽ ť  ð. Ŷ    0
 };
+#else
+const UINT32 MAX_EPOLL_EVENTS = 128;	// epoll_wait ѹ  ̺Ʈ 
 
+//۽  . Ϻθ  SentSize  ̾ .
+struct stSendBuffer
+{
+	char* pData = nullptr;
+	UINT32 DataSize = 0;
+	UINT32 SentSize = 0;
+	stBroadcastBuffer* pBroadcast = nullptr;	// ۸   pData  ۸ Ų.
+	SEND_CLASS SendClass = SEND_CLASS::RELIABLE;
+	UINT64 ReplaceKey = 0;
+	UINT64 EnqueueNs = 0;	//۽ ť  ð. Ŷ    0
+};
+
+const UINT32 URING_QUEUE_DEPTH = 4096;			// io_uring  ϳ SQ ũ
+const UINT32 URING_RECV_BUFFER_COUNT = 1024;	//  ϳ provided buffer  (2 ŵ)
+const UINT16 URING_RECV_BUFFER_GROUP = 0;
+
+//io_uring Ϸ 뺸 user_data  Ʈ ִ ۾ .  Ʈ  
+enum class UringOperation : UINT64
+{
+	WAKEUP = 0,
+	ACCEPT,
+	CONNECT,
+	RECV,
+	SEND
+};
+const UINT64 URING_OPERATION_MASK = 0x7;
+#endif
@@ -0,0 +1,435 @@
+#pragma once
+
+#include "Define.h"
+#include "SendBufferPool.h"
+#include "RecvRingBuffer.h"
+#include "SendBackpressure.h"
+#include "PacketLatency.h"
+#include "AsyncLogger.h"
+#include <stdio.h>
+#include <mutex>
+#include <deque>
+#include <algorithm>
+#include <sys/uio.h>
+#include <atomic>
+
+
+//epoll 鿣忡 Ŭ̾Ʈ   ü
+class stEpollClientInfo
+{
+public:
+	stEpollClientInfo()
+	{
+		mSocket = INVALID_SOCKET;
+	}
+
+	void Init(const UINT32 index, int epollFd_, stIOStat* pIOStat_, stSendPoolStat* pSendPoolStat_, const bool isSendPoolEnabled_)
+	{
+		mIndex = index;
+		mSessionId = MakeSessionId(index, 0);
+		mEpollFd = epollFd_;
+		mpIOStat = pIOStat_;
+		mSendPool.Init(pSendPoolStat_, isSendPoolEnabled_);
+		mSendLimit.Init(pIOStat_);
+	}
+
+	UINT32 GetIndex() { return mIndex; }
+
+	bool IsConnectd() { return mIsConnect == 1; }
+
+	SOCKET GetSock() { return mSocket; }
+
+	UINT32 GetSessionId() { return mSessionId.load(std::memory_order_acquire); }
+
+	RecvRingBuffer* GetRecvRing() { return &mRecvRing; }
+
+
+	bool OnConnect(SOCKET socket_)
+	{
+		mSocket = socket_;
+
+		Clear();
+
+		//  ť Close()  .
+		mSendLimit.Reset();
+
+		mSessionId.store(GetNextSessionId(mSessionId.load(std::memory_order_relaxed)), std::memory_order_release);
+		mIsConnect = 1;
+
+		return SetSocketOption();
+	}
+
+	//  Ŀ epoll ü Ѵ.
+	//edge-triggered ̹Ƿ б/ EAGAIN   ݺؾ Ѵ.
+	bool BindEpoll()
+	{
+		epoll_event ev = {};
+		ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		ev.data.ptr = this;
+
+		if (epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mSocket, &ev) == -1)
+		{
+			printf("[] epoll_ctl()Լ  : %d\n", errno);
+			return false;
+		}
+
+		return true;
+	}
+
+	//ȯ : ̹ ȣ ݾ true. ̹   false
+	bool Close(bool bIsForce = false)
+	{
+		struct linger stLinger = { 0, 0 };	// SO_DONTLINGER 
+
+		// bIsForce true̸ SO_LINGER, timeout = 0 Ͽ   Ų.  :  ս  
+		if (true == bIsForce)
+		{
+			stLinger.l_onoff = 1;
+		}
+
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (mIsConnect.exchange(0) != 1)
+		{
+			return false;
+		}
+
+		epoll_ctl(mEpollFd, EPOLL_CTL_DEL, mSocket, nullptr);
+
+		//socketClose  ۼ  ߴ Ų.
+		shutdown(mSocket, SHUT_RDWR);
+
+		// ɼ Ѵ.
+		setsockopt(mSocket, SOL_SOCKET, SO_LINGER, (char*)&stLinger, sizeof(stLinger));
+
+		//   Ų.
+		closesocket(mSocket);
+		mSocket = INVALID_SOCKET;
+
+		//  ʹ .
+		while (mSendDataqueue.empty() == false)
+		{
+			ReleaseFrontSendData();
+		}
+
+		return true;
+	}
+
+	void Clear()
+	{
+		mRecvRing.MarkSessionStart();
+	}
+
+	//  ִ ŭ     ٷ д´.   ġ readv 2  ޴´.
+	//ȯ :  Ʈ ,   Ͱ  0,  ų    á -1
+	INT32 RecvIO()
+	{
+		char* pSpans[2];
+		UINT32 spanSizes[2];
+		auto spanCount = mRecvRing.GetWriteSpans(pSpans, spanSizes);
+		if (spanCount == 0)
+		{
+			printf("[]   ۰   : Index(%d)\n", mIndex);
+			return -1;
+		}
+
+		iovec recvIovecs[2];
+		for (UINT32 i = 0; i < spanCount; ++i)
+		{
+			recvIovecs[i].iov_base = pSpans[i];
+			recvIovecs[i].iov_len = spanSizes[i];
+		}
+
+		while (true)
+		{
+			++mpIOStat->SyscallCount;
+
+			auto recvBytes = readv(mSocket, recvIovecs, (int)spanCount);
+			if (recvBytes > 0)
+			{
+				++mpIOStat->RecvCount;
+				mRecvRing.CommitWrite((UINT32)recvBytes);
+				return (INT32)recvBytes;
+			}
+
+			if (recvBytes == 0)
+			{
+				return -1;
+			}
+
+			if (errno == EINTR)
+			{
+				continue;
+			}
+
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				return 0;
+			}
+
+			printf("[] readv()Լ  : %d\n", errno);
+			return -1;
+		}
+	}
+
+	// 1 忡 ȣؾ Ѵ!
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pMsg_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		//۽ ؽƮ  ۴  Ǯ ѹ ޴´.
+		char* pSendBuf = nullptr;
+		auto sendData = mSendPool.Alloc(dataSize_, &pSendBuf);
+		sendData->pData = pSendBuf;
+		sendData->DataSize = dataSize_;
+		CopyMemory(pSendBuf, pMsg_, dataSize_);
+
+		return EnqueueSendData(sendData);
+	}
+
+	// ۴  ʰ  ť ִ´.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		auto sendData = mSendPool.AllocBroadcast(pBuffer_);
+		sendData->pData = pBuffer_->GetData();
+		sendData->DataSize = pBuffer_->GetDataSize();
+
+		return EnqueueSendData(sendData);
+	}
+
+	//ٸ 忡  ´. ۼ ߴܽŰ I/O 尡 ó Close() ȣѴ.
+	bool Disconnect(const UINT32 sessionId_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsConnectd() == false || sessionId_ != mSessionId.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		shutdown(mSocket, SHUT_RDWR);
+		return true;
+	}
+
+	//EPOLLOUT 뺸   ͸ ̾ .
+	bool SendReady()
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsConnectd() == false)
+		{
+			return false;
+		}
+
+		return SendIO();
+	}
+
+
+private:
+	//mSendLock  ¿ ȣѴ. ų    ۽ .
+	bool IsSendable(const UINT32 sessionId_)
+	{
+		if (IsConnectd() == false)
+		{
+			return false;
+		}
+
+		if (sessionId_ != mSessionId.load(std::memory_order_relaxed))
+		{
+			++mpIOStat->StaleSendCount;
+			return false;
+		}
+
+		return true;
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	bool EnqueueSendData(stSendBuffer* sendData_)
+	{
+		sendData_->EnqueueNs = PacketLatencyMonitor::Instance().Stamp();
+
+		if (sendData_->SendClass == SEND_CLASS::REPLACEABLE && ReplaceQueuedSendData(sendData_))
+		{
+			return true;
+		}
+
+		switch (mSendLimit.Admit(sendData_->SendClass, sendData_->DataSize))
+		{
+		case SendBackpressure::RESULT::DROP:
+			mSendPool.Free(sendData_, sendData_->DataSize);
+			return true;
+
+		//۽ ť Ǯ ʴ´. ޱ⸦  Ŀ ó  ϰ Ѵ.
+		case SendBackpressure::RESULT::CLOSE:
+			printf("[] ۽ ť Ǯ ʾƼ   : Index(%d)\n", mIndex);
+			mSendPool.Free(sendData_, sendData_->DataSize);
+			shutdown(mSocket, SHUT_RDWR);
+			return false;
+
+		default:
+			break;
+		}
+
+		mSendDataqueue.push_back(sendData_);
+
+		//տ  Ͱ  EPOLLOUT 뺸  ̾ .
+		if (mSendDataqueue.size() == 1)
+		{
+			return SendIO();
+		}
+
+		return true;
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	// Ŷ MAX_SEND_GATHER_COUNT iovec Ƽ sendmsg ѹ .
+	bool SendIO()
+	{
+		iovec sendIovecs[MAX_SEND_GATHER_COUNT];
+
+		while (mSendDataqueue.empty() == false)
+		{
+			UINT32 iovecCount = 0;
+			for (auto sendData : mSendDataqueue)
+			{
+				if (iovecCount == MAX_SEND_GATHER_COUNT)
+				{
+					break;
+				}
+
+				sendIovecs[iovecCount].iov_base = sendData->pData + sendData->SentSize;
+				sendIovecs[iovecCount].iov_len = sendData->DataSize - sendData->SentSize;
+				++iovecCount;
+			}
+
+			msghdr msg = {};
+			msg.msg_iov = sendIovecs;
+			msg.msg_iovlen = iovecCount;
+
+			++mpIOStat->SyscallCount;
+			++mpIOStat->SendCallCount;
+			auto sendBytes = sendmsg(mSocket, &msg, MSG_NOSIGNAL);
+
+			if (sendBytes < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				// ۽ ۰  á. EPOLLOUT 뺸 ٸ.
+				if (errno == EAGAIN || errno == EWOULDBLOCK)
+				{
+					return true;
+				}
+
+				//   ʿ ȴ.
+				printf("[] sendmsg()Լ  : %d\n", errno);
+				return false;
+			}
+
+			// ŭ տ Ϸ óѴ. Ϻθ  Ŷ  SentSize  ̾ .
+			auto remainBytes = (UINT32)sendBytes;
+			while (remainBytes > 0)
+			{
+				auto sendData = mSendDataqueue.front();
+				auto sentSize = std::min(remainBytes, sendData->DataSize - sendData->SentSize);
+
+				sendData->SentSize += sentSize;
+				remainBytes -= sentSize;
+
+				if (sendData->SentSize < sendData->DataSize)
+				{
+					break;
+				}
+
+				SendCompleted(sendData->DataSize);
+			}
+		}
+
+		return true;
+	}
+
+	void SendCompleted(const UINT32 dataSize_)
+	{
+		ALOG_TRACE("[۽ Ϸ] bytes : %d\n", dataSize_);
+
+		++mpIOStat->SendCount;
+
+		auto sendData = mSendDataqueue.front();
+		PacketLatencyMonitor::Instance().AddSend(sendData->pData, sendData->DataSize, sendData->EnqueueNs);
+
+		ReleaseFrontSendData();
+	}
+
+	//mSendLock  ¿ ȣѴ. Ϻζ  Ŷ ǵ帮 ʴ´.
+	//ȯ :  Ű Ŷ ãƼ ٲ true
+	bool ReplaceQueuedSendData(stSendBuffer* sendData_)
+	{
+		for (auto& queuedData : mSendDataqueue)
+		{
+			if (queuedData->SentSize > 0 || queuedData->SendClass != SEND_CLASS::REPLACEABLE || queuedData->ReplaceKey != sendData_->ReplaceKey)
+			{
+				continue;
+			}
+
+			mSendLimit.OnReplaced(queuedData->DataSize, sendData_->DataSize);
+			mSendPool.Free(queuedData, queuedData->DataSize);
+			queuedData = sendData_;
+			return true;
+		}
+
+		return false;
+	}
+
+	void ReleaseFrontSendData()
+	{
+		auto sendData = mSendDataqueue.front();
+		mSendLimit.OnRemoved(sendData->DataSize);
+		mSendPool.Free(sendData, sendData->DataSize);
+
+		mSendDataqueue.pop_front();
+	}
+
+	bool SetSocketOption()
+	{
+		int opt = 1;
+		if (SOCKET_ERROR == setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&opt, sizeof(int)))
+		{
+			printf_s("[DEBUG] TCP_NODELAY error: %d\n", errno);
+			return false;
+		}
+
+		return true;
+	}
+
+
+	INT32 mIndex = 0;
+	int mEpollFd = -1;
+
+	stIOStat* mpIOStat = nullptr;
+
+	std::atomic<INT64> mIsConnect{ 0 };
+	std::atomic<UINT32> mSessionId{ 0 };	// +  ȣ.   밡 ٲ.
+
+	SOCKET			mSocket;			//Cliet Ǵ 
+
+	RecvRingBuffer	mRecvRing;			//  .  尡 ⼭ ٷ Ŷ д´.
+
+	std::mutex mSendLock;
+	std::deque<stSendBuffer*> mSendDataqueue;
+	SendBufferPool<stSendBuffer> mSendPool;
+	SendBackpressure mSendLimit;			//۽ ť  з  ó
+};
\ No newline at end of file
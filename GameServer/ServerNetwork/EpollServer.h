@@ -0,0 +1,544 @@
+#pragma once
+
+#include "EpollClientInfo.h"
+#include "SessionPool.h"
+#include "ThreadAffinity.h"
+#include "ThreadStat.h"
+#include "Define.h"
+#include <thread>
+#include <vector>
+
+//IOCPServer  ̽   epoll(edge-triggered, non-blocking) 
+// (index % Ŀ ) ° Ŀ epoll ü ϵǾ  Ŀ óȴ.
+class EpollServer
+{
+public:
+	EpollServer(void) {}
+
+	virtual ~EpollServer(void) {}
+
+	// ʱȭϴ Լ
+	bool Init(const UINT32 maxIOWorkerThreadCount_)
+	{
+		// TCP , non-blocking  
+		mListenSocket = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, IPPROTO_TCP);
+
+		if (INVALID_SOCKET == mListenSocket)
+		{
+			printf("[] socket()Լ  : %d\n", errno);
+			return false;
+		}
+
+		MaxIOWorkerThreadCount = (maxIOWorkerThreadCount_ > 0) ? maxIOWorkerThreadCount_ : 1;
+
+		printf(" ʱȭ \n");
+		return true;
+	}
+
+	//ù Ϳ Բ  ޴´.  Ͽ TCP_DEFER_ACCEPT ɾ ù Ŷ(α) ؾ  Ϸǰ, ϷǸ ٷ д´.
+	//timeoutSec_  ƹ͵    Ŀ Ѱִ  ´. 0̸ . BindandListen()  ȣؾ Ѵ.
+	void SetAcceptDataTimeout(const UINT32 timeoutSec_) { mAcceptDataTimeoutSec = timeoutSec_; }
+
+	//false̸ ۽  Ǯ  ۽Ÿ new/delete Ѵ. Ǯ Ҵ    . StartServer()  ȣؾ Ѵ.
+	void SetSendPool(const bool isEnabled_) { mIsSendPoolEnabled = isEnabled_; }
+
+	//I/O Ŀ 带  CPU . Ŀ i cpus_[i % ] .   ʴ´. StartServer()  ȣؾ Ѵ.
+	void SetIOThreadCpus(const std::vector<UINT32>& cpus_) { mIOThreadCpus = cpus_; }
+
+	// ּ ϰ Ű  û ޱ   ϴ Լ
+	bool BindandListen(int bindPort_)
+	{
+		int opt = 1;
+		setsockopt(mListenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&opt, sizeof(int));
+
+		if (mAcceptDataTimeoutSec > 0)
+		{
+			int deferSec = (int)mAcceptDataTimeoutSec;
+			if (SOCKET_ERROR == setsockopt(mListenSocket, IPPROTO_TCP, TCP_DEFER_ACCEPT, (const char*)&deferSec, sizeof(int)))
+			{
+				printf("[] TCP_DEFER_ACCEPT   : %d\n", errno);
+				return false;
+			}
+		}
+
+		sockaddr_in		stServerAddr = {};
+		stServerAddr.sin_family = AF_INET;
+		stServerAddr.sin_port = htons(bindPort_); // Ʈ Ѵ.
+		stServerAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+		int nRet = bind(mListenSocket, (sockaddr*)&stServerAddr, sizeof(sockaddr_in));
+		if (0 != nRet)
+		{
+			printf("[] bind()Լ  : %d\n", errno);
+			return false;
+		}
+
+		nRet = listen(mListenSocket, SOMAXCONN);
+		if (0 != nRet)
+		{
+			printf("[] listen()Լ  : %d\n", errno);
+			return false;
+		}
+
+		// Ḧ ˸  eventfd.  Ƿ  epoll_wait .
+		mWakeupEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (-1 == mWakeupEventFd)
+		{
+			printf("[] eventfd()Լ  : %d\n", errno);
+			return false;
+		}
+
+		//Ŀ 帶 epoll ü ϳ .
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; ++i)
+		{
+			auto epollFd = epoll_create1(EPOLL_CLOEXEC);
+			if (-1 == epollFd)
+			{
+				printf("[] epoll_create1()Լ  : %d\n", errno);
+				return false;
+			}
+
+			epoll_event ev = {};
+			ev.events = EPOLLIN;
+			ev.data.ptr = nullptr;
+			epoll_ctl(epollFd, EPOLL_CTL_ADD, mWakeupEventFd, &ev);
+
+			mWorkerEpollFds.push_back(epollFd);
+		}
+
+		mAcceptEpollFd = epoll_create1(EPOLL_CLOEXEC);
+		if (-1 == mAcceptEpollFd)
+		{
+			printf("[] epoll_create1()Լ  : %d\n", errno);
+			return false;
+		}
+
+		epoll_event ev = {};
+		ev.events = EPOLLIN;
+		ev.data.fd = mListenSocket;
+		epoll_ctl(mAcceptEpollFd, EPOLL_CTL_ADD, mListenSocket, &ev);
+
+		ev.data.fd = mWakeupEventFd;
+		epoll_ctl(mAcceptEpollFd, EPOLL_CTL_ADD, mWakeupEventFd, &ev);
+
+		printf("  ..\n");
+		return true;
+	}
+
+	// û ϰ ޼ ޾Ƽ óϴ Լ
+	bool StartServer(const UINT32 maxClientCount_)
+	{
+		CreateClient(maxClientCount_);
+
+		bool bRet = CreateWokerThread();
+		if (false == bRet) {
+			return false;
+		}
+
+		bRet = CreateAccepterThread();
+		if (false == bRet) {
+			return false;
+		}
+
+		printf(" \n");
+		return true;
+	}
+
+	//Ǿִ 带 ıѴ.
+	void DestroyThread()
+	{
+		mIsWorkerRun = false;
+		mIsAccepterRun = false;
+
+		UINT64 wakeup = 1;
+		if (write(mWakeupEventFd, &wakeup, sizeof(wakeup)) < 0)
+		{
+			printf("[] eventfd write  : %d\n", errno);
+		}
+
+		for (auto& th : mIOWorkerThreads)
+		{
+			if (th.joinable())
+			{
+				th.join();
+			}
+		}
+
+		if (mAccepterThread.joinable())
+		{
+			mAccepterThread.join();
+		}
+
+		closesocket(mListenSocket);
+
+		for (auto epollFd : mWorkerEpollFds)
+		{
+			close(epollFd);
+		}
+		close(mAcceptEpollFd);
+		close(mWakeupEventFd);
+
+		mIOStat.Print("epoll");
+		mSendPoolStat.Print();
+	}
+
+	// ID Ű  ̹   ʴ´.
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, dataSize_, pData);
+	}
+
+	//  ۸  ǿ   .   ۽ ť  ´.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, pBuffer_);
+	}
+
+	// 尡 Ŷ    .  ų Ǿ nullptr
+	RecvRingBuffer* GetRecvRing(const UINT32 sessionId_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		//    ID ״ζ,  뺸 ڿ   뺸    ٽ   ִ.
+		if (pClient->GetSessionId() != sessionId_ || pClient->IsConnectd() == false)
+		{
+			return nullptr;
+		}
+
+		return pClient->GetRecvRing();
+	}
+
+	//ٸ 忡   ´. ̹    ID̸ false
+	bool Disconnect(const UINT32 sessionId_)
+	{
+		return GetClientInfo(GetSessionIndex(sessionId_))->Disconnect(sessionId_);
+	}
+
+	virtual void OnConnect(const UINT32 /*sessionId_*/) {}
+
+	virtual void OnClose(const UINT32 /*sessionId_*/) {}
+
+	// ʹ GetRecvRing(sessionId_)   ִ.
+	virtual void OnReceive(const UINT32 /*sessionId_*/, const UINT32 /*size_*/) {}
+
+private:
+	void CreateClient(const UINT32 maxClientCount_)
+	{
+		for (UINT32 i = 0; i < maxClientCount_; ++i)
+		{
+			auto client = new stEpollClientInfo;
+			client->Init(i, mWorkerEpollFds[i % MaxIOWorkerThreadCount], &mIOStat, &mSendPoolStat, mIsSendPoolEnabled);
+
+			mClientInfos.push_back(client);
+		}
+
+		mSessionPool.Init(maxClientCount_);
+	}
+
+	//epoll ü ϳ Ŀ  ϳ 
+	bool CreateWokerThread()
+	{
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; i++)
+		{
+			auto epollFd = mWorkerEpollFds[i];
+			mIOWorkerThreads.emplace_back([this, epollFd, i]() { WokerThread(epollFd, i); });
+		}
+
+		printf("WokerThread ..\n");
+		return true;
+	}
+
+	stEpollClientInfo* GetEmptyClientInfo()
+	{
+		UINT32 sessionIndex = 0;
+		if (mSessionPool.Pop(&sessionIndex) == false)
+		{
+			return nullptr;
+		}
+
+		return GetClientInfo(sessionIndex);
+	}
+
+	stEpollClientInfo* GetClientInfo(const UINT32 clientIndex_)
+	{
+		return mClientInfos[clientIndex_];
+	}
+
+	//acceptû óϴ  
+	bool CreateAccepterThread()
+	{
+		mAccepterThread = std::thread([this]() { AccepterThread(); });
+
+		printf("AccepterThread ..\n");
+		return true;
+	}
+
+	//epoll 뺸 ޾ ׿ شϴ ó ϴ Լ
+	void WokerThread(const int epollFd_, const UINT32 threadIndex_)
+	{
+		PinCurrentThread(mIOThreadCpus, threadIndex_, "io");
+		auto pStat = ThreadStatMonitor::Instance().Register("io", threadIndex_);
+
+		epoll_event events[MAX_EPOLL_EVENTS];
+
+		while (mIsWorkerRun)
+		{
+			++mIOStat.SyscallCount;
+			auto idleBeginNs = pStat->BeginIdle();
+			auto eventCount = epoll_wait(epollFd_, events, MAX_EPOLL_EVENTS, -1);
+			pStat->EndIdle(idleBeginNs);
+			if (eventCount < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				printf("[] epoll_wait()Լ  : %d\n", errno);
+				break;
+			}
+
+			pStat->AddCompletion(eventCount);
+
+			for (int i = 0; i < eventCount; ++i)
+			{
+				auto pClientInfo = (stEpollClientInfo*)events[i].data.ptr;
+
+				//   ޼ ó..
+				if (pClientInfo == nullptr)
+				{
+					continue;
+				}
+
+				if (pClientInfo->IsConnectd() == false)
+				{
+					continue;
+				}
+
+				if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+				{
+					if (ProcessRecv(pClientInfo) == false)
+					{
+						CloseSocket(pClientInfo); //Caller WokerThread()
+						continue;
+					}
+				}
+
+				if (events[i].events & EPOLLOUT)
+				{
+					pClientInfo->SendReady();
+				}
+			}
+		}
+
+		ThreadStatMonitor::Instance().Unregister(pStat);
+	}
+
+	//edge-triggered ̹Ƿ   Ͱ   д´.   false
+	bool ProcessRecv(stEpollClientInfo* pClientInfo_)
+	{
+		while (true)
+		{
+			auto recvBytes = pClientInfo_->RecvIO();
+			if (recvBytes < 0)
+			{
+				return false;
+			}
+
+			if (recvBytes == 0)
+			{
+				return true;
+			}
+
+			OnReceive(pClientInfo_->GetSessionId(), (UINT32)recvBytes);
+		}
+	}
+
+	//  ޴ 
+	void AccepterThread()
+	{
+		epoll_event events[2];
+
+		while (mIsAccepterRun)
+		{
+			++mIOStat.SyscallCount;
+			auto eventCount = epoll_wait(mAcceptEpollFd, events, 2, -1);
+			if (eventCount < 0)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				printf("[] epoll_wait()Լ  : %d\n", errno);
+				break;
+			}
+
+			for (int i = 0; i < eventCount; ++i)
+			{
+				if (events[i].data.fd == mListenSocket)
+				{
+					AcceptAll();
+				}
+			}
+		}
+	}
+
+	//   ޴´.
+	void AcceptAll()
+	{
+		while (mIsAccepterRun)
+		{
+			sockaddr_in		stClientAddr;
+			socklen_t nAddrLen = sizeof(sockaddr_in);
+
+			++mIOStat.SyscallCount;
+			auto clientSocket = accept4(mListenSocket, (sockaddr*)&stClientAddr, &nAddrLen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+			if (INVALID_SOCKET == clientSocket)
+			{
+				if (errno == EINTR)
+				{
+					continue;
+				}
+
+				if (errno != EAGAIN && errno != EWOULDBLOCK)
+				{
+					printf("[] accept4()Լ  : %d\n", errno);
+				}
+				return;
+			}
+
+			auto pClientInfo = GetEmptyClientInfo();
+			if (pClientInfo == nullptr)
+			{
+				printf("[] Client Full\n");
+				closesocket(clientSocket);
+				continue;
+			}
+
+			AcceptCompletion(pClientInfo, clientSocket, stClientAddr);
+		}
+	}
+
+	//TCP_DEFER_ACCEPT   ù Ͱ ̹  Ƿ  ɱ  ٷ д´.
+	//  Ѿ   ð  ƹ͵   ̴. ȯ :  ϸ false
+	bool ReceiveFirstData(stEpollClientInfo* pClientInfo_)
+	{
+		auto recvBytes = pClientInfo_->RecvIO();
+		if (recvBytes == 0)
+		{
+			printf("[˸] ù   ð ʰ : Index(%d)\n", pClientInfo_->GetIndex());
+		}
+
+		if (recvBytes <= 0)
+		{
+			return false;
+		}
+
+		OnReceive(pClientInfo_->GetSessionId(), (UINT32)recvBytes);
+		return true;
+	}
+
+	void AcceptCompletion(stEpollClientInfo* pClientInfo_, SOCKET clientSocket_, const sockaddr_in& clientAddr_)
+	{
+		printf_s("AcceptCompletion : SessionIndex(%d)\n", pClientInfo_->GetIndex());
+
+		if (pClientInfo_->OnConnect(clientSocket_) == false)
+		{
+			CloseSocket(pClientInfo_, true);
+			return;
+		}
+
+		char clientIP[32] = { 0, };
+		inet_ntop(AF_INET, &(clientAddr_.sin_addr), clientIP, 32 - 1);
+		printf("Ŭ̾Ʈ  : IP(%s) SOCKET(%d)\n", clientIP, (int)clientSocket_);
+
+		//Ŭ̾Ʈ  
+		++mClientCnt;
+
+		// 뺸  ͺ  óǵ epoll   ȣѴ.
+		OnConnect(pClientInfo_->GetSessionId());
+
+		if (mAcceptDataTimeoutSec > 0 && ReceiveFirstData(pClientInfo_) == false)
+		{
+			CloseSocket(pClientInfo_, true);
+			return;
+		}
+
+		if (pClientInfo_->BindEpoll() == false)
+		{
+			CloseSocket(pClientInfo_, true);
+		}
+	}
+
+	//   Ų.
+	void CloseSocket(stEpollClientInfo* clientInfo_, bool isForce_ = false)
+	{
+		if (clientInfo_->IsConnectd() == false)
+		{
+			return;
+		}
+
+		auto sessionId = clientInfo_->GetSessionId();
+
+		if (clientInfo_->Close(isForce_) == false)
+		{
+			return;
+		}
+
+		OnClose(sessionId);
+
+		//ɷִ Ŀ I/O Ƿ ٷ Ѵ.    Ŷ  ID  ɷ.
+		mSessionPool.Push(clientInfo_->GetIndex());
+	}
+
+
+
+	UINT32 MaxIOWorkerThreadCount = 0;
+	std::vector<UINT32> mIOThreadCpus;
+
+	//Ŭ̾Ʈ   ü
+	std::vector<stEpollClientInfo*> mClientInfos;
+
+	//  
+	SessionPool	mSessionPool;
+
+	//Ŭ̾Ʈ  ޱ  
+	SOCKET		mListenSocket = INVALID_SOCKET;
+
+	//0 ũ ù Ϳ Բ  ޴´.
+	UINT32		mAcceptDataTimeoutSec = 0;
+
+	//false̸ ۽  Ǯ  ʴ´.
+	bool		mIsSendPoolEnabled = true;
+
+	// Ǿִ Ŭ̾Ʈ 
+	int			mClientCnt = 0;
+
+	//IO Worker 
+	std::vector<std::thread> mIOWorkerThreads;
+
+	//Accept 
+	std::thread	mAccepterThread;
+
+	//Ŀ 庰 epoll ü
+	std::vector<int> mWorkerEpollFds;
+
+	// Ͽ epoll ü
+	int			mAcceptEpollFd = -1;
+
+	//  뺸 eventfd
+	int			mWakeupEventFd = -1;
+
+	stIOStat	mIOStat;
+
+	//۽  Ǯ 
+	stSendPoolStat	mSendPoolStat;
+
+	//۾   ÷
+	bool		mIsWorkerRun = true;
+
+	//   ÷
+	bool		mIsAccepterRun = true;
+};
\ No newline at end of file
@@ -1,12 +1,21 @@
 //ó: ߴ  '¶ Ӽ'
 #pragma once
+
+#ifdef _WIN32
 #pragma comment(lib, "ws2_32")
 #pragma comment(lib, "mswsock.lib")
 
 #include "ClientInfo.h"
+#include "SessionPool.h"
+#include "SessionHeartbeat.h"
+#include "ThreadAffinity.h"
+#include "ThreadStat.h"
 #include "Define.h"
 #include <thread>
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <mutex>
 
 class IOCPServer
 {
@@ -93,10 +102,28 @@ public:
 		return true;
 	}
 
+	//ù Ϳ Բ  ޴´. AcceptEx ù Ŷ(α)  ڿ ϷǹǷ WSARecv ѹ Ƴ.
+	//Ḹ ϰ timeoutSec_  ƹ͵  ʴ  ´. 0̸ . StartServer()  ȣؾ Ѵ.
+	void SetAcceptDataTimeout(const UINT32 timeoutSec_) { mAcceptDataTimeoutSec = timeoutSec_; }
+
+	//false̸ ۽  Ǯ  ۽Ÿ new/delete Ѵ. Ǯ Ҵ    . StartServer()  ȣؾ Ѵ.
+	void SetSendPool(const bool isEnabled_) { mIsSendPoolEnabled = isEnabled_; }
+
+	//pingIntervalSec_     ǿ  , timeoutSec_     ´. 0̸ .
+	//StartServer()  ȣؾ Ѵ.
+	void SetHeartbeat(const UINT32 pingIntervalSec_, const UINT32 timeoutSec_) { mHeartbeat.SetConfig(pingIntervalSec_ * 1000, timeoutSec_ * 1000); }
+
+	//I/O Ŀ 带  CPU . Ŀ i cpus_[i % ] .   ʴ´. StartServer()  ȣؾ Ѵ.
+	void SetIOThreadCpus(const std::vector<UINT32>& cpus_) { mIOThreadCpus = cpus_; }
+
 	// û ϰ ޼ ޾Ƽ óϴ Լ
 	bool StartServer(const UINT32 maxClientCount_)
 	{
 		CreateClient(maxClientCount_);
+
+		mHeartbeat.SendPingFunc = [this](UINT32 sessionId_, UINT64 pingTimeMs_) { OnPing(sessionId_, pingTimeMs_); };
+		mHeartbeat.CloseFunc = [this](UINT32 sessionId_) { Disconnect(sessionId_); };
+		mHeartbeat.Start(maxClientCount_);
 		
 		//ӵ Ŭ̾Ʈ ּ   ü
 		bool bRet = CreateWokerThread();
@@ -104,9 +131,12 @@ public:
 			return false;
 		}
 
-		bRet = CreateAccepterThread();
-		if (false == bRet) {
-			return false;
+		//AcceptEx ̸ ɾд. ķδ  Ϸ  ȯ  ä.
+		PostAccepts();
+
+		if (mAcceptDataTimeoutSec > 0)
+		{
+			mAcceptTimeoutThread = std::thread([this]() { AcceptTimeoutThread(); });
 		}
 		
 		printf(" \n");
@@ -116,6 +146,9 @@ public:
 	//Ǿִ 带 ıѴ.
 	void DestroyThread()
 	{
+		//ƮƮ ⸦ û ʵ  .
+		mHeartbeat.Stop();
+
 		mIsWorkerRun = false;
 		CloseHandle(mIOCPHandle);
 		
@@ -127,27 +160,66 @@ public:
 			}
 		}
 		
-		//Accepter 带 Ѵ.
 		mIsAccepterRun = false;
 		closesocket(mListenSocket);  
-		
-		if (mAccepterThread.joinable())
+
+		if (mAcceptTimeoutThread.joinable())
+		{
+			mAcceptTimeoutThread.join();
+		}
+
+		mIOStat.Print("IOCP");
+		mSendPoolStat.Print();
+	}
+
+	// ID Ű  ̹   ʴ´.
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, dataSize_, pData);
+	}
+
+	//  ۸  ǿ   .   ۽ ť  ´.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, pBuffer_);
+	}
+
+	// 尡 Ŷ    .  ų Ǿ nullptr
+	RecvRingBuffer* GetRecvRing(const UINT32 sessionId_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		//    ID ״ζ,  뺸 ڿ   뺸    ٽ   ִ.
+		if (pClient->GetSessionId() != sessionId_ || pClient->IsConnectd() == false)
 		{
-			mAccepterThread.join();
-		}		
+			return nullptr;
+		}
+
+		return pClient->GetRecvRing();
 	}
 
-	bool SendMsg(const UINT32 clientIndex_, const UINT32 dataSize_, char* pData)
+	//ٸ 忡   ´. ̹    ID̸ false
+	bool Disconnect(const UINT32 sessionId_)
 	{
-		auto pClient = GetClientInfo(clientIndex_);
-		return pClient->SendMsg(dataSize_, pData);
+		return GetClientInfo(GetSessionIndex(sessionId_))->Disconnect(sessionId_);
 	}
+
+	//Ŭ̾Ʈ   ð RTT . ȯ : ̹ RTT(ms).  ῡ   ƴϸ -1
+	INT32 ReportPong(const UINT32 sessionId_, const UINT64 pingTimeMs_) { return mHeartbeat.OnPong(sessionId_, pingTimeMs_); }
+
+	//  RTT ̵ (ms).     0
+	UINT32 GetSessionRtt(const UINT32 sessionId_) { return mHeartbeat.GetSmoothedRtt(sessionId_); }
 	
-	virtual void OnConnect(const UINT32 clientIndex_) {}
+	virtual void OnConnect(const UINT32 sessionId_) {}
 
-	virtual void OnClose(const UINT32 clientIndex_) {}
+	virtual void OnClose(const UINT32 sessionId_) {}
 
-	virtual void OnReceive(const UINT32 clientIndex_, const UINT32 size_, char* pData_) {}
+	// ʹ GetRecvRing(sessionId_)   ִ.
+	virtual void OnReceive(const UINT32 sessionId_, const UINT32 size_) {}
+
+	//pingTimeMs_   Ŷ    . ƮƮ 忡 ȣȴ.
+	virtual void OnPing(const UINT32 sessionId_, const UINT64 pingTimeMs_) {}
 
 private:
 	void CreateClient(const UINT32 maxClientCount_)
@@ -155,57 +227,111 @@ private:
 		for (UINT32 i = 0; i < maxClientCount_; ++i)
 		{
 			auto client = new stClientInfo;
-			client->Init(i, mIOCPHandle);
+			client->Init(i, mIOCPHandle, &mIOStat, &mSendPoolStat, mIsSendPoolEnabled);
 
 			mClientInfos.push_back(client);
 		}
+
+		mSessionPool.Init(maxClientCount_);
+		mPostedAccepts.reserve(MAX_POSTED_ACCEPT_COUNT);
 	}
 
 	//WaitingThread Queue   
 	bool CreateWokerThread()
 	{
-		//WaingThread Queue  ·    Ǵ  : (cpu * 2) + 1 
-		auto threadCount = (MaxIOWorkerThreadCount * 2) + 1;
-		for (UINT32 i = 0; i < threadCount; i++)
+		//Ϸ ó ߿ ŷϴ  Ƿ   (MaxIOWorkerThreadCount)ŭ . CPU    CPU  尡 ȴ.
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; i++)
 		{
-			mIOWorkerThreads.emplace_back([this](){ WokerThread(); });			
+			mIOWorkerThreads.emplace_back([this, i](){ WokerThread(i); });
 		}
 
 		printf("WokerThread ..\n");
 		return true;
 	}
 	
-	// ʴ Ŭ̾Ʈ  ü ȯѴ.
-	stClientInfo* GetEmptyClientInfo()
+	//ɷִ AcceptEx MAX_POSTED_ACCEPT_COUNT ǵ   AcceptEx Ǵ.
+	// ,  Ϸ,  ȯ  ȣѴ.  忡 ȣص ȴ.
+	void PostAccepts()
 	{
-		for (auto& client : mClientInfos)
+		while (mIsAccepterRun)
 		{
-			if (client->IsConnectd() == false)
+			//AcceptEx    ð ʰ Ȯ    ʵ mAcceptLock ȿ Ǵ.
+			std::lock_guard<std::mutex> guard(mAcceptLock);
+			if (mPostedAccepts.size() >= MAX_POSTED_ACCEPT_COUNT)
+			{
+				return;
+			}
+
+			UINT32 sessionIndex = 0;
+			if (mSessionPool.Pop(&sessionIndex) == false)
+			{
+				return;
+			}
+
+			auto acceptDataSize = (mAcceptDataTimeoutSec > 0) ? ACCEPT_DATA_SIZE : 0;
+			if (GetClientInfo(sessionIndex)->PostAccept(mListenSocket, acceptDataSize) == false)
 			{
-				return client;
+				mSessionPool.Push(sessionIndex);
+				return;
 			}
+
+			mPostedAccepts.push_back(sessionIndex);
 		}
+	}
 
-		return nullptr;
+	//AcceptEx Ϸ 뺸 ޾Ҵ. Ͽ  ڷδ ð ʰ Ȯ    ʴ´.
+	void RemovePostedAccept(const UINT32 sessionIndex_)
+	{
+		std::lock_guard<std::mutex> guard(mAcceptLock);
+		for (auto& postedIndex : mPostedAccepts)
+		{
+			if (postedIndex == sessionIndex_)
+			{
+				postedIndex = mPostedAccepts.back();
+				mPostedAccepts.pop_back();
+				return;
+			}
+		}
 	}
 
-	stClientInfo* GetClientInfo(const UINT32 clientIndex_)
+	//AcceptEx з ϷǾ.  ְ  Ǵ.
+	void AcceptFailed(stClientInfo* pClientInfo_)
 	{
-		return mClientInfos[clientIndex_];		
+		RemovePostedAccept(pClientInfo_->GetIndex());
+
+		pClientInfo_->CloseAcceptSocket();
+		mSessionPool.Push(pClientInfo_->GetIndex());
+
+		PostAccepts();
 	}
 
-	//acceptû óϴ  
-	bool CreateAccepterThread()
+	//   I/O . ٷ   ְ AcceptEx ä.
+	void ReleaseSession(stClientInfo* pClientInfo_)
 	{
-		mAccepterThread = std::thread([this]() { AccepterThread(); });
-		
-		printf("AccepterThread ..\n");
-		return true;
+		mSessionPool.Push(pClientInfo_->GetIndex());
+		PostAccepts();
 	}
-		  		
+
+	//WSARecv/WSASend Ϸ ϳ ó  ȣѴ.
+	void IOCompleted(stClientInfo* pClientInfo_)
+	{
+		if (pClientInfo_->ReleaseIORef())
+		{
+			ReleaseSession(pClientInfo_);
+		}
+	}
+
+	stClientInfo* GetClientInfo(const UINT32 clientIndex_)
+	{
+		return mClientInfos[clientIndex_];		
+	}
+
 	//Overlapped I/O۾  Ϸ 뺸 ޾ ׿ شϴ ó ϴ Լ
-	void WokerThread()
+	void WokerThread(const UINT32 threadIndex_)
 	{
+		PinCurrentThread(mIOThreadCpus, threadIndex_, "io");
+		auto pStat = ThreadStatMonitor::Instance().Register("io", threadIndex_);
+
 		//CompletionKey   
 		stClientInfo* pClientInfo = nullptr;
 		//Լ ȣ  
@@ -217,11 +343,15 @@ private:
 
 		while (mIsWorkerRun)
 		{
+			++mIOStat.SyscallCount;
+			auto idleBeginNs = pStat->BeginIdle();
 			bSuccess = GetQueuedCompletionStatus(mIOCPHandle,
 				&dwIoSize,					//  ۵ Ʈ
 				(PULONG_PTR)&pClientInfo,		// CompletionKey
 				&lpOverlapped,				// Overlapped IO ü
 				INFINITE);					//  ð
+			pStat->EndIdle(idleBeginNs);
+			pStat->AddCompletion();
 
 			//   ޼ ó..
 			if (TRUE == bSuccess && 0 == dwIoSize && NULL == lpOverlapped)
@@ -237,11 +367,26 @@ private:
 
 			auto pOverlappedEx = (stOverlappedEx*)lpOverlapped;
 
+			//  CompletionKey 0̹Ƿ  SessionIndex ã´.
+			if (FALSE == bSuccess && IOOperation::ACCEPT == pOverlappedEx->m_eOperation)
+			{
+				AcceptFailed(GetClientInfo(pOverlappedEx->SessionIndex));
+				continue;
+			}
+
 			//client  ..			
 			if (FALSE == bSuccess || (0 == dwIoSize && IOOperation::ACCEPT != pOverlappedEx->m_eOperation))
 			{
 				//printf("socket(%d)  \n", (int)pClientInfo->m_socketClient);
 				CloseSocket(pClientInfo); //Caller WokerThread()
+
+				// WSASend ۴  뺸  ڿ   ִ.
+				if (IOOperation::SEND == pOverlappedEx->m_eOperation)
+				{
+					pClientInfo->SendCompleted(0);
+				}
+
+				IOCompleted(pClientInfo);
 				continue;
 			}
 
@@ -249,12 +394,26 @@ private:
 			if (IOOperation::ACCEPT == pOverlappedEx->m_eOperation)
 			{
 				pClientInfo = GetClientInfo(pOverlappedEx->SessionIndex);
-				if (pClientInfo->AcceptCompletion())
+
+				//Ϸ ŭ  AcceptEx Ǵ.
+				RemovePostedAccept(pClientInfo->GetIndex());
+				PostAccepts();
+
+				if (pClientInfo->AcceptCompletion(dwIoSize))
 				{
 					//Ŭ̾Ʈ  
 					++mClientCnt;		
 
-					OnConnect(pClientInfo->GetIndex());
+					mHeartbeat.OnConnect(pClientInfo->GetSessionId());
+					OnConnect(pClientInfo->GetSessionId());
+
+					//Ӱ Բ  ù ʹ ̹   ִ.
+					if (dwIoSize > 0)
+					{
+						++mIOStat.RecvCount;
+						mHeartbeat.OnReceive(pClientInfo->GetSessionId());
+						OnReceive(pClientInfo->GetSessionId(), dwIoSize);
+					}
 				}
 				else
 				{
@@ -264,14 +423,24 @@ private:
 			//Overlapped I/O Recv۾   ó
 			else if (IOOperation::RECV == pOverlappedEx->m_eOperation)
 			{
-				OnReceive(pClientInfo->GetIndex(), dwIoSize, pClientInfo->RecvBuffer());
+				++mIOStat.RecvCount;
+				pClientInfo->RecvCompleted(dwIoSize);
+				mHeartbeat.OnReceive(pClientInfo->GetSessionId());
+				OnReceive(pClientInfo->GetSessionId(), dwIoSize);
 				
-				pClientInfo->BindRecv();
+				//   á    Ƿ ´.
+				if (pClientInfo->BindRecv() == false)
+				{
+					CloseSocket(pClientInfo);
+				}
+
+				IOCompleted(pClientInfo);
 			}
 			//Overlapped I/O Send۾   ó
 			else if (IOOperation::SEND == pOverlappedEx->m_eOperation)
 			{
 				pClientInfo->SendCompleted(dwIoSize);
+				IOCompleted(pClientInfo);
 			}
 			// Ȳ
 			else
@@ -279,40 +448,31 @@ private:
 				printf("Client Index(%d) ܻȲ\n", pClientInfo->GetIndex());
 			}
 		}
+
+		ThreadStatMonitor::Instance().Unregister(pStat);
 	}
 
-	//  ޴ 
-	void AccepterThread()
+	//ù ͸ ٸ AcceptEx  Ḹ ϰ ƹ͵  ʴ  ؼ  ޴´.
+	//ɷִ AcceptEx(ִ MAX_POSTED_ACCEPT_COUNT) . ִ    ϴ.
+	void AcceptTimeoutThread()
 	{
 		while (mIsAccepterRun)
 		{
-			auto curTimeSec = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+			std::this_thread::sleep_for(std::chrono::seconds(1));
 
-			for (auto client : mClientInfos)
+			std::lock_guard<std::mutex> guard(mAcceptLock);
+			for (auto sessionIndex : mPostedAccepts)
 			{
-				if (client->IsConnectd())
+				auto pClientInfo = GetClientInfo(sessionIndex);
+				if (pClientInfo->IsAcceptDataTimedOut(mAcceptDataTimeoutSec))
 				{
-					continue;
+					printf("[˸] ù   ð ʰ : Index(%d)\n", pClientInfo->GetIndex());
+					pClientInfo->CancelAccept(mListenSocket);
 				}
-
-				if ((UINT64)curTimeSec < client->GetLatestClosedTimeSec())
-				{
-					continue;
-				}
-
-				auto diff = curTimeSec - client->GetLatestClosedTimeSec();
-				if (diff <= RE_USE_SESSION_WAIT_TIMESEC)
-				{
-					continue;
-				}
-
-				client->PostAccept(mListenSocket, curTimeSec);
 			}
-			
-			std::this_thread::sleep_for(std::chrono::milliseconds(32));
 		}
 	}
-	
+
 	//   Ų.
 	void CloseSocket(stClientInfo* clientInfo_, bool isForce_ = false)
 	{
@@ -321,20 +481,47 @@ private:
 			return;
 		}
 
-		auto clientIndex = clientInfo_->GetIndex();
+		auto sessionId = clientInfo_->GetSessionId();
 
-		clientInfo_->Close(isForce_);
+		auto isReleasable = clientInfo_->Close(isForce_);
 		
-		OnClose(clientIndex);
+		mHeartbeat.OnClose(sessionId);
+		OnClose(sessionId);
+
+		//ɷִ I/O   Ϸ  ش.
+		if (isReleasable)
+		{
+			ReleaseSession(clientInfo_);
+		}
 	}
 
 
 
 	UINT32 MaxIOWorkerThreadCount = 0;
+	std::vector<UINT32> mIOThreadCpus;
 
 	//Ŭ̾Ʈ   ü
 	std::vector<stClientInfo*> mClientInfos;
 
+	//  
+	SessionPool	mSessionPool;
+
+	//AcceptEx ɷִ  .  AcceptEx ϵ   Ų.
+	std::mutex				mAcceptLock;
+	std::vector<UINT32>		mPostedAccepts;
+
+	//0 ũ ù Ϳ Բ  ޴´.
+	UINT32		mAcceptDataTimeoutSec = 0;
+
+	//false̸ ۽  Ǯ  ʴ´.
+	bool		mIsSendPoolEnabled = true;
+
+	//ù   ð ʰ Ȯ 
+	std::thread	mAcceptTimeoutThread;
+
+	//  ã RTT 
+	SessionHeartbeat mHeartbeat;
+
 	//Ŭ̾Ʈ  ޱ  
 	SOCKET		mListenSocket = INVALID_SOCKET;
 	
@@ -344,15 +531,23 @@ private:
 	//IO Worker 
 	std::vector<std::thread> mIOWorkerThreads;
 
-	//Accept 
-	std::thread	mAccepterThread;
-
 	//CompletionPortü ڵ
 	HANDLE		mIOCPHandle = INVALID_HANDLE_VALUE;
+
+	stIOStat	mIOStat;
+
+	//۽  Ǯ 
+	stSendPoolStat	mSendPoolStat;
 	
 	//۾   ÷
 	bool		mIsWorkerRun = true;
 
 	//   ÷
 	bool		mIsAccepterRun = true;
-};
\ No newline at end of file
+};
+#else
+//  ̽ epoll/io_uring  Ѵ.
+#include "LinuxServer.h"
+
+using IOCPServer = LinuxServer;
+#endif
\ No newline at end of file
@@ -0,0 +1,350 @@
+#pragma once
+
+#include "Define.h"
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/utsname.h>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+
+//liburing  io_uring ý   ϴ  ϳ  Ŭ
+//SQ  尡 ä  ֵ mSqLock ȣϰ, CQ  Ŀ  ϳ д´.
+class IoUring
+{
+public:
+	~IoUring()
+	{
+		Close();
+	}
+
+	//Ƽ accept/recv provided buffer ring   ִ Ŀ ȮѴ. (6.0 ̻)
+	static bool IsSupported()
+	{
+		utsname name;
+		if (uname(&name) != 0)
+		{
+			return false;
+		}
+
+		int major = 0, minor = 0;
+		if (sscanf(name.release, "%d.%d", &major, &minor) != 2 || major < 6)
+		{
+			return false;
+		}
+
+		//io_uring_disabled ̳ seccomp   ִ.
+		IoUring testRing;
+		return testRing.Init(8, nullptr);
+	}
+
+	bool Init(const UINT32 entries_, stIOStat* pIOStat_)
+	{
+		mpIOStat = pIOStat_;
+
+		io_uring_params params = {};
+		mRingFd = (int)syscall(__NR_io_uring_setup, entries_, &params);
+		if (mRingFd < 0)
+		{
+			printf("[] io_uring_setup()Լ  : %d\n", errno);
+			return false;
+		}
+
+		if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0 || (params.features & IORING_FEAT_NODROP) == 0)
+		{
+			printf("[] io_uring   : features(%x)\n", params.features);
+			return false;
+		}
+
+		//SQ CQ  ѹ mmap  εȴ.
+		mRingSize = params.sq_off.array + params.sq_entries * sizeof(UINT32);
+		auto cqSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		if (cqSize > mRingSize)
+		{
+			mRingSize = cqSize;
+		}
+
+		mpRingMem = (char*)mmap(nullptr, mRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQ_RING);
+		if (mpRingMem == MAP_FAILED)
+		{
+			mpRingMem = nullptr;
+			printf("[] io_uring mmap  : %d\n", errno);
+			return false;
+		}
+
+		mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+		mpSqes = (io_uring_sqe*)mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQES);
+		if (mpSqes == MAP_FAILED)
+		{
+			mpSqes = nullptr;
+			printf("[] io_uring sqes mmap  : %d\n", errno);
+			return false;
+		}
+
+		mpSqHead = (UINT32*)(mpRingMem + params.sq_off.head);
+		mpSqTail = (UINT32*)(mpRingMem + params.sq_off.tail);
+		mSqMask = *(UINT32*)(mpRingMem + params.sq_off.ring_mask);
+		mSqEntries = params.sq_entries;
+
+		//SQ ε 迭 ׻ ڱ ڽ Ű  д.
+		auto pSqArray = (UINT32*)(mpRingMem + params.sq_off.array);
+		for (UINT32 i = 0; i < mSqEntries; ++i)
+		{
+			pSqArray[i] = i;
+		}
+
+		mpCqHead = (UINT32*)(mpRingMem + params.cq_off.head);
+		mpCqTail = (UINT32*)(mpRingMem + params.cq_off.tail);
+		mCqMask = *(UINT32*)(mpRingMem + params.cq_off.ring_mask);
+		mpCqes = (io_uring_cqe*)(mpRingMem + params.cq_off.cqes);
+
+		mSqLocalTail = *mpSqTail;
+		return true;
+	}
+
+	void Close()
+	{
+		if (mpRecvBufRing != nullptr)
+		{
+			munmap(mpRecvBufRing, mRecvBufRingSize);
+			mpRecvBufRing = nullptr;
+			mpRecvBufRingTail = nullptr;
+		}
+
+		if (mpSqes != nullptr)
+		{
+			munmap(mpSqes, mSqesSize);
+			mpSqes = nullptr;
+		}
+
+		if (mpRingMem != nullptr)
+		{
+			munmap(mpRingMem, mRingSize);
+			mpRingMem = nullptr;
+		}
+
+		if (mRingFd >= 0)
+		{
+			close(mRingFd);
+			mRingFd = -1;
+		}
+
+		mRecvBuffers.clear();
+	}
+
+	int GetFd() { return mRingFd; }
+
+	//(registered) ۸ Ѵ. sqe buf_index pIovecs_ ̴.
+	bool RegisterBuffers(const iovec* pIovecs_, const UINT32 count_)
+	{
+		if (syscall(__NR_io_uring_register, mRingFd, IORING_REGISTER_BUFFERS, pIovecs_, count_) < 0)
+		{
+			printf("[] IORING_REGISTER_BUFFERS  : %d\n", errno);
+			return false;
+		}
+
+		return true;
+	}
+
+	//Ƽ recv     (provided buffer ring) . count_ 2 ŵ̾ Ѵ.
+	bool SetupRecvBufferRing(const UINT16 groupId_, const UINT32 count_, const UINT32 bufferSize_)
+	{
+		mRecvBufGroupId = groupId_;
+		mRecvBufCount = count_;
+		mRecvBufSize = bufferSize_;
+		mRecvBufRingSize = count_ * sizeof(io_uring_buf);
+
+		auto pRingMem = mmap(nullptr, mRecvBufRingSize, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+		if (pRingMem == MAP_FAILED)
+		{
+			printf("[]    mmap  : %d\n", errno);
+			return false;
+		}
+
+		//C++ io_uring_buf_ring::bufs(flex array)  0 ƴϰ Ƿ  迭 Ѵ.
+		//tail ù° io_uring_buf resv ڸ  ִ.
+		mpRecvBufRing = (io_uring_buf*)pRingMem;
+		mpRecvBufRingTail = (UINT16*)((char*)pRingMem + offsetof(io_uring_buf_ring, tail));
+
+		io_uring_buf_reg reg = {};
+		reg.ring_addr = (UINT64)mpRecvBufRing;
+		reg.ring_entries = count_;
+		reg.bgid = groupId_;
+
+		if (syscall(__NR_io_uring_register, mRingFd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+		{
+			printf("[] IORING_REGISTER_PBUF_RING  : %d\n", errno);
+			return false;
+		}
+
+		mRecvBuffers.resize((size_t)count_ * bufferSize_);
+
+		mRecvBufTail = 0;
+		for (UINT32 i = 0; i < count_; ++i)
+		{
+			AddRecvBuffer((UINT16)i);
+		}
+		__atomic_store_n(mpRecvBufRingTail, mRecvBufTail, __ATOMIC_RELEASE);
+
+		return true;
+	}
+
+	UINT16 GetRecvBufferGroupId() { return mRecvBufGroupId; }
+
+	char* GetRecvBuffer(const UINT16 bufferId_)
+	{
+		return &mRecvBuffers[(size_t)bufferId_ * mRecvBufSize];
+	}
+
+	//   ۸ Ŀο ش. CQ д Ŀ 忡 ȣѴ.
+	void RecycleRecvBuffer(const UINT16 bufferId_)
+	{
+		AddRecvBuffer(bufferId_);
+		__atomic_store_n(mpRecvBufRingTail, mRecvBufTail, __ATOMIC_RELEASE);
+	}
+
+	//prepare_(sqe) sqe ϳ ä  ť ִ´.
+	//submitNow_ false̸ Ŀ  SubmitAndWait() Ѳ ȴ.
+	template <typename PrepareFunc>
+	bool Push(PrepareFunc&& prepare_, const bool submitNow_)
+	{
+		std::lock_guard<std::mutex> guard(mSqLock);
+
+		//SQ  á  ؼ ڸ .
+		if (mSqLocalTail - __atomic_load_n(mpSqHead, __ATOMIC_ACQUIRE) >= mSqEntries)
+		{
+			if (Enter(GetUnsubmittedCount(), 0, 0) < 0)
+			{
+				return false;
+			}
+		}
+
+		auto pSqe = &mpSqes[mSqLocalTail & mSqMask];
+		memset(pSqe, 0, sizeof(io_uring_sqe));
+		prepare_(pSqe);
+
+		++mSqLocalTail;
+		__atomic_store_n(mpSqTail, mSqLocalTail, __ATOMIC_RELEASE);
+
+		if (submitNow_)
+		{
+			return Enter(GetUnsubmittedCount(), 0, 0) >= 0;
+		}
+
+		return true;
+	}
+
+	// sqe ϰ Ϸᰡ ϳ ̻   ٸ. ý  1ȸ
+	bool SubmitAndWait()
+	{
+		UINT32 toSubmit = 0;
+		{
+			std::lock_guard<std::mutex> guard(mSqLock);
+			toSubmit = GetUnsubmittedCount();
+		}
+
+		return Enter(toSubmit, 1, IORING_ENTER_GETEVENTS) >= 0 || errno == EINTR;
+	}
+
+	//׿ִ Ϸ 뺸  óѴ.
+	template <typename CompletionFunc>
+	UINT32 ForEachCompletion(CompletionFunc&& process_)
+	{
+		UINT32 count = 0;
+		auto head = *mpCqHead;
+
+		while (true)
+		{
+			auto tail = __atomic_load_n(mpCqTail, __ATOMIC_ACQUIRE);
+			if (head == tail)
+			{
+				break;
+			}
+
+			for (; head != tail; ++head, ++count)
+			{
+				process_(&mpCqes[head & mCqMask]);
+			}
+
+			__atomic_store_n(mpCqHead, head, __ATOMIC_RELEASE);
+		}
+
+		return count;
+	}
+
+
+private:
+	//mSqLock  ¿ ȣѴ.
+	UINT32 GetUnsubmittedCount()
+	{
+		return mSqLocalTail - __atomic_load_n(mpSqHead, __ATOMIC_ACQUIRE);
+	}
+
+	int Enter(const UINT32 toSubmit_, const UINT32 minComplete_, const UINT32 flags_)
+	{
+		if (toSubmit_ == 0 && minComplete_ == 0)
+		{
+			return 0;
+		}
+
+		if (mpIOStat != nullptr)
+		{
+			++mpIOStat->SyscallCount;
+		}
+
+		auto ret = (int)syscall(__NR_io_uring_enter, mRingFd, toSubmit_, minComplete_, flags_, nullptr, 0);
+		if (ret < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+		{
+			printf("[] io_uring_enter()Լ  : %d\n", errno);
+		}
+
+		return ret;
+	}
+
+	void AddRecvBuffer(const UINT16 bufferId_)
+	{
+		auto pBuf = &mpRecvBufRing[mRecvBufTail & (mRecvBufCount - 1)];
+		pBuf->addr = (UINT64)GetRecvBuffer(bufferId_);
+		pBuf->len = mRecvBufSize;
+		pBuf->bid = bufferId_;
+		++mRecvBufTail;
+	}
+
+
+	int mRingFd = -1;
+
+	stIOStat* mpIOStat = nullptr;
+
+	char* mpRingMem = nullptr;
+	size_t mRingSize = 0;
+
+	io_uring_sqe* mpSqes = nullptr;
+	size_t mSqesSize = 0;
+
+	//SQ :  尡 ä.
+	std::mutex mSqLock;
+	UINT32* mpSqHead = nullptr;
+	UINT32* mpSqTail = nullptr;
+	UINT32 mSqMask = 0;
+	UINT32 mSqEntries = 0;
+	UINT32 mSqLocalTail = 0;
+
+	//CQ : Ŀ  ϳ д´.
+	UINT32* mpCqHead = nullptr;
+	UINT32* mpCqTail = nullptr;
+	UINT32 mCqMask = 0;
+	io_uring_cqe* mpCqes = nullptr;
+
+	//provided buffer ring
+	io_uring_buf* mpRecvBufRing = nullptr;
+	UINT16* mpRecvBufRingTail = nullptr;
+	size_t mRecvBufRingSize = 0;
+	UINT16 mRecvBufGroupId = 0;
+	UINT32 mRecvBufCount = 0;
+	UINT32 mRecvBufSize = 0;
+	UINT16 mRecvBufTail = 0;
+	std::vector<char> mRecvBuffers;
+};
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+// 忡  ڵ尡 ϴ Win32 Ÿ԰ Լ ش.
+//쿡 windows.h   Ѵ.
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <unistd.h>
+
+typedef int8_t				INT8;
+typedef int16_t				INT16;
+typedef int32_t				INT32;
+typedef long long			INT64;
+typedef uint8_t				UINT8;
+typedef uint16_t			UINT16;
+typedef uint32_t			UINT32;
+typedef unsigned long long	UINT64;
+typedef unsigned int		UINT;
+typedef uint32_t			DWORD;
+typedef int					BOOL;
+
+#ifndef TRUE
+#define TRUE 1
+#define FALSE 0
+#endif
+
+typedef int SOCKET;
+const SOCKET INVALID_SOCKET = -1;
+const int SOCKET_ERROR = -1;
+
+#define CopyMemory(dst, src, len) memcpy((dst), (src), (len))
+#define ZeroMemory(dst, len) memset((dst), 0, (len))
+#define UNREFERENCED_PARAMETER(p) ((void)(p))
+#define printf_s printf
+
+inline int closesocket(SOCKET socket_) { return close(socket_); }
+
+//strsafe.h StringCbCopyA ü. ġ ߶ Ѵ.
+inline int StringCbCopyA(char* pDest_, size_t destSize_, const char* pSrc_)
+{
+	if (destSize_ == 0)
+	{
+		return -1;
+	}
+
+	snprintf(pDest_, destSize_, "%s", pSrc_);
+	return 0;
+}
+
+template <size_t N>
+inline int strncpy_s(char(&dest_)[N], const char* pSrc_, size_t count_)
+{
+	auto len = strnlen(pSrc_, count_);
+	if (len >= N)
+	{
+		len = N - 1;
+	}
+
+	memcpy(dest_, pSrc_, len);
+	dest_[len] = '\0';
+	return 0;
+}
+
+inline int fopen_s(FILE** ppFile_, const char* pPath_, const char* pMode_)
+{
+	*ppFile_ = fopen(pPath_, pMode_);
+	return (*ppFile_ == nullptr) ? errno : 0;
+}
\ No newline at end of file
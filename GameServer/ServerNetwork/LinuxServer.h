@@ -0,0 +1,183 @@
+#pragma once
+
+#include "EpollServer.h"
+#include "UringServer.h"
+#include "SessionHeartbeat.h"
+#include <memory>
+#include <vector>
+
+enum class LinuxIOMode
+{
+	EPOLL,
+	IO_URING
+};
+
+// IOCPServer  ϴ Ŭ.   epoll io_uring  ϳ 鿣带  Ѵ.
+class LinuxServer
+{
+public:
+	LinuxServer(void) {}
+
+	virtual ~LinuxServer(void) {}
+
+	//Init()  ȣؾ Ѵ.
+	void SetIOMode(const LinuxIOMode ioMode_) { mIOMode = ioMode_; }
+
+	LinuxIOMode GetIOMode() { return mIOMode; }
+
+	//ù Ϳ Բ  ޴´. Init()  ȣؾ Ѵ. 0̸ .
+	void SetAcceptDataTimeout(const UINT32 timeoutSec_) { mAcceptDataTimeoutSec = timeoutSec_; }
+
+	//false̸ ۽  Ǯ  ۽Ÿ new/delete Ѵ. Init()  ȣؾ Ѵ.
+	void SetSendPool(const bool isEnabled_) { mIsSendPoolEnabled = isEnabled_; }
+
+	//pingIntervalSec_     ǿ  , timeoutSec_     ´. 0̸ .
+	//StartServer()  ȣؾ Ѵ.
+	void SetHeartbeat(const UINT32 pingIntervalSec_, const UINT32 timeoutSec_) { mHeartbeat.SetConfig(pingIntervalSec_ * 1000, timeoutSec_ * 1000); }
+
+	//I/O Ŀ 带  CPU .   ʴ´. Init()  ȣؾ Ѵ.
+	void SetIOThreadCpus(const std::vector<UINT32>& cpus_) { mIOThreadCpus = cpus_; }
+
+	// ʱȭϴ Լ
+	bool Init(const UINT32 maxIOWorkerThreadCount_)
+	{
+		if (mIOMode == LinuxIOMode::IO_URING && UringServer::IsSupported() == false)
+		{
+			printf("[˸] io_uring    epoll մϴ\n");
+			mIOMode = LinuxIOMode::EPOLL;
+		}
+
+		if (mIOMode == LinuxIOMode::IO_URING)
+		{
+			mpBackend = std::make_unique<Backend<UringServer>>(this);
+		}
+		else
+		{
+			mpBackend = std::make_unique<Backend<EpollServer>>(this);
+		}
+
+		mpBackend->SetAcceptDataTimeout(mAcceptDataTimeoutSec);
+		mpBackend->SetSendPool(mIsSendPoolEnabled);
+		mpBackend->SetIOThreadCpus(mIOThreadCpus);
+
+		return mpBackend->Init(maxIOWorkerThreadCount_);
+	}
+
+	bool BindandListen(int bindPort_) { return mpBackend->BindandListen(bindPort_); }
+
+	bool StartServer(const UINT32 maxClientCount_)
+	{
+		mHeartbeat.SendPingFunc = [this](UINT32 sessionId_, UINT64 pingTimeMs_) { OnPing(sessionId_, pingTimeMs_); };
+		mHeartbeat.CloseFunc = [this](UINT32 sessionId_) { mpBackend->Disconnect(sessionId_); };
+		mHeartbeat.Start(maxClientCount_);
+
+		return mpBackend->StartServer(maxClientCount_);
+	}
+
+	//ƮƮ ⸦ û ʵ  .
+	void DestroyThread()
+	{
+		mHeartbeat.Stop();
+		mpBackend->DestroyThread();
+	}
+
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData)
+	{
+		return mpBackend->SendMsg(sessionId_, dataSize_, pData);
+	}
+
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		return mpBackend->SendMsg(sessionId_, pBuffer_);
+	}
+
+	RecvRingBuffer* GetRecvRing(const UINT32 sessionId_) { return mpBackend->GetRecvRing(sessionId_); }
+
+	bool Disconnect(const UINT32 sessionId_) { return mpBackend->Disconnect(sessionId_); }
+
+	//Ŭ̾Ʈ   ð RTT . ȯ : ̹ RTT(ms).  ῡ   ƴϸ -1
+	INT32 ReportPong(const UINT32 sessionId_, const UINT64 pingTimeMs_) { return mHeartbeat.OnPong(sessionId_, pingTimeMs_); }
+
+	//  RTT ̵ (ms).     0
+	UINT32 GetSessionRtt(const UINT32 sessionId_) { return mHeartbeat.GetSmoothedRtt(sessionId_); }
+
+	virtual void OnConnect(const UINT32 /*sessionId_*/) {}
+
+	virtual void OnClose(const UINT32 /*sessionId_*/) {}
+
+	// ʹ GetRecvRing(sessionId_)   ִ.
+	virtual void OnReceive(const UINT32 /*sessionId_*/, const UINT32 /*size_*/) {}
+
+	//pingTimeMs_   Ŷ    . ƮƮ 忡 ȣȴ.
+	virtual void OnPing(const UINT32 /*sessionId_*/, const UINT64 /*pingTimeMs_*/) {}
+
+private:
+	class IBackend
+	{
+	public:
+		virtual ~IBackend() {}
+		virtual void SetAcceptDataTimeout(const UINT32 timeoutSec_) = 0;
+		virtual void SetSendPool(const bool isEnabled_) = 0;
+		virtual void SetIOThreadCpus(const std::vector<UINT32>& cpus_) = 0;
+		virtual bool Init(const UINT32 maxIOWorkerThreadCount_) = 0;
+		virtual bool BindandListen(int bindPort_) = 0;
+		virtual bool StartServer(const UINT32 maxClientCount_) = 0;
+		virtual void DestroyThread() = 0;
+		virtual bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData) = 0;
+		virtual bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_) = 0;
+		virtual RecvRingBuffer* GetRecvRing(const UINT32 sessionId_) = 0;
+		virtual bool Disconnect(const UINT32 sessionId_) = 0;
+	};
+
+	//鿣  뺸 LinuxServer(  GameServer) Ѱش.
+	template <typename ServerT>
+	class Backend : public ServerT, public IBackend
+	{
+	public:
+		Backend(LinuxServer* pOwner_) : mpOwner(pOwner_) {}
+
+		void SetAcceptDataTimeout(const UINT32 timeoutSec_) override { ServerT::SetAcceptDataTimeout(timeoutSec_); }
+		void SetSendPool(const bool isEnabled_) override { ServerT::SetSendPool(isEnabled_); }
+		void SetIOThreadCpus(const std::vector<UINT32>& cpus_) override { ServerT::SetIOThreadCpus(cpus_); }
+		bool Init(const UINT32 maxIOWorkerThreadCount_) override { return ServerT::Init(maxIOWorkerThreadCount_); }
+		bool BindandListen(int bindPort_) override { return ServerT::BindandListen(bindPort_); }
+		bool StartServer(const UINT32 maxClientCount_) override { return ServerT::StartServer(maxClientCount_); }
+		void DestroyThread() override { ServerT::DestroyThread(); }
+		bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData) override { return ServerT::SendMsg(sessionId_, dataSize_, pData); }
+		bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_) override { return ServerT::SendMsg(sessionId_, pBuffer_); }
+		RecvRingBuffer* GetRecvRing(const UINT32 sessionId_) override { return ServerT::GetRecvRing(sessionId_); }
+		bool Disconnect(const UINT32 sessionId_) override { return ServerT::Disconnect(sessionId_); }
+
+		// 鿣 뺸 ⼭ ƮƮ ˷ش.
+		void OnConnect(const UINT32 sessionId_) override
+		{
+			mpOwner->mHeartbeat.OnConnect(sessionId_);
+			mpOwner->OnConnect(sessionId_);
+		}
+
+		void OnClose(const UINT32 sessionId_) override
+		{
+			mpOwner->mHeartbeat.OnClose(sessionId_);
+			mpOwner->OnClose(sessionId_);
+		}
+
+		void OnReceive(const UINT32 sessionId_, const UINT32 size_) override
+		{
+			mpOwner->mHeartbeat.OnReceive(sessionId_);
+			mpOwner->OnReceive(sessionId_, size_);
+		}
+
+	private:
+		LinuxServer* mpOwner;
+	};
+
+	LinuxIOMode mIOMode = LinuxIOMode::EPOLL;
+	UINT32 mAcceptDataTimeoutSec = 0;
+	bool mIsSendPoolEnabled = true;
+	std::vector<UINT32> mIOThreadCpus;
+
+	//  ã RTT 
+	SessionHeartbeat mHeartbeat;
+
+	std::unique_ptr<IBackend> mpBackend;
+};
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "Define.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+
+// 尡 ְ  常   ũ ť.   ĭ  ξ ִ ڸ CAS  ´.
+// (ڸ  ) . T 縸 ű  ־ Ѵ.
+template<typename T>
+class MpscQueue
+{
+public:
+	//capacity_ 2 ŵ ø.
+	void Init(const UINT32 capacity_)
+	{
+		mCapacity = 1;
+		while (mCapacity < capacity_)
+		{
+			mCapacity <<= 1;
+		}
+		mMask = mCapacity - 1;
+
+		mCells.reset(new stCell[mCapacity]);
+		for (UINT32 i = 0; i < mCapacity; ++i)
+		{
+			mCells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		mTail.store(0, std::memory_order_relaxed);
+		mHead = 0;
+	}
+
+	//ȯ :  á false
+	bool TryPush(const T& value_)
+	{
+		auto pos = mTail.load(std::memory_order_relaxed);
+		while (true)
+		{
+			auto& cell = mCells[pos & mMask];
+			auto sequence = cell.Sequence.load(std::memory_order_acquire);
+			auto diff = (INT64)sequence - (INT64)pos;
+
+			if (diff == 0)
+			{
+				if (mTail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				{
+					cell.Value = value_;
+					cell.Sequence.store(pos + 1, std::memory_order_release);
+					return true;
+				}
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = mTail.load(std::memory_order_relaxed);
+			}
+		}
+	}
+
+	//   尡   纸ϸ ٸ.  尡    ȴ.
+	void Push(const T& value_)
+	{
+		if (TryPush(value_))
+		{
+			return;
+		}
+
+		mFullCount.fetch_add(1, std::memory_order_relaxed);
+		while (TryPush(value_) == false)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	// 常 ȣѴ. ڸ      ĭ  ̸   .
+	bool TryPop(T* pValue_)
+	{
+		auto& cell = mCells[mHead & mMask];
+		if (cell.Sequence.load(std::memory_order_acquire) != mHead + 1)
+		{
+			return false;
+		}
+
+		*pValue_ = cell.Value;
+		cell.Sequence.store(mHead + mCapacity, std::memory_order_release);
+		++mHead;
+		return true;
+	}
+
+	// 常 ȣѴ.
+	bool IsEmpty() const
+	{
+		return mCells[mHead & mMask].Sequence.load(std::memory_order_acquire) != mHead + 1;
+	}
+
+	//ť   ִ 尡 ٸ Ƚ
+	UINT64 GetFullCount() const { return mFullCount.load(std::memory_order_relaxed); }
+
+private:
+	struct stCell
+	{
+		std::atomic<UINT64> Sequence{ 0 };
+		T Value;
+	};
+
+	std::unique_ptr<stCell[]> mCells;
+	UINT64 mCapacity = 0;
+	UINT64 mMask = 0;
+
+	alignas(64) std::atomic<UINT64> mTail{ 0 };	//ִ   ´.
+	alignas(64) UINT64 mHead = 0;				// 常 .
+	alignas(64) std::atomic<UINT64> mFullCount{ 0 };
+};
\ No newline at end of file
@@ -0,0 +1,357 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+//Ŷ ó ܰ. Ŷ ID ܰ躰    .
+enum class PACKET_LATENCY_STAGE : UINT8
+{
+	QUEUE,		//I/O 尡 ޾Ƽ ť    尡  
+	HANDLER,	//  Ŷ ó Լ
+	SEND,		//SendMsg() ۽ ť   Ͽ   
+	COUNT
+};
+
+const char* const PACKET_LATENCY_STAGE_NAMES[(int)PACKET_LATENCY_STAGE::COUNT] = { "queue", "handler", "send" };
+
+const UINT32 PACKET_LATENCY_ID_COUNT = 1024;	//  Ŷ ID 
+
+//  . 2 ŵ  16ĭ    6% ̴. (HDR ׷  )
+// 尡   Add() ϰ, д   ߳    ִ.
+class PacketLatencyHistogram
+{
+public:
+	static const UINT32 SUB_BUCKET_BITS = 4;
+	static const UINT32 SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	static const UINT32 BUCKET_COUNT = SUB_BUCKET_COUNT * (64 - SUB_BUCKET_BITS + 1);
+
+	void Add(const UINT64 latencyNs_)
+	{
+		mBuckets[GetBucketIndex(latencyNs_)].fetch_add(1, std::memory_order_relaxed);
+		mSumNs.fetch_add(latencyNs_, std::memory_order_relaxed);
+
+		//ִ밪 幰 ٲǷ о Ŭ  ٲ۴.
+		auto maxNs = mMaxNs.load(std::memory_order_relaxed);
+		while (latencyNs_ > maxNs && mMaxNs.compare_exchange_weak(maxNs, latencyNs_, std::memory_order_relaxed) == false)
+		{
+		}
+	}
+
+	void Reset()
+	{
+		for (auto& bucket : mBuckets)
+		{
+			bucket.store(0, std::memory_order_relaxed);
+		}
+		mSumNs.store(0, std::memory_order_relaxed);
+		mMaxNs.store(0, std::memory_order_relaxed);
+	}
+
+	//д  ٲ ʰ ĭ  ΰ Ѵ.
+	struct stSnapshot
+	{
+		UINT64 Buckets[BUCKET_COUNT];
+		UINT64 Count = 0;
+		UINT64 SumNs = 0;
+		UINT64 MaxNs = 0;
+
+		//percent_ : 0 ~ 100.  ĭ  ū  ش.
+		UINT64 GetPercentileNs(const double percent_) const
+		{
+			if (Count == 0)
+			{
+				return 0;
+			}
+
+			auto rank = (UINT64)(percent_ / 100.0 * (double)Count + 0.5);
+			if (rank == 0)
+			{
+				rank = 1;
+			}
+
+			UINT64 count = 0;
+			for (UINT32 i = 0; i < BUCKET_COUNT; ++i)
+			{
+				count += Buckets[i];
+				if (count >= rank)
+				{
+					auto bucketMaxNs = GetBucketMaxNs(i);
+					return (bucketMaxNs < MaxNs) ? bucketMaxNs : MaxNs;
+				}
+			}
+			return MaxNs;
+		}
+	};
+
+	void GetSnapshot(stSnapshot* pSnapshot_) const
+	{
+		pSnapshot_->Count = 0;
+		for (UINT32 i = 0; i < BUCKET_COUNT; ++i)
+		{
+			pSnapshot_->Buckets[i] = mBuckets[i].load(std::memory_order_relaxed);
+			pSnapshot_->Count += pSnapshot_->Buckets[i];
+		}
+		pSnapshot_->SumNs = mSumNs.load(std::memory_order_relaxed);
+		pSnapshot_->MaxNs = mMaxNs.load(std::memory_order_relaxed);
+	}
+
+private:
+	static UINT32 GetTopBit(const UINT64 value_)
+	{
+#ifdef _MSC_VER
+		unsigned long topBit = 0;
+		if (_BitScanReverse(&topBit, (unsigned long)(value_ >> 32)))
+		{
+			return (UINT32)topBit + 32;
+		}
+		_BitScanReverse(&topBit, (unsigned long)value_);
+		return (UINT32)topBit;
+#else
+		return 63 - (UINT32)__builtin_clzll(value_);
+#endif
+	}
+
+	//16 ̸  ״,   (ֻ Ʈ ġ,  4Ʈ) ĭ .
+	static UINT32 GetBucketIndex(const UINT64 valueNs_)
+	{
+		if (valueNs_ < SUB_BUCKET_COUNT)
+		{
+			return (UINT32)valueNs_;
+		}
+
+		auto shift = GetTopBit(valueNs_) - SUB_BUCKET_BITS;
+		auto subIndex = (UINT32)(valueNs_ >> shift) & (SUB_BUCKET_COUNT - 1);
+		return SUB_BUCKET_COUNT + shift * SUB_BUCKET_COUNT + subIndex;
+	}
+
+	static UINT64 GetBucketMaxNs(const UINT32 index_)
+	{
+		if (index_ < SUB_BUCKET_COUNT)
+		{
+			return index_;
+		}
+
+		auto shift = (index_ - SUB_BUCKET_COUNT) / SUB_BUCKET_COUNT;
+		auto subIndex = (index_ - SUB_BUCKET_COUNT) % SUB_BUCKET_COUNT;
+		return ((UINT64)(SUB_BUCKET_COUNT + subIndex + 1) << shift) - 1;
+	}
+
+	std::atomic<UINT64> mBuckets[BUCKET_COUNT] = {};
+	std::atomic<UINT64> mSumNs{ 0 };
+	std::atomic<UINT64> mMaxNs{ 0 };
+};
+
+
+//Ŷ ID ܰ  . I/O 忡  ,  尡  , ó Լ յ, SendMsg() ۽ Ϸῡ ð ´.
+// ó  Ŷ ID  CAS ̹Ƿ Ͽ  . ܼ(latency) ֱ   .
+class PacketLatencyMonitor
+{
+public:
+	//I/O,  尡    Ƿ Ϻη ı ʴ´.
+	static PacketLatencyMonitor& Instance()
+	{
+		static PacketLatencyMonitor* pInstance = new PacketLatencyMonitor;
+		return *pInstance;
+	}
+
+	static UINT64 GetNowNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void SetEnable(const bool isEnable_) { mIsEnable.store(isEnable_, std::memory_order_relaxed); }
+
+	//  ð  ʰ 0 ش. 0  Ŷ  ʴ´.
+	UINT64 Stamp() const
+	{
+		return mIsEnable.load(std::memory_order_relaxed) ? GetNowNs() : 0;
+	}
+
+	//beginNs_  ݱ Ѵ.
+	void AddSince(const PACKET_LATENCY_STAGE stage_, const UINT16 packetId_, const UINT64 beginNs_)
+	{
+		if (beginNs_ == 0 || packetId_ >= PACKET_LATENCY_ID_COUNT)
+		{
+			return;
+		}
+
+		auto nowNs = GetNowNs();
+		GetEntry(packetId_)->Stages[(int)stage_].Add((nowNs > beginNs_) ? nowNs - beginNs_ : 0);
+	}
+
+	//۽ ʹ Ŷ ϳ̰ տ Ŷ ( UINT16, ID UINT16) ִ.
+	void AddSend(const char* pPacket_, const UINT32 dataSize_, const UINT64 enqueueNs_)
+	{
+		if (dataSize_ < sizeof(UINT16) * 2)
+		{
+			return;
+		}
+
+		UINT16 packetId = 0;
+		CopyMemory(&packetId, pPacket_ + sizeof(UINT16), sizeof(UINT16));
+		AddSince(PACKET_LATENCY_STAGE::SEND, packetId, enqueueNs_);
+	}
+
+	void Reset()
+	{
+		for (auto& entry : mEntries)
+		{
+			auto pEntry = entry.load(std::memory_order_acquire);
+			if (pEntry == nullptr)
+			{
+				continue;
+			}
+
+			for (auto& stage : pEntry->Stages)
+			{
+				stage.Reset();
+			}
+		}
+	}
+
+	//ũ   ִ Ŷ ID ܰ踸 Ѵ.  (Ǵ Reset())   ̴.
+	void Print(FILE* pFile_)
+	{
+		std::lock_guard<std::mutex> guard(mPrintLock);
+
+		for (UINT32 packetId = 0; packetId < PACKET_LATENCY_ID_COUNT; ++packetId)
+		{
+			auto pEntry = mEntries[packetId].load(std::memory_order_acquire);
+			if (pEntry == nullptr)
+			{
+				continue;
+			}
+
+			for (int stage = 0; stage < (int)PACKET_LATENCY_STAGE::COUNT; ++stage)
+			{
+				pEntry->Stages[stage].GetSnapshot(&mSnapshot);
+				if (mSnapshot.Count == 0)
+				{
+					continue;
+				}
+
+				fprintf(pFile_, "[Ŷ ] id(%4u) %-7s : count(%llu) avg(%.1fus) p50(%.1fus) p90(%.1fus) p99(%.1fus) p99.9(%.1fus) max(%.1fus)\n",
+					packetId, PACKET_LATENCY_STAGE_NAMES[stage], mSnapshot.Count,
+					(double)mSnapshot.SumNs / (double)mSnapshot.Count / 1000.0,
+					mSnapshot.GetPercentileNs(50) / 1000.0, mSnapshot.GetPercentileNs(90) / 1000.0,
+					mSnapshot.GetPercentileNs(99) / 1000.0, mSnapshot.GetPercentileNs(99.9) / 1000.0,
+					mSnapshot.MaxNs / 1000.0);
+			}
+		}
+	}
+
+	//intervalSec_  pFilePath_    δ. 0̸  ʴ´.
+	void Start(const UINT32 intervalSec_, const std::string& filePath_)
+	{
+		if (intervalSec_ == 0 || mIsRun)
+		{
+			return;
+		}
+
+		mIntervalSec = intervalSec_;
+		mFilePath = filePath_;
+		mIsRun = true;
+		mReportThread = std::thread([this]() { ReportThread(); });
+	}
+
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			mIsRun = false;
+		}
+		mReportCondition.notify_all();
+
+		if (mReportThread.joinable())
+		{
+			mReportThread.join();
+		}
+	}
+
+private:
+	struct stPacketLatency
+	{
+		PacketLatencyHistogram Stages[(int)PACKET_LATENCY_STAGE::COUNT];
+	};
+
+	PacketLatencyMonitor() = default;
+
+	//ó  Ŷ ID   δ. ÿ      ڱ  .
+	stPacketLatency* GetEntry(const UINT16 packetId_)
+	{
+		auto pEntry = mEntries[packetId_].load(std::memory_order_acquire);
+		if (pEntry != nullptr)
+		{
+			return pEntry;
+		}
+
+		auto pNewEntry = new stPacketLatency;
+		if (mEntries[packetId_].compare_exchange_strong(pEntry, pNewEntry, std::memory_order_acq_rel) == false)
+		{
+			delete pNewEntry;
+			return pEntry;
+		}
+
+		return pNewEntry;
+	}
+
+	void ReportThread()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mLock);
+				mReportCondition.wait_for(lock, std::chrono::seconds(mIntervalSec), [this]() { return mIsRun == false; });
+				if (mIsRun == false)
+				{
+					return;
+				}
+			}
+
+			FILE* pFile = nullptr;
+			if (fopen_s(&pFile, mFilePath.c_str(), "a") != 0 || pFile == nullptr)
+			{
+				printf("[] Ŷ      : %s\n", mFilePath.c_str());
+				continue;
+			}
+
+			char timeText[32] = { 0, };
+			auto now = time(nullptr);
+			tm localTime;
+#ifdef _WIN32
+			localtime_s(&localTime, &now);
+#else
+			localtime_r(&now, &localTime);
+#endif
+			strftime(timeText, sizeof(timeText), "%Y-%m-%d %H:%M:%S", &localTime);
+			fprintf(pFile, "[Ŷ ] ===== %s =====\n", timeText);
+			Print(pFile);
+			fclose(pFile);
+		}
+	}
+
+	std::atomic<bool> mIsEnable{ false };
+	std::atomic<stPacketLatency*> mEntries[PACKET_LATENCY_ID_COUNT] = {};
+
+	std::mutex mPrintLock;
+	PacketLatencyHistogram::stSnapshot mSnapshot;	//Print() . ÿ α⿡ ũ.
+
+	std::mutex mLock;
+	std::string mFilePath;
+	UINT32 mIntervalSec = 0;
+	bool mIsRun = false;
+	std::condition_variable mReportCondition;
+	std::thread mReportThread;
+};
\ No newline at end of file
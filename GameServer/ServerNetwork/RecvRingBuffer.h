@@ -0,0 +1,183 @@
+#pragma once
+
+#include "Define.h"
+#include <atomic>
+
+
+// ϳ   .   ۿ ٷ ް,  尡 Ŷ  д´.
+//  I/O  ϳ, б   ϳ Ѵ. (SPSC,  )
+//ġ  ϴ ̰  ġ ũ     簡 .
+class RecvRingBuffer
+{
+	static_assert((RECV_RING_BUFFER_SIZE & (RECV_RING_BUFFER_SIZE - 1)) == 0, "RECV_RING_BUFFER_SIZE 2 ŵ̾ Ѵ");
+
+public:
+	//    ù   I/O 忡 ȣѴ.
+	// ٷ ǹǷ  尡 д   ִ б ġ ǵ帮 ʰ,   ϴ ġ .
+	void MarkSessionStart()
+	{
+		mScanPos = mWritePos.load(std::memory_order_relaxed);
+		mSessionStartPos.store(mScanPos, std::memory_order_release);
+	}
+
+	// 尡   ó   ȣѴ. ִ   ͸ ǳʶڴ.
+	void SkipToSessionStart()
+	{
+		auto sessionStartPos = mSessionStartPos.load(std::memory_order_acquire);
+		auto readPos = mReadPos.load(std::memory_order_relaxed);
+
+		//   翬Ǿ ̹  ġ ̸ ״ д.
+		if ((INT32)(sessionStartPos - readPos) > 0)
+		{
+			mReadPos.store(sessionStartPos, std::memory_order_release);
+		}
+	}
+
+	// ----  (I/O ) ----
+
+	//ִ  ִ 2( ,  ó) ش.
+	//ȯ :  . 0̸   ̴.
+	UINT32 GetWriteSpans(char* pSpans_[2], UINT32 spanSizes_[2])
+	{
+		auto writePos = mWritePos.load(std::memory_order_relaxed);
+		auto freeSize = RECV_RING_BUFFER_SIZE - (writePos - mReadPos.load(std::memory_order_acquire));
+		if (freeSize == 0)
+		{
+			return 0;
+		}
+
+		auto offset = writePos & RING_MASK;
+		auto firstSize = RECV_RING_BUFFER_SIZE - offset;
+
+		pSpans_[0] = &mBuffer[offset];
+		if (freeSize <= firstSize)
+		{
+			spanSizes_[0] = freeSize;
+			return 1;
+		}
+
+		spanSizes_[0] = firstSize;
+		pSpans_[1] = &mBuffer[0];
+		spanSizes_[1] = freeSize - firstSize;
+		return 2;
+	}
+
+	//GetWriteSpans()   size_ ŭ ޾Ҵ.
+	void CommitWrite(const UINT32 size_)
+	{
+		mWritePos.store(mWritePos.load(std::memory_order_relaxed) + size_, std::memory_order_release);
+	}
+
+	//ٸ ۿ  ͸  ִ´.  ڶ ƹ͵  ʰ false
+	bool Write(const char* pData_, const UINT32 size_)
+	{
+		char* pSpans[2];
+		UINT32 spanSizes[2] = { 0, 0 };
+		auto spanCount = GetWriteSpans(pSpans, spanSizes);
+		if (spanCount == 0 || spanSizes[0] + spanSizes[1] < size_)
+		{
+			return false;
+		}
+
+		auto firstSize = (size_ < spanSizes[0]) ? size_ : spanSizes[0];
+		CopyMemory(pSpans[0], pData_, firstSize);
+		if (firstSize < size_)
+		{
+			CopyMemory(pSpans[1], pData_ + firstSize, size_ - firstSize);
+		}
+
+		CommitWrite(size_);
+		return true;
+	}
+
+	// ---- Ŷ  (I/O ) ----
+	//I/O 尡  ͸  忡 ˸  Ŷ  Ⱦ. ˻ ġ I/O 常 .
+	//  ˸  Ŷ Ƿ ˻ ġ  ʹ   ʴ´.
+
+	UINT32 GetUnscannedSize()
+	{
+		return mWritePos.load(std::memory_order_relaxed) - mScanPos;
+	}
+
+	void PeekUnscanned(char* pDest_, const UINT32 size_)
+	{
+		CopyOut(mScanPos, pDest_, size_);
+	}
+
+	//˻ ġ ͸ ٲ .  忡 ˸  ȣؾ Ѵ.
+	void OverwriteUnscanned(const char* pSrc_, const UINT32 size_)
+	{
+		auto offset = mScanPos & RING_MASK;
+		auto firstSize = RECV_RING_BUFFER_SIZE - offset;
+		if (size_ <= firstSize)
+		{
+			CopyMemory(&mBuffer[offset], pSrc_, size_);
+			return;
+		}
+
+		CopyMemory(&mBuffer[offset], pSrc_, firstSize);
+		CopyMemory(&mBuffer[0], pSrc_ + firstSize, size_ - firstSize);
+	}
+
+	void CommitScan(const UINT32 size_)
+	{
+		mScanPos += size_;
+	}
+
+	// ---- б ( ) ----
+
+	UINT32 GetReadableSize()
+	{
+		return mWritePos.load(std::memory_order_acquire) - mReadPos.load(std::memory_order_relaxed);
+	}
+
+	//б ġ size_ ŭ   ġ   ġ, ġ nullptr ش.
+	char* GetContiguousData(const UINT32 size_)
+	{
+		auto offset = mReadPos.load(std::memory_order_relaxed) & RING_MASK;
+		if (offset + size_ > RECV_RING_BUFFER_SIZE)
+		{
+			return nullptr;
+		}
+
+		return &mBuffer[offset];
+	}
+
+	//б ġ ű ʰ size_ ŭ Ѵ.   ġ ι  Ѵ.
+	void Peek(char* pDest_, const UINT32 size_)
+	{
+		CopyOut(mReadPos.load(std::memory_order_relaxed), pDest_, size_);
+	}
+
+	//ó  size_ ŭ  I/O 忡 ش.
+	void CommitRead(const UINT32 size_)
+	{
+		mReadPos.store(mReadPos.load(std::memory_order_relaxed) + size_, std::memory_order_release);
+	}
+
+
+private:
+	static const UINT32 RING_MASK = RECV_RING_BUFFER_SIZE - 1;
+
+	void CopyOut(const UINT32 pos_, char* pDest_, const UINT32 size_)
+	{
+		auto offset = pos_ & RING_MASK;
+		auto firstSize = RECV_RING_BUFFER_SIZE - offset;
+		if (size_ <= firstSize)
+		{
+			CopyMemory(pDest_, &mBuffer[offset], size_);
+			return;
+		}
+
+		CopyMemory(pDest_, &mBuffer[offset], firstSize);
+		CopyMemory(pDest_ + firstSize, &mBuffer[0], size_ - firstSize);
+	}
+
+	// 尡   ġ ĳ   д.
+	alignas(64) std::atomic<UINT32> mWritePos{ 0 };
+	UINT32 mScanPos = 0;
+	alignas(64) std::atomic<UINT32> mReadPos{ 0 };
+	std::atomic<UINT32> mSessionStartPos{ 0 };
+
+	char mBuffer[RECV_RING_BUFFER_SIZE];
+};
\ No newline at end of file
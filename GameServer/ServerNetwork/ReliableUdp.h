@@ -0,0 +1,814 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <algorithm>
+
+
+//Ʈ Ŷ ϴ 
+enum class RUDP_DELIVERY : UINT8
+{
+	UNRELIABLE_SEQUENCED,	// ʴ´. ̹  ͺ  Ŷ .
+	RELIABLE_UNORDERED,		// Ѵ. ޴  Ѵ.
+	RELIABLE_ORDERED,		// Ѵ.   Ѵ. ׸Ʈ ū Ŷ  .
+};
+
+const UINT32 RUDP_MAX_STREAM_COUNT = 8;
+const UINT32 RUDP_MAX_DATAGRAM_SIZE = 512;	// UdpChannel   ִ ũ .
+const UINT32 RUDP_WINDOW_SIZE = 32;			// Ʈ Ȯ  ٸ  ִ ׸Ʈ . ack Ʈ  .
+const UINT32 RUDP_TICK_MS = 5;				// , Ȯ , ۽   Ȯϴ 
+const UINT32 RUDP_INITIAL_RTO_MS = 200;
+const UINT32 RUDP_MIN_RTO_MS = 30;
+const UINT32 RUDP_MAX_RTO_MS = 2000;
+const UINT32 RUDP_MAX_RETRANSMIT = 10;		//  ׸Ʈ ̸ŭ ص Ȯ    ´.
+const UINT32 RUDP_FAST_RETRANSMIT_COUNT = 3;	//  ׸Ʈ ̸ŭ ȮεǴ   ׸Ʈ ð ٸ ʰ Ѵ.
+const UINT32 RUDP_INITIAL_CWND = 4;			// ȥ (׸Ʈ )
+const UINT32 RUDP_MIN_CWND = 2;
+const UINT32 RUDP_MAX_CWND = 256;
+const UINT32 RUDP_MAX_PENDING_COUNT = 1024;	//  ϰ  ׸Ʈ ̺   ´.
+const UINT32 RUDP_MAX_PACKET_SIZE = 64 * 1024;	//   Ŷ ģ ִ ũ
+
+const UINT8 RUDP_FLAG_DATA = 0x01;
+const UINT8 RUDP_FLAG_ACK = 0x02;
+const UINT8 RUDP_FLAG_MORE_FRAGMENTS = 0x04;	// ڿ  Ŷ  ̾.
+
+#pragma pack(push,1)
+//UDP Ŷ ϳ ׸Ʈ ϳ ´.
+// 5Ʈ  Ŷ   ڸ(, Ŷ ID, Type). UdpChannel ̸ ,   Ŷ ID ׸Ʈ ȴ.
+struct stRudpHeader
+{
+	UINT16 DatagramLength;
+	UINT16 SegmentPacketId;
+	UINT8 Type;
+	UINT8 Stream;
+	UINT8 Flags;
+	UINT16 Seq;			//DATA : Ʈ  
+	UINT16 AckSeq;		//ACK :   .    ޾Ҵ.
+	UINT32 AckBits;		//ACK : AckSeq + 1  32  ( Ȯ )
+};
+#pragma pack(pop)
+
+const UINT32 RUDP_HEADER_SIZE = sizeof(stRudpHeader);
+const UINT32 RUDP_MAX_PAYLOAD_SIZE = RUDP_MAX_DATAGRAM_SIZE - RUDP_HEADER_SIZE;
+
+
+//UdpChannel  ŷڼ UDP.
+//Ǹ   Ʈ ϳ UDP ּҷ ְ޴´. Ʈ   ζ  Ʈ ս ٸ Ʈ  ʴ´.
+//Ȯ    + Ʈ( Ȯ)̰,  ׸Ʈ  ȮεǸ  ׸Ʈ  Ѵ.
+//ŷڼ Ʈ ۽   ȥ (AIMD) ϰ, 츦 RTT   ƽ ۽ŷ Ѵ.
+class ReliableUdp
+{
+public:
+	//SendDatagramFunc( ID, ũ, ) : ǿ  UDP ּҷ .
+	std::function<bool(UINT32, UINT32, char*)> SendDatagramFunc;
+
+	//DeliverFunc( ID, Ʈ, ũ, Ŷ) :  Ŷ Ѵ. ׸Ʈ  忡 ȣȴ.
+	std::function<void(UINT32, UINT8, UINT32, char*)> DeliverFunc;
+
+	//CloseFunc( ID) :   ص Ȯ  ų ۽ ʹ и  ´. Ÿ̸ 忡 ȣȴ.
+	std::function<void(UINT32)> CloseFunc;
+
+	//streams_ : Ʈ ȣ  
+	void Init(const UINT32 maxSessionCount_, const UINT16 segmentPacketId_, const std::vector<RUDP_DELIVERY>& streams_)
+	{
+		mMaxSessionCount = maxSessionCount_;
+		mSegmentPacketId = segmentPacketId_;
+		mStreamCount = (std::min)((UINT32)streams_.size(), RUDP_MAX_STREAM_COUNT);
+		for (UINT32 i = 0; i < mStreamCount; ++i)
+		{
+			mDeliveries[i] = streams_[i];
+		}
+
+		mConnections.reset(new stRudpConnection[maxSessionCount_]);
+	}
+
+	void Start()
+	{
+		mIsRun = true;
+		mTimerThread = std::thread([this]() { TimerThread(); });
+	}
+
+	void Stop()
+	{
+		mIsRun = false;
+
+		if (mTimerThread.joinable())
+		{
+			mTimerThread.join();
+		}
+	}
+
+	// UDP ּҰ ̸ . ̹   ״ д( û ).
+	void Open(const UINT32 sessionId_)
+	{
+		auto pConnection = GetConnection(sessionId_);
+		if (pConnection == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(pConnection->Lock);
+		if (pConnection->SessionId.load(std::memory_order_relaxed) == sessionId_)
+		{
+			return;
+		}
+
+		pConnection->Reset(mStreamCount);
+		pConnection->SessionId.store(sessionId_, std::memory_order_release);
+	}
+
+	void Close(const UINT32 sessionId_)
+	{
+		auto pConnection = GetConnection(sessionId_);
+		if (pConnection == nullptr)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(pConnection->Lock);
+		if (pConnection->SessionId.load(std::memory_order_relaxed) != sessionId_)
+		{
+			return;
+		}
+
+		pConnection->Reset(0);
+		pConnection->SessionId.store(0, std::memory_order_release);
+	}
+
+	bool IsOpen(const UINT32 sessionId_)
+	{
+		auto pConnection = GetConnection(sessionId_);
+		return pConnection != nullptr && pConnection->SessionId.load(std::memory_order_acquire) == sessionId_;
+	}
+
+	//Ŷ ϳ Ʈ .  忡 ȣ  ִ.
+	//ȯ :   ̰ų     Ʈ ׸Ʈ ū Ŷ̸ false. ȣ  TCP  ȴ.
+	bool Send(const UINT32 sessionId_, const UINT8 stream_, const UINT32 dataSize_, const char* pData_)
+	{
+		auto pConnection = GetConnection(sessionId_);
+		if (pConnection == nullptr || stream_ >= mStreamCount)
+		{
+			return false;
+		}
+
+		auto delivery = mDeliveries[stream_];
+		if (dataSize_ > RUDP_MAX_PAYLOAD_SIZE && delivery != RUDP_DELIVERY::RELIABLE_ORDERED)
+		{
+			return false;
+		}
+
+		std::lock_guard<std::mutex> guard(pConnection->Lock);
+		if (pConnection->SessionId.load(std::memory_order_relaxed) != sessionId_)
+		{
+			return false;
+		}
+
+		auto& stream = pConnection->Streams[stream_];
+
+		// ٿ ٷ .   Ŷ Ѵ.
+		if (delivery == RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+		{
+			char datagram[RUDP_MAX_DATAGRAM_SIZE];
+			auto datagramSize = BuildDatagram(datagram, stream_, RUDP_FLAG_DATA, stream.NextSeq++, pData_, dataSize_);
+			SendDatagram(*pConnection, datagramSize, datagram);
+			return true;
+		}
+
+		if (stream.Pending.size() + (dataSize_ / RUDP_MAX_PAYLOAD_SIZE + 1) > RUDP_MAX_PENDING_COUNT)
+		{
+			pConnection->IsFailed = true;
+			return true;
+		}
+
+		// ׸Ʈ ϳ.   ƴϸ MORE_FRAGMENTS δ.
+		UINT32 offset = 0;
+		do
+		{
+			auto fragmentSize = (std::min)(dataSize_ - offset, RUDP_MAX_PAYLOAD_SIZE);
+			auto isLast = (offset + fragmentSize == dataSize_);
+
+			stPendingSegment segment;
+			segment.Flags = isLast ? 0 : RUDP_FLAG_MORE_FRAGMENTS;
+			segment.Data.assign(pData_ + offset, pData_ + offset + fragmentSize);
+			stream.Pending.push_back(std::move(segment));
+
+			offset += fragmentSize;
+		} while (offset < dataSize_);
+
+		FlushPending(*pConnection, GetNowMs());
+		return true;
+	}
+
+	//׸Ʈ ޴´. UdpChannel  忡 ǿ  ּҿ  ͸ ѱ.
+	void OnReceive(const UINT32 sessionId_, const UINT32 size_, char* pData_)
+	{
+		auto pConnection = GetConnection(sessionId_);
+		if (pConnection == nullptr || size_ < RUDP_HEADER_SIZE)
+		{
+			return;
+		}
+
+		auto pHeader = (stRudpHeader*)pData_;
+		if (pHeader->Stream >= mStreamCount)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(pConnection->Lock);
+		if (pConnection->SessionId.load(std::memory_order_relaxed) != sessionId_)
+		{
+			return;
+		}
+
+		auto nowMs = GetNowMs();
+
+		if (pHeader->Flags & RUDP_FLAG_ACK)
+		{
+			ProcessAck(*pConnection, pHeader->Stream, pHeader->AckSeq, pHeader->AckBits, nowMs);
+		}
+
+		if (pHeader->Flags & RUDP_FLAG_DATA)
+		{
+			ProcessData(*pConnection, sessionId_, pHeader, pData_ + RUDP_HEADER_SIZE, size_ - RUDP_HEADER_SIZE);
+		}
+
+		//Ȯ  찡  ̾ .
+		FlushPending(*pConnection, nowMs);
+	}
+
+	void Print()
+	{
+		printf("[RUDP] sent(%llu) retransmit timeout(%llu) fast(%llu) acks(%llu) delivered(%llu) duplicate(%llu) stale(%llu) closed(%llu)\n",
+			mSentCount.load(), mTimeoutRetransmitCount.load(), mFastRetransmitCount.load(), mAckSentCount.load(),
+			mDeliveredCount.load(), mDuplicateCount.load(), mStaleCount.load(), mClosedCount.load());
+	}
+
+
+private:
+	struct stPendingSegment
+	{
+		UINT8 Flags = 0;
+		std::vector<char> Data;
+	};
+
+	//Ȯ  ٸ ׸Ʈ. ϼ UDP Ŷ ״  ִٰ Ѵ.
+	struct stInflightSegment
+	{
+		bool IsAcked = false;
+		bool IsFastRetransmitted = false;
+		UINT32 RetransmitCount = 0;
+		UINT32 MissCount = 0;
+		UINT64 SentMs = 0;
+		UINT64 DeadlineMs = 0;
+		std::vector<char> Datagram;
+	};
+
+	struct stRudpStream
+	{
+		//۽
+		UINT16 NextSeq = 0;
+		UINT16 SendBase = 0;	//   Ȯ 
+		std::deque<stPendingSegment> Pending;
+		stInflightSegment Inflight[RUDP_WINDOW_SIZE];	//  % RUDP_WINDOW_SIZE
+
+		//
+		bool IsRecvStarted = false;	// UNRELIABLE_SEQUENCED : ù Ŷ ޾Ҵ.
+		UINT16 RecvExpected = 0;	// ŷڼ Ʈ :   . UNRELIABLE_SEQUENCED :   
+		UINT32 RecvMask = 0;		// Ʈ i = RecvExpected + 1 + i  ޾Ҵ.
+		std::vector<char> RecvBuffer[RUDP_WINDOW_SIZE];	// RELIABLE_ORDERED :  ٸ ׸Ʈ( )
+		std::vector<char> Reassembly;	// RELIABLE_ORDERED : ġ ִ Ŷ
+		bool IsAckPending = false;
+	};
+
+	struct stRudpConnection
+	{
+		std::mutex Lock;
+		std::atomic<UINT32> SessionId{ 0 };
+
+		std::unique_ptr<stRudpStream[]> Streams;	//  ִ ȸ ִ.
+
+		//ȥ   .
+		double Cwnd = RUDP_INITIAL_CWND;
+		double Ssthresh = RUDP_MAX_CWND;
+		double PacingCredit = RUDP_INITIAL_CWND;
+		UINT32 InflightCount = 0;
+		UINT64 LastLossMs = 0;
+
+		UINT32 SrttMs = 0;
+		UINT32 RttVarMs = 0;
+		UINT32 RtoMs = RUDP_INITIAL_RTO_MS;
+
+		bool IsFailed = false;
+
+		//streamCount_ 0̸ Ʈ Ѵ( ).
+		void Reset(const UINT32 streamCount_)
+		{
+			Streams.reset((streamCount_ > 0) ? new stRudpStream[streamCount_] : nullptr);
+
+			Cwnd = RUDP_INITIAL_CWND;
+			Ssthresh = RUDP_MAX_CWND;
+			PacingCredit = RUDP_INITIAL_CWND;
+			InflightCount = 0;
+			LastLossMs = 0;
+			SrttMs = 0;
+			RttVarMs = 0;
+			RtoMs = RUDP_INITIAL_RTO_MS;
+			IsFailed = false;
+		}
+	};
+
+	static UINT64 GetNowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	//16Ʈ  ưǷ ̷ Ѵ.
+	static bool IsSeqBefore(const UINT16 a_, const UINT16 b_)
+	{
+		return (INT16)(a_ - b_) < 0;
+	}
+
+	stRudpConnection* GetConnection(const UINT32 sessionId_)
+	{
+		auto sessionIndex = GetSessionIndex(sessionId_);
+		if (mConnections == nullptr || sessionIndex >= mMaxSessionCount)
+		{
+			return nullptr;
+		}
+
+		return &mConnections[sessionIndex];
+	}
+
+	UINT32 BuildDatagram(char* pDatagram_, const UINT8 stream_, const UINT8 flags_, const UINT16 seq_, const char* pPayload_, const UINT32 payloadSize_)
+	{
+		auto pHeader = (stRudpHeader*)pDatagram_;
+		pHeader->DatagramLength = (UINT16)(RUDP_HEADER_SIZE + payloadSize_);
+		pHeader->SegmentPacketId = mSegmentPacketId;
+		pHeader->Type = 0;
+		pHeader->Stream = stream_;
+		pHeader->Flags = flags_;
+		pHeader->Seq = seq_;
+		pHeader->AckSeq = 0;
+		pHeader->AckBits = 0;
+
+		if (payloadSize_ > 0)
+		{
+			CopyMemory(pDatagram_ + RUDP_HEADER_SIZE, pPayload_, payloadSize_);
+		}
+
+		return pHeader->DatagramLength;
+	}
+
+	// Lock  ¿ ȣѴ.    Ʈ Ȯ   ƴ´.
+	void SendDatagram(stRudpConnection& connection_, const UINT32 size_, char* pDatagram_)
+	{
+		auto pHeader = (stRudpHeader*)pDatagram_;
+		auto& stream = connection_.Streams[pHeader->Stream];
+
+		if (mDeliveries[pHeader->Stream] != RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+		{
+			pHeader->Flags |= RUDP_FLAG_ACK;
+			pHeader->AckSeq = stream.RecvExpected;
+			pHeader->AckBits = stream.RecvMask;
+			stream.IsAckPending = false;
+		}
+
+		mSentCount.fetch_add(1, std::memory_order_relaxed);
+		SendDatagramFunc(connection_.SessionId.load(std::memory_order_relaxed), size_, pDatagram_);
+	}
+
+	// Lock  ¿ ȣѴ.
+	//ȥ  ۽   ϴ ŭ ٸ ׸Ʈ . Ʈ ư ϳ   Ʈ 츦  ʰ Ѵ.
+	void FlushPending(stRudpConnection& connection_, const UINT64 nowMs_)
+	{
+		bool isSent = true;
+		while (isSent)
+		{
+			isSent = false;
+
+			for (UINT32 i = 0; i < mStreamCount; ++i)
+			{
+				if (connection_.InflightCount >= (UINT32)connection_.Cwnd || connection_.PacingCredit < 1.0)
+				{
+					return;
+				}
+
+				auto& stream = connection_.Streams[i];
+				if (stream.Pending.empty() || (UINT16)(stream.NextSeq - stream.SendBase) >= RUDP_WINDOW_SIZE)
+				{
+					continue;
+				}
+
+				auto& pending = stream.Pending.front();
+				auto seq = stream.NextSeq++;
+				auto& segment = stream.Inflight[seq % RUDP_WINDOW_SIZE];
+				segment.IsAcked = false;
+				segment.IsFastRetransmitted = false;
+				segment.RetransmitCount = 0;
+				segment.MissCount = 0;
+				segment.SentMs = nowMs_;
+				segment.DeadlineMs = nowMs_ + connection_.RtoMs;
+				segment.Datagram.resize(RUDP_HEADER_SIZE + pending.Data.size());
+				BuildDatagram(segment.Datagram.data(), (UINT8)i, RUDP_FLAG_DATA | pending.Flags, seq,
+					pending.Data.data(), (UINT32)pending.Data.size());
+				stream.Pending.pop_front();
+
+				connection_.InflightCount++;
+				connection_.PacingCredit -= 1.0;
+				SendDatagram(connection_, (UINT32)segment.Datagram.size(), segment.Datagram.data());
+				isSent = true;
+			}
+		}
+	}
+
+	void Retransmit(stRudpConnection& connection_, stInflightSegment& segment_, const UINT64 nowMs_)
+	{
+		segment_.RetransmitCount++;
+		segment_.SentMs = nowMs_;
+		segment_.DeadlineMs = nowMs_ + (std::min)((UINT64)connection_.RtoMs << (std::min)(segment_.RetransmitCount, 6u), (UINT64)RUDP_MAX_RTO_MS);
+		SendDatagram(connection_, (UINT32)segment_.Datagram.size(), segment_.Datagram.data());
+	}
+
+	//ս ˾  ȥ 츦 δ.  RTT  ս ѹ .
+	void OnLoss(stRudpConnection& connection_, const UINT64 nowMs_, const bool isTimeout_)
+	{
+		if (nowMs_ - connection_.LastLossMs < (std::max)(connection_.SrttMs, RUDP_TICK_MS))
+		{
+			return;
+		}
+
+		connection_.LastLossMs = nowMs_;
+		connection_.Ssthresh = (std::max)(connection_.Cwnd / 2, (double)RUDP_MIN_CWND);
+		connection_.Cwnd = isTimeout_ ? RUDP_MIN_CWND : connection_.Ssthresh;
+	}
+
+	void OnSegmentAcked(stRudpConnection& connection_, stInflightSegment& segment_, const UINT64 nowMs_)
+	{
+		segment_.IsAcked = true;
+		connection_.InflightCount--;
+
+		// ׸Ʈ   Ȯ 𸣹Ƿ RTT  ʴ´.
+		if (segment_.RetransmitCount == 0)
+		{
+			UpdateRtt(connection_, (UINT32)(nowMs_ - segment_.SentMs));
+		}
+
+		if (connection_.Cwnd < connection_.Ssthresh)
+		{
+			connection_.Cwnd += 1.0;
+		}
+		else
+		{
+			connection_.Cwnd += 1.0 / connection_.Cwnd;
+		}
+		connection_.Cwnd = (std::min)(connection_.Cwnd, (double)RUDP_MAX_CWND);
+	}
+
+	void UpdateRtt(stRudpConnection& connection_, const UINT32 rttMs_)
+	{
+		if (connection_.SrttMs == 0)
+		{
+			connection_.SrttMs = (std::max)(rttMs_, 1u);
+			connection_.RttVarMs = rttMs_ / 2;
+		}
+		else
+		{
+			auto diff = (connection_.SrttMs > rttMs_) ? connection_.SrttMs - rttMs_ : rttMs_ - connection_.SrttMs;
+			connection_.RttVarMs = (3 * connection_.RttVarMs + diff) / 4;
+			connection_.SrttMs = (std::max)((7 * connection_.SrttMs + rttMs_) / 8, 1u);
+		}
+
+		auto rtoMs = connection_.SrttMs + (std::max)(RUDP_TICK_MS, 4 * connection_.RttVarMs);
+		connection_.RtoMs = (std::min)((std::max)(rtoMs, RUDP_MIN_RTO_MS), RUDP_MAX_RTO_MS);
+	}
+
+	void ProcessAck(stRudpConnection& connection_, const UINT8 streamIndex_, const UINT16 ackSeq_, const UINT32 ackBits_, const UINT64 nowMs_)
+	{
+		if (mDeliveries[streamIndex_] == RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+		{
+			return;
+		}
+
+		auto& stream = connection_.Streams[streamIndex_];
+		auto inflightCount = (UINT16)(stream.NextSeq - stream.SendBase);
+
+		//   Ȯߴٴ  ߸ ̴.
+		if ((UINT16)(ackSeq_ - stream.SendBase) > inflightCount)
+		{
+			if (IsSeqBefore(ackSeq_, stream.SendBase) == false)
+			{
+				return;
+			}
+		}
+
+		// Ȯΰ  Ȯ
+		UINT16 highestAcked = stream.SendBase;
+		bool isAnySelective = false;
+		for (UINT16 i = 0; i < inflightCount; ++i)
+		{
+			UINT16 seq = stream.SendBase + i;
+			auto& segment = stream.Inflight[seq % RUDP_WINDOW_SIZE];
+			if (segment.IsAcked)
+			{
+				continue;
+			}
+
+			bool isAcked = IsSeqBefore(seq, ackSeq_);
+			if (isAcked == false && IsSeqBefore(ackSeq_, seq))
+			{
+				UINT16 bit = seq - ackSeq_ - 1;
+				if (bit < 32 && (ackBits_ & (1u << bit)))
+				{
+					isAcked = true;
+					isAnySelective = true;
+				}
+			}
+
+			if (isAcked)
+			{
+				OnSegmentAcked(connection_, segment, nowMs_);
+				highestAcked = seq;
+			}
+		}
+
+		// ׸Ʈ  ȮεǾ    ׸Ʈ     Ѵ.
+		if (isAnySelective)
+		{
+			for (UINT16 seq = stream.SendBase; IsSeqBefore(seq, highestAcked); ++seq)
+			{
+				auto& segment = stream.Inflight[seq % RUDP_WINDOW_SIZE];
+				if (segment.IsAcked || segment.IsFastRetransmitted)
+				{
+					continue;
+				}
+
+				if (++segment.MissCount >= RUDP_FAST_RETRANSMIT_COUNT)
+				{
+					segment.IsFastRetransmitted = true;
+					mFastRetransmitCount.fetch_add(1, std::memory_order_relaxed);
+					OnLoss(connection_, nowMs_, false);
+					Retransmit(connection_, segment, nowMs_);
+				}
+			}
+		}
+
+		//տ Ȯε ׸Ʈ 쿡 .
+		while (stream.SendBase != stream.NextSeq)
+		{
+			auto& segment = stream.Inflight[stream.SendBase % RUDP_WINDOW_SIZE];
+			if (segment.IsAcked == false)
+			{
+				break;
+			}
+
+			stream.SendBase++;
+		}
+	}
+
+	void Deliver(const UINT32 sessionId_, const UINT8 stream_, const UINT32 size_, char* pData_)
+	{
+		mDeliveredCount.fetch_add(1, std::memory_order_relaxed);
+		DeliverFunc(sessionId_, stream_, size_, pData_);
+	}
+
+	//RELIABLE_ORDERED :    ļ Ŷ ϼǸ Ѵ.
+	void DeliverOrderedFragment(stRudpConnection& connection_, const UINT32 sessionId_, const UINT8 streamIndex_, const UINT8 flags_, char* pPayload_, const UINT32 payloadSize_)
+	{
+		auto& stream = connection_.Streams[streamIndex_];
+
+		if ((flags_ & RUDP_FLAG_MORE_FRAGMENTS) == 0 && stream.Reassembly.empty())
+		{
+			Deliver(sessionId_, streamIndex_, payloadSize_, pPayload_);
+			return;
+		}
+
+		if (stream.Reassembly.size() + payloadSize_ > RUDP_MAX_PACKET_SIZE)
+		{
+			connection_.IsFailed = true;
+			stream.Reassembly.clear();
+			return;
+		}
+
+		stream.Reassembly.insert(stream.Reassembly.end(), pPayload_, pPayload_ + payloadSize_);
+		if (flags_ & RUDP_FLAG_MORE_FRAGMENTS)
+		{
+			return;
+		}
+
+		Deliver(sessionId_, streamIndex_, (UINT32)stream.Reassembly.size(), stream.Reassembly.data());
+		stream.Reassembly.clear();
+	}
+
+	void ProcessData(stRudpConnection& connection_, const UINT32 sessionId_, stRudpHeader* pHeader_, char* pPayload_, const UINT32 payloadSize_)
+	{
+		auto streamIndex = pHeader_->Stream;
+		auto delivery = mDeliveries[streamIndex];
+		auto& stream = connection_.Streams[streamIndex];
+		auto seq = pHeader_->Seq;
+
+		if (delivery == RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+		{
+			if (stream.IsRecvStarted && IsSeqBefore(stream.RecvExpected, seq) == false)
+			{
+				mStaleCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			stream.IsRecvStarted = true;
+			stream.RecvExpected = seq;
+			Deliver(sessionId_, streamIndex, payloadSize_, pPayload_);
+			return;
+		}
+
+		//  ߺ̾ ٽ Ȯ  .  Ȯ  Ҿ  ִ.
+		stream.IsAckPending = true;
+
+		UINT16 distance = seq - stream.RecvExpected;
+		if (distance > RUDP_WINDOW_SIZE)
+		{
+			mDuplicateCount.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		if (distance > 0)
+		{
+			auto bit = 1u << (distance - 1);
+			if (stream.RecvMask & bit)
+			{
+				mDuplicateCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			stream.RecvMask |= bit;
+
+			if (delivery == RUDP_DELIVERY::RELIABLE_UNORDERED)
+			{
+				Deliver(sessionId_, streamIndex, payloadSize_, pPayload_);
+			}
+			else
+			{
+				auto& buffer = stream.RecvBuffer[seq % RUDP_WINDOW_SIZE];
+				buffer.assign((char*)pHeader_, pPayload_ + payloadSize_);
+			}
+			return;
+		}
+
+		//  ׸Ʈ. ڿ ̹ ޾Ƶ ͵ ̾ óѴ.
+		if (delivery == RUDP_DELIVERY::RELIABLE_UNORDERED)
+		{
+			Deliver(sessionId_, streamIndex, payloadSize_, pPayload_);
+		}
+		else
+		{
+			DeliverOrderedFragment(connection_, sessionId_, streamIndex, pHeader_->Flags, pPayload_, payloadSize_);
+		}
+
+		stream.RecvExpected++;
+		while (true)
+		{
+			auto isReceived = (stream.RecvMask & 1) != 0;
+			stream.RecvMask >>= 1;
+			if (isReceived == false)
+			{
+				break;
+			}
+
+			if (delivery == RUDP_DELIVERY::RELIABLE_ORDERED)
+			{
+				auto& buffer = stream.RecvBuffer[stream.RecvExpected % RUDP_WINDOW_SIZE];
+				auto pBufferedHeader = (stRudpHeader*)buffer.data();
+				DeliverOrderedFragment(connection_, sessionId_, streamIndex, pBufferedHeader->Flags,
+					buffer.data() + RUDP_HEADER_SIZE, (UINT32)buffer.size() - RUDP_HEADER_SIZE);
+				buffer.clear();
+			}
+
+			stream.RecvExpected++;
+		}
+	}
+
+	// Lock  ¿ ȣѴ.
+	//ȯ :  ϴ ̸ false
+	bool Tick(stRudpConnection& connection_, const UINT64 nowMs_)
+	{
+		if (connection_.IsFailed)
+		{
+			return false;
+		}
+
+		for (UINT32 i = 0; i < mStreamCount; ++i)
+		{
+			if (mDeliveries[i] == RUDP_DELIVERY::UNRELIABLE_SEQUENCED)
+			{
+				continue;
+			}
+
+			auto& stream = connection_.Streams[i];
+			for (UINT16 seq = stream.SendBase; seq != stream.NextSeq; ++seq)
+			{
+				auto& segment = stream.Inflight[seq % RUDP_WINDOW_SIZE];
+				if (segment.IsAcked || nowMs_ < segment.DeadlineMs)
+				{
+					continue;
+				}
+
+				if (segment.RetransmitCount >= RUDP_MAX_RETRANSMIT)
+				{
+					return false;
+				}
+
+				mTimeoutRetransmitCount.fetch_add(1, std::memory_order_relaxed);
+				OnLoss(connection_, nowMs_, true);
+				Retransmit(connection_, segment, nowMs_);
+			}
+		}
+
+		// RTT  ȥ 츸ŭ  ƽ  ۽ŷ ÷ش. ѹ    츦  ʴ´.
+		auto rttMs = (std::max)(connection_.SrttMs, RUDP_TICK_MS);
+		connection_.PacingCredit = (std::min)(connection_.PacingCredit + connection_.Cwnd * RUDP_TICK_MS / rttMs, connection_.Cwnd);
+		FlushPending(connection_, nowMs_);
+
+		//Ϳ Ǿ   Ȯ   .
+		for (UINT32 i = 0; i < mStreamCount; ++i)
+		{
+			if (connection_.Streams[i].IsAckPending == false)
+			{
+				continue;
+			}
+
+			char datagram[RUDP_HEADER_SIZE];
+			auto datagramSize = BuildDatagram(datagram, (UINT8)i, 0, 0, nullptr, 0);
+			mAckSentCount.fetch_add(1, std::memory_order_relaxed);
+			SendDatagram(connection_, datagramSize, datagram);
+		}
+
+		return true;
+	}
+
+	void TimerThread()
+	{
+		std::vector<UINT32> closeSessionIds;
+
+		while (mIsRun)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(RUDP_TICK_MS));
+
+			auto nowMs = GetNowMs();
+			for (UINT32 i = 0; i < mMaxSessionCount; ++i)
+			{
+				auto& connection = mConnections[i];
+				if (connection.SessionId.load(std::memory_order_acquire) == 0)
+				{
+					continue;
+				}
+
+				std::lock_guard<std::mutex> guard(connection.Lock);
+				auto sessionId = connection.SessionId.load(std::memory_order_relaxed);
+				if (sessionId == 0 || Tick(connection, nowMs))
+				{
+					continue;
+				}
+
+				connection.Reset(0);
+				connection.SessionId.store(0, std::memory_order_release);
+				closeSessionIds.push_back(sessionId);
+			}
+
+			// ʿ Close() ٽ θ  Ƿ  Lock  ȣѴ.
+			for (auto sessionId : closeSessionIds)
+			{
+				printf("[RUDP] Ȯ  ų ۽ з  : Session(%u)\n", sessionId);
+				mClosedCount.fetch_add(1, std::memory_order_relaxed);
+				CloseFunc(sessionId);
+			}
+			closeSessionIds.clear();
+		}
+	}
+
+
+	UINT32 mMaxSessionCount = 0;
+	UINT16 mSegmentPacketId = 0;
+	UINT32 mStreamCount = 0;
+	RUDP_DELIVERY mDeliveries[RUDP_MAX_STREAM_COUNT] = {};
+
+	std::unique_ptr<stRudpConnection[]> mConnections;
+
+	bool mIsRun = false;
+	std::thread mTimerThread;
+
+	std::atomic<UINT64> mSentCount{ 0 };
+	std::atomic<UINT64> mTimeoutRetransmitCount{ 0 };
+	std::atomic<UINT64> mFastRetransmitCount{ 0 };
+	std::atomic<UINT64> mAckSentCount{ 0 };
+	std::atomic<UINT64> mDeliveredCount{ 0 };
+	std::atomic<UINT64> mDuplicateCount{ 0 };
+	std::atomic<UINT64> mStaleCount{ 0 };
+	std::atomic<UINT64> mClosedCount{ 0 };
+};
\ No newline at end of file
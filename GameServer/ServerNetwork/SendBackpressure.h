@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Define.h"
+#include <chrono>
+
+
+// ۽ ť   ,  Ŷ ť  Ѵ.  mSendLock  ¿ ȣѴ.
+//ť    и ° Ǿ RELIABLE ƴ Ŷ ,   Ʒ  Ǯ.
+//и ° SEND_QUEUE_CONGESTION_TIMEOUT_MS Ѱ ̾ų SEND_QUEUE_MAX_BYTES   ˷ش.
+class SendBackpressure
+{
+public:
+	enum class RESULT
+	{
+		ENQUEUE,
+		DROP,
+		CLOSE,		// ݾƾ Ѵ.  Ŷ  .
+	};
+
+	void Init(stIOStat* pIOStat_)
+	{
+		mpIOStat = pIOStat_;
+	}
+
+	//    ȣѴ.
+	void Reset()
+	{
+		mQueuedBytes = 0;
+		mQueuedCount = 0;
+		mIsCongested = false;
+		mIsClosing = false;
+	}
+
+	RESULT Admit(const SEND_CLASS sendClass_, const UINT32 dataSize_)
+	{
+		if (mIsClosing)
+		{
+			return RESULT::DROP;
+		}
+
+		if (mIsCongested == false &&
+			(mQueuedBytes + dataSize_ > SEND_QUEUE_HIGH_WATERMARK_BYTES || mQueuedCount + 1 > SEND_QUEUE_HIGH_WATERMARK_COUNT))
+		{
+			mIsCongested = true;
+			mCongestedTime = std::chrono::steady_clock::now();
+		}
+
+		if (mIsCongested)
+		{
+			auto congestedMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - mCongestedTime).count();
+			if (mQueuedBytes + dataSize_ > SEND_QUEUE_MAX_BYTES || congestedMs > SEND_QUEUE_CONGESTION_TIMEOUT_MS)
+			{
+				mIsClosing = true;
+				++mpIOStat->BackpressureCloseCount;
+				return RESULT::CLOSE;
+			}
+
+			if (sendClass_ != SEND_CLASS::RELIABLE)
+			{
+				++mpIOStat->DroppedSendCount;
+				mpIOStat->DroppedSendBytes += dataSize_;
+				return RESULT::DROP;
+			}
+		}
+
+		mQueuedBytes += dataSize_;
+		++mQueuedCount;
+		return RESULT::ENQUEUE;
+	}
+
+	//ť ִ Ŷ  Ŷ ٲ.
+	void OnReplaced(const UINT32 oldDataSize_, const UINT32 newDataSize_)
+	{
+		mQueuedBytes = mQueuedBytes - oldDataSize_ + newDataSize_;
+
+		++mpIOStat->SupersededSendCount;
+		mpIOStat->SupersededSendBytes += oldDataSize_;
+	}
+
+	//°ų  ť .
+	void OnRemoved(const UINT32 dataSize_)
+	{
+		mQueuedBytes -= dataSize_;
+		--mQueuedCount;
+
+		if (mIsCongested && mQueuedBytes <= SEND_QUEUE_LOW_WATERMARK_BYTES && mQueuedCount <= SEND_QUEUE_LOW_WATERMARK_COUNT)
+		{
+			mIsCongested = false;
+		}
+	}
+
+
+private:
+	stIOStat* mpIOStat = nullptr;
+
+	UINT64 mQueuedBytes = 0;
+	UINT32 mQueuedCount = 0;
+
+	bool mIsCongested = false;
+	bool mIsClosing = false;
+	std::chrono::steady_clock::time_point mCongestedTime;
+};
\ No newline at end of file
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Define.h"
+#include "BroadcastBuffer.h"
+#include <stdio.h>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <vector>
+
+
+//۽  Ǯ ũ . ̺ ū Ŷ(INVENTORY_INFO_RESPONSE_PACKET ) Ǯ  ʰ  ҴѴ.
+const UINT32 SEND_POOL_SIZE_CLASSES[] = { 64, 128, 256, 512 };
+const UINT32 SEND_POOL_SIZE_CLASS_COUNT = sizeof(SEND_POOL_SIZE_CLASSES) / sizeof(UINT32);
+const UINT32 SEND_POOL_SLAB_BLOCK_COUNT = 32;	// ޺  ڶ  ѹ ø 
+
+
+//۽  Ǯ .    Ѵ.
+struct stSendPoolStat
+{
+	std::atomic<UINT64> HitCount{ 0 };			//Ǯ ִ  
+	std::atomic<UINT64> MissCount{ 0 };			// ڶ   Ҵ
+	std::atomic<UINT64> OverflowCount{ 0 };		//޺ ũų Ǯ   Ҵ
+	std::atomic<UINT64> BroadcastCount{ 0 };	//    ۸ 
+	std::atomic<UINT64> BroadcastBytes{ 0 };	//   Ƴ  Ʈ
+
+	void Print()
+	{
+		printf("[۽ Ǯ ] hit(%llu) miss(%llu) overflow(%llu) broadcast(%llu) saved copy bytes(%llu)\n",
+			(UINT64)HitCount, (UINT64)MissCount, (UINT64)OverflowCount, (UINT64)BroadcastCount, (UINT64)BroadcastBytes);
+	}
+};
+
+
+// ϳ ۽ ؽƮ(ContextT) +   Ǯ
+// ϳ ؽƮ ͸  Ƽ SendMsg ѹ Ҵ ѹ Ͼ ʰ Ѵ.
+// ۽ (mSendLock) ȿ ϹǷ Ǯ ü  .
+template <typename ContextT>
+class SendBufferPool
+{
+public:
+	//isEnabled_ false̸ Ǯ  ʰ ۽Ÿ  new/delete Ѵ. Ǯ   .
+	void Init(stSendPoolStat* pStat_, const bool isEnabled_)
+	{
+		mpStat = pStat_;
+		mIsEnabled = isEnabled_;
+	}
+
+	//ؽƮ  ʱȭ  · ְ, ͸  ġ ppData_ ش.
+	ContextT* Alloc(const UINT32 dataSize_, char** ppData_)
+	{
+		char* pBlock = nullptr;
+
+		auto sizeClass = mIsEnabled ? GetSizeClass(dataSize_) : SEND_POOL_SIZE_CLASS_COUNT;
+		if (sizeClass < SEND_POOL_SIZE_CLASS_COUNT)
+		{
+			if (mFreeLists[sizeClass] == nullptr)
+			{
+				++mpStat->MissCount;
+				AddSlab(sizeClass);
+			}
+			else
+			{
+				++mpStat->HitCount;
+			}
+
+			auto pNode = mFreeLists[sizeClass];
+			mFreeLists[sizeClass] = pNode->pNext;
+			pBlock = (char*)pNode;
+		}
+		else
+		{
+			++mpStat->OverflowCount;
+			pBlock = new char[GetBlockSize(dataSize_)];
+		}
+
+		*ppData_ = pBlock + GetContextSize();
+		return new (pBlock) ContextT();
+	}
+
+	// ۸ ϴ ؽƮ ޴´. ʹ  ʰ   ø.
+	ContextT* AllocBroadcast(stBroadcastBuffer* pBuffer_)
+	{
+		++mpStat->BroadcastCount;
+		mpStat->BroadcastBytes += pBuffer_->GetDataSize();
+
+		char* pUnused = nullptr;
+		auto pContext = Alloc(0, &pUnused);
+
+		pBuffer_->AddRef();
+		pContext->pBroadcast = pBuffer_;
+		pContext->SendClass = pBuffer_->GetSendClass();
+		pContext->ReplaceKey = pBuffer_->GetReplaceKey();
+		return pContext;
+	}
+
+	//Alloc   dataSize_  Ѵ.   ؽƮ  ´.
+	void Free(ContextT* pContext_, UINT32 dataSize_)
+	{
+		if (pContext_->pBroadcast != nullptr)
+		{
+			pContext_->pBroadcast->Release();
+			dataSize_ = 0;
+		}
+
+		pContext_->~ContextT();
+
+		auto sizeClass = mIsEnabled ? GetSizeClass(dataSize_) : SEND_POOL_SIZE_CLASS_COUNT;
+		if (sizeClass >= SEND_POOL_SIZE_CLASS_COUNT)
+		{
+			delete[] (char*)pContext_;
+			return;
+		}
+
+		auto pNode = (FreeNode*)pContext_;
+		pNode->pNext = mFreeLists[sizeClass];
+		mFreeLists[sizeClass] = pNode;
+	}
+
+
+private:
+	struct FreeNode
+	{
+		FreeNode* pNext;
+	};
+
+	static UINT32 GetSizeClass(const UINT32 dataSize_)
+	{
+		for (UINT32 i = 0; i < SEND_POOL_SIZE_CLASS_COUNT; ++i)
+		{
+			if (dataSize_ <= SEND_POOL_SIZE_CLASSES[i])
+			{
+				return i;
+			}
+		}
+
+		return SEND_POOL_SIZE_CLASS_COUNT;
+	}
+
+	//Ͱ ؽƮ ٷ ڿ  ؽƮ ũ⸦  ũ  .
+	static constexpr size_t GetContextSize()
+	{
+		return (sizeof(ContextT) + alignof(void*) - 1) & ~(alignof(void*) - 1);
+	}
+
+	static size_t GetBlockSize(const UINT32 dataSize_)
+	{
+		return (GetContextSize() + dataSize_ + alignof(void*) - 1) & ~(alignof(void*) - 1);
+	}
+
+	void AddSlab(const UINT32 sizeClass_)
+	{
+		auto blockSize = GetBlockSize(SEND_POOL_SIZE_CLASSES[sizeClass_]);
+
+		mSlabs.emplace_back(new char[blockSize * SEND_POOL_SLAB_BLOCK_COUNT]);
+		auto pSlab = mSlabs.back().get();
+
+		for (UINT32 i = 0; i < SEND_POOL_SLAB_BLOCK_COUNT; ++i)
+		{
+			auto pNode = (FreeNode*)(pSlab + blockSize * i);
+			pNode->pNext = mFreeLists[sizeClass_];
+			mFreeLists[sizeClass_] = pNode;
+		}
+	}
+
+
+	stSendPoolStat* mpStat = nullptr;
+	bool mIsEnabled = true;
+
+	FreeNode* mFreeLists[SEND_POOL_SIZE_CLASS_COUNT] = {};
+
+	std::vector<std::unique_ptr<char[]>> mSlabs;
+};
\ No newline at end of file
@@ -0,0 +1,243 @@
+#pragma once
+
+#include "TimerWheel.h"
+#include "Define.h"
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <memory>
+#include <functional>
+
+
+//  ð   (half-open ) ãƼ ´.
+//   ð ٲٰ( ), Ǹ Ÿ̸ ϳ ٿ ɾд.
+//Ÿ̸Ӱ Ǹ ׶   ð   ų, ų,  Ȯ ð ٽ Ǵ.
+class SessionHeartbeat
+{
+public:
+	//SendPingFunc( ID,  ð) :  Ŷ . Ŭ̾Ʈ  ð ״  ش.
+	std::function<void(UINT32, UINT64)> SendPingFunc;
+
+	//CloseFunc( ID) : ð ȿ ƹ͵    ´.
+	std::function<void(UINT32)> CloseFunc;
+
+	//pingIntervalMs_      , timeoutMs_     ´. timeoutMs_ 0̸ .
+	void SetConfig(const UINT32 pingIntervalMs_, const UINT32 timeoutMs_)
+	{
+		mPingIntervalMs = pingIntervalMs_;
+		mTimeoutMs = timeoutMs_;
+	}
+
+	bool IsEnabled() { return mTimeoutMs > 0; }
+
+	bool Start(const UINT32 maxSessionCount_)
+	{
+		mSessions.reset(new stHeartbeatSession[maxSessionCount_]);
+		for (UINT32 i = 0; i < maxSessionCount_; ++i)
+		{
+			mSessions[i].TimerNode.Id = i;
+		}
+
+		if (IsEnabled() == false)
+		{
+			return true;
+		}
+
+		mWheel.Init(GetNowMs() / HEARTBEAT_TICK_MS);
+
+		mIsRun = true;
+		mTimerThread = std::thread([this]() { TimerThread(); });
+
+		printf("[ƮƮ] ping(%ums) timeout(%ums)\n", mPingIntervalMs, mTimeoutMs);
+		return true;
+	}
+
+	void Stop()
+	{
+		mIsRun = false;
+
+		if (mTimerThread.joinable())
+		{
+			mTimerThread.join();
+		}
+	}
+
+	// 뺸  I/O 忡 ȣѴ.
+	void OnConnect(const UINT32 sessionId_)
+	{
+		auto& session = mSessions[GetSessionIndex(sessionId_)];
+		auto nowMs = GetNowMs();
+
+		session.ActiveSessionId.store(sessionId_, std::memory_order_relaxed);
+		session.ConnectMs.store(nowMs, std::memory_order_relaxed);
+		session.LastRecvMs.store(nowMs, std::memory_order_relaxed);
+		session.LastRttMs.store(0, std::memory_order_relaxed);
+		session.SmoothedRttMs.store(0, std::memory_order_release);
+
+		if (IsEnabled() == false)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+		mWheel.Add(&session.TimerNode, MsToTick(nowMs + mPingIntervalMs));
+	}
+
+	void OnClose(const UINT32 sessionId_)
+	{
+		auto& session = mSessions[GetSessionIndex(sessionId_)];
+		if (session.ActiveSessionId.load(std::memory_order_relaxed) != sessionId_)
+		{
+			return;
+		}
+
+		session.ActiveSessionId.store(0, std::memory_order_relaxed);
+
+		if (IsEnabled() == false)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+		mWheel.Remove(&session.TimerNode);
+	}
+
+	//  I/O 忡 ȣѴ. ð ϰ Ÿ̸Ӵ   ٽ Ǵ.
+	void OnReceive(const UINT32 sessionId_)
+	{
+		mSessions[GetSessionIndex(sessionId_)].LastRecvMs.store(GetNowMs(), std::memory_order_relaxed);
+	}
+
+	//Ŭ̾Ʈ   ð RTT . ƹ 忡 ȣص ȴ.
+	//ȯ : ̹ RTT(ms).  ῡ   ƴϸ -1
+	INT32 OnPong(const UINT32 sessionId_, const UINT64 pingTimeMs_)
+	{
+		auto& session = mSessions[GetSessionIndex(sessionId_)];
+		auto nowMs = GetNowMs();
+
+		if (session.ActiveSessionId.load(std::memory_order_relaxed) != sessionId_ ||
+			pingTimeMs_ < session.ConnectMs.load(std::memory_order_relaxed) || pingTimeMs_ > nowMs)
+		{
+			return -1;
+		}
+
+		auto rttMs = (UINT32)(nowMs - pingTimeMs_);
+		session.LastRttMs.store(rttMs, std::memory_order_relaxed);
+
+		//TCP SRTT    1/8 ݿѴ.
+		auto smoothedRttMs = session.SmoothedRttMs.load(std::memory_order_relaxed);
+		smoothedRttMs = (smoothedRttMs == 0) ? rttMs : (smoothedRttMs * 7 + rttMs) / 8;
+		session.SmoothedRttMs.store(smoothedRttMs, std::memory_order_release);
+
+		return (INT32)rttMs;
+	}
+
+	//    0
+	UINT32 GetLastRtt(const UINT32 sessionId_) { return mSessions[GetSessionIndex(sessionId_)].LastRttMs.load(std::memory_order_relaxed); }
+	UINT32 GetSmoothedRtt(const UINT32 sessionId_) { return mSessions[GetSessionIndex(sessionId_)].SmoothedRttMs.load(std::memory_order_acquire); }
+
+	// ð RTT 꿡   ð(ms)
+	static UINT64 GetNowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+
+private:
+	struct stHeartbeatSession
+	{
+		stTimerNode TimerNode;					//mLock ȿ ٷ.
+		std::atomic<UINT32> ActiveSessionId{ 0 };	//Ǿִ  ID.  0
+		std::atomic<UINT64> ConnectMs{ 0 };
+		std::atomic<UINT64> LastRecvMs{ 0 };
+		std::atomic<UINT32> LastRttMs{ 0 };
+		std::atomic<UINT32> SmoothedRttMs{ 0 };
+	};
+
+	static UINT64 MsToTick(const UINT64 ms_) { return (ms_ + HEARTBEAT_TICK_MS - 1) / HEARTBEAT_TICK_MS; }
+
+	void TimerThread()
+	{
+		std::vector<std::pair<UINT32, UINT64>> pingTargets;
+		std::vector<UINT32> closeTargets;
+
+		while (mIsRun)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(HEARTBEAT_TICK_MS));
+
+			auto nowMs = GetNowMs();
+
+			{
+				std::lock_guard<std::mutex> guard(mLock);
+				mWheel.Advance(nowMs / HEARTBEAT_TICK_MS, [&](stTimerNode* pNode_) {
+					CheckSession(mSessions[pNode_->Id], nowMs, pingTargets, closeTargets);
+				});
+			}
+
+			//۽Ű    Ƿ   ۿ Ѵ.
+			for (auto sessionId : closeTargets)
+			{
+				printf("[˸] ƮƮ ð ʰ   : Session(%u)\n", sessionId);
+				CloseFunc(sessionId);
+			}
+
+			for (auto& target : pingTargets)
+			{
+				SendPingFunc(target.first, target.second);
+			}
+
+			pingTargets.clear();
+			closeTargets.clear();
+		}
+	}
+
+	//mLock  ¿ ȣѴ.   Ÿ̸Ӹ   ð  ٽ Ǵ.
+	void CheckSession(stHeartbeatSession& session_, const UINT64 nowMs_, std::vector<std::pair<UINT32, UINT64>>& pingTargets_, std::vector<UINT32>& closeTargets_)
+	{
+		auto sessionId = session_.ActiveSessionId.load(std::memory_order_relaxed);
+		if (sessionId == 0)
+		{
+			return;
+		}
+
+		auto lastRecvMs = session_.LastRecvMs.load(std::memory_order_relaxed);
+		auto idleMs = (nowMs_ > lastRecvMs) ? nowMs_ - lastRecvMs : 0;
+
+		UINT64 nextCheckMs = lastRecvMs + mPingIntervalMs;
+
+		if (idleMs >= mTimeoutMs)
+		{
+			closeTargets_.push_back(sessionId);
+
+			// OnClose() .  ʾ ٽ õѴ.
+			nextCheckMs = nowMs_ + mPingIntervalMs;
+		}
+		else if (idleMs >= mPingIntervalMs)
+		{
+			pingTargets_.emplace_back(sessionId, nowMs_);
+
+			nextCheckMs = nowMs_ + mPingIntervalMs;
+			if (nextCheckMs > lastRecvMs + mTimeoutMs)
+			{
+				nextCheckMs = lastRecvMs + mTimeoutMs;
+			}
+		}
+
+		mWheel.Add(&session_.TimerNode, MsToTick(nextCheckMs));
+	}
+
+
+	UINT32 mPingIntervalMs = 0;
+	UINT32 mTimeoutMs = 0;
+
+	std::unique_ptr<stHeartbeatSession[]> mSessions;
+
+	std::mutex mLock;
+	TimerWheel mWheel;
+
+	std::thread mTimerThread;
+	std::atomic<bool> mIsRun{ false };
+};
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Define.h"
+#include <atomic>
+#include <memory>
+
+
+//  ȣ   (free-list) Ѵ.
+// ɷִ I/O   ٷ ش.  ID   ٲǷ   Ŷ  ʴ´.
+class SessionPool
+{
+public:
+	//0 ~ sessionCount_-1      .
+	void Init(const UINT32 sessionCount_)
+	{
+		mNextIndexes.reset(new std::atomic<UINT32>[sessionCount_]);
+		mHead.store(EMPTY_INDEX, std::memory_order_relaxed);
+
+		//0   ڿ ִ´.
+		for (auto i = sessionCount_; i > 0; --i)
+		{
+			Push(i - 1);
+		}
+	}
+
+	bool Pop(UINT32* pIndex_)
+	{
+		auto head = mHead.load(std::memory_order_acquire);
+		while (true)
+		{
+			auto top = (UINT32)head;
+			if (top == EMPTY_INDEX)
+			{
+				return false;
+			}
+
+			// 32Ʈ    þ ±(ABA )
+			auto next = mNextIndexes[top].load(std::memory_order_relaxed);
+			auto newHead = (NextTag(head) << 32) | next;
+			if (mHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				*pIndex_ = top;
+				return true;
+			}
+		}
+	}
+
+	void Push(const UINT32 index_)
+	{
+		auto head = mHead.load(std::memory_order_relaxed);
+		UINT64 newHead = 0;
+		do
+		{
+			mNextIndexes[index_].store((UINT32)head, std::memory_order_relaxed);
+			newHead = (NextTag(head) << 32) | index_;
+		} while (mHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed) == false);
+	}
+
+
+private:
+	static const UINT32 EMPTY_INDEX = UINT32_MAX;
+
+	static UINT64 NextTag(const UINT64 head_)
+	{
+		return (UINT32)((head_ >> 32) + 1);
+	}
+
+
+	// 32Ʈ : ±,  32Ʈ :    ȣ
+	std::atomic<UINT64> mHead{ EMPTY_INDEX };
+	std::unique_ptr<std::atomic<UINT32>[]> mNextIndexes;
+};
\ No newline at end of file
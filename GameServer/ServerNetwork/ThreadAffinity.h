@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef _WIN32
+const UINT32 MAX_AFFINITY_CPU = 64;		// SetThreadAffinityMask   ִ CPU  (μ ׷ ϳ)
+#else
+const UINT32 MAX_AFFINITY_CPU = CPU_SETSIZE;
+#endif
+
+//"0-3,8,10-11"  CPU  CPU ȣ  ٲ۴.
+//ȯ : ߸ ׸  false.  ڿ  ( )̴.
+inline bool ParseCpuList(const std::string& cpuList_, std::vector<UINT32>* pCpus_)
+{
+	std::vector<UINT32> cpus;
+
+	size_t pos = 0;
+	while (pos < cpuList_.size())
+	{
+		auto end = cpuList_.find(',', pos);
+		if (end == std::string::npos)
+		{
+			end = cpuList_.size();
+		}
+
+		auto item = cpuList_.substr(pos, end - pos);
+		pos = end + 1;
+
+		char* pEnd = nullptr;
+		auto first = strtoul(item.c_str(), &pEnd, 10);
+		auto last = first;
+		bool isValid = (item.empty() == false && item[0] != '-' && pEnd != item.c_str());
+
+		if (isValid && *pEnd == '-')
+		{
+			auto pLast = pEnd + 1;
+			last = strtoul(pLast, &pEnd, 10);
+			isValid = (*pLast != '\0' && *pLast != '-' && pEnd != pLast);
+		}
+
+		if (isValid == false || *pEnd != '\0' || last < first || last >= MAX_AFFINITY_CPU)
+		{
+			printf("[] ߸ CPU  : %s\n", cpuList_.c_str());
+			return false;
+		}
+
+		for (auto cpu = first; cpu <= last; ++cpu)
+		{
+			cpus.push_back((UINT32)cpu);
+		}
+	}
+
+	*pCpus_ = std::move(cpus);
+	return true;
+}
+
+inline std::string CpuListToString(const std::vector<UINT32>& cpus_)
+{
+	if (cpus_.empty())
+	{
+		return "-";
+	}
+
+	std::string text;
+	for (auto cpu : cpus_)
+	{
+		if (text.empty() == false)
+		{
+			text += ',';
+		}
+		text += std::to_string(cpu);
+	}
+	return text;
+}
+
+// 带 cpus_ threadIndex_ ° CPU Ѵ. 尡 CPU   ư  ´.
+//   ʴ´. ص     .
+inline bool PinCurrentThread(const std::vector<UINT32>& cpus_, const UINT32 threadIndex_, const char* pThreadName_)
+{
+	if (cpus_.empty())
+	{
+		return true;
+	}
+
+	auto cpu = cpus_[threadIndex_ % cpus_.size()];
+
+#ifdef _WIN32
+	if (cpu >= MAX_AFFINITY_CPU || SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << cpu) == 0)
+	{
+		printf("[] %s-%u 带 CPU %u   : %d\n", pThreadName_, threadIndex_, cpu, (int)GetLastError());
+		return false;
+	}
+#else
+	cpu_set_t cpuSet;
+	CPU_ZERO(&cpuSet);
+	CPU_SET(cpu, &cpuSet);
+
+	auto ret = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+	if (ret != 0)
+	{
+		printf("[] %s-%u 带 CPU %u   : %d\n", pThreadName_, threadIndex_, cpu, ret);
+		return false;
+	}
+#endif
+
+	return true;
+}
\ No newline at end of file
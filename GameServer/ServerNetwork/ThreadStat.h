@@ -0,0 +1,186 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// ϳ  .   常  ThreadStatMonitor д´.
+struct stThreadStat
+{
+	static UINT64 GetNowNs()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// ٸ ȣ(GetQueuedCompletionStatus, epoll_wait, sleep ) BeginIdle()/EndIdle() Ѵ.
+	UINT64 BeginIdle()
+	{
+		auto nowNs = GetNowNs();
+		IdleBeginNs.store(nowNs, std::memory_order_relaxed);
+		return nowNs;
+	}
+
+	void EndIdle(const UINT64 beginNs_)
+	{
+		IdleNs.fetch_add(GetNowNs() - beginNs_, std::memory_order_relaxed);
+		IdleBeginNs.store(0, std::memory_order_relaxed);
+	}
+
+	//     ð. Ⱑ   ġ  Ʋ     .
+	UINT64 GetIdleNs(const UINT64 nowNs_)
+	{
+		UINT64 idleBeginNs = IdleBeginNs.load(std::memory_order_relaxed);
+		UINT64 idleNs = IdleNs.load(std::memory_order_relaxed);
+		return (idleBeginNs != 0 && nowNs_ > idleBeginNs) ? idleNs + (nowNs_ - idleBeginNs) : idleNs;
+	}
+
+	//ó Ϸ 뺸, Ŷ, ƽ 
+	void AddCompletion(const UINT64 count_ = 1) { CompletionCount.fetch_add(count_, std::memory_order_relaxed); }
+
+	char Name[32] = { 0, };
+	std::atomic<UINT64> IdleNs{ 0 };			//  
+	std::atomic<UINT64> IdleBeginNs{ 0 };	//  ̸ ⸦  ð
+	std::atomic<UINT64> CompletionCount{ 0 };
+
+	//   .  常 .
+	UINT64 LastReportNs = 0;
+	UINT64 LastIdleNs = 0;
+	UINT64 LastCompletionCount = 0;
+};
+
+//I/O, ,   , ʴ Ϸ ,  ð ֱ Ѵ.
+//   Register(),   Unregister()  ȣѴ.
+class ThreadStatMonitor
+{
+public:
+	//α׷    ( Ʈ ) 踦    Ƿ Ϻη ı ʴ´.
+	static ThreadStatMonitor& Instance()
+	{
+		static ThreadStatMonitor* pInstance = new ThreadStatMonitor;
+		return *pInstance;
+	}
+
+	//ȯ  Unregister()   ȿϴ.
+	stThreadStat* Register(const char* pName_, const UINT32 index_)
+	{
+		auto pStat = new stThreadStat;
+		snprintf(pStat->Name, sizeof(pStat->Name), "%s-%u", pName_, index_);
+		pStat->LastReportNs = stThreadStat::GetNowNs();
+
+		std::lock_guard<std::mutex> guard(mLock);
+		mStats.emplace_back(pStat);
+		return pStat;
+	}
+
+	void Unregister(stThreadStat* pStat_)
+	{
+		std::lock_guard<std::mutex> guard(mLock);
+		for (auto iter = mStats.begin(); iter != mStats.end(); ++iter)
+		{
+			if (iter->get() == pStat_)
+			{
+				mStats.erase(iter);
+				return;
+			}
+		}
+	}
+
+	//intervalSec_  踦 Ѵ. 0̸  ʴ´.
+	void Start(const UINT32 intervalSec_)
+	{
+		if (intervalSec_ == 0 || mIsRun)
+		{
+			return;
+		}
+
+		mIntervalSec = intervalSec_;
+		mIsRun = true;
+		mReportThread = std::thread([this]() { ReportThread(); });
+	}
+
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			mIsRun = false;
+		}
+		mReportCondition.notify_all();
+
+		if (mReportThread.joinable())
+		{
+			mReportThread.join();
+		}
+	}
+
+	//util   ٸ  ð ̴.
+	void Print()
+	{
+		std::lock_guard<std::mutex> guard(mLock);
+
+		auto nowNs = stThreadStat::GetNowNs();
+		for (auto& pStat : mStats)
+		{
+			UINT64 idleNs = pStat->GetIdleNs(nowNs);
+			UINT64 completionCount = pStat->CompletionCount.load(std::memory_order_relaxed);
+
+			auto elapsedNs = nowNs - pStat->LastReportNs;
+			auto deltaCompletion = completionCount - pStat->LastCompletionCount;
+
+			//Ⱑ   ģ      ִ.
+			INT64 deltaIdleNs = (INT64)(idleNs - pStat->LastIdleNs);
+			if (deltaIdleNs < 0)
+			{
+				deltaIdleNs = 0;
+			}
+			else if ((UINT64)deltaIdleNs > elapsedNs)
+			{
+				deltaIdleNs = (INT64)elapsedNs;
+			}
+
+			double elapsedSec = (double)elapsedNs / 1e9;
+			printf("[ ] %-10s : util(%5.1f%%) completions/s(%.1f) idle(%llums / %llums)\n", pStat->Name,
+				(elapsedNs > 0) ? 100.0 * (double)(elapsedNs - (UINT64)deltaIdleNs) / (double)elapsedNs : 0.0,
+				(elapsedSec > 0) ? (double)deltaCompletion / elapsedSec : 0.0,
+				(UINT64)deltaIdleNs / 1000000, elapsedNs / 1000000);
+
+			pStat->LastReportNs = nowNs;
+			pStat->LastIdleNs = idleNs;
+			pStat->LastCompletionCount = completionCount;
+		}
+	}
+
+private:
+	ThreadStatMonitor() = default;
+
+	void ReportThread()
+	{
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mLock);
+				mReportCondition.wait_for(lock, std::chrono::seconds(mIntervalSec), [this]() { return mIsRun == false; });
+				if (mIsRun == false)
+				{
+					return;
+				}
+			}
+
+			Print();
+		}
+	}
+
+	std::mutex mLock;
+	std::vector<std::unique_ptr<stThreadStat>> mStats;
+
+	UINT32 mIntervalSec = 0;
+	bool mIsRun = false;
+	std::condition_variable mReportCondition;
+	std::thread mReportThread;
+};
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Define.h"
+#include <atomic>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+//    ϳ ٸ  . Windows ڵ  ̺Ʈ, Linux eventfd .
+// ȿ  ý ȣ ϹǷ ٻ  ִ    б ϳ.
+//
+//	ٸ  : PrepareWait() -> ť  ٽ Ȯ ->  Wait(), ƴϸ CancelWait()
+//	    : ť ֱ -> Notify()
+class ThreadWakeup
+{
+public:
+	~ThreadWakeup()
+	{
+		Close();
+	}
+
+	bool Init()
+	{
+#ifdef _WIN32
+		mEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+		if (mEvent == nullptr)
+		{
+			printf("[] CreateEvent()Լ  : %d\n", (int)GetLastError());
+			return false;
+		}
+#else
+		mEventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		if (-1 == mEventFd)
+		{
+			printf("[] eventfd()Լ  : %d\n", errno);
+			return false;
+		}
+#endif
+		return true;
+	}
+
+	void Close()
+	{
+#ifdef _WIN32
+		if (mEvent != nullptr)
+		{
+			CloseHandle(mEvent);
+			mEvent = nullptr;
+		}
+#else
+		if (mEventFd != -1)
+		{
+			close(mEventFd);
+			mEventFd = -1;
+		}
+#endif
+	}
+
+	//ڴٰ ˸.  ڿ ־  Notify()  ġ ʴ´.
+	void PrepareWait()
+	{
+		mIsWaiting.store(true, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+	}
+
+	void CancelWait()
+	{
+		mIsWaiting.store(false, std::memory_order_relaxed);
+	}
+
+	//Notify() ų timeoutMs_  ƿ´.
+	void Wait(const UINT32 timeoutMs_)
+	{
+#ifdef _WIN32
+		WaitForSingleObject(mEvent, timeoutMs_);
+#else
+		pollfd pollFd{ mEventFd, POLLIN, 0 };
+		if (poll(&pollFd, 1, (int)timeoutMs_) > 0)
+		{
+			UINT64 count = 0;
+			if (read(mEventFd, &count, sizeof(count)) < 0 && errno != EAGAIN)
+			{
+				printf("[] eventfd read  : %d\n", errno);
+			}
+		}
+#endif
+		mIsWaiting.store(false, std::memory_order_relaxed);
+	}
+
+	//ť   ȣѴ. ٸ 尡  ƹ͵  ʴ´.
+	void Notify()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (mIsWaiting.load(std::memory_order_relaxed) == false || mIsWaiting.exchange(false, std::memory_order_relaxed) == false)
+		{
+			return;
+		}
+
+		mNotifyCount.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+		SetEvent(mEvent);
+#else
+		UINT64 wakeup = 1;
+		if (write(mEventFd, &wakeup, sizeof(wakeup)) < 0)
+		{
+			printf("[] eventfd write  : %d\n", errno);
+		}
+#endif
+	}
+
+	//  ý ȣ  Ƚ
+	UINT64 GetNotifyCount() const { return mNotifyCount.load(std::memory_order_relaxed); }
+
+private:
+	std::atomic<bool> mIsWaiting{ false };
+	std::atomic<UINT64> mNotifyCount{ 0 };
+
+#ifdef _WIN32
+	HANDLE mEvent = nullptr;
+#else
+	int mEventFd = -1;
+#endif
+};
\ No newline at end of file
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "Define.h"
+
+
+//Ÿ̸ ٿ Ŵ Ÿ̸ ϳ.  带 Ҵ Ƿ ó   ü ־д.
+struct stTimerNode
+{
+	stTimerNode* pPrev = nullptr;
+	stTimerNode* pNext = nullptr;
+	UINT64 ExpireTick = 0;
+	UINT32 Id = 0;			// 뺸   Ÿ̸ ˷ش.
+
+	bool IsScheduled() const { return pNext != nullptr; }
+};
+
+
+// Ÿ̸ . ܰ踶 64ḭ̆, Ʒ ܰ    ܰ  ĭ̴.
+//ɱ/Ҵ ĭ   Ʈ ְ  ̶ O(1)̰, ƽ  ƽ ĭ . (ü Ÿ̸Ӹ  ʴ´)
+// ܰ ĭ Ʒ ܰ      ĭ Ʒ ܰ Ű.
+//  ʴ.  ʿ  ´.
+class TimerWheel
+{
+public:
+	TimerWheel()
+	{
+		for (auto& level : mSlots)
+		{
+			for (auto& slot : level)
+			{
+				slot.pPrev = &slot;
+				slot.pNext = &slot;
+			}
+		}
+	}
+
+	void Init(const UINT64 nowTick_) { mCurrentTick = nowTick_; }
+
+	UINT64 GetCurrentTick() const { return mCurrentTick; }
+
+	// ƽ ɸ  ƽ ȴ.    ִ ͺ  ƽ   ĭ Ǵ.
+	void Add(stTimerNode* pNode_, UINT64 expireTick_)
+	{
+		if (pNode_->IsScheduled())
+		{
+			Remove(pNode_);
+		}
+
+		if (expireTick_ <= mCurrentTick)
+		{
+			expireTick_ = mCurrentTick + 1;
+		}
+
+		if (expireTick_ - mCurrentTick >= MAX_DELTA_TICK)
+		{
+			expireTick_ = mCurrentTick + MAX_DELTA_TICK - 1;
+		}
+
+		Place(pNode_, expireTick_);
+	}
+
+	void Remove(stTimerNode* pNode_)
+	{
+		if (pNode_->IsScheduled() == false)
+		{
+			return;
+		}
+
+		pNode_->pPrev->pNext = pNode_->pNext;
+		pNode_->pNext->pPrev = pNode_->pPrev;
+		pNode_->pPrev = nullptr;
+		pNode_->pNext = nullptr;
+	}
+
+	//nowTick_  ƽ ϰ  Ÿ̸Ӹ onExpire_(stTimerNode*) ȣѴ.
+	//뺸   ٿ  ̹Ƿ  ȿ ٽ ɾ ȴ.
+	template <typename ExpireFunc>
+	void Advance(const UINT64 nowTick_, ExpireFunc&& onExpire_)
+	{
+		while (mCurrentTick < nowTick_)
+		{
+			++mCurrentTick;
+
+			//Ʒ ܰ谡     ܰ  ĭ  .
+			for (UINT32 level = 1; level < LEVEL_COUNT; ++level)
+			{
+				if ((mCurrentTick & (((UINT64)1 << (SLOT_BITS * level)) - 1)) != 0)
+				{
+					break;
+				}
+
+				Cascade(level, (mCurrentTick >> (SLOT_BITS * level)) & SLOT_MASK);
+			}
+
+			stTimerNode expired;
+			TakeSlot(&mSlots[0][mCurrentTick & SLOT_MASK], &expired);
+
+			while (expired.pNext != &expired)
+			{
+				auto pNode = expired.pNext;
+				Remove(pNode);
+				onExpire_(pNode);
+			}
+		}
+	}
+
+
+private:
+	static const UINT32 SLOT_BITS = 6;
+	static const UINT32 SLOT_COUNT = 1 << SLOT_BITS;
+	static const UINT64 SLOT_MASK = SLOT_COUNT - 1;
+	static const UINT32 LEVEL_COUNT = 4;
+	static const UINT64 MAX_DELTA_TICK = (UINT64)1 << (SLOT_BITS * LEVEL_COUNT);
+
+	static void LinkBack(stTimerNode* pHead_, stTimerNode* pNode_)
+	{
+		pNode_->pPrev = pHead_->pPrev;
+		pNode_->pNext = pHead_;
+		pHead_->pPrev->pNext = pNode_;
+		pHead_->pPrev = pNode_;
+	}
+
+	// ƽ  ´ ܰ ĭ ִ´.  ƽ 0̸  ƽ ĭ  ̹ Advance() ȴ.
+	void Place(stTimerNode* pNode_, const UINT64 expireTick_)
+	{
+		pNode_->ExpireTick = expireTick_;
+
+		auto delta = expireTick_ - mCurrentTick;
+		UINT32 level = 0;
+		while (delta >= ((UINT64)1 << (SLOT_BITS * (level + 1))))
+		{
+			++level;
+		}
+
+		auto slotIndex = (expireTick_ >> (SLOT_BITS * level)) & SLOT_MASK;
+		LinkBack(&mSlots[level][slotIndex], pNode_);
+	}
+
+	//ĭ 带  pOut_ Ʈ ű. pOut_   ʱȭȴ.
+	static void TakeSlot(stTimerNode* pSlot_, stTimerNode* pOut_)
+	{
+		if (pSlot_->pNext == pSlot_)
+		{
+			pOut_->pPrev = pOut_;
+			pOut_->pNext = pOut_;
+			return;
+		}
+
+		pOut_->pNext = pSlot_->pNext;
+		pOut_->pPrev = pSlot_->pPrev;
+		pOut_->pNext->pPrev = pOut_;
+		pOut_->pPrev->pNext = pOut_;
+
+		pSlot_->pPrev = pSlot_;
+		pSlot_->pNext = pSlot_;
+	}
+
+	void Cascade(const UINT32 level_, const UINT64 slotIndex_)
+	{
+		stTimerNode moving;
+		TakeSlot(&mSlots[level_][slotIndex_], &moving);
+
+		while (moving.pNext != &moving)
+		{
+			auto pNode = moving.pNext;
+			Remove(pNode);
+			Place(pNode, pNode->ExpireTick);
+		}
+	}
+
+
+	UINT64 mCurrentTick = 0;
+
+	//ĭ  带 δ    Ʈ
+	stTimerNode mSlots[LEVEL_COUNT][SLOT_COUNT];
+};
\ No newline at end of file
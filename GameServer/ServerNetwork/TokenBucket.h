@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Define.h"
+
+
+//ū Ŷ. ʴ ratePerSec_  ä burst_  δ.
+//ū 1/1000   ms  ð  길 Ѵ.  忡 .
+struct stTokenBucket
+{
+	static const UINT64 TOKEN_UNIT = 1000;
+
+	void Init(const UINT32 ratePerSec_, const UINT32 burst_, const UINT64 nowMs_)
+	{
+		RatePerSec = ratePerSec_;
+		Capacity = (UINT64)burst_ * TOKEN_UNIT;
+		Tokens = Capacity;
+		LastRefillMs = nowMs_;
+	}
+
+	//ū ϳ . ڶ  ʰ false
+	bool TryConsume(const UINT64 nowMs_)
+	{
+		if (nowMs_ > LastRefillMs)
+		{
+			// ms * ʴ  = 1/1000 ū  ä 
+			Tokens += (nowMs_ - LastRefillMs) * RatePerSec;
+			if (Tokens > Capacity)
+			{
+				Tokens = Capacity;
+			}
+			LastRefillMs = nowMs_;
+		}
+
+		if (Tokens < TOKEN_UNIT)
+		{
+			return false;
+		}
+
+		Tokens -= TOKEN_UNIT;
+		return true;
+	}
+
+	UINT32 RatePerSec = 0;
+	UINT64 Capacity = 0;
+	UINT64 Tokens = 0;
+	UINT64 LastRefillMs = 0;
+};
\ No newline at end of file
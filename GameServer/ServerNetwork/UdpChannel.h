@@ -0,0 +1,519 @@
+#pragma once
+
+#include "Define.h"
+#include <stdio.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <random>
+#include <memory>
+#include <chrono>
+#include <vector>
+#include <queue>
+#include <functional>
+#include <condition_variable>
+#include <unordered_map>
+
+
+const UINT32 UDP_MAX_DATAGRAM_SIZE = 512;	//   ִ UDP Ŷ ϳ ִ ũ
+const UINT32 UDP_RECV_TIMEOUT_MS = 100;		//  尡  û Ȯϴ 
+
+//UDP ּ. IPv4 ּҿ Ʈ ģ  Ű .
+struct stUdpEndpoint
+{
+	sockaddr_in Addr = {};
+
+	UINT64 GetKey() const
+	{
+		return ((UINT64)Addr.sin_addr.s_addr << 16) | (UINT64)ntohs(Addr.sin_port);
+	}
+};
+
+
+//TCP ǿ ̴ ŷ UDP ä.
+//αϸ Ǹ ū ߱ؼ TCP ˷ְ, Ŭ̾Ʈ  ū UDP   ּҸ ǿ ´.
+// ּҿ  Ŷ  ID Բ ѱ, ǿ    ּҷ .  ʾ  ʰ false ش.
+//Ҿ  Ŷ  ̵/ġ Ŷ̴.    ʴ´.
+class UdpChannel
+{
+public:
+	//ReceiveFunc( ID,  ּ, ũ, ) :  忡 ȣȴ.   ּҿ  Ŷ̸  ID 0̴.
+	//ʹ   ˻縦 ģ Ŷ ϳ.
+	std::function<void(UINT32, const stUdpEndpoint&, UINT32, char*)> ReceiveFunc;
+
+	bool Init(const UINT16 port_, const UINT32 maxSessionCount_)
+	{
+		mSessions.reset(new stUdpSession[maxSessionCount_]);
+		mMaxSessionCount = maxSessionCount_;
+
+		mSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+		if (mSocket == INVALID_SOCKET)
+		{
+			printf("[] UDP socket()Լ  : %d\n", GetLastSocketError());
+			return false;
+		}
+
+		// û Ȯ  ְ  ⿡ ð  д.
+#ifdef _WIN32
+		DWORD recvTimeout = UDP_RECV_TIMEOUT_MS;
+#else
+		timeval recvTimeout = { 0, (long)UDP_RECV_TIMEOUT_MS * 1000 };
+#endif
+		setsockopt(mSocket, SOL_SOCKET, SO_RCVTIMEO, (const char*)&recvTimeout, sizeof(recvTimeout));
+
+		sockaddr_in stServerAddr = {};
+		stServerAddr.sin_family = AF_INET;
+		stServerAddr.sin_port = htons(port_);
+		stServerAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+		if (bind(mSocket, (sockaddr*)&stServerAddr, sizeof(sockaddr_in)) != 0)
+		{
+			printf("[] UDP bind()Լ  : %d\n", GetLastSocketError());
+			closesocket(mSocket);
+			mSocket = INVALID_SOCKET;
+			return false;
+		}
+
+		mPort = port_;
+		printf("[UDP] port(%u)\n", mPort);
+		return true;
+	}
+
+	// ׽Ʈ ġũ ս/ 䳻. Start()  ȣѴ.
+	//dropPercent_ :  Ŷ  Ŷ  Ȯ(%) .
+	//delayMs_, jitterMs_ :  Ŷ  Ŷ delayMs_ + [0, jitterMs_] ŭ ʰ óѴ. 鸲   ٲ  ִ.
+	void SetNetworkSimulation(const UINT32 dropPercent_, const UINT32 delayMs_, const UINT32 jitterMs_)
+	{
+		mDropPercent = dropPercent_;
+		mDelayMs = delayMs_;
+		mJitterMs = jitterMs_;
+
+		if (mDropPercent > 0 || IsDelayEnabled())
+		{
+			printf("[UDP] Ʈũ 䳻 : drop(%u%%) delay(%ums) jitter(%ums)\n", mDropPercent, mDelayMs, mJitterMs);
+		}
+	}
+
+	bool IsEnabled() { return mSocket != INVALID_SOCKET; }
+
+	UINT16 GetPort() { return mPort; }
+
+	bool Start()
+	{
+		if (IsEnabled() == false)
+		{
+			return false;
+		}
+
+		mIsRun = true;
+		mRecvThread = std::thread([this]() { RecvThread(); });
+
+		if (IsDelayEnabled())
+		{
+			mDelayThread = std::thread([this]() { DelayThread(); });
+		}
+		return true;
+	}
+
+	void Stop()
+	{
+		{
+			std::lock_guard<std::mutex> guard(mDelayLock);
+			mIsRun = false;
+		}
+		mDelayCondition.notify_all();
+
+		if (mRecvThread.joinable())
+		{
+			mRecvThread.join();
+		}
+
+		if (mDelayThread.joinable())
+		{
+			mDelayThread.join();
+		}
+
+		if (IsEnabled())
+		{
+			closesocket(mSocket);
+			mSocket = INVALID_SOCKET;
+		}
+	}
+
+	//ǿ  ū ߱Ѵ.   ȣ ִ  ּҴ Ǯ.
+	//ū  16Ʈ  ȣ̰  . 0 ߱ ʴ´.
+	UINT64 IssueToken(const UINT32 sessionId_)
+	{
+		auto sessionIndex = GetSessionIndex(sessionId_);
+		if (IsEnabled() == false || sessionIndex >= mMaxSessionCount)
+		{
+			return 0;
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+
+		auto token = (mTokenRandom() & ~(UINT64)SESSION_INDEX_MASK) | sessionIndex;
+		if ((token & ~(UINT64)SESSION_INDEX_MASK) == 0)
+		{
+			token |= (UINT64)1 << SESSION_INDEX_BITS;
+		}
+
+		auto& session = mSessions[sessionIndex];
+		UnbindLocked(session);
+		session.SessionId = sessionId_;
+		session.Token = token;
+		return token;
+	}
+
+	//ū   ּҸ ǿ ´.  ū ٽ   ּҷ ٲ۴(Ŭ̾Ʈ NAT Ʈ ٲ ).
+	//ȯ :   ID. ū   0
+	UINT32 Bind(const UINT64 token_, const stUdpEndpoint& from_)
+	{
+		auto sessionIndex = (UINT32)(token_ & SESSION_INDEX_MASK);
+		if (token_ == 0 || sessionIndex >= mMaxSessionCount)
+		{
+			return 0;
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+
+		auto& session = mSessions[sessionIndex];
+		if (session.Token != token_)
+		{
+			return 0;
+		}
+
+		//ٸ   ̸ּ  ǿ .
+		auto key = from_.GetKey();
+		if (auto iter = mEndpointSessions.find(key); iter != mEndpointSessions.end() && iter->second != sessionIndex)
+		{
+			UnbindLocked(mSessions[iter->second]);
+		}
+
+		UnbindLocked(session);
+		session.Endpoint = from_;
+		session.IsBound = true;
+		mEndpointSessions[key] = sessionIndex;
+		return session.SessionId;
+	}
+
+	//  ū ּҸ  . ̹     ȣ̸ Ѵ.
+	void OnClose(const UINT32 sessionId_)
+	{
+		auto sessionIndex = GetSessionIndex(sessionId_);
+		if (IsEnabled() == false || sessionIndex >= mMaxSessionCount)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> guard(mLock);
+
+		auto& session = mSessions[sessionIndex];
+		if (session.SessionId != sessionId_)
+		{
+			return;
+		}
+
+		UnbindLocked(session);
+		session.SessionId = 0;
+		session.Token = 0;
+	}
+
+	//ǿ  ּҷ .  忡 ȣ  ִ.
+	//ȯ :  ּҰ  false. ȣ  TCP  ȴ. ս      ģ.
+	bool SendTo(const UINT32 sessionId_, const UINT32 dataSize_, char* pData_)
+	{
+		auto sessionIndex = GetSessionIndex(sessionId_);
+		if (IsEnabled() == false || sessionIndex >= mMaxSessionCount)
+		{
+			return false;
+		}
+
+		stUdpEndpoint endpoint;
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+
+			auto& session = mSessions[sessionIndex];
+			if (session.SessionId != sessionId_ || session.IsBound == false)
+			{
+				return false;
+			}
+
+			endpoint = session.Endpoint;
+		}
+
+		if (IsInjectedDrop())
+		{
+			mSendDropCount.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+
+		SendToEndpoint(endpoint, dataSize_, pData_);
+		return true;
+	}
+
+	//ǿ   ּҷ .  û 信 .
+	void SendToEndpoint(const stUdpEndpoint& to_, const UINT32 dataSize_, char* pData_)
+	{
+		if (IsDelayEnabled())
+		{
+			PushDelayed(true, to_, dataSize_, pData_);
+			return;
+		}
+
+		SendToEndpointNow(to_, dataSize_, pData_);
+	}
+
+	void Print()
+	{
+		if (mPort == 0)
+		{
+			return;
+		}
+
+		printf("[UDP] recv(%llu) sent(%llu) unbound(%llu) bad(%llu) injected drop in(%llu) out(%llu)\n",
+			mRecvCount.load(), mSendCount.load(), mUnboundCount.load(), mBadPacketCount.load(),
+			mRecvDropCount.load(), mSendDropCount.load());
+	}
+
+
+private:
+	struct stUdpSession
+	{
+		UINT32 SessionId = 0;
+		UINT64 Token = 0;
+		stUdpEndpoint Endpoint;
+		bool IsBound = false;
+	};
+
+	static int GetLastSocketError()
+	{
+#ifdef _WIN32
+		return WSAGetLastError();
+#else
+		return errno;
+#endif
+	}
+
+	static bool IsRecvTimeout(const int error_)
+	{
+#ifdef _WIN32
+		// Ŷ ICMP Ʈ  Ұ recvfrom() з ´.     ִ.
+		return error_ == WSAETIMEDOUT || error_ == WSAECONNRESET;
+#else
+		return error_ == EAGAIN || error_ == EWOULDBLOCK || error_ == EINTR;
+#endif
+	}
+
+	void SendToEndpointNow(const stUdpEndpoint& to_, const UINT32 dataSize_, char* pData_)
+	{
+		auto sendBytes = sendto(mSocket, pData_, (int)dataSize_, 0, (const sockaddr*)&to_.Addr, sizeof(sockaddr_in));
+		if (sendBytes < 0)
+		{
+			printf("[] UDP sendto()Լ  : %d\n", GetLastSocketError());
+			return;
+		}
+
+		mSendCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	//mLock  ¿ ȣѴ.
+	void UnbindLocked(stUdpSession& session_)
+	{
+		if (session_.IsBound == false)
+		{
+			return;
+		}
+
+		mEndpointSessions.erase(session_.Endpoint.GetKey());
+		session_.IsBound = false;
+	}
+
+	bool IsInjectedDrop()
+	{
+		if (mDropPercent == 0)
+		{
+			return false;
+		}
+
+		thread_local std::minstd_rand dropRandom(std::random_device{}());
+		return (dropRandom() % 100) < mDropPercent;
+	}
+
+	// Ŷ  ּҿ   ID Բ ѱ.
+	void Dispatch(const stUdpEndpoint& from_, const UINT32 size_, char* pData_)
+	{
+		UINT32 sessionId = 0;
+		{
+			std::lock_guard<std::mutex> guard(mLock);
+			if (auto iter = mEndpointSessions.find(from_.GetKey()); iter != mEndpointSessions.end())
+			{
+				sessionId = mSessions[iter->second].SessionId;
+			}
+		}
+
+		if (sessionId == 0)
+		{
+			mUnboundCount.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		mRecvCount.fetch_add(1, std::memory_order_relaxed);
+		ReceiveFunc(sessionId, from_, size_, pData_);
+	}
+
+	bool IsDelayEnabled() { return mDelayMs > 0 || mJitterMs > 0; }
+
+	void PushDelayed(const bool isSend_, const stUdpEndpoint& endpoint_, const UINT32 size_, char* pData_)
+	{
+		thread_local std::minstd_rand jitterRandom(std::random_device{}());
+
+		stDelayedDatagram datagram;
+		datagram.DueMs = GetNowMs() + mDelayMs + ((mJitterMs > 0) ? jitterRandom() % (mJitterMs + 1) : 0);
+		datagram.Order = mDelayOrder.fetch_add(1, std::memory_order_relaxed);
+		datagram.IsSend = isSend_;
+		datagram.Endpoint = endpoint_;
+		datagram.Data.assign(pData_, pData_ + size_);
+
+		{
+			std::lock_guard<std::mutex> guard(mDelayLock);
+			mDelayQueue.push(std::move(datagram));
+		}
+		mDelayCondition.notify_one();
+	}
+
+	// Ŷ ð Ǹ ų   ѱ.  䳻   Ŷ  忡 ѱ.
+	void DelayThread()
+	{
+		std::unique_lock<std::mutex> lock(mDelayLock);
+
+		while (mIsRun)
+		{
+			if (mDelayQueue.empty())
+			{
+				mDelayCondition.wait(lock);
+				continue;
+			}
+
+			auto nowMs = GetNowMs();
+			if (mDelayQueue.top().DueMs > nowMs)
+			{
+				mDelayCondition.wait_for(lock, std::chrono::milliseconds(mDelayQueue.top().DueMs - nowMs));
+				continue;
+			}
+
+			auto datagram = mDelayQueue.top();
+			mDelayQueue.pop();
+
+			lock.unlock();
+			if (datagram.IsSend)
+			{
+				SendToEndpointNow(datagram.Endpoint, (UINT32)datagram.Data.size(), datagram.Data.data());
+			}
+			else
+			{
+				Dispatch(datagram.Endpoint, (UINT32)datagram.Data.size(), datagram.Data.data());
+			}
+			lock.lock();
+		}
+	}
+
+	static UINT64 GetNowMs()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	void RecvThread()
+	{
+		char recvBuf[UDP_MAX_DATAGRAM_SIZE];
+
+		while (mIsRun)
+		{
+			stUdpEndpoint from;
+			socklen_t fromLen = sizeof(sockaddr_in);
+
+			auto recvBytes = recvfrom(mSocket, recvBuf, UDP_MAX_DATAGRAM_SIZE, 0, (sockaddr*)&from.Addr, &fromLen);
+			if (recvBytes < 0)
+			{
+				auto error = GetLastSocketError();
+				if (IsRecvTimeout(error) == false)
+				{
+					printf("[] UDP recvfrom()Լ  : %d\n", error);
+				}
+				continue;
+			}
+
+			if (IsInjectedDrop())
+			{
+				mRecvDropCount.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			//UDP Ŷ ϳ  Ŷ ϳ ´.  ̰  ũ ٸ .
+			//  2Ʈ ü ̴.
+			UINT16 packetLength = 0;
+			if (recvBytes >= (INT32)sizeof(packetLength))
+			{
+				CopyMemory(&packetLength, recvBuf, sizeof(packetLength));
+			}
+
+			if (packetLength != (UINT32)recvBytes)
+			{
+				mBadPacketCount.fetch_add(1, std::memory_order_relaxed);
+				continue;
+			}
+
+			if (IsDelayEnabled())
+			{
+				PushDelayed(false, from, (UINT32)recvBytes, recvBuf);
+				continue;
+			}
+
+			Dispatch(from, (UINT32)recvBytes, recvBuf);
+		}
+	}
+
+
+	SOCKET mSocket = INVALID_SOCKET;
+	UINT16 mPort = 0;
+
+	bool mIsRun = false;
+	std::thread mRecvThread;
+
+	//ս/ 䳻
+	struct stDelayedDatagram
+	{
+		UINT64 DueMs = 0;
+		UINT64 Order = 0;	//  ð̸  
+		bool IsSend = false;
+		stUdpEndpoint Endpoint;
+		std::vector<char> Data;
+
+		bool operator>(const stDelayedDatagram& other_) const
+		{
+			return (DueMs != other_.DueMs) ? DueMs > other_.DueMs : Order > other_.Order;
+		}
+	};
+
+	UINT32 mDropPercent = 0;
+	UINT32 mDelayMs = 0;
+	UINT32 mJitterMs = 0;
+	std::thread mDelayThread;
+	std::mutex mDelayLock;
+	std::condition_variable mDelayCondition;
+	std::priority_queue<stDelayedDatagram, std::vector<stDelayedDatagram>, std::greater<stDelayedDatagram>> mDelayQueue;
+	std::atomic<UINT64> mDelayOrder{ 0 };
+
+	// ȣ -> ū  ּ,  ּ ->  ȣ.   mLock Ų.
+	std::mutex mLock;
+	UINT32 mMaxSessionCount = 0;
+	std::unique_ptr<stUdpSession[]> mSessions;
+	std::unordered_map<UINT64, UINT32> mEndpointSessions;
+	std::mt19937_64 mTokenRandom{ std::random_device{}() };
+
+	std::atomic<UINT64> mRecvCount{ 0 };
+	std::atomic<UINT64> mSendCount{ 0 };
+	std::atomic<UINT64> mUnboundCount{ 0 };
+	std::atomic<UINT64> mBadPacketCount{ 0 };
+	std::atomic<UINT64> mRecvDropCount{ 0 };
+	std::atomic<UINT64> mSendDropCount{ 0 };
+};
\ No newline at end of file
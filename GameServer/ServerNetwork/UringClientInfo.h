@@ -0,0 +1,577 @@
+#pragma once
+
+#include "IoUring.h"
+#include "Define.h"
+#include "SendBufferPool.h"
+#include "RecvRingBuffer.h"
+#include "SendBackpressure.h"
+#include "PacketLatency.h"
+#include "AsyncLogger.h"
+#include <stdio.h>
+#include <mutex>
+#include <deque>
+#include <atomic>
+#include <sys/uio.h>
+
+
+//io_uring 鿣忡 Ŭ̾Ʈ   ü
+//  I/O  (mpRing) Ϸǰ,   Ŀ 尡 óѴ.
+class stUringClientInfo
+{
+public:
+	stUringClientInfo()
+	{
+		mSocket = INVALID_SOCKET;
+	}
+
+	//pSendSlot_ :    ۷ ϵ    ۽ (MAX_SOCK_SENDBUF ũ)
+	void Init(const UINT32 index, IoUring* pRing_, char* pSendSlot_, const UINT16 sendSlotIndex_, stIOStat* pIOStat_, stSendPoolStat* pSendPoolStat_, const bool isSendPoolEnabled_)
+	{
+		mSendPool.Init(pSendPoolStat_, isSendPoolEnabled_);
+		mIndex = index;
+		mSessionId = MakeSessionId(index, 0);
+		mpRing = pRing_;
+		mpSendSlot = pSendSlot_;
+		mSendSlotIndex = sendSlotIndex_;
+		mpIOStat = pIOStat_;
+		mSendLimit.Init(pIOStat_);
+	}
+
+	UINT32 GetIndex() { return mIndex; }
+
+	bool IsConnectd() { return mIsConnect == 1; }
+
+	SOCKET GetSock() { return mSocket; }
+
+	UINT32 GetSessionId() { return mSessionId.load(std::memory_order_acquire); }
+
+	IoUring* GetRing() { return mpRing; }
+
+	RecvRingBuffer* GetRecvRing() { return &mRecvRing; }
+
+	//Ŀ ۾ Ϸ ϳ ó  ȣѴ.
+	//ȯ :    ۾̾ true. ̶    Ͽ ش.
+	bool ReleaseIORef()
+	{
+		return mIORefCount.fetch_sub(1, std::memory_order_acq_rel) == 1;
+	}
+
+	UINT64 MakeUserData(const UringOperation operation_)
+	{
+		return (UINT64)this | (UINT64)operation_;
+	}
+
+
+	bool OnConnect(SOCKET socket_)
+	{
+		mSocket = socket_;
+
+		mRecvRing.MarkSessionStart();
+
+		//  ť    ڶ ִ.
+		mSendLimit.Reset();
+
+		// ü  1 . Close() ´.
+		mIORefCount.store(1, std::memory_order_relaxed);
+		mSessionId.store(GetNextSessionId(mSessionId.load(std::memory_order_relaxed)), std::memory_order_release);
+		mIsConnect = 1;
+
+		return SetSocketOption();
+	}
+
+	//Ӱ Բ  ù ͸   ٷ д´. recv ɱ  accept  Ŀ ȣѴ.
+	//ȯ :  Ʈ ,  Ͱ  0,  ų    á -1
+	INT32 RecvFirstData()
+	{
+		char* pSpans[2];
+		UINT32 spanSizes[2];
+		auto spanCount = mRecvRing.GetWriteSpans(pSpans, spanSizes);
+		if (spanCount == 0)
+		{
+			return -1;
+		}
+
+		iovec recvIovecs[2];
+		for (UINT32 i = 0; i < spanCount; ++i)
+		{
+			recvIovecs[i].iov_base = pSpans[i];
+			recvIovecs[i].iov_len = spanSizes[i];
+		}
+
+		msghdr recvMsg = {};
+		recvMsg.msg_iov = recvIovecs;
+		recvMsg.msg_iovlen = spanCount;
+
+		++mpIOStat->SyscallCount;
+		auto recvBytes = recvmsg(mSocket, &recvMsg, MSG_DONTWAIT);
+		if (recvBytes > 0)
+		{
+			++mpIOStat->RecvCount;
+			mRecvRing.CommitWrite((UINT32)recvBytes);
+			return (INT32)recvBytes;
+		}
+
+		if (recvBytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		{
+			return 0;
+		}
+
+		return -1;
+	}
+
+	//ٸ  Ŀ     ñ.  Ŀ BindRecv() ȣѴ.
+	bool PostConnect(IoUring* pFromRing_)
+	{
+		++mIORefCount;
+
+		auto targetRingFd = mpRing->GetFd();
+		auto userData = MakeUserData(UringOperation::CONNECT);
+
+		auto bRet = pFromRing_->Push([&](io_uring_sqe* pSqe) {
+			pSqe->opcode = IORING_OP_MSG_RING;
+			pSqe->fd = targetRingFd;
+			pSqe->addr = IORING_MSG_DATA;
+			pSqe->off = userData;
+			pSqe->flags = IOSQE_CQE_SKIP_SUCCESS;
+			pSqe->user_data = (UINT64)UringOperation::WAKEUP;
+		}, false);
+
+		//  Ƿ 0  ʴ´.
+		if (bRet == false)
+		{
+			--mIORefCount;
+		}
+
+		return bRet;
+	}
+
+	bool ConnectCompleted()
+	{
+		return ReleaseIORef();
+	}
+
+	//Ƽ recv Ǵ.  ۴ Ŀ provided buffer ring  .
+	//Ϸ 뺸 IORING_CQE_F_MORE  Ƽ  ̹Ƿ ٽ ɾ Ѵ.
+	bool BindRecv()
+	{
+		++mIORefCount;
+
+		auto socket = mSocket;
+		auto bufferGroup = mpRing->GetRecvBufferGroupId();
+		auto userData = MakeUserData(UringOperation::RECV);
+
+		auto bRet = mpRing->Push([&](io_uring_sqe* pSqe) {
+			pSqe->opcode = IORING_OP_RECV;
+			pSqe->fd = socket;
+			pSqe->ioprio = IORING_RECV_MULTISHOT;
+			pSqe->flags = IOSQE_BUFFER_SELECT;
+			pSqe->buf_group = bufferGroup;
+			pSqe->user_data = userData;
+		}, false);
+
+		//ȣ Ϸ  Ƿ 0  ʴ´.
+		if (bRet == false)
+		{
+			--mIORefCount;
+		}
+
+		return bRet;
+	}
+
+	//Ƽ   뺸 ó  ȣѴ. ȯ : ReleaseIORef() .
+	bool RecvCompleted()
+	{
+		return ReleaseIORef();
+	}
+
+	//ȯ : ɷִ ۾  ٷ  ൵ Ǹ true
+	bool Close(bool bIsForce = false)
+	{
+		struct linger stLinger = { 0, 0 };	// SO_DONTLINGER 
+
+		// bIsForce true̸ SO_LINGER, timeout = 0 Ͽ   Ų.  :  ս  
+		if (true == bIsForce)
+		{
+			stLinger.l_onoff = 1;
+		}
+
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (mIsConnect.exchange(0) != 1)
+		{
+			return false;
+		}
+
+		//ɷִ recv/send  з Ϸǵ  ۼ ߴ Ų.
+		shutdown(mSocket, SHUT_RDWR);
+
+		// ɼ Ѵ.
+		setsockopt(mSocket, SOL_SOCKET, SO_LINGER, (char*)&stLinger, sizeof(stLinger));
+
+		//   Ų.
+		closesocket(mSocket);
+		mSocket = INVALID_SOCKET;
+
+		//  ʹ . Ŀ     ʹ ۽ Ϸ 뺸  .
+		ReleaseWaitingSendData();
+
+		//۽ ߿    ʵ mSendLock ȿ ´.
+		return ReleaseIORef();
+	}
+
+	// 1 忡 ȣؾ Ѵ!
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pMsg_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		//۽ ؽƮ  ۴  Ǯ ѹ ޴´.
+		char* pSendBuf = nullptr;
+		auto sendData = mSendPool.Alloc(dataSize_, &pSendBuf);
+		sendData->pData = pSendBuf;
+		sendData->DataSize = dataSize_;
+		CopyMemory(pSendBuf, pMsg_, dataSize_);
+
+		return EnqueueSendData(sendData);
+	}
+
+	// ۴  ʰ  ť ִ´.  Ŷ  ۷   ѹ ȴ.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsSendable(sessionId_) == false)
+		{
+			return false;
+		}
+
+		auto sendData = mSendPool.AllocBroadcast(pBuffer_);
+		sendData->pData = pBuffer_->GetData();
+		sendData->DataSize = pBuffer_->GetDataSize();
+
+		return EnqueueSendData(sendData);
+	}
+
+	//ٸ 忡  ´. ۼ ߴܽŰ I/O 尡 ó Close() ȣѴ.
+	bool Disconnect(const UINT32 sessionId_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		if (IsConnectd() == false || sessionId_ != mSessionId.load(std::memory_order_relaxed))
+		{
+			return false;
+		}
+
+		shutdown(mSocket, SHUT_RDWR);
+		return true;
+	}
+
+	//۽ Ϸ 뺸.   Ŀ 忡 ȣȴ. ȯ : ReleaseIORef() .
+	bool SendCompleted(const INT32 result_)
+	{
+		ProcessSendCompletion(result_);
+
+		//  Ǵܿ ̹Ƿ ۽    ڿ ´.
+		return ReleaseIORef();
+	}
+
+
+private:
+	//mSendLock  ¿ ȣѴ. ų    ۽ .
+	bool IsSendable(const UINT32 sessionId_)
+	{
+		if (IsConnectd() == false)
+		{
+			return false;
+		}
+
+		if (sessionId_ != mSessionId.load(std::memory_order_relaxed))
+		{
+			++mpIOStat->StaleSendCount;
+			return false;
+		}
+
+		return true;
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	bool EnqueueSendData(stSendBuffer* sendData_)
+	{
+		sendData_->EnqueueNs = PacketLatencyMonitor::Instance().Stamp();
+
+		if (sendData_->SendClass == SEND_CLASS::REPLACEABLE && ReplaceQueuedSendData(sendData_))
+		{
+			return true;
+		}
+
+		switch (mSendLimit.Admit(sendData_->SendClass, sendData_->DataSize))
+		{
+		case SendBackpressure::RESULT::DROP:
+			mSendPool.Free(sendData_, sendData_->DataSize);
+			return true;
+
+		//۽ ť Ǯ ʴ´. ޱ⸦  Ŀ ó  ϰ Ѵ.
+		case SendBackpressure::RESULT::CLOSE:
+			printf("[] ۽ ť Ǯ ʾƼ   : Index(%d)\n", mIndex);
+			mSendPool.Free(sendData_, sendData_->DataSize);
+			shutdown(mSocket, SHUT_RDWR);
+			return false;
+
+		default:
+			break;
+		}
+
+		mSendDataqueue.push_back(sendData_);
+
+		//  Ͱ  ۽ Ϸ 뺸  ̾ .
+		if (mIsSending == false)
+		{
+			return SendIO(true);
+		}
+
+		return true;
+	}
+
+	void ProcessSendCompletion(const INT32 result_)
+	{
+		std::lock_guard<std::mutex> guard(mSendLock);
+
+		mIsSending = false;
+
+		if (IsConnectd() == false)
+		{
+			if (mIsSlotSending == false && mSendDataqueue.empty() == false)
+			{
+				ReleaseFrontSendData();
+			}
+			return;
+		}
+
+		//   ʿ ȴ.
+		if (result_ <= 0)
+		{
+			if (result_ < 0 && result_ != -EPIPE && result_ != -ECONNRESET)
+			{
+				printf("[] io_uring send  : %d\n", -result_);
+			}
+			return;
+		}
+
+		if (mIsSlotSending)
+		{
+			//Ϻθ     κ ̾ .
+			mSlotSentSize += (UINT32)result_;
+			if (mSlotSentSize < mSlotDataSize)
+			{
+				PushSend(true, mpSendSlot + mSlotSentSize, mSlotDataSize - mSlotSentSize, false);
+				return;
+			}
+
+			ALOG_TRACE("[۽ Ϸ] bytes : %d\n", mSlotDataSize);
+			mpIOStat->SendCount += mSlotPacketCount;
+
+			for (UINT32 i = 0; i < mSlotPacketCount; ++i)
+			{
+				auto offset = mSlotPacketOffsets[i];
+				PacketLatencyMonitor::Instance().AddSend(mpSendSlot + offset, mSlotDataSize - offset, mSlotEnqueueNs[i]);
+			}
+		}
+		else
+		{
+			auto sendData = mSendDataqueue.front();
+			sendData->SentSize += (UINT32)result_;
+
+			if (sendData->SentSize < sendData->DataSize)
+			{
+				PushSend(false, sendData->pData + sendData->SentSize, sendData->DataSize - sendData->SentSize, false);
+				return;
+			}
+
+			ALOG_TRACE("[۽ Ϸ] bytes : %d\n", sendData->DataSize);
+			++mpIOStat->SendCount;
+
+			PacketLatencyMonitor::Instance().AddSend(sendData->pData, sendData->DataSize, sendData->EnqueueNs);
+			ReleaseFrontSendData();
+		}
+
+		//Ŀ  SubmitAndWait() ȴ.
+		if (mSendDataqueue.empty() == false)
+		{
+			SendIO(false);
+		}
+	}
+
+	//mSendLock  ¿ ȣѴ.
+	//  Ŷ MAX_SEND_GATHER_COUNT, MAX_SOCK_SENDBUF Ʈ  ۿ Ƽ ѹ .
+	// ۺ ū Ŷ Ǯ ۿ ٷ .
+	bool SendIO(const bool bSubmitNow_)
+	{
+		auto sendData = mSendDataqueue.front();
+		if (sendData->DataSize > MAX_SOCK_SENDBUF)
+		{
+			mIsSlotSending = false;
+			return PushSend(false, sendData->pData + sendData->SentSize, sendData->DataSize - sendData->SentSize, bSubmitNow_);
+		}
+
+		// ۿ  Ŷ ٷ Ǯ ش.
+		mSlotDataSize = 0;
+		mSlotSentSize = 0;
+		mSlotPacketCount = 0;
+
+		while (mSendDataqueue.empty() == false && mSlotPacketCount < MAX_SEND_GATHER_COUNT)
+		{
+			sendData = mSendDataqueue.front();
+			if (mSlotDataSize + sendData->DataSize > MAX_SOCK_SENDBUF)
+			{
+				break;
+			}
+
+			CopyMemory(mpSendSlot + mSlotDataSize, sendData->pData, sendData->DataSize);
+			mSlotPacketOffsets[mSlotPacketCount] = mSlotDataSize;
+			mSlotEnqueueNs[mSlotPacketCount] = sendData->EnqueueNs;
+			mSlotDataSize += sendData->DataSize;
+			++mSlotPacketCount;
+
+			ReleaseFrontSendData();
+		}
+
+		mIsSlotSending = true;
+		return PushSend(true, mpSendSlot, mSlotDataSize, bSubmitNow_);
+	}
+
+	bool PushSend(const bool bUseFixedBuffer_, char* pData_, const UINT32 dataSize_, const bool bSubmitNow_)
+	{
+		auto socket = mSocket;
+		auto sendSlotIndex = mSendSlotIndex;
+		auto userData = MakeUserData(UringOperation::SEND);
+
+		mIsSending = true;
+		++mIORefCount;
+		++mpIOStat->SendCallCount;
+
+		auto bRet = mpRing->Push([&](io_uring_sqe* pSqe) {
+			//  ۽ Ͽ WRITE_FIXED . (SIGPIPE    ϵ )
+			pSqe->opcode = bUseFixedBuffer_ ? IORING_OP_WRITE_FIXED : IORING_OP_SEND;
+			pSqe->fd = socket;
+			pSqe->addr = (UINT64)pData_;
+			pSqe->len = dataSize_;
+			if (bUseFixedBuffer_)
+			{
+				pSqe->buf_index = sendSlotIndex;
+			}
+			else
+			{
+				pSqe->msg_flags = MSG_NOSIGNAL;
+			}
+			pSqe->user_data = userData;
+		}, bSubmitNow_);
+
+		if (bRet == false)
+		{
+			printf("[] io_uring send   : %d\n", errno);
+			//  ȣ Ϸ  Ƿ 0  ʴ´.
+			mIsSending = false;
+			--mIORefCount;
+		}
+
+		return bRet;
+	}
+
+	//mSendLock  ¿ ȣѴ. Ŀ Ǯ ۿ ٷ     ʹ ǵ帮 ʴ´.
+	//ȯ :  Ű Ŷ ãƼ ٲ true
+	bool ReplaceQueuedSendData(stSendBuffer* sendData_)
+	{
+		size_t startPos = (mIsSending && mIsSlotSending == false) ? 1 : 0;
+		for (auto i = startPos; i < mSendDataqueue.size(); ++i)
+		{
+			auto& queuedData = mSendDataqueue[i];
+			if (queuedData->SendClass != SEND_CLASS::REPLACEABLE || queuedData->ReplaceKey != sendData_->ReplaceKey)
+			{
+				continue;
+			}
+
+			mSendLimit.OnReplaced(queuedData->DataSize, sendData_->DataSize);
+			mSendPool.Free(queuedData, queuedData->DataSize);
+			queuedData = sendData_;
+			return true;
+		}
+
+		return false;
+	}
+
+	void ReleaseFrontSendData()
+	{
+		auto sendData = mSendDataqueue.front();
+		mSendLimit.OnRemoved(sendData->DataSize);
+		mSendPool.Free(sendData, sendData->DataSize);
+
+		mSendDataqueue.pop_front();
+	}
+
+	// ͸ . Ŀ Ǯ ۿ ٷ     ʹ .
+	void ReleaseWaitingSendData()
+	{
+		std::deque<stSendBuffer*> remainQueue;
+		if (mIsSending && mIsSlotSending == false)
+		{
+			remainQueue.push_back(mSendDataqueue.front());
+			mSendDataqueue.pop_front();
+		}
+
+		while (mSendDataqueue.empty() == false)
+		{
+			ReleaseFrontSendData();
+		}
+
+		mSendDataqueue.swap(remainQueue);
+	}
+
+	bool SetSocketOption()
+	{
+		int opt = 1;
+		if (SOCKET_ERROR == setsockopt(mSocket, IPPROTO_TCP, TCP_NODELAY, (const char*)&opt, sizeof(int)))
+		{
+			printf_s("[DEBUG] TCP_NODELAY error: %d\n", errno);
+			return false;
+		}
+
+		return true;
+	}
+
+
+	INT32 mIndex = 0;
+
+	IoUring* mpRing = nullptr;
+	stIOStat* mpIOStat = nullptr;
+
+	std::atomic<INT64> mIsConnect{ 0 };
+	std::atomic<UINT32> mSessionId{ 0 };	// +  ȣ.   밡 ٲ.
+
+	SOCKET			mSocket;			//Cliet Ǵ 
+
+	//  . provided buffer  ͸ Ű ,  尡 ⼭ ٷ Ŷ д´.
+	RecvRingBuffer	mRecvRing;
+
+	// 1 + Ŀο ɷִ recv/send/connect ۾ . 0 Ǹ    ִ.
+	std::atomic<INT32> mIORefCount{ 0 };
+
+	// ۷ ϵ ۽ 
+	char*			mpSendSlot = nullptr;
+	UINT16			mSendSlotIndex = 0;
+
+	std::mutex mSendLock;
+	bool mIsSending = false;
+	bool mIsSlotSending = false;		//true :  ۿ  Ŷ  
+	UINT32 mSlotDataSize = 0;
+	UINT32 mSlotSentSize = 0;
+	UINT32 mSlotPacketCount = 0;
+	UINT32 mSlotPacketOffsets[MAX_SEND_GATHER_COUNT] = {};	// ۿ  Ŷ ġ ۽ ť  ð. ۽  Ͽ
+	UINT64 mSlotEnqueueNs[MAX_SEND_GATHER_COUNT] = {};
+	std::deque<stSendBuffer*> mSendDataqueue;
+	SendBufferPool<stSendBuffer> mSendPool;
+	SendBackpressure mSendLimit;			//۽ ť  з  ó
+};
\ No newline at end of file
@@ -0,0 +1,574 @@
+#pragma once
+
+#include "UringClientInfo.h"
+#include "IoUring.h"
+#include "SessionPool.h"
+#include "ThreadAffinity.h"
+#include "ThreadStat.h"
+#include "Define.h"
+#include <signal.h>
+#include <thread>
+#include <vector>
+#include <memory>
+
+//IOCPServer  ̽   io_uring 
+//Ŀ 帶  ϳ ΰ,  (index % Ŀ ) °  I/O Ϸȴ.
+//0  Ƽ accept ɾιǷ  Accept 尡 ,
+// Ƽ recv + provided buffer ring, ۽ Ǻ (registered) ۸ Ѵ.
+class UringServer
+{
+public:
+	UringServer(void) {}
+
+	virtual ~UringServer(void) {}
+
+	static bool IsSupported()
+	{
+		return IoUring::IsSupported();
+	}
+
+	// ʱȭϴ Լ
+	bool Init(const UINT32 maxIOWorkerThreadCount_)
+	{
+		//  ۽ write ̹Ƿ  Ͽ   SIGPIPE  ʵ Ѵ.
+		signal(SIGPIPE, SIG_IGN);
+
+		// TCP  
+		mListenSocket = socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, IPPROTO_TCP);
+
+		if (INVALID_SOCKET == mListenSocket)
+		{
+			printf("[] socket()Լ  : %d\n", errno);
+			return false;
+		}
+
+		MaxIOWorkerThreadCount = (maxIOWorkerThreadCount_ > 0) ? maxIOWorkerThreadCount_ : 1;
+
+		printf(" ʱȭ  (io_uring)\n");
+		return true;
+	}
+
+	//ù Ϳ Բ  ޴´.  Ͽ TCP_DEFER_ACCEPT ɾ ù Ŷ(α) ؾ  Ϸǰ, ϷǸ ٷ д´.
+	//timeoutSec_  ƹ͵    Ŀ Ѱִ  ´. 0̸ . BindandListen()  ȣؾ Ѵ.
+	void SetAcceptDataTimeout(const UINT32 timeoutSec_) { mAcceptDataTimeoutSec = timeoutSec_; }
+
+	//false̸ ۽  Ǯ  ۽Ÿ new/delete Ѵ. Ǯ Ҵ    . StartServer()  ȣؾ Ѵ.
+	void SetSendPool(const bool isEnabled_) { mIsSendPoolEnabled = isEnabled_; }
+
+	//I/O Ŀ 带  CPU . Ŀ i cpus_[i % ] .   ʴ´. StartServer()  ȣؾ Ѵ.
+	void SetIOThreadCpus(const std::vector<UINT32>& cpus_) { mIOThreadCpus = cpus_; }
+
+	// ּ ϰ Ű  û ޱ   ϴ Լ
+	bool BindandListen(int bindPort_)
+	{
+		int opt = 1;
+		setsockopt(mListenSocket, SOL_SOCKET, SO_REUSEADDR, (const char*)&opt, sizeof(int));
+
+		if (mAcceptDataTimeoutSec > 0)
+		{
+			int deferSec = (int)mAcceptDataTimeoutSec;
+			if (SOCKET_ERROR == setsockopt(mListenSocket, IPPROTO_TCP, TCP_DEFER_ACCEPT, (const char*)&deferSec, sizeof(int)))
+			{
+				printf("[] TCP_DEFER_ACCEPT   : %d\n", errno);
+				return false;
+			}
+		}
+
+		sockaddr_in		stServerAddr = {};
+		stServerAddr.sin_family = AF_INET;
+		stServerAddr.sin_port = htons(bindPort_); // Ʈ Ѵ.
+		stServerAddr.sin_addr.s_addr = htonl(INADDR_ANY);
+
+		int nRet = bind(mListenSocket, (sockaddr*)&stServerAddr, sizeof(sockaddr_in));
+		if (0 != nRet)
+		{
+			printf("[] bind()Լ  : %d\n", errno);
+			return false;
+		}
+
+		nRet = listen(mListenSocket, SOMAXCONN);
+		if (0 != nRet)
+		{
+			printf("[] listen()Լ  : %d\n", errno);
+			return false;
+		}
+
+		//Ŀ 帶  ϳ .
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; ++i)
+		{
+			auto pRing = std::make_unique<IoUring>();
+			if (pRing->Init(URING_QUEUE_DEPTH, &mIOStat) == false)
+			{
+				return false;
+			}
+
+			if (pRing->SetupRecvBufferRing(URING_RECV_BUFFER_GROUP, URING_RECV_BUFFER_COUNT, MAX_SOCK_RECVBUF) == false)
+			{
+				return false;
+			}
+
+			mRings.push_back(std::move(pRing));
+		}
+
+		printf("  ..\n");
+		return true;
+	}
+
+	// û ϰ ޼ ޾Ƽ óϴ Լ
+	bool StartServer(const UINT32 maxClientCount_)
+	{
+		if (CreateClient(maxClientCount_) == false)
+		{
+			return false;
+		}
+
+		if (BindAccept() == false)
+		{
+			return false;
+		}
+
+		bool bRet = CreateWokerThread();
+		if (false == bRet) {
+			return false;
+		}
+
+		printf(" \n");
+		return true;
+	}
+
+	//Ǿִ 带 ıѴ.
+	void DestroyThread()
+	{
+		mIsWorkerRun = false;
+
+		//ɷִ Ƽ accept     ʵ  .
+		shutdown(mListenSocket, SHUT_RDWR);
+
+		//NOP ؼ ϷḦ ٸ ִ Ŀ .
+		for (auto& pRing : mRings)
+		{
+			pRing->Push([](io_uring_sqe* pSqe) {
+				pSqe->opcode = IORING_OP_NOP;
+				pSqe->user_data = (UINT64)UringOperation::WAKEUP;
+			}, true);
+		}
+
+		for (auto& th : mIOWorkerThreads)
+		{
+			if (th.joinable())
+			{
+				th.join();
+			}
+		}
+
+		closesocket(mListenSocket);
+
+		mIOStat.Print("io_uring");
+		mSendPoolStat.Print();
+	}
+
+	// ID Ű  ̹   ʴ´.
+	bool SendMsg(const UINT32 sessionId_, const UINT32 dataSize_, char* pData)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, dataSize_, pData);
+	}
+
+	//  ۸  ǿ   .   ۽ ť  ´.
+	bool SendMsg(const UINT32 sessionId_, stBroadcastBuffer* pBuffer_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		return pClient->SendMsg(sessionId_, pBuffer_);
+	}
+
+	// 尡 Ŷ    .  ų Ǿ nullptr
+	RecvRingBuffer* GetRecvRing(const UINT32 sessionId_)
+	{
+		auto pClient = GetClientInfo(GetSessionIndex(sessionId_));
+		//    ID ״ζ,  뺸 ڿ   뺸    ٽ   ִ.
+		if (pClient->GetSessionId() != sessionId_ || pClient->IsConnectd() == false)
+		{
+			return nullptr;
+		}
+
+		return pClient->GetRecvRing();
+	}
+
+	//ٸ 忡   ´. ̹    ID̸ false
+	bool Disconnect(const UINT32 sessionId_)
+	{
+		return GetClientInfo(GetSessionIndex(sessionId_))->Disconnect(sessionId_);
+	}
+
+	virtual void OnConnect(const UINT32 /*sessionId_*/) {}
+
+	virtual void OnClose(const UINT32 /*sessionId_*/) {}
+
+	// ʹ GetRecvRing(sessionId_)   ִ.
+	virtual void OnReceive(const UINT32 /*sessionId_*/, const UINT32 /*size_*/) {}
+
+private:
+	// ,   ڱ ǵ ۽ ۸  ۷ Ѵ.
+	bool CreateClient(const UINT32 maxClientCount_)
+	{
+		mSendSlots.resize((size_t)maxClientCount_ * MAX_SOCK_SENDBUF);
+
+		std::vector<std::vector<iovec>> ringIovecs(MaxIOWorkerThreadCount);
+
+		for (UINT32 i = 0; i < maxClientCount_; ++i)
+		{
+			auto ringIndex = i % MaxIOWorkerThreadCount;
+			auto pSendSlot = &mSendSlots[(size_t)i * MAX_SOCK_SENDBUF];
+
+			auto& iovecs = ringIovecs[ringIndex];
+			auto sendSlotIndex = (UINT16)iovecs.size();
+			iovecs.push_back({ pSendSlot, MAX_SOCK_SENDBUF });
+
+			auto client = new stUringClientInfo;
+			client->Init(i, mRings[ringIndex].get(), pSendSlot, sendSlotIndex, &mIOStat, &mSendPoolStat, mIsSendPoolEnabled);
+
+			mClientInfos.push_back(client);
+		}
+
+		mSessionPool.Init(maxClientCount_);
+
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; ++i)
+		{
+			if (ringIovecs[i].empty())
+			{
+				continue;
+			}
+
+			if (mRings[i]->RegisterBuffers(ringIovecs[i].data(), (UINT32)ringIovecs[i].size()) == false)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	// ϳ Ŀ  ϳ 
+	bool CreateWokerThread()
+	{
+		for (UINT32 i = 0; i < MaxIOWorkerThreadCount; i++)
+		{
+			auto pRing = mRings[i].get();
+			mIOWorkerThreads.emplace_back([this, pRing, i]() { WokerThread(pRing, i); });
+		}
+
+		printf("WokerThread ..\n");
+		return true;
+	}
+
+	//  Ͽ Ŀο ɸ ۾   Ǹ ִ.
+	stUringClientInfo* GetEmptyClientInfo()
+	{
+		UINT32 sessionIndex = 0;
+		if (mSessionPool.Pop(&sessionIndex) == false)
+		{
+			return nullptr;
+		}
+
+		return GetClientInfo(sessionIndex);
+	}
+
+	//   ۾ . ٸ  accept ٷ   Ƿ ķ  ǵ帮 ȵȴ.
+	void ReleaseSession(stUringClientInfo* pClientInfo_)
+	{
+		mSessionPool.Push(pClientInfo_->GetIndex());
+	}
+
+	stUringClientInfo* GetClientInfo(const UINT32 clientIndex_)
+	{
+		return mClientInfos[clientIndex_];
+	}
+
+	//0  Ƽ accept Ǵ. Ϸ 뺸 IORING_CQE_F_MORE  ٽ ɾ Ѵ.
+	bool BindAccept()
+	{
+		auto listenSocket = mListenSocket;
+
+		return mRings[0]->Push([&](io_uring_sqe* pSqe) {
+			pSqe->opcode = IORING_OP_ACCEPT;
+			pSqe->fd = listenSocket;
+			pSqe->ioprio = IORING_ACCEPT_MULTISHOT;
+			pSqe->accept_flags = SOCK_CLOEXEC;
+			pSqe->user_data = (UINT64)UringOperation::ACCEPT;
+		}, false);
+	}
+
+	//Ϸ 뺸 ޾ ׿ شϴ ó ϴ Լ
+	//Ϸ ó ߿  sqe  SubmitAndWait() ѹ ý ݷ ȴ.
+	// Ⱑ ѹ ý ̹Ƿ SubmitAndWait() ü  ð .
+	void WokerThread(IoUring* pRing_, const UINT32 threadIndex_)
+	{
+		PinCurrentThread(mIOThreadCpus, threadIndex_, "io");
+		auto pStat = ThreadStatMonitor::Instance().Register("io", threadIndex_);
+
+		while (mIsWorkerRun)
+		{
+			auto idleBeginNs = pStat->BeginIdle();
+			auto isSubmitted = pRing_->SubmitAndWait();
+			pStat->EndIdle(idleBeginNs);
+
+			if (isSubmitted == false)
+			{
+				break;
+			}
+
+			auto completionCount = pRing_->ForEachCompletion([this, pRing_](io_uring_cqe* pCqe) {
+				ProcessCompletion(pRing_, pCqe);
+			});
+			pStat->AddCompletion(completionCount);
+		}
+
+		ThreadStatMonitor::Instance().Unregister(pStat);
+	}
+
+	void ProcessCompletion(IoUring* pRing_, io_uring_cqe* pCqe_)
+	{
+		auto operation = (UringOperation)(pCqe_->user_data & URING_OPERATION_MASK);
+		auto pClientInfo = (stUringClientInfo*)(pCqe_->user_data & ~URING_OPERATION_MASK);
+
+		switch (operation)
+		{
+		//   ޼ ó..
+		case UringOperation::WAKEUP:
+			break;
+
+		case UringOperation::ACCEPT:
+			ProcessAccept(pCqe_);
+			break;
+
+		//accept  Ŀ Ѱ .    Ѵ.
+		case UringOperation::CONNECT:
+			if (pClientInfo->IsConnectd() && pClientInfo->BindRecv() == false)
+			{
+				CloseSocket(pClientInfo, true);
+			}
+
+			if (pClientInfo->ConnectCompleted())
+			{
+				ReleaseSession(pClientInfo);
+			}
+			break;
+
+		case UringOperation::RECV:
+			ProcessRecv(pRing_, pClientInfo, pCqe_);
+			break;
+
+		case UringOperation::SEND:
+			if (pClientInfo->SendCompleted(pCqe_->res))
+			{
+				ReleaseSession(pClientInfo);
+			}
+			break;
+		}
+	}
+
+	void ProcessRecv(IoUring* pRing_, stUringClientInfo* pClientInfo_, io_uring_cqe* pCqe_)
+	{
+		bool bIsFinal = (pCqe_->flags & IORING_CQE_F_MORE) == 0;
+
+		if (pCqe_->res > 0)
+		{
+			auto bufferId = (UINT16)(pCqe_->flags >> IORING_CQE_BUFFER_SHIFT);
+
+			if (pClientInfo_->IsConnectd())
+			{
+				++mIOStat.RecvCount;
+
+				//Ŀ   ۴  ٷ  ϹǷ    Ű ´.
+				if (pClientInfo_->GetRecvRing()->Write(pRing_->GetRecvBuffer(bufferId), (UINT32)pCqe_->res))
+				{
+					OnReceive(pClientInfo_->GetSessionId(), (UINT32)pCqe_->res);
+				}
+				else
+				{
+					printf("[]   ۰   : Index(%d)\n", pClientInfo_->GetIndex());
+					CloseSocket(pClientInfo_);
+				}
+			}
+
+			pRing_->RecycleRecvBuffer(bufferId);
+		}
+
+		if (bIsFinal == false)
+		{
+			return;
+		}
+
+		//Ͱ ְų  ۰  ڶ  Ƽ recv ٽ Ǵ.
+		bool bIsRebound = false;
+		if (pClientInfo_->IsConnectd() && (pCqe_->res > 0 || pCqe_->res == -ENOBUFS))
+		{
+			bIsRebound = pClientInfo_->BindRecv();
+		}
+
+		//client   ..
+		if (bIsRebound == false)
+		{
+			CloseSocket(pClientInfo_); //Caller WokerThread()
+		}
+
+		// recv       ´.
+		if (pClientInfo_->RecvCompleted())
+		{
+			ReleaseSession(pClientInfo_);
+		}
+	}
+
+	void ProcessAccept(io_uring_cqe* pCqe_)
+	{
+		if (pCqe_->res >= 0)
+		{
+			auto clientSocket = (SOCKET)pCqe_->res;
+			auto pClientInfo = GetEmptyClientInfo();
+			if (pClientInfo == nullptr)
+			{
+				printf("[] Client Full\n");
+				closesocket(clientSocket);
+			}
+			else
+			{
+				AcceptCompletion(pClientInfo, clientSocket);
+			}
+		}
+		else if (mIsWorkerRun)
+		{
+			printf("[] io_uring accept  : %d\n", -pCqe_->res);
+		}
+
+		if ((pCqe_->flags & IORING_CQE_F_MORE) == 0 && mIsWorkerRun)
+		{
+			BindAccept();
+		}
+	}
+
+	//TCP_DEFER_ACCEPT   ù Ͱ ̹  Ƿ  ɱ  ٷ д´.
+	//  Ѿ   ð  ƹ͵   ̴. ȯ :  ϸ false
+	bool ReceiveFirstData(stUringClientInfo* pClientInfo_)
+	{
+		auto recvBytes = pClientInfo_->RecvFirstData();
+		if (recvBytes == 0)
+		{
+			printf("[˸] ù   ð ʰ : Index(%d)\n", pClientInfo_->GetIndex());
+		}
+
+		if (recvBytes <= 0)
+		{
+			return false;
+		}
+
+		OnReceive(pClientInfo_->GetSessionId(), (UINT32)recvBytes);
+		return true;
+	}
+
+	void AcceptCompletion(stUringClientInfo* pClientInfo_, SOCKET clientSocket_)
+	{
+		printf_s("AcceptCompletion : SessionIndex(%d)\n", pClientInfo_->GetIndex());
+
+		if (pClientInfo_->OnConnect(clientSocket_) == false)
+		{
+			CloseSocket(pClientInfo_, true);
+			return;
+		}
+
+		sockaddr_in		stClientAddr = {};
+		socklen_t nAddrLen = sizeof(sockaddr_in);
+		getpeername(clientSocket_, (sockaddr*)&stClientAddr, &nAddrLen);
+
+		char clientIP[32] = { 0, };
+		inet_ntop(AF_INET, &(stClientAddr.sin_addr), clientIP, 32 - 1);
+		printf("Ŭ̾Ʈ  : IP(%s) SOCKET(%d)\n", clientIP, (int)clientSocket_);
+
+		//Ŭ̾Ʈ  
+		++mClientCnt;
+
+		// 뺸  ͺ  óǵ recv ɱ  ȣѴ.
+		OnConnect(pClientInfo_->GetSessionId());
+
+		if (mAcceptDataTimeoutSec > 0 && ReceiveFirstData(pClientInfo_) == false)
+		{
+			CloseSocket(pClientInfo_, true);
+			return;
+		}
+
+		bool bRet = false;
+		if (pClientInfo_->GetRing() == mRings[0].get())
+		{
+			bRet = pClientInfo_->BindRecv();
+		}
+		else
+		{
+			bRet = pClientInfo_->PostConnect(mRings[0].get());
+		}
+
+		if (bRet == false)
+		{
+			CloseSocket(pClientInfo_, true);
+		}
+	}
+
+	//   Ų.
+	void CloseSocket(stUringClientInfo* clientInfo_, bool isForce_ = false)
+	{
+		if (clientInfo_->IsConnectd() == false)
+		{
+			return;
+		}
+
+		auto sessionId = clientInfo_->GetSessionId();
+
+		auto isReleasable = clientInfo_->Close(isForce_);
+
+		OnClose(sessionId);
+
+		//Ŀο ɸ ۾   Ϸ 뺸  ش.
+		if (isReleasable)
+		{
+			ReleaseSession(clientInfo_);
+		}
+	}
+
+
+
+	UINT32 MaxIOWorkerThreadCount = 0;
+	std::vector<UINT32> mIOThreadCpus;
+
+	//Ŭ̾Ʈ   ü
+	std::vector<stUringClientInfo*> mClientInfos;
+
+	//  
+	SessionPool	mSessionPool;
+
+	//Ǻ ۽  
+	std::vector<char> mSendSlots;
+
+	//Ŭ̾Ʈ  ޱ  
+	SOCKET		mListenSocket = INVALID_SOCKET;
+
+	//0 ũ ù Ϳ Բ  ޴´.
+	UINT32		mAcceptDataTimeoutSec = 0;
+
+	//false̸ ۽  Ǯ  ʴ´.
+	bool		mIsSendPoolEnabled = true;
+
+	// Ǿִ Ŭ̾Ʈ 
+	int			mClientCnt = 0;
+
+	//IO Worker 
+	std::vector<std::thread> mIOWorkerThreads;
+
+	//Ŀ 庰 io_uring
+	std::vector<std::unique_ptr<IoUring>> mRings;
+
+	stIOStat	mIOStat;
+
+	//۽  Ǯ 
+	stSendPoolStat	mSendPoolStat;
+
+	//۾   ÷
+	bool		mIsWorkerRun = true;
+};
\ No newline at end of file
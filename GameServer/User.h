@@ -2,11 +2,11 @@
 
 #include "Actor.h"
 #include "Inventory.h"
+#include "ServerNetwork/RecvRingBuffer.h"
+#include <atomic>
 
 class User: public Actor
 {
-	const UINT32 PACKET_DATA_BUFFER_SIZE = 8096;
-
 public:
 
 	User() = default;
@@ -15,7 +15,7 @@ public:
 	void Init(const INT32 index)
 	{
 		Actor::Init(index);
-		mPakcetDataBuffer = new char[PACKET_DATA_BUFFER_SIZE];
+		mWrapPacketBuffer = new char[RECV_RING_BUFFER_SIZE];
 		mInventory.Init(); // κ丮 ʱȭ
 	}
 
@@ -23,54 +23,38 @@ public:
 	{
 		Actor::Clear();
 		mIsConfirm = false;
-
-		mPakcetDataBufferWPos = 0;
-		mPakcetDataBufferRPos = 0;
+		mRttMs = 0;
 
 		mQuestState = QUEST_STATE::NOT_ACCEPTED;
 	}
 
+	//     Ʈũ   ID.  0
+	// Ʈ 嵵 ۽  Ƿ atomic д.
+	UINT32 GetSessionId() const { return mSessionId.load(std::memory_order_acquire); }
+	void SetSessionId(const UINT32 sessionId_) { mSessionId.store(sessionId_, std::memory_order_release); }
+
+	// ƮƮ  RTT(ms).    ʾ 0
+	UINT32 GetRttMs() const { return mRttMs; }
+	void SetRttMs(const UINT32 rttMs_) { mRttMs = rttMs_; }
+
 	QUEST_STATE GetQuestState() const { return mQuestState; }
 	void SetQuestState(QUEST_STATE s) { mQuestState = s; }
 		
-	//TODO SetPacketData, GetPacket Լ Ƽ忡 ȣϰ ִٸ  lock ɾ Ѵ
-	void SetPacketData(const UINT32 dataSize_, char* pData_)
+	//   ϼ Ŷ ϳ .  忡 ȣѴ.
+	//  ġ  Ŷ     Ű, ģ Ŷ mWrapPacketBuffer .
+	//ó  ReleasePacket()    Ѵ.
+	PacketInfo GetPacket(RecvRingBuffer* pRecvRing_)
 	{
-		if ((mPakcetDataBufferWPos + dataSize_) >= PACKET_DATA_BUFFER_SIZE)
-		{
-			auto remainDataSize = mPakcetDataBufferWPos - mPakcetDataBufferRPos;
-
-			if (remainDataSize > 0)
-			{
-				CopyMemory(&mPakcetDataBuffer[0], &mPakcetDataBuffer[mPakcetDataBufferRPos], remainDataSize);
-				mPakcetDataBufferWPos = remainDataSize;
-			}
-			else
-			{
-				mPakcetDataBufferWPos = 0;
-			}
-			
-			mPakcetDataBufferRPos = 0;
-		}
-
-		CopyMemory(&mPakcetDataBuffer[mPakcetDataBufferWPos], pData_, dataSize_);
-		mPakcetDataBufferWPos += dataSize_;
-	}
-
-	PacketInfo GetPacket()
-	{
-		const int PACKET_SIZE_LENGTH = 2;
-		const int PACKET_TYPE_LENGTH = 2;
-		short packetSize = 0;
-		
-		UINT32 remainByte = mPakcetDataBufferWPos - mPakcetDataBufferRPos;
+		UINT32 remainByte = pRecvRing_->GetReadableSize();
 
 		if(remainByte < PACKET_HEADER_LENGTH)
 		{
 			return PacketInfo();
 		}
 
-		auto pHeader = (PACKET_HEADER*)&mPakcetDataBuffer[mPakcetDataBufferRPos];
+		char headerData[PACKET_HEADER_LENGTH];
+		pRecvRing_->Peek(headerData, PACKET_HEADER_LENGTH);
+		auto pHeader = (PACKET_HEADER*)headerData;
 		
 		if (pHeader->PacketLength > remainByte)
 		{
@@ -80,13 +64,22 @@ public:
 		PacketInfo packetInfo;
 		packetInfo.PacketId = pHeader->PacketId;
 		packetInfo.DataSize = pHeader->PacketLength;
-		packetInfo.pDataPtr = &mPakcetDataBuffer[mPakcetDataBufferRPos];
-		
-		mPakcetDataBufferRPos += pHeader->PacketLength;
+		packetInfo.pDataPtr = pRecvRing_->GetContiguousData(pHeader->PacketLength);
+
+		if (packetInfo.pDataPtr == nullptr)
+		{
+			pRecvRing_->Peek(mWrapPacketBuffer, pHeader->PacketLength);
+			packetInfo.pDataPtr = mWrapPacketBuffer;
+		}
 
 		return packetInfo;
 	}
 
+	void ReleasePacket(RecvRingBuffer* pRecvRing_, const PacketInfo& packet_)
+	{
+		pRecvRing_->CommitRead(packet_.DataSize);
+	}
+
 	Inventory& GetInventory() { return mInventory; }
 
 private:
@@ -94,9 +87,10 @@ private:
 	std::string mAuthToken;
 	
 
-	UINT32 mPakcetDataBufferWPos = 0;
-	UINT32 mPakcetDataBufferRPos = 0;
-	char* mPakcetDataBuffer = nullptr;
+	std::atomic<UINT32> mSessionId{ 0 };
+	UINT32 mRttMs = 0;
+
+	char* mWrapPacketBuffer = nullptr;	//   ģ Ŷ  
 	QUEST_STATE mQuestState = QUEST_STATE::NOT_ACCEPTED;
 	
 	Inventory mInventory;
@@ -1,24 +1,56 @@
 #include "GameServer.h"
+#include "ServerConfig.h"
 #include <string>
 #include <iostream>
 
-const UINT16 SERVER_PORT = 11021;
-const UINT16 MAX_CLIENT = 3;		// Ҽ ִ Ŭ̾Ʈ 
-const UINT32 MAX_IO_WORKER_THREAD = 4;  // Ǯ   
-
-int main()
+int main(int argc, char* argv[])
 {
+	//--config=   ϰ  ڷ Ʈ,  ,   CPU  Ѵ. ̸ ServerConfig.h 
+	ServerConfig config;
+	if (config.Load(argc, argv) == false)
+	{
+		return 1;
+	}
+	config.Print();
+
+	//I/O, ,   α״  尡 Ƽ .
+	AsyncLogger::SetLevel(config.LogLevel);
+	AsyncLogger::Instance().Start(config.LogFile);
+
 	GameServer server;
 
+	//accept_data  Ѹ ù Ŷ(α) Բ  ޴´.
+	if (config.IsAcceptData)
+	{
+		server.SetAcceptDataTimeout(DEFAULT_ACCEPT_DATA_TIMEOUT_SEC);
+	}
+
+#ifndef _WIN32
+	//io_uring  Ѹ epoll  io_uring 鿣带 Ѵ.
+	if (config.IsIoUring)
+	{
+		server.SetIOMode(LinuxIOMode::IO_URING);
+	}
+#endif
+
+	//send_pool   ۽Ÿ ۸ new/delete Ѵ. Ǯ   .
+	server.SetSendPool(config.IsSendPool);
+
+	//heartbeat_timeout 0̸ ƮƮ .
+	server.SetHeartbeat(config.HeartbeatPingSec, config.HeartbeatTimeoutSec);
+
+	server.SetIOThreadCpus(config.IOCpus);
+
 	// ʱȭ
-	server.Init(MAX_IO_WORKER_THREAD);
+	server.Init(config.IOThreadCount);
 
 	//ϰ  ּҸ ϰ  Ų.
-	server.BindandListen(SERVER_PORT);
+	server.BindandListen(config.Port);
 
-	server.Run(MAX_CLIENT);
+	server.Run(config);
 
 	printf("ƹ Ű   մϴ\n");
+	printf("latency : Ŷ   , latency reset :  ʱȭ, log ܰ : α ܰ (trace ~ off), quit : \n");
 	while (true)
 	{
 		std::string inputCmd;
@@ -28,9 +60,31 @@ int main()
 		{
 			break;
 		}
+		else if (inputCmd == "latency")
+		{
+			PacketLatencyMonitor::Instance().Print(stdout);
+		}
+		else if (inputCmd == "latency reset")
+		{
+			PacketLatencyMonitor::Instance().Reset();
+		}
+		else if (inputCmd.rfind("log ", 0) == 0)
+		{
+			LOG_LEVEL level;
+			if (AsyncLogger::ParseLevel(inputCmd.substr(4), &level))
+			{
+				AsyncLogger::SetLevel(level);
+				printf("[α] ܰ : %s\n", LOG_LEVEL_NAMES[(UINT8)level]);
+			}
+			else
+			{
+				printf("[]    α ܰ : %s\n", inputCmd.substr(4).c_str());
+			}
+		}
 	}
 
 	server.End();
+	AsyncLogger::Instance().Stop();
 	return 0;
 }
 